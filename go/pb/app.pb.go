@@ -5,7 +5,7 @@
 // Code generated by protoc-gen-go. DO NOT EDIT.
 // versions:
 // 	protoc-gen-go v1.27.1
-// 	protoc        v3.15.6
+// 	protoc        v3.21.12
 // source: heyp/proto/app.proto
 
 package pb
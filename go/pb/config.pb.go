@@ -5,7 +5,7 @@
 // Code generated by protoc-gen-go. DO NOT EDIT.
 // versions:
 // 	protoc-gen-go v1.27.1
-// 	protoc        v3.15.6
+// 	protoc        v3.21.12
 // source: heyp/proto/config.proto
 
 package pb
@@ -24,6 +24,72 @@ const (
 	_ = protoimpl.EnforceVersion(protoimpl.MaxVersion - 20)
 )
 
+type DemandPredictorType int32
+
+const (
+	// DP_BWE predicts the max usage over time_window.
+	DemandPredictorType_DP_BWE DemandPredictorType = 0
+	// DP_DECAYED_PEAK predicts a peak usage that halves every time_window.
+	DemandPredictorType_DP_DECAYED_PEAK DemandPredictorType = 1
+	// DP_QUANTILE predicts the given quantile of usage over the last 1-2 time_windows.
+	DemandPredictorType_DP_QUANTILE DemandPredictorType = 2
+	// DP_HOLT forecasts usage time_window ahead using Holt's linear trend method.
+	DemandPredictorType_DP_HOLT DemandPredictorType = 3
+)
+
+// Enum value maps for DemandPredictorType.
+var (
+	DemandPredictorType_name = map[int32]string{
+		0: "DP_BWE",
+		1: "DP_DECAYED_PEAK",
+		2: "DP_QUANTILE",
+		3: "DP_HOLT",
+	}
+	DemandPredictorType_value = map[string]int32{
+		"DP_BWE":          0,
+		"DP_DECAYED_PEAK": 1,
+		"DP_QUANTILE":     2,
+		"DP_HOLT":         3,
+	}
+)
+
+func (x DemandPredictorType) Enum() *DemandPredictorType {
+	p := new(DemandPredictorType)
+	*p = x
+	return p
+}
+
+func (x DemandPredictorType) String() string {
+	return protoimpl.X.EnumStringOf(x.Descriptor(), protoreflect.EnumNumber(x))
+}
+
+func (DemandPredictorType) Descriptor() protoreflect.EnumDescriptor {
+	return file_heyp_proto_config_proto_enumTypes[0].Descriptor()
+}
+
+func (DemandPredictorType) Type() protoreflect.EnumType {
+	return &file_heyp_proto_config_proto_enumTypes[0]
+}
+
+func (x DemandPredictorType) Number() protoreflect.EnumNumber {
+	return protoreflect.EnumNumber(x)
+}
+
+// Deprecated: Do not use.
+func (x *DemandPredictorType) UnmarshalJSON(b []byte) error {
+	num, err := protoimpl.X.UnmarshalJSONEnum(x.Descriptor(), b)
+	if err != nil {
+		return err
+	}
+	*x = DemandPredictorType(num)
+	return nil
+}
+
+// Deprecated: Use DemandPredictorType.Descriptor instead.
+func (DemandPredictorType) EnumDescriptor() ([]byte, []int) {
+	return file_heyp_proto_config_proto_rawDescGZIP(), []int{0}
+}
+
 type NetemDelayDist int32
 
 const (
@@ -63,11 +129,11 @@ func (x NetemDelayDist) String() string {
 }
 
 func (NetemDelayDist) Descriptor() protoreflect.EnumDescriptor {
-	return file_heyp_proto_config_proto_enumTypes[0].Descriptor()
+	return file_heyp_proto_config_proto_enumTypes[1].Descriptor()
 }
 
 func (NetemDelayDist) Type() protoreflect.EnumType {
-	return &file_heyp_proto_config_proto_enumTypes[0]
+	return &file_heyp_proto_config_proto_enumTypes[1]
 }
 
 func (x NetemDelayDist) Number() protoreflect.EnumNumber {
@@ -86,7 +152,7 @@ func (x *NetemDelayDist) UnmarshalJSON(b []byte) error {
 
 // Deprecated: Use NetemDelayDist.Descriptor instead.
 func (NetemDelayDist) EnumDescriptor() ([]byte, []int) {
-	return file_heyp_proto_config_proto_rawDescGZIP(), []int{0}
+	return file_heyp_proto_config_proto_rawDescGZIP(), []int{1}
 }
 
 type ClusterAllocatorType int32
@@ -128,11 +194,11 @@ func (x ClusterAllocatorType) String() string {
 }
 
 func (ClusterAllocatorType) Descriptor() protoreflect.EnumDescriptor {
-	return file_heyp_proto_config_proto_enumTypes[1].Descriptor()
+	return file_heyp_proto_config_proto_enumTypes[2].Descriptor()
 }
 
 func (ClusterAllocatorType) Type() protoreflect.EnumType {
-	return &file_heyp_proto_config_proto_enumTypes[1]
+	return &file_heyp_proto_config_proto_enumTypes[2]
 }
 
 func (x ClusterAllocatorType) Number() protoreflect.EnumNumber {
@@ -151,7 +217,7 @@ func (x *ClusterAllocatorType) UnmarshalJSON(b []byte) error {
 
 // Deprecated: Use ClusterAllocatorType.Descriptor instead.
 func (ClusterAllocatorType) EnumDescriptor() ([]byte, []int) {
-	return file_heyp_proto_config_proto_rawDescGZIP(), []int{1}
+	return file_heyp_proto_config_proto_rawDescGZIP(), []int{2}
 }
 
 type DowngradeSelectorType int32
@@ -193,11 +259,11 @@ func (x DowngradeSelectorType) String() string {
 }
 
 func (DowngradeSelectorType) Descriptor() protoreflect.EnumDescriptor {
-	return file_heyp_proto_config_proto_enumTypes[2].Descriptor()
+	return file_heyp_proto_config_proto_enumTypes[3].Descriptor()
 }
 
 func (DowngradeSelectorType) Type() protoreflect.EnumType {
-	return &file_heyp_proto_config_proto_enumTypes[2]
+	return &file_heyp_proto_config_proto_enumTypes[3]
 }
 
 func (x DowngradeSelectorType) Number() protoreflect.EnumNumber {
@@ -216,7 +282,7 @@ func (x *DowngradeSelectorType) UnmarshalJSON(b []byte) error {
 
 // Deprecated: Use DowngradeSelectorType.Descriptor instead.
 func (DowngradeSelectorType) EnumDescriptor() ([]byte, []int) {
-	return file_heyp_proto_config_proto_rawDescGZIP(), []int{2}
+	return file_heyp_proto_config_proto_rawDescGZIP(), []int{3}
 }
 
 type HipriThrottleConditions int32
@@ -255,11 +321,11 @@ func (x HipriThrottleConditions) String() string {
 }
 
 func (HipriThrottleConditions) Descriptor() protoreflect.EnumDescriptor {
-	return file_heyp_proto_config_proto_enumTypes[3].Descriptor()
+	return file_heyp_proto_config_proto_enumTypes[4].Descriptor()
 }
 
 func (HipriThrottleConditions) Type() protoreflect.EnumType {
-	return &file_heyp_proto_config_proto_enumTypes[3]
+	return &file_heyp_proto_config_proto_enumTypes[4]
 }
 
 func (x HipriThrottleConditions) Number() protoreflect.EnumNumber {
@@ -278,7 +344,7 @@ func (x *HipriThrottleConditions) UnmarshalJSON(b []byte) error {
 
 // Deprecated: Use HipriThrottleConditions.Descriptor instead.
 func (HipriThrottleConditions) EnumDescriptor() ([]byte, []int) {
-	return file_heyp_proto_config_proto_rawDescGZIP(), []int{3}
+	return file_heyp_proto_config_proto_rawDescGZIP(), []int{4}
 }
 
 type ClusterControllerType int32
@@ -316,11 +382,11 @@ func (x ClusterControllerType) String() string {
 }
 
 func (ClusterControllerType) Descriptor() protoreflect.EnumDescriptor {
-	return file_heyp_proto_config_proto_enumTypes[4].Descriptor()
+	return file_heyp_proto_config_proto_enumTypes[5].Descriptor()
 }
 
 func (ClusterControllerType) Type() protoreflect.EnumType {
-	return &file_heyp_proto_config_proto_enumTypes[4]
+	return &file_heyp_proto_config_proto_enumTypes[5]
 }
 
 func (x ClusterControllerType) Number() protoreflect.EnumNumber {
@@ -339,7 +405,7 @@ func (x *ClusterControllerType) UnmarshalJSON(b []byte) error {
 
 // Deprecated: Use ClusterControllerType.Descriptor instead.
 func (ClusterControllerType) EnumDescriptor() ([]byte, []int) {
-	return file_heyp_proto_config_proto_rawDescGZIP(), []int{4}
+	return file_heyp_proto_config_proto_rawDescGZIP(), []int{5}
 }
 
 type DemandPredictorConfig struct {
@@ -347,9 +413,12 @@ type DemandPredictorConfig struct {
 	sizeCache     protoimpl.SizeCache
 	unknownFields protoimpl.UnknownFields
 
-	TimeWindowDur   *string  `protobuf:"bytes,1,opt,name=time_window_dur,json=timeWindowDur,def=10s" json:"time_window_dur,omitempty"`
-	UsageMultiplier *float64 `protobuf:"fixed64,2,opt,name=usage_multiplier,json=usageMultiplier,def=1.1" json:"usage_multiplier,omitempty"`
-	MinDemandBps    *int64   `protobuf:"varint,3,opt,name=min_demand_bps,json=minDemandBps,def=5242880" json:"min_demand_bps,omitempty"`
+	TimeWindowDur   *string              `protobuf:"bytes,1,opt,name=time_window_dur,json=timeWindowDur,def=10s" json:"time_window_dur,omitempty"`
+	UsageMultiplier *float64             `protobuf:"fixed64,2,opt,name=usage_multiplier,json=usageMultiplier,def=1.1" json:"usage_multiplier,omitempty"`
+	MinDemandBps    *int64               `protobuf:"varint,3,opt,name=min_demand_bps,json=minDemandBps,def=5242880" json:"min_demand_bps,omitempty"`
+	Type            *DemandPredictorType `protobuf:"varint,4,opt,name=type,enum=heyp.proto.DemandPredictorType,def=0" json:"type,omitempty"`
+	Quantile        *float64             `protobuf:"fixed64,5,opt,name=quantile,def=0.95" json:"quantile,omitempty"`                                  // only for DP_QUANTILE
+	TrendSmoothing  *float64             `protobuf:"fixed64,6,opt,name=trend_smoothing,json=trendSmoothing,def=0.1" json:"trend_smoothing,omitempty"` // only for DP_HOLT
 }
 
 // Default values for DemandPredictorConfig fields.
@@ -357,6 +426,9 @@ const (
 	Default_DemandPredictorConfig_TimeWindowDur   = string("10s")
 	Default_DemandPredictorConfig_UsageMultiplier = float64(1.1)
 	Default_DemandPredictorConfig_MinDemandBps    = int64(5242880)
+	Default_DemandPredictorConfig_Type            = DemandPredictorType_DP_BWE
+	Default_DemandPredictorConfig_Quantile        = float64(0.95)
+	Default_DemandPredictorConfig_TrendSmoothing  = float64(0.1)
 )
 
 func (x *DemandPredictorConfig) Reset() {
@@ -412,6 +484,27 @@ func (x *DemandPredictorConfig) GetMinDemandBps() int64 {
 	return Default_DemandPredictorConfig_MinDemandBps
 }
 
+func (x *DemandPredictorConfig) GetType() DemandPredictorType {
+	if x != nil && x.Type != nil {
+		return *x.Type
+	}
+	return Default_DemandPredictorConfig_Type
+}
+
+func (x *DemandPredictorConfig) GetQuantile() float64 {
+	if x != nil && x.Quantile != nil {
+		return *x.Quantile
+	}
+	return Default_DemandPredictorConfig_Quantile
+}
+
+func (x *DemandPredictorConfig) GetTrendSmoothing() float64 {
+	if x != nil && x.TrendSmoothing != nil {
+		return *x.TrendSmoothing
+	}
+	return Default_DemandPredictorConfig_TrendSmoothing
+}
+
 type HostFlowTrackerConfig struct {
 	state         protoimpl.MessageState
 	sizeCache     protoimpl.SizeCache
@@ -478,8 +571,15 @@ type FlowAggregatorConfig struct {
 	unknownFields protoimpl.UnknownFields
 
 	DemandPredictor *DemandPredictorConfig `protobuf:"bytes,1,opt,name=demand_predictor,json=demandPredictor" json:"demand_predictor,omitempty"`
+	// Maintain running per-FG sums instead of rebuilding them every period.
+	Incremental *bool `protobuf:"varint,2,opt,name=incremental,def=0" json:"incremental,omitempty"`
 }
 
+// Default values for FlowAggregatorConfig fields.
+const (
+	Default_FlowAggregatorConfig_Incremental = bool(false)
+)
+
 func (x *FlowAggregatorConfig) Reset() {
 	*x = FlowAggregatorConfig{}
 	if protoimpl.UnsafeEnabled {
@@ -519,6 +619,13 @@ func (x *FlowAggregatorConfig) GetDemandPredictor() *DemandPredictorConfig {
 	return nil
 }
 
+func (x *FlowAggregatorConfig) GetIncremental() bool {
+	if x != nil && x.Incremental != nil {
+		return *x.Incremental
+	}
+	return Default_FlowAggregatorConfig_Incremental
+}
+
 type HostFlowStateReporterConfig struct {
 	state         protoimpl.MessageState
 	sizeCache     protoimpl.SizeCache
@@ -1489,11 +1596,21 @@ type ClusterServerConfig struct {
 	// Format: 0.0.0.0:1415
 	Addresses     []string `protobuf:"bytes,1,rep,name=addresses" json:"addresses,omitempty"`
 	ControlPeriod *string  `protobuf:"bytes,2,opt,name=control_period,json=controlPeriod,def=5s" json:"control_period,omitempty"`
+	// If positive, host InfoBundles are queued and applied to the controller by this
+	// many workers instead of on gRPC threads.
+	NumIngestWorkers *int32 `protobuf:"varint,3,opt,name=num_ingest_workers,json=numIngestWorkers,def=0" json:"num_ingest_workers,omitempty"`
+	// Max number of InfoBundles queued per ingest worker. More are dropped.
+	IngestQueueCapacity *int32 `protobuf:"varint,4,opt,name=ingest_queue_capacity,json=ingestQueueCapacity,def=4096" json:"ingest_queue_capacity,omitempty"`
+	// If set, allocations are also recomputed as soon as enough new information
+	// arrives. control_period then bounds the time between recomputations.
+	AdaptiveControl *AdaptiveControlConfig `protobuf:"bytes,5,opt,name=adaptive_control,json=adaptiveControl" json:"adaptive_control,omitempty"`
 }
 
 // Default values for ClusterServerConfig fields.
 const (
-	Default_ClusterServerConfig_ControlPeriod = string("5s")
+	Default_ClusterServerConfig_ControlPeriod       = string("5s")
+	Default_ClusterServerConfig_NumIngestWorkers    = int32(0)
+	Default_ClusterServerConfig_IngestQueueCapacity = int32(4096)
 )
 
 func (x *ClusterServerConfig) Reset() {
@@ -1542,6 +1659,111 @@ func (x *ClusterServerConfig) GetControlPeriod() string {
 	return Default_ClusterServerConfig_ControlPeriod
 }
 
+func (x *ClusterServerConfig) GetNumIngestWorkers() int32 {
+	if x != nil && x.NumIngestWorkers != nil {
+		return *x.NumIngestWorkers
+	}
+	return Default_ClusterServerConfig_NumIngestWorkers
+}
+
+func (x *ClusterServerConfig) GetIngestQueueCapacity() int32 {
+	if x != nil && x.IngestQueueCapacity != nil {
+		return *x.IngestQueueCapacity
+	}
+	return Default_ClusterServerConfig_IngestQueueCapacity
+}
+
+func (x *ClusterServerConfig) GetAdaptiveControl() *AdaptiveControlConfig {
+	if x != nil {
+		return x.AdaptiveControl
+	}
+	return nil
+}
+
+type AdaptiveControlConfig struct {
+	state         protoimpl.MessageState
+	sizeCache     protoimpl.SizeCache
+	unknownFields protoimpl.UnknownFields
+
+	// Minimum time between recomputations.
+	MinPeriod *string `protobuf:"bytes,1,opt,name=min_period,json=minPeriod,def=100ms" json:"min_period,omitempty"`
+	// Recompute once this many reports per known host have arrived.
+	ReportFrac *float64 `protobuf:"fixed64,2,opt,name=report_frac,json=reportFrac,def=0.5" json:"report_frac,omitempty"`
+	// Recompute once an FG's estimated usage crosses its approval.
+	// Only supported by CC_FAST.
+	OnApprovalCrossing *bool `protobuf:"varint,3,opt,name=on_approval_crossing,json=onApprovalCrossing,def=1" json:"on_approval_crossing,omitempty"`
+	// How often to check for new information.
+	PollPeriod *string `protobuf:"bytes,4,opt,name=poll_period,json=pollPeriod,def=10ms" json:"poll_period,omitempty"`
+}
+
+// Default values for AdaptiveControlConfig fields.
+const (
+	Default_AdaptiveControlConfig_MinPeriod          = string("100ms")
+	Default_AdaptiveControlConfig_ReportFrac         = float64(0.5)
+	Default_AdaptiveControlConfig_OnApprovalCrossing = bool(true)
+	Default_AdaptiveControlConfig_PollPeriod         = string("10ms")
+)
+
+func (x *AdaptiveControlConfig) Reset() {
+	*x = AdaptiveControlConfig{}
+	if protoimpl.UnsafeEnabled {
+		mi := &file_heyp_proto_config_proto_msgTypes[16]
+		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
+		ms.StoreMessageInfo(mi)
+	}
+}
+
+func (x *AdaptiveControlConfig) String() string {
+	return protoimpl.X.MessageStringOf(x)
+}
+
+func (*AdaptiveControlConfig) ProtoMessage() {}
+
+func (x *AdaptiveControlConfig) ProtoReflect() protoreflect.Message {
+	mi := &file_heyp_proto_config_proto_msgTypes[16]
+	if protoimpl.UnsafeEnabled && x != nil {
+		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
+		if ms.LoadMessageInfo() == nil {
+			ms.StoreMessageInfo(mi)
+		}
+		return ms
+	}
+	return mi.MessageOf(x)
+}
+
+// Deprecated: Use AdaptiveControlConfig.ProtoReflect.Descriptor instead.
+func (*AdaptiveControlConfig) Descriptor() ([]byte, []int) {
+	return file_heyp_proto_config_proto_rawDescGZIP(), []int{16}
+}
+
+func (x *AdaptiveControlConfig) GetMinPeriod() string {
+	if x != nil && x.MinPeriod != nil {
+		return *x.MinPeriod
+	}
+	return Default_AdaptiveControlConfig_MinPeriod
+}
+
+func (x *AdaptiveControlConfig) GetReportFrac() float64 {
+	if x != nil && x.ReportFrac != nil {
+		return *x.ReportFrac
+	}
+	return Default_AdaptiveControlConfig_ReportFrac
+}
+
+func (x *AdaptiveControlConfig) GetOnApprovalCrossing() bool {
+	if x != nil && x.OnApprovalCrossing != nil {
+		return *x.OnApprovalCrossing
+	}
+	return Default_AdaptiveControlConfig_OnApprovalCrossing
+}
+
+func (x *AdaptiveControlConfig) GetPollPeriod() string {
+	if x != nil && x.PollPeriod != nil {
+		return *x.PollPeriod
+	}
+	return Default_AdaptiveControlConfig_PollPeriod
+}
+
 type FastClusterControllerConfig struct {
 	state         protoimpl.MessageState
 	sizeCache     protoimpl.SizeCache
@@ -1550,18 +1772,56 @@ type FastClusterControllerConfig struct {
 	TargetNumSamples        *int32                   `protobuf:"varint,1,opt,name=target_num_samples,json=targetNumSamples,def=200" json:"target_num_samples,omitempty"`
 	NumThreads              *int32                   `protobuf:"varint,2,opt,name=num_threads,json=numThreads,def=8" json:"num_threads,omitempty"`
 	DowngradeFracController *DowngradeFracController `protobuf:"bytes,3,opt,name=downgrade_frac_controller,json=downgradeFracController" json:"downgrade_frac_controller,omitempty"`
+	// Number of shards used to ingest host infos.
+	// If <= 0, uses one shard per core.
+	NumInfoShards *int32 `protobuf:"varint,4,opt,name=num_info_shards,json=numInfoShards" json:"num_info_shards,omitempty"`
+	// Max number of FG usage records each shard buffers between control periods.
+	// Records that arrive when a shard is full are dropped.
+	// If <= 0, derived from expected_num_hosts.
+	InfoShardCapacity *int32 `protobuf:"varint,5,opt,name=info_shard_capacity,json=infoShardCapacity" json:"info_shard_capacity,omitempty"`
+	// If set, hosts are sent only the FlowAllocs that changed since their last
+	// bundle (see AllocBundle.delta_base_seq).
+	SendDeltaAllocs *bool `protobuf:"varint,6,opt,name=send_delta_allocs,json=sendDeltaAllocs,def=0" json:"send_delta_allocs,omitempty"`
+	// If set, hosts threshold-sample their FG usage before sending it and the
+	// cluster agent's usage estimates are built from the samples alone. Unsampled
+	// hosts still send an InfoBundle (without usage) as a heartbeat.
+	//
+	// Hosts behind aggregator-agents should not sample since aggregators sum the usage
+	// of all hosts exactly.
+	HostSideSampling *bool `protobuf:"varint,7,opt,name=host_side_sampling,json=hostSideSampling,def=0" json:"host_side_sampling,omitempty"`
+	// FG usage is only checked for approval crossings once at least this many reports
+	// per known host have arrived since the last control period.
+	MinReportFracForCrossing *float64 `protobuf:"fixed64,8,opt,name=min_report_frac_for_crossing,json=minReportFracForCrossing,def=0.1" json:"min_report_frac_for_crossing,omitempty"`
+	// If set, per-FG downgrade state and per-host QoS assignments are saved to this
+	// file every checkpoint_every_n_runs control periods, and restored from it on
+	// startup.
+	CheckpointFile       *string `protobuf:"bytes,9,opt,name=checkpoint_file,json=checkpointFile" json:"checkpoint_file,omitempty"`
+	CheckpointEveryNRuns *int32  `protobuf:"varint,10,opt,name=checkpoint_every_n_runs,json=checkpointEveryNRuns,def=12" json:"checkpoint_every_n_runs,omitempty"`
+	// Number of hosts expected to report each control period. Used to size the info
+	// shards when info_shard_capacity is unset.
+	ExpectedNumHosts *int32 `protobuf:"varint,11,opt,name=expected_num_hosts,json=expectedNumHosts,def=50000" json:"expected_num_hosts,omitempty"`
+	// If set, usage reported between control periods is summed as it arrives so that
+	// approval crossings can be detected early. The cluster agent sets this when
+	// AdaptiveControlConfig.on_approval_crossing is enabled.
+	TrackPendingUsage *bool `protobuf:"varint,12,opt,name=track_pending_usage,json=trackPendingUsage,def=0" json:"track_pending_usage,omitempty"`
 }
 
 // Default values for FastClusterControllerConfig fields.
 const (
-	Default_FastClusterControllerConfig_TargetNumSamples = int32(200)
-	Default_FastClusterControllerConfig_NumThreads       = int32(8)
+	Default_FastClusterControllerConfig_TargetNumSamples         = int32(200)
+	Default_FastClusterControllerConfig_NumThreads               = int32(8)
+	Default_FastClusterControllerConfig_SendDeltaAllocs          = bool(false)
+	Default_FastClusterControllerConfig_HostSideSampling         = bool(false)
+	Default_FastClusterControllerConfig_MinReportFracForCrossing = float64(0.1)
+	Default_FastClusterControllerConfig_CheckpointEveryNRuns     = int32(12)
+	Default_FastClusterControllerConfig_ExpectedNumHosts         = int32(50000)
+	Default_FastClusterControllerConfig_TrackPendingUsage        = bool(false)
 )
 
 func (x *FastClusterControllerConfig) Reset() {
 	*x = FastClusterControllerConfig{}
 	if protoimpl.UnsafeEnabled {
-		mi := &file_heyp_proto_config_proto_msgTypes[16]
+		mi := &file_heyp_proto_config_proto_msgTypes[17]
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		ms.StoreMessageInfo(mi)
 	}
@@ -1574,7 +1834,7 @@ func (x *FastClusterControllerConfig) String() string {
 func (*FastClusterControllerConfig) ProtoMessage() {}
 
 func (x *FastClusterControllerConfig) ProtoReflect() protoreflect.Message {
-	mi := &file_heyp_proto_config_proto_msgTypes[16]
+	mi := &file_heyp_proto_config_proto_msgTypes[17]
 	if protoimpl.UnsafeEnabled && x != nil {
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		if ms.LoadMessageInfo() == nil {
@@ -1587,7 +1847,7 @@ func (x *FastClusterControllerConfig) ProtoReflect() protoreflect.Message {
 
 // Deprecated: Use FastClusterControllerConfig.ProtoReflect.Descriptor instead.
 func (*FastClusterControllerConfig) Descriptor() ([]byte, []int) {
-	return file_heyp_proto_config_proto_rawDescGZIP(), []int{16}
+	return file_heyp_proto_config_proto_rawDescGZIP(), []int{17}
 }
 
 func (x *FastClusterControllerConfig) GetTargetNumSamples() int32 {
@@ -1611,6 +1871,242 @@ func (x *FastClusterControllerConfig) GetDowngradeFracController() *DowngradeFra
 	return nil
 }
 
+func (x *FastClusterControllerConfig) GetNumInfoShards() int32 {
+	if x != nil && x.NumInfoShards != nil {
+		return *x.NumInfoShards
+	}
+	return 0
+}
+
+func (x *FastClusterControllerConfig) GetInfoShardCapacity() int32 {
+	if x != nil && x.InfoShardCapacity != nil {
+		return *x.InfoShardCapacity
+	}
+	return 0
+}
+
+func (x *FastClusterControllerConfig) GetSendDeltaAllocs() bool {
+	if x != nil && x.SendDeltaAllocs != nil {
+		return *x.SendDeltaAllocs
+	}
+	return Default_FastClusterControllerConfig_SendDeltaAllocs
+}
+
+func (x *FastClusterControllerConfig) GetHostSideSampling() bool {
+	if x != nil && x.HostSideSampling != nil {
+		return *x.HostSideSampling
+	}
+	return Default_FastClusterControllerConfig_HostSideSampling
+}
+
+func (x *FastClusterControllerConfig) GetMinReportFracForCrossing() float64 {
+	if x != nil && x.MinReportFracForCrossing != nil {
+		return *x.MinReportFracForCrossing
+	}
+	return Default_FastClusterControllerConfig_MinReportFracForCrossing
+}
+
+func (x *FastClusterControllerConfig) GetCheckpointFile() string {
+	if x != nil && x.CheckpointFile != nil {
+		return *x.CheckpointFile
+	}
+	return ""
+}
+
+func (x *FastClusterControllerConfig) GetCheckpointEveryNRuns() int32 {
+	if x != nil && x.CheckpointEveryNRuns != nil {
+		return *x.CheckpointEveryNRuns
+	}
+	return Default_FastClusterControllerConfig_CheckpointEveryNRuns
+}
+
+func (x *FastClusterControllerConfig) GetExpectedNumHosts() int32 {
+	if x != nil && x.ExpectedNumHosts != nil {
+		return *x.ExpectedNumHosts
+	}
+	return Default_FastClusterControllerConfig_ExpectedNumHosts
+}
+
+func (x *FastClusterControllerConfig) GetTrackPendingUsage() bool {
+	if x != nil && x.TrackPendingUsage != nil {
+		return *x.TrackPendingUsage
+	}
+	return Default_FastClusterControllerConfig_TrackPendingUsage
+}
+
+type FullClusterControllerConfig struct {
+	state         protoimpl.MessageState
+	sizeCache     protoimpl.SizeCache
+	unknownFields protoimpl.UnknownFields
+
+	// Threads used to build and broadcast alloc bundles.
+	NumThreads *int32 `protobuf:"varint,1,opt,name=num_threads,json=numThreads,def=4" json:"num_threads,omitempty"`
+	// If set, hosts are not sent bundles that match the last one they were sent,
+	// allowing each rate limit to differ by rate_limit_tolerance (a fraction).
+	SkipUnchangedBundles *bool    `protobuf:"varint,2,opt,name=skip_unchanged_bundles,json=skipUnchangedBundles,def=0" json:"skip_unchanged_bundles,omitempty"`
+	RateLimitTolerance   *float64 `protobuf:"fixed64,3,opt,name=rate_limit_tolerance,json=rateLimitTolerance,def=0" json:"rate_limit_tolerance,omitempty"`
+	// If positive, unchanged bundles are resent after this many skipped periods.
+	RefreshAfterSkips *int32 `protobuf:"varint,4,opt,name=refresh_after_skips,json=refreshAfterSkips,def=0" json:"refresh_after_skips,omitempty"`
+}
+
+// Default values for FullClusterControllerConfig fields.
+const (
+	Default_FullClusterControllerConfig_NumThreads           = int32(4)
+	Default_FullClusterControllerConfig_SkipUnchangedBundles = bool(false)
+	Default_FullClusterControllerConfig_RateLimitTolerance   = float64(0)
+	Default_FullClusterControllerConfig_RefreshAfterSkips    = int32(0)
+)
+
+func (x *FullClusterControllerConfig) Reset() {
+	*x = FullClusterControllerConfig{}
+	if protoimpl.UnsafeEnabled {
+		mi := &file_heyp_proto_config_proto_msgTypes[18]
+		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
+		ms.StoreMessageInfo(mi)
+	}
+}
+
+func (x *FullClusterControllerConfig) String() string {
+	return protoimpl.X.MessageStringOf(x)
+}
+
+func (*FullClusterControllerConfig) ProtoMessage() {}
+
+func (x *FullClusterControllerConfig) ProtoReflect() protoreflect.Message {
+	mi := &file_heyp_proto_config_proto_msgTypes[18]
+	if protoimpl.UnsafeEnabled && x != nil {
+		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
+		if ms.LoadMessageInfo() == nil {
+			ms.StoreMessageInfo(mi)
+		}
+		return ms
+	}
+	return mi.MessageOf(x)
+}
+
+// Deprecated: Use FullClusterControllerConfig.ProtoReflect.Descriptor instead.
+func (*FullClusterControllerConfig) Descriptor() ([]byte, []int) {
+	return file_heyp_proto_config_proto_rawDescGZIP(), []int{18}
+}
+
+func (x *FullClusterControllerConfig) GetNumThreads() int32 {
+	if x != nil && x.NumThreads != nil {
+		return *x.NumThreads
+	}
+	return Default_FullClusterControllerConfig_NumThreads
+}
+
+func (x *FullClusterControllerConfig) GetSkipUnchangedBundles() bool {
+	if x != nil && x.SkipUnchangedBundles != nil {
+		return *x.SkipUnchangedBundles
+	}
+	return Default_FullClusterControllerConfig_SkipUnchangedBundles
+}
+
+func (x *FullClusterControllerConfig) GetRateLimitTolerance() float64 {
+	if x != nil && x.RateLimitTolerance != nil {
+		return *x.RateLimitTolerance
+	}
+	return Default_FullClusterControllerConfig_RateLimitTolerance
+}
+
+func (x *FullClusterControllerConfig) GetRefreshAfterSkips() int32 {
+	if x != nil && x.RefreshAfterSkips != nil {
+		return *x.RefreshAfterSkips
+	}
+	return Default_FullClusterControllerConfig_RefreshAfterSkips
+}
+
+type AggregatorAgentConfig struct {
+	state         protoimpl.MessageState
+	sizeCache     protoimpl.SizeCache
+	unknownFields protoimpl.UnknownFields
+
+	// Unique among the aggregator-agents of a cluster agent.
+	AggregatorId *uint64 `protobuf:"varint,1,opt,name=aggregator_id,json=aggregatorId" json:"aggregator_id,omitempty"`
+	// Hosts connect here. Format: 0.0.0.0:1415
+	Addresses []string `protobuf:"bytes,2,rep,name=addresses" json:"addresses,omitempty"`
+	// Address of the cluster agent to forward to.
+	ClusterAgentAddress *string `protobuf:"bytes,3,opt,name=cluster_agent_address,json=clusterAgentAddress" json:"cluster_agent_address,omitempty"`
+	// How often summaries are sent to the cluster agent.
+	ForwardPeriod *string `protobuf:"bytes,4,opt,name=forward_period,json=forwardPeriod,def=1s" json:"forward_period,omitempty"`
+	// Number of children per FG forwarded when the FG is using its approval.
+	TargetNumSamples *int32 `protobuf:"varint,5,opt,name=target_num_samples,json=targetNumSamples,def=200" json:"target_num_samples,omitempty"`
+}
+
+// Default values for AggregatorAgentConfig fields.
+const (
+	Default_AggregatorAgentConfig_ForwardPeriod    = string("1s")
+	Default_AggregatorAgentConfig_TargetNumSamples = int32(200)
+)
+
+func (x *AggregatorAgentConfig) Reset() {
+	*x = AggregatorAgentConfig{}
+	if protoimpl.UnsafeEnabled {
+		mi := &file_heyp_proto_config_proto_msgTypes[19]
+		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
+		ms.StoreMessageInfo(mi)
+	}
+}
+
+func (x *AggregatorAgentConfig) String() string {
+	return protoimpl.X.MessageStringOf(x)
+}
+
+func (*AggregatorAgentConfig) ProtoMessage() {}
+
+func (x *AggregatorAgentConfig) ProtoReflect() protoreflect.Message {
+	mi := &file_heyp_proto_config_proto_msgTypes[19]
+	if protoimpl.UnsafeEnabled && x != nil {
+		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
+		if ms.LoadMessageInfo() == nil {
+			ms.StoreMessageInfo(mi)
+		}
+		return ms
+	}
+	return mi.MessageOf(x)
+}
+
+// Deprecated: Use AggregatorAgentConfig.ProtoReflect.Descriptor instead.
+func (*AggregatorAgentConfig) Descriptor() ([]byte, []int) {
+	return file_heyp_proto_config_proto_rawDescGZIP(), []int{19}
+}
+
+func (x *AggregatorAgentConfig) GetAggregatorId() uint64 {
+	if x != nil && x.AggregatorId != nil {
+		return *x.AggregatorId
+	}
+	return 0
+}
+
+func (x *AggregatorAgentConfig) GetAddresses() []string {
+	if x != nil {
+		return x.Addresses
+	}
+	return nil
+}
+
+func (x *AggregatorAgentConfig) GetClusterAgentAddress() string {
+	if x != nil && x.ClusterAgentAddress != nil {
+		return *x.ClusterAgentAddress
+	}
+	return ""
+}
+
+func (x *AggregatorAgentConfig) GetForwardPeriod() string {
+	if x != nil && x.ForwardPeriod != nil {
+		return *x.ForwardPeriod
+	}
+	return Default_AggregatorAgentConfig_ForwardPeriod
+}
+
+func (x *AggregatorAgentConfig) GetTargetNumSamples() int32 {
+	if x != nil && x.TargetNumSamples != nil {
+		return *x.TargetNumSamples
+	}
+	return Default_AggregatorAgentConfig_TargetNumSamples
+}
+
 type ClusterAgentConfig struct {
 	state         protoimpl.MessageState
 	sizeCache     protoimpl.SizeCache
@@ -1621,8 +2117,14 @@ type ClusterAgentConfig struct {
 	// Only used if controller_type == CC_FULL.
 	FlowAggregator *FlowAggregatorConfig   `protobuf:"bytes,3,opt,name=flow_aggregator,json=flowAggregator" json:"flow_aggregator,omitempty"`
 	Allocator      *ClusterAllocatorConfig `protobuf:"bytes,4,opt,name=allocator" json:"allocator,omitempty"`
+	// Only used if controller_type == CC_FULL.
+	FullControllerConfig *FullClusterControllerConfig `protobuf:"bytes,6,opt,name=full_controller_config,json=fullControllerConfig" json:"full_controller_config,omitempty"`
 	// Only used in controller_type == CC_FAST.
 	FastControllerConfig *FastClusterControllerConfig `protobuf:"bytes,5,opt,name=fast_controller_config,json=fastControllerConfig" json:"fast_controller_config,omitempty"`
+	// If set (e.g. "5s"), the limits file is reread this often and changed approvals
+	// are applied without restarting. Only supported with controller_type == CC_FAST,
+	// and not together with aggregator-agents (which keep the limits they started with).
+	LimitsReloadPeriod *string `protobuf:"bytes,7,opt,name=limits_reload_period,json=limitsReloadPeriod" json:"limits_reload_period,omitempty"`
 }
 
 // Default values for ClusterAgentConfig fields.
@@ -1633,7 +2135,7 @@ const (
 func (x *ClusterAgentConfig) Reset() {
 	*x = ClusterAgentConfig{}
 	if protoimpl.UnsafeEnabled {
-		mi := &file_heyp_proto_config_proto_msgTypes[17]
+		mi := &file_heyp_proto_config_proto_msgTypes[20]
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		ms.StoreMessageInfo(mi)
 	}
@@ -1646,7 +2148,7 @@ func (x *ClusterAgentConfig) String() string {
 func (*ClusterAgentConfig) ProtoMessage() {}
 
 func (x *ClusterAgentConfig) ProtoReflect() protoreflect.Message {
-	mi := &file_heyp_proto_config_proto_msgTypes[17]
+	mi := &file_heyp_proto_config_proto_msgTypes[20]
 	if protoimpl.UnsafeEnabled && x != nil {
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		if ms.LoadMessageInfo() == nil {
@@ -1659,7 +2161,7 @@ func (x *ClusterAgentConfig) ProtoReflect() protoreflect.Message {
 
 // Deprecated: Use ClusterAgentConfig.ProtoReflect.Descriptor instead.
 func (*ClusterAgentConfig) Descriptor() ([]byte, []int) {
-	return file_heyp_proto_config_proto_rawDescGZIP(), []int{17}
+	return file_heyp_proto_config_proto_rawDescGZIP(), []int{20}
 }
 
 func (x *ClusterAgentConfig) GetControllerType() ClusterControllerType {
@@ -1690,6 +2192,13 @@ func (x *ClusterAgentConfig) GetAllocator() *ClusterAllocatorConfig {
 	return nil
 }
 
+func (x *ClusterAgentConfig) GetFullControllerConfig() *FullClusterControllerConfig {
+	if x != nil {
+		return x.FullControllerConfig
+	}
+	return nil
+}
+
 func (x *ClusterAgentConfig) GetFastControllerConfig() *FastClusterControllerConfig {
 	if x != nil {
 		return x.FastControllerConfig
@@ -1697,6 +2206,13 @@ func (x *ClusterAgentConfig) GetFastControllerConfig() *FastClusterControllerCon
 	return nil
 }
 
+func (x *ClusterAgentConfig) GetLimitsReloadPeriod() string {
+	if x != nil && x.LimitsReloadPeriod != nil {
+		return *x.LimitsReloadPeriod
+	}
+	return ""
+}
+
 type DCMapping_Entry struct {
 	state         protoimpl.MessageState
 	sizeCache     protoimpl.SizeCache
@@ -1709,7 +2225,7 @@ type DCMapping_Entry struct {
 func (x *DCMapping_Entry) Reset() {
 	*x = DCMapping_Entry{}
 	if protoimpl.UnsafeEnabled {
-		mi := &file_heyp_proto_config_proto_msgTypes[18]
+		mi := &file_heyp_proto_config_proto_msgTypes[21]
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		ms.StoreMessageInfo(mi)
 	}
@@ -1722,7 +2238,7 @@ func (x *DCMapping_Entry) String() string {
 func (*DCMapping_Entry) ProtoMessage() {}
 
 func (x *DCMapping_Entry) ProtoReflect() protoreflect.Message {
-	mi := &file_heyp_proto_config_proto_msgTypes[18]
+	mi := &file_heyp_proto_config_proto_msgTypes[21]
 	if protoimpl.UnsafeEnabled && x != nil {
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		if ms.LoadMessageInfo() == nil {
@@ -1766,7 +2282,7 @@ type SimulatedWanConfig_Pair struct {
 func (x *SimulatedWanConfig_Pair) Reset() {
 	*x = SimulatedWanConfig_Pair{}
 	if protoimpl.UnsafeEnabled {
-		mi := &file_heyp_proto_config_proto_msgTypes[19]
+		mi := &file_heyp_proto_config_proto_msgTypes[22]
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		ms.StoreMessageInfo(mi)
 	}
@@ -1779,7 +2295,7 @@ func (x *SimulatedWanConfig_Pair) String() string {
 func (*SimulatedWanConfig_Pair) ProtoMessage() {}
 
 func (x *SimulatedWanConfig_Pair) ProtoReflect() protoreflect.Message {
-	mi := &file_heyp_proto_config_proto_msgTypes[19]
+	mi := &file_heyp_proto_config_proto_msgTypes[22]
 	if protoimpl.UnsafeEnabled && x != nil {
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		if ms.LoadMessageInfo() == nil {
@@ -1846,7 +2362,7 @@ const (
 func (x *DowngradeSelector_HybridHashingConfig) Reset() {
 	*x = DowngradeSelector_HybridHashingConfig{}
 	if protoimpl.UnsafeEnabled {
-		mi := &file_heyp_proto_config_proto_msgTypes[20]
+		mi := &file_heyp_proto_config_proto_msgTypes[23]
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		ms.StoreMessageInfo(mi)
 	}
@@ -1859,7 +2375,7 @@ func (x *DowngradeSelector_HybridHashingConfig) String() string {
 func (*DowngradeSelector_HybridHashingConfig) ProtoMessage() {}
 
 func (x *DowngradeSelector_HybridHashingConfig) ProtoReflect() protoreflect.Message {
-	mi := &file_heyp_proto_config_proto_msgTypes[20]
+	mi := &file_heyp_proto_config_proto_msgTypes[23]
 	if protoimpl.UnsafeEnabled && x != nil {
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		if ms.LoadMessageInfo() == nil {
@@ -1901,7 +2417,7 @@ type FixedClusterHostAllocs_FlowAllocAndCount struct {
 func (x *FixedClusterHostAllocs_FlowAllocAndCount) Reset() {
 	*x = FixedClusterHostAllocs_FlowAllocAndCount{}
 	if protoimpl.UnsafeEnabled {
-		mi := &file_heyp_proto_config_proto_msgTypes[21]
+		mi := &file_heyp_proto_config_proto_msgTypes[24]
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		ms.StoreMessageInfo(mi)
 	}
@@ -1914,7 +2430,7 @@ func (x *FixedClusterHostAllocs_FlowAllocAndCount) String() string {
 func (*FixedClusterHostAllocs_FlowAllocAndCount) ProtoMessage() {}
 
 func (x *FixedClusterHostAllocs_FlowAllocAndCount) ProtoReflect() protoreflect.Message {
-	mi := &file_heyp_proto_config_proto_msgTypes[21]
+	mi := &file_heyp_proto_config_proto_msgTypes[24]
 	if protoimpl.UnsafeEnabled && x != nil {
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		if ms.LoadMessageInfo() == nil {
@@ -1962,7 +2478,7 @@ type FixedClusterHostAllocs_Snapshot struct {
 func (x *FixedClusterHostAllocs_Snapshot) Reset() {
 	*x = FixedClusterHostAllocs_Snapshot{}
 	if protoimpl.UnsafeEnabled {
-		mi := &file_heyp_proto_config_proto_msgTypes[22]
+		mi := &file_heyp_proto_config_proto_msgTypes[25]
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		ms.StoreMessageInfo(mi)
 	}
@@ -1975,7 +2491,7 @@ func (x *FixedClusterHostAllocs_Snapshot) String() string {
 func (*FixedClusterHostAllocs_Snapshot) ProtoMessage() {}
 
 func (x *FixedClusterHostAllocs_Snapshot) ProtoReflect() protoreflect.Message {
-	mi := &file_heyp_proto_config_proto_msgTypes[22]
+	mi := &file_heyp_proto_config_proto_msgTypes[25]
 	if protoimpl.UnsafeEnabled && x != nil {
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		if ms.LoadMessageInfo() == nil {
@@ -2004,7 +2520,7 @@ var file_heyp_proto_config_proto_rawDesc = []byte{
 	0x0a, 0x17, 0x68, 0x65, 0x79, 0x70, 0x2f, 0x70, 0x72, 0x6f, 0x74, 0x6f, 0x2f, 0x63, 0x6f, 0x6e,
 	0x66, 0x69, 0x67, 0x2e, 0x70, 0x72, 0x6f, 0x74, 0x6f, 0x12, 0x0a, 0x68, 0x65, 0x79, 0x70, 0x2e,
 	0x70, 0x72, 0x6f, 0x74, 0x6f, 0x1a, 0x15, 0x68, 0x65, 0x79, 0x70, 0x2f, 0x70, 0x72, 0x6f, 0x74,
-	0x6f, 0x2f, 0x68, 0x65, 0x79, 0x70, 0x2e, 0x70, 0x72, 0x6f, 0x74, 0x6f, 0x22, 0xa3, 0x01, 0x0a,
+	0x6f, 0x2f, 0x68, 0x65, 0x79, 0x70, 0x2e, 0x70, 0x72, 0x6f, 0x74, 0x6f, 0x22, 0xb0, 0x02, 0x0a,
 	0x15, 0x44, 0x65, 0x6d, 0x61, 0x6e, 0x64, 0x50, 0x72, 0x65, 0x64, 0x69, 0x63, 0x74, 0x6f, 0x72,
 	0x43, 0x6f, 0x6e, 0x66, 0x69, 0x67, 0x12, 0x2b, 0x0a, 0x0f, 0x74, 0x69, 0x6d, 0x65, 0x5f, 0x77,
 	0x69, 0x6e, 0x64, 0x6f, 0x77, 0x5f, 0x64, 0x75, 0x72, 0x18, 0x01, 0x20, 0x01, 0x28, 0x09, 0x3a,
@@ -2015,342 +2531,450 @@ var file_heyp_proto_config_proto_rawDesc = []byte{
 	0x69, 0x65, 0x72, 0x12, 0x2d, 0x0a, 0x0e, 0x6d, 0x69, 0x6e, 0x5f, 0x64, 0x65, 0x6d, 0x61, 0x6e,
 	0x64, 0x5f, 0x62, 0x70, 0x73, 0x18, 0x03, 0x20, 0x01, 0x28, 0x03, 0x3a, 0x07, 0x35, 0x32, 0x34,
 	0x32, 0x38, 0x38, 0x30, 0x52, 0x0c, 0x6d, 0x69, 0x6e, 0x44, 0x65, 0x6d, 0x61, 0x6e, 0x64, 0x42,
-	0x70, 0x73, 0x22, 0xa9, 0x01, 0x0a, 0x15, 0x48, 0x6f, 0x73, 0x74, 0x46, 0x6c, 0x6f, 0x77, 0x54,
-	0x72, 0x61, 0x63, 0x6b, 0x65, 0x72, 0x43, 0x6f, 0x6e, 0x66, 0x69, 0x67, 0x12, 0x4c, 0x0a, 0x10,
-	0x64, 0x65, 0x6d, 0x61, 0x6e, 0x64, 0x5f, 0x70, 0x72, 0x65, 0x64, 0x69, 0x63, 0x74, 0x6f, 0x72,
-	0x18, 0x01, 0x20, 0x01, 0x28, 0x0b, 0x32, 0x21, 0x2e, 0x68, 0x65, 0x79, 0x70, 0x2e, 0x70, 0x72,
-	0x6f, 0x74, 0x6f, 0x2e, 0x44, 0x65, 0x6d, 0x61, 0x6e, 0x64, 0x50, 0x72, 0x65, 0x64, 0x69, 0x63,
-	0x74, 0x6f, 0x72, 0x43, 0x6f, 0x6e, 0x66, 0x69, 0x67, 0x52, 0x0f, 0x64, 0x65, 0x6d, 0x61, 0x6e,
-	0x64, 0x50, 0x72, 0x65, 0x64, 0x69, 0x63, 0x74, 0x6f, 0x72, 0x12, 0x42, 0x0a, 0x1a, 0x69, 0x67,
-	0x6e, 0x6f, 0x72, 0x65, 0x5f, 0x69, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x61, 0x6e, 0x65, 0x6f,
-	0x75, 0x73, 0x5f, 0x75, 0x73, 0x61, 0x67, 0x65, 0x18, 0x02, 0x20, 0x01, 0x28, 0x08, 0x3a, 0x04,
-	0x74, 0x72, 0x75, 0x65, 0x52, 0x18, 0x69, 0x67, 0x6e, 0x6f, 0x72, 0x65, 0x49, 0x6e, 0x73, 0x74,
-	0x61, 0x6e, 0x74, 0x61, 0x6e, 0x65, 0x6f, 0x75, 0x73, 0x55, 0x73, 0x61, 0x67, 0x65, 0x22, 0x64,
-	0x0a, 0x14, 0x46, 0x6c, 0x6f, 0x77, 0x41, 0x67, 0x67, 0x72, 0x65, 0x67, 0x61, 0x74, 0x6f, 0x72,
-	0x43, 0x6f, 0x6e, 0x66, 0x69, 0x67, 0x12, 0x4c, 0x0a, 0x10, 0x64, 0x65, 0x6d, 0x61, 0x6e, 0x64,
-	0x5f, 0x70, 0x72, 0x65, 0x64, 0x69, 0x63, 0x74, 0x6f, 0x72, 0x18, 0x01, 0x20, 0x01, 0x28, 0x0b,
-	0x32, 0x21, 0x2e, 0x68, 0x65, 0x79, 0x70, 0x2e, 0x70, 0x72, 0x6f, 0x74, 0x6f, 0x2e, 0x44, 0x65,
-	0x6d, 0x61, 0x6e, 0x64, 0x50, 0x72, 0x65, 0x64, 0x69, 0x63, 0x74, 0x6f, 0x72, 0x43, 0x6f, 0x6e,
-	0x66, 0x69, 0x67, 0x52, 0x0f, 0x64, 0x65, 0x6d, 0x61, 0x6e, 0x64, 0x50, 0x72, 0x65, 0x64, 0x69,
-	0x63, 0x74, 0x6f, 0x72, 0x22, 0x47, 0x0a, 0x1b, 0x48, 0x6f, 0x73, 0x74, 0x46, 0x6c, 0x6f, 0x77,
-	0x53, 0x74, 0x61, 0x74, 0x65, 0x52, 0x65, 0x70, 0x6f, 0x72, 0x74, 0x65, 0x72, 0x43, 0x6f, 0x6e,
-	0x66, 0x69, 0x67, 0x12, 0x28, 0x0a, 0x0e, 0x73, 0x73, 0x5f, 0x62, 0x69, 0x6e, 0x61, 0x72, 0x79,
-	0x5f, 0x6e, 0x61, 0x6d, 0x65, 0x18, 0x01, 0x20, 0x01, 0x28, 0x09, 0x3a, 0x02, 0x73, 0x73, 0x52,
-	0x0c, 0x73, 0x73, 0x42, 0x69, 0x6e, 0x61, 0x72, 0x79, 0x4e, 0x61, 0x6d, 0x65, 0x22, 0xb2, 0x02,
-	0x0a, 0x12, 0x48, 0x6f, 0x73, 0x74, 0x45, 0x6e, 0x66, 0x6f, 0x72, 0x63, 0x65, 0x72, 0x43, 0x6f,
-	0x6e, 0x66, 0x69, 0x67, 0x12, 0x22, 0x0a, 0x0d, 0x64, 0x65, 0x62, 0x75, 0x67, 0x5f, 0x6c, 0x6f,
-	0x67, 0x5f, 0x64, 0x69, 0x72, 0x18, 0x01, 0x20, 0x01, 0x28, 0x09, 0x52, 0x0b, 0x64, 0x65, 0x62,
-	0x75, 0x67, 0x4c, 0x6f, 0x67, 0x44, 0x69, 0x72, 0x12, 0x25, 0x0a, 0x0b, 0x6c, 0x69, 0x6d, 0x69,
-	0x74, 0x5f, 0x68, 0x69, 0x70, 0x72, 0x69, 0x18, 0x02, 0x20, 0x01, 0x28, 0x08, 0x3a, 0x04, 0x74,
-	0x72, 0x75, 0x65, 0x52, 0x0a, 0x6c, 0x69, 0x6d, 0x69, 0x74, 0x48, 0x69, 0x70, 0x72, 0x69, 0x12,
-	0x25, 0x0a, 0x0b, 0x6c, 0x69, 0x6d, 0x69, 0x74, 0x5f, 0x6c, 0x6f, 0x70, 0x72, 0x69, 0x18, 0x03,
+	0x70, 0x73, 0x12, 0x3b, 0x0a, 0x04, 0x74, 0x79, 0x70, 0x65, 0x18, 0x04, 0x20, 0x01, 0x28, 0x0e,
+	0x32, 0x1f, 0x2e, 0x68, 0x65, 0x79, 0x70, 0x2e, 0x70, 0x72, 0x6f, 0x74, 0x6f, 0x2e, 0x44, 0x65,
+	0x6d, 0x61, 0x6e, 0x64, 0x50, 0x72, 0x65, 0x64, 0x69, 0x63, 0x74, 0x6f, 0x72, 0x54, 0x79, 0x70,
+	0x65, 0x3a, 0x06, 0x44, 0x50, 0x5f, 0x42, 0x57, 0x45, 0x52, 0x04, 0x74, 0x79, 0x70, 0x65, 0x12,
+	0x20, 0x0a, 0x08, 0x71, 0x75, 0x61, 0x6e, 0x74, 0x69, 0x6c, 0x65, 0x18, 0x05, 0x20, 0x01, 0x28,
+	0x01, 0x3a, 0x04, 0x30, 0x2e, 0x39, 0x35, 0x52, 0x08, 0x71, 0x75, 0x61, 0x6e, 0x74, 0x69, 0x6c,
+	0x65, 0x12, 0x2c, 0x0a, 0x0f, 0x74, 0x72, 0x65, 0x6e, 0x64, 0x5f, 0x73, 0x6d, 0x6f, 0x6f, 0x74,
+	0x68, 0x69, 0x6e, 0x67, 0x18, 0x06, 0x20, 0x01, 0x28, 0x01, 0x3a, 0x03, 0x30, 0x2e, 0x31, 0x52,
+	0x0e, 0x74, 0x72, 0x65, 0x6e, 0x64, 0x53, 0x6d, 0x6f, 0x6f, 0x74, 0x68, 0x69, 0x6e, 0x67, 0x22,
+	0xa9, 0x01, 0x0a, 0x15, 0x48, 0x6f, 0x73, 0x74, 0x46, 0x6c, 0x6f, 0x77, 0x54, 0x72, 0x61, 0x63,
+	0x6b, 0x65, 0x72, 0x43, 0x6f, 0x6e, 0x66, 0x69, 0x67, 0x12, 0x4c, 0x0a, 0x10, 0x64, 0x65, 0x6d,
+	0x61, 0x6e, 0x64, 0x5f, 0x70, 0x72, 0x65, 0x64, 0x69, 0x63, 0x74, 0x6f, 0x72, 0x18, 0x01, 0x20,
+	0x01, 0x28, 0x0b, 0x32, 0x21, 0x2e, 0x68, 0x65, 0x79, 0x70, 0x2e, 0x70, 0x72, 0x6f, 0x74, 0x6f,
+	0x2e, 0x44, 0x65, 0x6d, 0x61, 0x6e, 0x64, 0x50, 0x72, 0x65, 0x64, 0x69, 0x63, 0x74, 0x6f, 0x72,
+	0x43, 0x6f, 0x6e, 0x66, 0x69, 0x67, 0x52, 0x0f, 0x64, 0x65, 0x6d, 0x61, 0x6e, 0x64, 0x50, 0x72,
+	0x65, 0x64, 0x69, 0x63, 0x74, 0x6f, 0x72, 0x12, 0x42, 0x0a, 0x1a, 0x69, 0x67, 0x6e, 0x6f, 0x72,
+	0x65, 0x5f, 0x69, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x61, 0x6e, 0x65, 0x6f, 0x75, 0x73, 0x5f,
+	0x75, 0x73, 0x61, 0x67, 0x65, 0x18, 0x02, 0x20, 0x01, 0x28, 0x08, 0x3a, 0x04, 0x74, 0x72, 0x75,
+	0x65, 0x52, 0x18, 0x69, 0x67, 0x6e, 0x6f, 0x72, 0x65, 0x49, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74,
+	0x61, 0x6e, 0x65, 0x6f, 0x75, 0x73, 0x55, 0x73, 0x61, 0x67, 0x65, 0x22, 0x8d, 0x01, 0x0a, 0x14,
+	0x46, 0x6c, 0x6f, 0x77, 0x41, 0x67, 0x67, 0x72, 0x65, 0x67, 0x61, 0x74, 0x6f, 0x72, 0x43, 0x6f,
+	0x6e, 0x66, 0x69, 0x67, 0x12, 0x4c, 0x0a, 0x10, 0x64, 0x65, 0x6d, 0x61, 0x6e, 0x64, 0x5f, 0x70,
+	0x72, 0x65, 0x64, 0x69, 0x63, 0x74, 0x6f, 0x72, 0x18, 0x01, 0x20, 0x01, 0x28, 0x0b, 0x32, 0x21,
+	0x2e, 0x68, 0x65, 0x79, 0x70, 0x2e, 0x70, 0x72, 0x6f, 0x74, 0x6f, 0x2e, 0x44, 0x65, 0x6d, 0x61,
+	0x6e, 0x64, 0x50, 0x72, 0x65, 0x64, 0x69, 0x63, 0x74, 0x6f, 0x72, 0x43, 0x6f, 0x6e, 0x66, 0x69,
+	0x67, 0x52, 0x0f, 0x64, 0x65, 0x6d, 0x61, 0x6e, 0x64, 0x50, 0x72, 0x65, 0x64, 0x69, 0x63, 0x74,
+	0x6f, 0x72, 0x12, 0x27, 0x0a, 0x0b, 0x69, 0x6e, 0x63, 0x72, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x61,
+	0x6c, 0x18, 0x02, 0x20, 0x01, 0x28, 0x08, 0x3a, 0x05, 0x66, 0x61, 0x6c, 0x73, 0x65, 0x52, 0x0b,
+	0x69, 0x6e, 0x63, 0x72, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x61, 0x6c, 0x22, 0x47, 0x0a, 0x1b, 0x48,
+	0x6f, 0x73, 0x74, 0x46, 0x6c, 0x6f, 0x77, 0x53, 0x74, 0x61, 0x74, 0x65, 0x52, 0x65, 0x70, 0x6f,
+	0x72, 0x74, 0x65, 0x72, 0x43, 0x6f, 0x6e, 0x66, 0x69, 0x67, 0x12, 0x28, 0x0a, 0x0e, 0x73, 0x73,
+	0x5f, 0x62, 0x69, 0x6e, 0x61, 0x72, 0x79, 0x5f, 0x6e, 0x61, 0x6d, 0x65, 0x18, 0x01, 0x20, 0x01,
+	0x28, 0x09, 0x3a, 0x02, 0x73, 0x73, 0x52, 0x0c, 0x73, 0x73, 0x42, 0x69, 0x6e, 0x61, 0x72, 0x79,
+	0x4e, 0x61, 0x6d, 0x65, 0x22, 0xb2, 0x02, 0x0a, 0x12, 0x48, 0x6f, 0x73, 0x74, 0x45, 0x6e, 0x66,
+	0x6f, 0x72, 0x63, 0x65, 0x72, 0x43, 0x6f, 0x6e, 0x66, 0x69, 0x67, 0x12, 0x22, 0x0a, 0x0d, 0x64,
+	0x65, 0x62, 0x75, 0x67, 0x5f, 0x6c, 0x6f, 0x67, 0x5f, 0x64, 0x69, 0x72, 0x18, 0x01, 0x20, 0x01,
+	0x28, 0x09, 0x52, 0x0b, 0x64, 0x65, 0x62, 0x75, 0x67, 0x4c, 0x6f, 0x67, 0x44, 0x69, 0x72, 0x12,
+	0x25, 0x0a, 0x0b, 0x6c, 0x69, 0x6d, 0x69, 0x74, 0x5f, 0x68, 0x69, 0x70, 0x72, 0x69, 0x18, 0x02,
 	0x20, 0x01, 0x28, 0x08, 0x3a, 0x04, 0x74, 0x72, 0x75, 0x65, 0x52, 0x0a, 0x6c, 0x69, 0x6d, 0x69,
-	0x74, 0x4c, 0x6f, 0x70, 0x72, 0x69, 0x12, 0x2c, 0x0a, 0x12, 0x70, 0x61, 0x63, 0x69, 0x6e, 0x67,
-	0x5f, 0x62, 0x75, 0x72, 0x73, 0x74, 0x5f, 0x62, 0x79, 0x74, 0x65, 0x73, 0x18, 0x04, 0x20, 0x01,
-	0x28, 0x03, 0x52, 0x10, 0x70, 0x61, 0x63, 0x69, 0x6e, 0x67, 0x42, 0x75, 0x72, 0x73, 0x74, 0x42,
-	0x79, 0x74, 0x65, 0x73, 0x12, 0x34, 0x0a, 0x12, 0x6d, 0x69, 0x6e, 0x5f, 0x72, 0x61, 0x74, 0x65,
-	0x5f, 0x6c, 0x69, 0x6d, 0x69, 0x74, 0x5f, 0x62, 0x70, 0x73, 0x18, 0x05, 0x20, 0x01, 0x28, 0x03,
-	0x3a, 0x07, 0x35, 0x32, 0x34, 0x32, 0x38, 0x38, 0x30, 0x52, 0x0f, 0x6d, 0x69, 0x6e, 0x52, 0x61,
-	0x74, 0x65, 0x4c, 0x69, 0x6d, 0x69, 0x74, 0x42, 0x70, 0x73, 0x12, 0x23, 0x0a, 0x0a, 0x64, 0x73,
-	0x63, 0x70, 0x5f, 0x68, 0x69, 0x70, 0x72, 0x69, 0x18, 0x06, 0x20, 0x01, 0x28, 0x09, 0x3a, 0x04,
-	0x41, 0x46, 0x32, 0x31, 0x52, 0x09, 0x64, 0x73, 0x63, 0x70, 0x48, 0x69, 0x70, 0x72, 0x69, 0x12,
-	0x21, 0x0a, 0x0a, 0x64, 0x73, 0x63, 0x70, 0x5f, 0x6c, 0x6f, 0x70, 0x72, 0x69, 0x18, 0x07, 0x20,
-	0x01, 0x28, 0x09, 0x3a, 0x02, 0x42, 0x45, 0x52, 0x09, 0x64, 0x73, 0x63, 0x70, 0x4c, 0x6f, 0x70,
-	0x72, 0x69, 0x22, 0xe2, 0x02, 0x0a, 0x10, 0x48, 0x6f, 0x73, 0x74, 0x44, 0x61, 0x65, 0x6d, 0x6f,
-	0x6e, 0x43, 0x6f, 0x6e, 0x66, 0x69, 0x67, 0x12, 0x37, 0x0a, 0x14, 0x63, 0x6f, 0x6c, 0x6c, 0x65,
-	0x63, 0x74, 0x5f, 0x73, 0x74, 0x61, 0x74, 0x73, 0x5f, 0x70, 0x65, 0x72, 0x69, 0x6f, 0x64, 0x18,
-	0x01, 0x20, 0x01, 0x28, 0x09, 0x3a, 0x05, 0x35, 0x30, 0x30, 0x6d, 0x73, 0x52, 0x12, 0x63, 0x6f,
-	0x6c, 0x6c, 0x65, 0x63, 0x74, 0x53, 0x74, 0x61, 0x74, 0x73, 0x50, 0x65, 0x72, 0x69, 0x6f, 0x64,
-	0x12, 0x2e, 0x0a, 0x11, 0x69, 0x6e, 0x66, 0x6f, 0x72, 0x6d, 0x5f, 0x70, 0x65, 0x72, 0x69, 0x6f,
-	0x64, 0x5f, 0x64, 0x75, 0x72, 0x18, 0x02, 0x20, 0x01, 0x28, 0x09, 0x3a, 0x02, 0x32, 0x73, 0x52,
-	0x0f, 0x69, 0x6e, 0x66, 0x6f, 0x72, 0x6d, 0x50, 0x65, 0x72, 0x69, 0x6f, 0x64, 0x44, 0x75, 0x72,
-	0x12, 0x2c, 0x0a, 0x12, 0x63, 0x6c, 0x75, 0x73, 0x74, 0x65, 0x72, 0x5f, 0x61, 0x67, 0x65, 0x6e,
-	0x74, 0x5f, 0x61, 0x64, 0x64, 0x72, 0x18, 0x03, 0x20, 0x01, 0x28, 0x09, 0x52, 0x10, 0x63, 0x6c,
-	0x75, 0x73, 0x74, 0x65, 0x72, 0x41, 0x67, 0x65, 0x6e, 0x74, 0x41, 0x64, 0x64, 0x72, 0x12, 0x53,
-	0x0a, 0x24, 0x63, 0x6c, 0x75, 0x73, 0x74, 0x65, 0x72, 0x5f, 0x61, 0x67, 0x65, 0x6e, 0x74, 0x5f,
-	0x63, 0x6f, 0x6e, 0x6e, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x74, 0x69, 0x6d, 0x65, 0x6f,
-	0x75, 0x74, 0x5f, 0x64, 0x75, 0x72, 0x18, 0x04, 0x20, 0x01, 0x28, 0x09, 0x3a, 0x03, 0x31, 0x30,
-	0x73, 0x52, 0x20, 0x63, 0x6c, 0x75, 0x73, 0x74, 0x65, 0x72, 0x41, 0x67, 0x65, 0x6e, 0x74, 0x43,
-	0x6f, 0x6e, 0x6e, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x54, 0x69, 0x6d, 0x65, 0x6f, 0x75, 0x74,
-	0x44, 0x75, 0x72, 0x12, 0x24, 0x0a, 0x0e, 0x73, 0x74, 0x61, 0x74, 0x73, 0x5f, 0x6c, 0x6f, 0x67,
-	0x5f, 0x66, 0x69, 0x6c, 0x65, 0x18, 0x05, 0x20, 0x01, 0x28, 0x09, 0x52, 0x0c, 0x73, 0x74, 0x61,
-	0x74, 0x73, 0x4c, 0x6f, 0x67, 0x46, 0x69, 0x6c, 0x65, 0x12, 0x3c, 0x0a, 0x1b, 0x66, 0x69, 0x6e,
-	0x65, 0x5f, 0x67, 0x72, 0x61, 0x69, 0x6e, 0x65, 0x64, 0x5f, 0x73, 0x74, 0x61, 0x74, 0x73, 0x5f,
-	0x6c, 0x6f, 0x67, 0x5f, 0x66, 0x69, 0x6c, 0x65, 0x18, 0x06, 0x20, 0x01, 0x28, 0x09, 0x52, 0x17,
-	0x66, 0x69, 0x6e, 0x65, 0x47, 0x72, 0x61, 0x69, 0x6e, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74, 0x73,
-	0x4c, 0x6f, 0x67, 0x46, 0x69, 0x6c, 0x65, 0x22, 0x78, 0x0a, 0x09, 0x44, 0x43, 0x4d, 0x61, 0x70,
-	0x70, 0x69, 0x6e, 0x67, 0x12, 0x35, 0x0a, 0x07, 0x65, 0x6e, 0x74, 0x72, 0x69, 0x65, 0x73, 0x18,
-	0x01, 0x20, 0x03, 0x28, 0x0b, 0x32, 0x1b, 0x2e, 0x68, 0x65, 0x79, 0x70, 0x2e, 0x70, 0x72, 0x6f,
-	0x74, 0x6f, 0x2e, 0x44, 0x43, 0x4d, 0x61, 0x70, 0x70, 0x69, 0x6e, 0x67, 0x2e, 0x45, 0x6e, 0x74,
-	0x72, 0x79, 0x52, 0x07, 0x65, 0x6e, 0x74, 0x72, 0x69, 0x65, 0x73, 0x1a, 0x34, 0x0a, 0x05, 0x45,
-	0x6e, 0x74, 0x72, 0x79, 0x12, 0x1b, 0x0a, 0x09, 0x68, 0x6f, 0x73, 0x74, 0x5f, 0x61, 0x64, 0x64,
-	0x72, 0x18, 0x01, 0x20, 0x01, 0x28, 0x09, 0x52, 0x08, 0x68, 0x6f, 0x73, 0x74, 0x41, 0x64, 0x64,
-	0x72, 0x12, 0x0e, 0x0a, 0x02, 0x64, 0x63, 0x18, 0x02, 0x20, 0x01, 0x28, 0x09, 0x52, 0x02, 0x64,
-	0x63, 0x22, 0x47, 0x0a, 0x14, 0x53, 0x74, 0x61, 0x74, 0x69, 0x63, 0x44, 0x43, 0x4d, 0x61, 0x70,
-	0x70, 0x65, 0x72, 0x43, 0x6f, 0x6e, 0x66, 0x69, 0x67, 0x12, 0x2f, 0x0a, 0x07, 0x6d, 0x61, 0x70,
-	0x70, 0x69, 0x6e, 0x67, 0x18, 0x01, 0x20, 0x01, 0x28, 0x0b, 0x32, 0x15, 0x2e, 0x68, 0x65, 0x79,
-	0x70, 0x2e, 0x70, 0x72, 0x6f, 0x74, 0x6f, 0x2e, 0x44, 0x43, 0x4d, 0x61, 0x70, 0x70, 0x69, 0x6e,
-	0x67, 0x52, 0x07, 0x6d, 0x61, 0x70, 0x70, 0x69, 0x6e, 0x67, 0x22, 0xcd, 0x01, 0x0a, 0x0b, 0x4e,
-	0x65, 0x74, 0x65, 0x6d, 0x43, 0x6f, 0x6e, 0x66, 0x69, 0x67, 0x12, 0x19, 0x0a, 0x08, 0x64, 0x65,
-	0x6c, 0x61, 0x79, 0x5f, 0x6d, 0x73, 0x18, 0x01, 0x20, 0x01, 0x28, 0x05, 0x52, 0x07, 0x64, 0x65,
-	0x6c, 0x61, 0x79, 0x4d, 0x73, 0x12, 0x26, 0x0a, 0x0f, 0x64, 0x65, 0x6c, 0x61, 0x79, 0x5f, 0x6a,
-	0x69, 0x74, 0x74, 0x65, 0x72, 0x5f, 0x6d, 0x73, 0x18, 0x02, 0x20, 0x01, 0x28, 0x05, 0x52, 0x0d,
-	0x64, 0x65, 0x6c, 0x61, 0x79, 0x4a, 0x69, 0x74, 0x74, 0x65, 0x72, 0x4d, 0x73, 0x12, 0x32, 0x0a,
-	0x15, 0x64, 0x65, 0x6c, 0x61, 0x79, 0x5f, 0x63, 0x6f, 0x72, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x69,
-	0x6f, 0x6e, 0x5f, 0x70, 0x63, 0x74, 0x18, 0x03, 0x20, 0x01, 0x28, 0x01, 0x52, 0x13, 0x64, 0x65,
-	0x6c, 0x61, 0x79, 0x43, 0x6f, 0x72, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x50, 0x63,
-	0x74, 0x12, 0x47, 0x0a, 0x0a, 0x64, 0x65, 0x6c, 0x61, 0x79, 0x5f, 0x64, 0x69, 0x73, 0x74, 0x18,
-	0x04, 0x20, 0x01, 0x28, 0x0e, 0x32, 0x1a, 0x2e, 0x68, 0x65, 0x79, 0x70, 0x2e, 0x70, 0x72, 0x6f,
-	0x74, 0x6f, 0x2e, 0x4e, 0x65, 0x74, 0x65, 0x6d, 0x44, 0x65, 0x6c, 0x61, 0x79, 0x44, 0x69, 0x73,
-	0x74, 0x3a, 0x0c, 0x4e, 0x45, 0x54, 0x45, 0x4d, 0x5f, 0x4e, 0x4f, 0x52, 0x4d, 0x41, 0x4c, 0x52,
-	0x09, 0x64, 0x65, 0x6c, 0x61, 0x79, 0x44, 0x69, 0x73, 0x74, 0x22, 0xf4, 0x01, 0x0a, 0x12, 0x53,
-	0x69, 0x6d, 0x75, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x57, 0x61, 0x6e, 0x43, 0x6f, 0x6e, 0x66, 0x69,
-	0x67, 0x12, 0x3e, 0x0a, 0x08, 0x64, 0x63, 0x5f, 0x70, 0x61, 0x69, 0x72, 0x73, 0x18, 0x01, 0x20,
-	0x03, 0x28, 0x0b, 0x32, 0x23, 0x2e, 0x68, 0x65, 0x79, 0x70, 0x2e, 0x70, 0x72, 0x6f, 0x74, 0x6f,
-	0x2e, 0x53, 0x69, 0x6d, 0x75, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x57, 0x61, 0x6e, 0x43, 0x6f, 0x6e,
-	0x66, 0x69, 0x67, 0x2e, 0x50, 0x61, 0x69, 0x72, 0x52, 0x07, 0x64, 0x63, 0x50, 0x61, 0x69, 0x72,
-	0x73, 0x1a, 0x9d, 0x01, 0x0a, 0x04, 0x50, 0x61, 0x69, 0x72, 0x12, 0x15, 0x0a, 0x06, 0x73, 0x72,
-	0x63, 0x5f, 0x64, 0x63, 0x18, 0x01, 0x20, 0x01, 0x28, 0x09, 0x52, 0x05, 0x73, 0x72, 0x63, 0x44,
-	0x63, 0x12, 0x15, 0x0a, 0x06, 0x64, 0x73, 0x74, 0x5f, 0x64, 0x63, 0x18, 0x02, 0x20, 0x01, 0x28,
-	0x09, 0x52, 0x05, 0x64, 0x73, 0x74, 0x44, 0x63, 0x12, 0x2d, 0x0a, 0x05, 0x6e, 0x65, 0x74, 0x65,
-	0x6d, 0x18, 0x03, 0x20, 0x01, 0x28, 0x0b, 0x32, 0x17, 0x2e, 0x68, 0x65, 0x79, 0x70, 0x2e, 0x70,
-	0x72, 0x6f, 0x74, 0x6f, 0x2e, 0x4e, 0x65, 0x74, 0x65, 0x6d, 0x43, 0x6f, 0x6e, 0x66, 0x69, 0x67,
-	0x52, 0x05, 0x6e, 0x65, 0x74, 0x65, 0x6d, 0x12, 0x38, 0x0a, 0x0b, 0x6e, 0x65, 0x74, 0x65, 0x6d,
-	0x5f, 0x6c, 0x6f, 0x70, 0x72, 0x69, 0x18, 0x04, 0x20, 0x01, 0x28, 0x0b, 0x32, 0x17, 0x2e, 0x68,
-	0x65, 0x79, 0x70, 0x2e, 0x70, 0x72, 0x6f, 0x74, 0x6f, 0x2e, 0x4e, 0x65, 0x74, 0x65, 0x6d, 0x43,
-	0x6f, 0x6e, 0x66, 0x69, 0x67, 0x52, 0x0a, 0x6e, 0x65, 0x74, 0x65, 0x6d, 0x4c, 0x6f, 0x70, 0x72,
-	0x69, 0x22, 0xcd, 0x04, 0x0a, 0x0f, 0x48, 0x6f, 0x73, 0x74, 0x41, 0x67, 0x65, 0x6e, 0x74, 0x43,
-	0x6f, 0x6e, 0x66, 0x69, 0x67, 0x12, 0x26, 0x0a, 0x0f, 0x74, 0x68, 0x69, 0x73, 0x5f, 0x68, 0x6f,
-	0x73, 0x74, 0x5f, 0x61, 0x64, 0x64, 0x72, 0x73, 0x18, 0x01, 0x20, 0x03, 0x28, 0x09, 0x52, 0x0d,
-	0x74, 0x68, 0x69, 0x73, 0x48, 0x6f, 0x73, 0x74, 0x41, 0x64, 0x64, 0x72, 0x73, 0x12, 0x20, 0x0a,
-	0x08, 0x6a, 0x6f, 0x62, 0x5f, 0x6e, 0x61, 0x6d, 0x65, 0x18, 0x02, 0x20, 0x01, 0x28, 0x09, 0x3a,
-	0x05, 0x55, 0x4e, 0x53, 0x45, 0x54, 0x52, 0x07, 0x6a, 0x6f, 0x62, 0x4e, 0x61, 0x6d, 0x65, 0x12,
-	0x44, 0x0a, 0x0c, 0x66, 0x6c, 0x6f, 0x77, 0x5f, 0x74, 0x72, 0x61, 0x63, 0x6b, 0x65, 0x72, 0x18,
-	0x03, 0x20, 0x01, 0x28, 0x0b, 0x32, 0x21, 0x2e, 0x68, 0x65, 0x79, 0x70, 0x2e, 0x70, 0x72, 0x6f,
-	0x74, 0x6f, 0x2e, 0x48, 0x6f, 0x73, 0x74, 0x46, 0x6c, 0x6f, 0x77, 0x54, 0x72, 0x61, 0x63, 0x6b,
-	0x65, 0x72, 0x43, 0x6f, 0x6e, 0x66, 0x69, 0x67, 0x52, 0x0b, 0x66, 0x6c, 0x6f, 0x77, 0x54, 0x72,
-	0x61, 0x63, 0x6b, 0x65, 0x72, 0x12, 0x5b, 0x0a, 0x19, 0x73, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x5f,
-	0x74, 0x6f, 0x5f, 0x68, 0x6f, 0x73, 0x74, 0x5f, 0x61, 0x67, 0x67, 0x72, 0x65, 0x67, 0x61, 0x74,
-	0x6f, 0x72, 0x18, 0x04, 0x20, 0x01, 0x28, 0x0b, 0x32, 0x20, 0x2e, 0x68, 0x65, 0x79, 0x70, 0x2e,
-	0x70, 0x72, 0x6f, 0x74, 0x6f, 0x2e, 0x46, 0x6c, 0x6f, 0x77, 0x41, 0x67, 0x67, 0x72, 0x65, 0x67,
-	0x61, 0x74, 0x6f, 0x72, 0x43, 0x6f, 0x6e, 0x66, 0x69, 0x67, 0x52, 0x16, 0x73, 0x6f, 0x63, 0x6b,
-	0x65, 0x74, 0x54, 0x6f, 0x48, 0x6f, 0x73, 0x74, 0x41, 0x67, 0x67, 0x72, 0x65, 0x67, 0x61, 0x74,
-	0x6f, 0x72, 0x12, 0x57, 0x0a, 0x13, 0x66, 0x6c, 0x6f, 0x77, 0x5f, 0x73, 0x74, 0x61, 0x74, 0x65,
-	0x5f, 0x72, 0x65, 0x70, 0x6f, 0x72, 0x74, 0x65, 0x72, 0x18, 0x05, 0x20, 0x01, 0x28, 0x0b, 0x32,
-	0x27, 0x2e, 0x68, 0x65, 0x79, 0x70, 0x2e, 0x70, 0x72, 0x6f, 0x74, 0x6f, 0x2e, 0x48, 0x6f, 0x73,
-	0x74, 0x46, 0x6c, 0x6f, 0x77, 0x53, 0x74, 0x61, 0x74, 0x65, 0x52, 0x65, 0x70, 0x6f, 0x72, 0x74,
-	0x65, 0x72, 0x43, 0x6f, 0x6e, 0x66, 0x69, 0x67, 0x52, 0x11, 0x66, 0x6c, 0x6f, 0x77, 0x53, 0x74,
-	0x61, 0x74, 0x65, 0x52, 0x65, 0x70, 0x6f, 0x72, 0x74, 0x65, 0x72, 0x12, 0x3a, 0x0a, 0x08, 0x65,
-	0x6e, 0x66, 0x6f, 0x72, 0x63, 0x65, 0x72, 0x18, 0x06, 0x20, 0x01, 0x28, 0x0b, 0x32, 0x1e, 0x2e,
-	0x68, 0x65, 0x79, 0x70, 0x2e, 0x70, 0x72, 0x6f, 0x74, 0x6f, 0x2e, 0x48, 0x6f, 0x73, 0x74, 0x45,
-	0x6e, 0x66, 0x6f, 0x72, 0x63, 0x65, 0x72, 0x43, 0x6f, 0x6e, 0x66, 0x69, 0x67, 0x52, 0x08, 0x65,
-	0x6e, 0x66, 0x6f, 0x72, 0x63, 0x65, 0x72, 0x12, 0x34, 0x0a, 0x06, 0x64, 0x61, 0x65, 0x6d, 0x6f,
-	0x6e, 0x18, 0x07, 0x20, 0x01, 0x28, 0x0b, 0x32, 0x1c, 0x2e, 0x68, 0x65, 0x79, 0x70, 0x2e, 0x70,
-	0x72, 0x6f, 0x74, 0x6f, 0x2e, 0x48, 0x6f, 0x73, 0x74, 0x44, 0x61, 0x65, 0x6d, 0x6f, 0x6e, 0x43,
-	0x6f, 0x6e, 0x66, 0x69, 0x67, 0x52, 0x06, 0x64, 0x61, 0x65, 0x6d, 0x6f, 0x6e, 0x12, 0x3d, 0x0a,
-	0x09, 0x64, 0x63, 0x5f, 0x6d, 0x61, 0x70, 0x70, 0x65, 0x72, 0x18, 0x08, 0x20, 0x01, 0x28, 0x0b,
-	0x32, 0x20, 0x2e, 0x68, 0x65, 0x79, 0x70, 0x2e, 0x70, 0x72, 0x6f, 0x74, 0x6f, 0x2e, 0x53, 0x74,
-	0x61, 0x74, 0x69, 0x63, 0x44, 0x43, 0x4d, 0x61, 0x70, 0x70, 0x65, 0x72, 0x43, 0x6f, 0x6e, 0x66,
-	0x69, 0x67, 0x52, 0x08, 0x64, 0x63, 0x4d, 0x61, 0x70, 0x70, 0x65, 0x72, 0x12, 0x43, 0x0a, 0x0d,
-	0x73, 0x69, 0x6d, 0x75, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x5f, 0x77, 0x61, 0x6e, 0x18, 0x09, 0x20,
-	0x01, 0x28, 0x0b, 0x32, 0x1e, 0x2e, 0x68, 0x65, 0x79, 0x70, 0x2e, 0x70, 0x72, 0x6f, 0x74, 0x6f,
-	0x2e, 0x53, 0x69, 0x6d, 0x75, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x57, 0x61, 0x6e, 0x43, 0x6f, 0x6e,
-	0x66, 0x69, 0x67, 0x52, 0x0c, 0x73, 0x69, 0x6d, 0x75, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x57, 0x61,
-	0x6e, 0x22, 0xaf, 0x03, 0x0a, 0x11, 0x44, 0x6f, 0x77, 0x6e, 0x67, 0x72, 0x61, 0x64, 0x65, 0x53,
-	0x65, 0x6c, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x12, 0x48, 0x0a, 0x04, 0x74, 0x79, 0x70, 0x65, 0x18,
-	0x01, 0x20, 0x01, 0x28, 0x0e, 0x32, 0x21, 0x2e, 0x68, 0x65, 0x79, 0x70, 0x2e, 0x70, 0x72, 0x6f,
-	0x74, 0x6f, 0x2e, 0x44, 0x6f, 0x77, 0x6e, 0x67, 0x72, 0x61, 0x64, 0x65, 0x53, 0x65, 0x6c, 0x65,
-	0x63, 0x74, 0x6f, 0x72, 0x54, 0x79, 0x70, 0x65, 0x3a, 0x11, 0x44, 0x53, 0x5f, 0x48, 0x45, 0x59,
-	0x50, 0x5f, 0x53, 0x49, 0x47, 0x43, 0x4f, 0x4d, 0x4d, 0x32, 0x30, 0x52, 0x04, 0x74, 0x79, 0x70,
-	0x65, 0x12, 0x2d, 0x0a, 0x0f, 0x64, 0x6f, 0x77, 0x6e, 0x67, 0x72, 0x61, 0x64, 0x65, 0x5f, 0x75,
-	0x73, 0x61, 0x67, 0x65, 0x18, 0x02, 0x20, 0x01, 0x28, 0x08, 0x3a, 0x04, 0x74, 0x72, 0x75, 0x65,
-	0x52, 0x0e, 0x64, 0x6f, 0x77, 0x6e, 0x67, 0x72, 0x61, 0x64, 0x65, 0x55, 0x73, 0x61, 0x67, 0x65,
-	0x12, 0x2c, 0x0a, 0x0e, 0x64, 0x6f, 0x77, 0x6e, 0x67, 0x72, 0x61, 0x64, 0x65, 0x5f, 0x6a, 0x6f,
-	0x62, 0x73, 0x18, 0x03, 0x20, 0x01, 0x28, 0x08, 0x3a, 0x05, 0x66, 0x61, 0x6c, 0x73, 0x65, 0x52,
-	0x0d, 0x64, 0x6f, 0x77, 0x6e, 0x67, 0x72, 0x61, 0x64, 0x65, 0x4a, 0x6f, 0x62, 0x73, 0x12, 0x28,
-	0x0a, 0x0e, 0x74, 0x69, 0x6d, 0x65, 0x5f, 0x6c, 0x69, 0x6d, 0x69, 0x74, 0x5f, 0x73, 0x65, 0x63,
-	0x18, 0x04, 0x20, 0x01, 0x28, 0x01, 0x3a, 0x02, 0x2d, 0x31, 0x52, 0x0c, 0x74, 0x69, 0x6d, 0x65,
-	0x4c, 0x69, 0x6d, 0x69, 0x74, 0x53, 0x65, 0x63, 0x12, 0x58, 0x0a, 0x0e, 0x68, 0x79, 0x62, 0x72,
-	0x69, 0x64, 0x5f, 0x68, 0x61, 0x73, 0x68, 0x69, 0x6e, 0x67, 0x18, 0x05, 0x20, 0x01, 0x28, 0x0b,
-	0x32, 0x31, 0x2e, 0x68, 0x65, 0x79, 0x70, 0x2e, 0x70, 0x72, 0x6f, 0x74, 0x6f, 0x2e, 0x44, 0x6f,
-	0x77, 0x6e, 0x67, 0x72, 0x61, 0x64, 0x65, 0x53, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x2e,
-	0x48, 0x79, 0x62, 0x72, 0x69, 0x64, 0x48, 0x61, 0x73, 0x68, 0x69, 0x6e, 0x67, 0x43, 0x6f, 0x6e,
-	0x66, 0x69, 0x67, 0x52, 0x0d, 0x68, 0x79, 0x62, 0x72, 0x69, 0x64, 0x48, 0x61, 0x73, 0x68, 0x69,
-	0x6e, 0x67, 0x1a, 0x6f, 0x0a, 0x13, 0x48, 0x79, 0x62, 0x72, 0x69, 0x64, 0x48, 0x61, 0x73, 0x68,
-	0x69, 0x6e, 0x67, 0x43, 0x6f, 0x6e, 0x66, 0x69, 0x67, 0x12, 0x2d, 0x0a, 0x10, 0x6e, 0x75, 0x6d,
-	0x5f, 0x64, 0x65, 0x6d, 0x61, 0x6e, 0x64, 0x5f, 0x61, 0x77, 0x61, 0x72, 0x65, 0x18, 0x01, 0x20,
-	0x01, 0x28, 0x05, 0x3a, 0x03, 0x31, 0x30, 0x30, 0x52, 0x0e, 0x6e, 0x75, 0x6d, 0x44, 0x65, 0x6d,
-	0x61, 0x6e, 0x64, 0x41, 0x77, 0x61, 0x72, 0x65, 0x12, 0x29, 0x0a, 0x0e, 0x6d, 0x69, 0x6e, 0x5f,
-	0x71, 0x6f, 0x73, 0x5f, 0x70, 0x69, 0x6e, 0x5f, 0x6d, 0x73, 0x18, 0x02, 0x20, 0x01, 0x28, 0x03,
-	0x3a, 0x04, 0x31, 0x30, 0x30, 0x30, 0x52, 0x0b, 0x6d, 0x69, 0x6e, 0x51, 0x6f, 0x73, 0x50, 0x69,
-	0x6e, 0x4d, 0x73, 0x22, 0xe0, 0x01, 0x0a, 0x17, 0x44, 0x6f, 0x77, 0x6e, 0x67, 0x72, 0x61, 0x64,
-	0x65, 0x46, 0x72, 0x61, 0x63, 0x43, 0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x6c, 0x65, 0x72, 0x12,
-	0x1a, 0x0a, 0x07, 0x6d, 0x61, 0x78, 0x5f, 0x69, 0x6e, 0x63, 0x18, 0x01, 0x20, 0x01, 0x28, 0x01,
-	0x3a, 0x01, 0x31, 0x52, 0x06, 0x6d, 0x61, 0x78, 0x49, 0x6e, 0x63, 0x12, 0x21, 0x0a, 0x09, 0x70,
-	0x72, 0x6f, 0x70, 0x5f, 0x67, 0x61, 0x69, 0x6e, 0x18, 0x02, 0x20, 0x01, 0x28, 0x01, 0x3a, 0x04,
-	0x30, 0x2e, 0x37, 0x35, 0x52, 0x08, 0x70, 0x72, 0x6f, 0x70, 0x47, 0x61, 0x69, 0x6e, 0x12, 0x30,
-	0x0a, 0x14, 0x69, 0x67, 0x6e, 0x6f, 0x72, 0x65, 0x5f, 0x6f, 0x76, 0x65, 0x72, 0x61, 0x67, 0x65,
-	0x5f, 0x62, 0x65, 0x6c, 0x6f, 0x77, 0x18, 0x03, 0x20, 0x01, 0x28, 0x01, 0x52, 0x12, 0x69, 0x67,
-	0x6e, 0x6f, 0x72, 0x65, 0x4f, 0x76, 0x65, 0x72, 0x61, 0x67, 0x65, 0x42, 0x65, 0x6c, 0x6f, 0x77,
-	0x12, 0x54, 0x0a, 0x27, 0x69, 0x67, 0x6e, 0x6f, 0x72, 0x65, 0x5f, 0x6f, 0x76, 0x65, 0x72, 0x61,
-	0x67, 0x65, 0x5f, 0x62, 0x79, 0x5f, 0x63, 0x6f, 0x61, 0x72, 0x73, 0x65, 0x6e, 0x65, 0x73, 0x73,
-	0x5f, 0x6d, 0x75, 0x6c, 0x74, 0x69, 0x70, 0x6c, 0x69, 0x65, 0x72, 0x18, 0x04, 0x20, 0x01, 0x28,
-	0x01, 0x52, 0x23, 0x69, 0x67, 0x6e, 0x6f, 0x72, 0x65, 0x4f, 0x76, 0x65, 0x72, 0x61, 0x67, 0x65,
-	0x42, 0x79, 0x43, 0x6f, 0x61, 0x72, 0x73, 0x65, 0x6e, 0x65, 0x73, 0x73, 0x4d, 0x75, 0x6c, 0x74,
-	0x69, 0x70, 0x6c, 0x69, 0x65, 0x72, 0x22, 0xd7, 0x02, 0x0a, 0x16, 0x46, 0x69, 0x78, 0x65, 0x64,
+	0x74, 0x48, 0x69, 0x70, 0x72, 0x69, 0x12, 0x25, 0x0a, 0x0b, 0x6c, 0x69, 0x6d, 0x69, 0x74, 0x5f,
+	0x6c, 0x6f, 0x70, 0x72, 0x69, 0x18, 0x03, 0x20, 0x01, 0x28, 0x08, 0x3a, 0x04, 0x74, 0x72, 0x75,
+	0x65, 0x52, 0x0a, 0x6c, 0x69, 0x6d, 0x69, 0x74, 0x4c, 0x6f, 0x70, 0x72, 0x69, 0x12, 0x2c, 0x0a,
+	0x12, 0x70, 0x61, 0x63, 0x69, 0x6e, 0x67, 0x5f, 0x62, 0x75, 0x72, 0x73, 0x74, 0x5f, 0x62, 0x79,
+	0x74, 0x65, 0x73, 0x18, 0x04, 0x20, 0x01, 0x28, 0x03, 0x52, 0x10, 0x70, 0x61, 0x63, 0x69, 0x6e,
+	0x67, 0x42, 0x75, 0x72, 0x73, 0x74, 0x42, 0x79, 0x74, 0x65, 0x73, 0x12, 0x34, 0x0a, 0x12, 0x6d,
+	0x69, 0x6e, 0x5f, 0x72, 0x61, 0x74, 0x65, 0x5f, 0x6c, 0x69, 0x6d, 0x69, 0x74, 0x5f, 0x62, 0x70,
+	0x73, 0x18, 0x05, 0x20, 0x01, 0x28, 0x03, 0x3a, 0x07, 0x35, 0x32, 0x34, 0x32, 0x38, 0x38, 0x30,
+	0x52, 0x0f, 0x6d, 0x69, 0x6e, 0x52, 0x61, 0x74, 0x65, 0x4c, 0x69, 0x6d, 0x69, 0x74, 0x42, 0x70,
+	0x73, 0x12, 0x23, 0x0a, 0x0a, 0x64, 0x73, 0x63, 0x70, 0x5f, 0x68, 0x69, 0x70, 0x72, 0x69, 0x18,
+	0x06, 0x20, 0x01, 0x28, 0x09, 0x3a, 0x04, 0x41, 0x46, 0x32, 0x31, 0x52, 0x09, 0x64, 0x73, 0x63,
+	0x70, 0x48, 0x69, 0x70, 0x72, 0x69, 0x12, 0x21, 0x0a, 0x0a, 0x64, 0x73, 0x63, 0x70, 0x5f, 0x6c,
+	0x6f, 0x70, 0x72, 0x69, 0x18, 0x07, 0x20, 0x01, 0x28, 0x09, 0x3a, 0x02, 0x42, 0x45, 0x52, 0x09,
+	0x64, 0x73, 0x63, 0x70, 0x4c, 0x6f, 0x70, 0x72, 0x69, 0x22, 0xe2, 0x02, 0x0a, 0x10, 0x48, 0x6f,
+	0x73, 0x74, 0x44, 0x61, 0x65, 0x6d, 0x6f, 0x6e, 0x43, 0x6f, 0x6e, 0x66, 0x69, 0x67, 0x12, 0x37,
+	0x0a, 0x14, 0x63, 0x6f, 0x6c, 0x6c, 0x65, 0x63, 0x74, 0x5f, 0x73, 0x74, 0x61, 0x74, 0x73, 0x5f,
+	0x70, 0x65, 0x72, 0x69, 0x6f, 0x64, 0x18, 0x01, 0x20, 0x01, 0x28, 0x09, 0x3a, 0x05, 0x35, 0x30,
+	0x30, 0x6d, 0x73, 0x52, 0x12, 0x63, 0x6f, 0x6c, 0x6c, 0x65, 0x63, 0x74, 0x53, 0x74, 0x61, 0x74,
+	0x73, 0x50, 0x65, 0x72, 0x69, 0x6f, 0x64, 0x12, 0x2e, 0x0a, 0x11, 0x69, 0x6e, 0x66, 0x6f, 0x72,
+	0x6d, 0x5f, 0x70, 0x65, 0x72, 0x69, 0x6f, 0x64, 0x5f, 0x64, 0x75, 0x72, 0x18, 0x02, 0x20, 0x01,
+	0x28, 0x09, 0x3a, 0x02, 0x32, 0x73, 0x52, 0x0f, 0x69, 0x6e, 0x66, 0x6f, 0x72, 0x6d, 0x50, 0x65,
+	0x72, 0x69, 0x6f, 0x64, 0x44, 0x75, 0x72, 0x12, 0x2c, 0x0a, 0x12, 0x63, 0x6c, 0x75, 0x73, 0x74,
+	0x65, 0x72, 0x5f, 0x61, 0x67, 0x65, 0x6e, 0x74, 0x5f, 0x61, 0x64, 0x64, 0x72, 0x18, 0x03, 0x20,
+	0x01, 0x28, 0x09, 0x52, 0x10, 0x63, 0x6c, 0x75, 0x73, 0x74, 0x65, 0x72, 0x41, 0x67, 0x65, 0x6e,
+	0x74, 0x41, 0x64, 0x64, 0x72, 0x12, 0x53, 0x0a, 0x24, 0x63, 0x6c, 0x75, 0x73, 0x74, 0x65, 0x72,
+	0x5f, 0x61, 0x67, 0x65, 0x6e, 0x74, 0x5f, 0x63, 0x6f, 0x6e, 0x6e, 0x65, 0x63, 0x74, 0x69, 0x6f,
+	0x6e, 0x5f, 0x74, 0x69, 0x6d, 0x65, 0x6f, 0x75, 0x74, 0x5f, 0x64, 0x75, 0x72, 0x18, 0x04, 0x20,
+	0x01, 0x28, 0x09, 0x3a, 0x03, 0x31, 0x30, 0x73, 0x52, 0x20, 0x63, 0x6c, 0x75, 0x73, 0x74, 0x65,
+	0x72, 0x41, 0x67, 0x65, 0x6e, 0x74, 0x43, 0x6f, 0x6e, 0x6e, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e,
+	0x54, 0x69, 0x6d, 0x65, 0x6f, 0x75, 0x74, 0x44, 0x75, 0x72, 0x12, 0x24, 0x0a, 0x0e, 0x73, 0x74,
+	0x61, 0x74, 0x73, 0x5f, 0x6c, 0x6f, 0x67, 0x5f, 0x66, 0x69, 0x6c, 0x65, 0x18, 0x05, 0x20, 0x01,
+	0x28, 0x09, 0x52, 0x0c, 0x73, 0x74, 0x61, 0x74, 0x73, 0x4c, 0x6f, 0x67, 0x46, 0x69, 0x6c, 0x65,
+	0x12, 0x3c, 0x0a, 0x1b, 0x66, 0x69, 0x6e, 0x65, 0x5f, 0x67, 0x72, 0x61, 0x69, 0x6e, 0x65, 0x64,
+	0x5f, 0x73, 0x74, 0x61, 0x74, 0x73, 0x5f, 0x6c, 0x6f, 0x67, 0x5f, 0x66, 0x69, 0x6c, 0x65, 0x18,
+	0x06, 0x20, 0x01, 0x28, 0x09, 0x52, 0x17, 0x66, 0x69, 0x6e, 0x65, 0x47, 0x72, 0x61, 0x69, 0x6e,
+	0x65, 0x64, 0x53, 0x74, 0x61, 0x74, 0x73, 0x4c, 0x6f, 0x67, 0x46, 0x69, 0x6c, 0x65, 0x22, 0x78,
+	0x0a, 0x09, 0x44, 0x43, 0x4d, 0x61, 0x70, 0x70, 0x69, 0x6e, 0x67, 0x12, 0x35, 0x0a, 0x07, 0x65,
+	0x6e, 0x74, 0x72, 0x69, 0x65, 0x73, 0x18, 0x01, 0x20, 0x03, 0x28, 0x0b, 0x32, 0x1b, 0x2e, 0x68,
+	0x65, 0x79, 0x70, 0x2e, 0x70, 0x72, 0x6f, 0x74, 0x6f, 0x2e, 0x44, 0x43, 0x4d, 0x61, 0x70, 0x70,
+	0x69, 0x6e, 0x67, 0x2e, 0x45, 0x6e, 0x74, 0x72, 0x79, 0x52, 0x07, 0x65, 0x6e, 0x74, 0x72, 0x69,
+	0x65, 0x73, 0x1a, 0x34, 0x0a, 0x05, 0x45, 0x6e, 0x74, 0x72, 0x79, 0x12, 0x1b, 0x0a, 0x09, 0x68,
+	0x6f, 0x73, 0x74, 0x5f, 0x61, 0x64, 0x64, 0x72, 0x18, 0x01, 0x20, 0x01, 0x28, 0x09, 0x52, 0x08,
+	0x68, 0x6f, 0x73, 0x74, 0x41, 0x64, 0x64, 0x72, 0x12, 0x0e, 0x0a, 0x02, 0x64, 0x63, 0x18, 0x02,
+	0x20, 0x01, 0x28, 0x09, 0x52, 0x02, 0x64, 0x63, 0x22, 0x47, 0x0a, 0x14, 0x53, 0x74, 0x61, 0x74,
+	0x69, 0x63, 0x44, 0x43, 0x4d, 0x61, 0x70, 0x70, 0x65, 0x72, 0x43, 0x6f, 0x6e, 0x66, 0x69, 0x67,
+	0x12, 0x2f, 0x0a, 0x07, 0x6d, 0x61, 0x70, 0x70, 0x69, 0x6e, 0x67, 0x18, 0x01, 0x20, 0x01, 0x28,
+	0x0b, 0x32, 0x15, 0x2e, 0x68, 0x65, 0x79, 0x70, 0x2e, 0x70, 0x72, 0x6f, 0x74, 0x6f, 0x2e, 0x44,
+	0x43, 0x4d, 0x61, 0x70, 0x70, 0x69, 0x6e, 0x67, 0x52, 0x07, 0x6d, 0x61, 0x70, 0x70, 0x69, 0x6e,
+	0x67, 0x22, 0xcd, 0x01, 0x0a, 0x0b, 0x4e, 0x65, 0x74, 0x65, 0x6d, 0x43, 0x6f, 0x6e, 0x66, 0x69,
+	0x67, 0x12, 0x19, 0x0a, 0x08, 0x64, 0x65, 0x6c, 0x61, 0x79, 0x5f, 0x6d, 0x73, 0x18, 0x01, 0x20,
+	0x01, 0x28, 0x05, 0x52, 0x07, 0x64, 0x65, 0x6c, 0x61, 0x79, 0x4d, 0x73, 0x12, 0x26, 0x0a, 0x0f,
+	0x64, 0x65, 0x6c, 0x61, 0x79, 0x5f, 0x6a, 0x69, 0x74, 0x74, 0x65, 0x72, 0x5f, 0x6d, 0x73, 0x18,
+	0x02, 0x20, 0x01, 0x28, 0x05, 0x52, 0x0d, 0x64, 0x65, 0x6c, 0x61, 0x79, 0x4a, 0x69, 0x74, 0x74,
+	0x65, 0x72, 0x4d, 0x73, 0x12, 0x32, 0x0a, 0x15, 0x64, 0x65, 0x6c, 0x61, 0x79, 0x5f, 0x63, 0x6f,
+	0x72, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x70, 0x63, 0x74, 0x18, 0x03, 0x20,
+	0x01, 0x28, 0x01, 0x52, 0x13, 0x64, 0x65, 0x6c, 0x61, 0x79, 0x43, 0x6f, 0x72, 0x72, 0x65, 0x6c,
+	0x61, 0x74, 0x69, 0x6f, 0x6e, 0x50, 0x63, 0x74, 0x12, 0x47, 0x0a, 0x0a, 0x64, 0x65, 0x6c, 0x61,
+	0x79, 0x5f, 0x64, 0x69, 0x73, 0x74, 0x18, 0x04, 0x20, 0x01, 0x28, 0x0e, 0x32, 0x1a, 0x2e, 0x68,
+	0x65, 0x79, 0x70, 0x2e, 0x70, 0x72, 0x6f, 0x74, 0x6f, 0x2e, 0x4e, 0x65, 0x74, 0x65, 0x6d, 0x44,
+	0x65, 0x6c, 0x61, 0x79, 0x44, 0x69, 0x73, 0x74, 0x3a, 0x0c, 0x4e, 0x45, 0x54, 0x45, 0x4d, 0x5f,
+	0x4e, 0x4f, 0x52, 0x4d, 0x41, 0x4c, 0x52, 0x09, 0x64, 0x65, 0x6c, 0x61, 0x79, 0x44, 0x69, 0x73,
+	0x74, 0x22, 0xf4, 0x01, 0x0a, 0x12, 0x53, 0x69, 0x6d, 0x75, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x57,
+	0x61, 0x6e, 0x43, 0x6f, 0x6e, 0x66, 0x69, 0x67, 0x12, 0x3e, 0x0a, 0x08, 0x64, 0x63, 0x5f, 0x70,
+	0x61, 0x69, 0x72, 0x73, 0x18, 0x01, 0x20, 0x03, 0x28, 0x0b, 0x32, 0x23, 0x2e, 0x68, 0x65, 0x79,
+	0x70, 0x2e, 0x70, 0x72, 0x6f, 0x74, 0x6f, 0x2e, 0x53, 0x69, 0x6d, 0x75, 0x6c, 0x61, 0x74, 0x65,
+	0x64, 0x57, 0x61, 0x6e, 0x43, 0x6f, 0x6e, 0x66, 0x69, 0x67, 0x2e, 0x50, 0x61, 0x69, 0x72, 0x52,
+	0x07, 0x64, 0x63, 0x50, 0x61, 0x69, 0x72, 0x73, 0x1a, 0x9d, 0x01, 0x0a, 0x04, 0x50, 0x61, 0x69,
+	0x72, 0x12, 0x15, 0x0a, 0x06, 0x73, 0x72, 0x63, 0x5f, 0x64, 0x63, 0x18, 0x01, 0x20, 0x01, 0x28,
+	0x09, 0x52, 0x05, 0x73, 0x72, 0x63, 0x44, 0x63, 0x12, 0x15, 0x0a, 0x06, 0x64, 0x73, 0x74, 0x5f,
+	0x64, 0x63, 0x18, 0x02, 0x20, 0x01, 0x28, 0x09, 0x52, 0x05, 0x64, 0x73, 0x74, 0x44, 0x63, 0x12,
+	0x2d, 0x0a, 0x05, 0x6e, 0x65, 0x74, 0x65, 0x6d, 0x18, 0x03, 0x20, 0x01, 0x28, 0x0b, 0x32, 0x17,
+	0x2e, 0x68, 0x65, 0x79, 0x70, 0x2e, 0x70, 0x72, 0x6f, 0x74, 0x6f, 0x2e, 0x4e, 0x65, 0x74, 0x65,
+	0x6d, 0x43, 0x6f, 0x6e, 0x66, 0x69, 0x67, 0x52, 0x05, 0x6e, 0x65, 0x74, 0x65, 0x6d, 0x12, 0x38,
+	0x0a, 0x0b, 0x6e, 0x65, 0x74, 0x65, 0x6d, 0x5f, 0x6c, 0x6f, 0x70, 0x72, 0x69, 0x18, 0x04, 0x20,
+	0x01, 0x28, 0x0b, 0x32, 0x17, 0x2e, 0x68, 0x65, 0x79, 0x70, 0x2e, 0x70, 0x72, 0x6f, 0x74, 0x6f,
+	0x2e, 0x4e, 0x65, 0x74, 0x65, 0x6d, 0x43, 0x6f, 0x6e, 0x66, 0x69, 0x67, 0x52, 0x0a, 0x6e, 0x65,
+	0x74, 0x65, 0x6d, 0x4c, 0x6f, 0x70, 0x72, 0x69, 0x22, 0xcd, 0x04, 0x0a, 0x0f, 0x48, 0x6f, 0x73,
+	0x74, 0x41, 0x67, 0x65, 0x6e, 0x74, 0x43, 0x6f, 0x6e, 0x66, 0x69, 0x67, 0x12, 0x26, 0x0a, 0x0f,
+	0x74, 0x68, 0x69, 0x73, 0x5f, 0x68, 0x6f, 0x73, 0x74, 0x5f, 0x61, 0x64, 0x64, 0x72, 0x73, 0x18,
+	0x01, 0x20, 0x03, 0x28, 0x09, 0x52, 0x0d, 0x74, 0x68, 0x69, 0x73, 0x48, 0x6f, 0x73, 0x74, 0x41,
+	0x64, 0x64, 0x72, 0x73, 0x12, 0x20, 0x0a, 0x08, 0x6a, 0x6f, 0x62, 0x5f, 0x6e, 0x61, 0x6d, 0x65,
+	0x18, 0x02, 0x20, 0x01, 0x28, 0x09, 0x3a, 0x05, 0x55, 0x4e, 0x53, 0x45, 0x54, 0x52, 0x07, 0x6a,
+	0x6f, 0x62, 0x4e, 0x61, 0x6d, 0x65, 0x12, 0x44, 0x0a, 0x0c, 0x66, 0x6c, 0x6f, 0x77, 0x5f, 0x74,
+	0x72, 0x61, 0x63, 0x6b, 0x65, 0x72, 0x18, 0x03, 0x20, 0x01, 0x28, 0x0b, 0x32, 0x21, 0x2e, 0x68,
+	0x65, 0x79, 0x70, 0x2e, 0x70, 0x72, 0x6f, 0x74, 0x6f, 0x2e, 0x48, 0x6f, 0x73, 0x74, 0x46, 0x6c,
+	0x6f, 0x77, 0x54, 0x72, 0x61, 0x63, 0x6b, 0x65, 0x72, 0x43, 0x6f, 0x6e, 0x66, 0x69, 0x67, 0x52,
+	0x0b, 0x66, 0x6c, 0x6f, 0x77, 0x54, 0x72, 0x61, 0x63, 0x6b, 0x65, 0x72, 0x12, 0x5b, 0x0a, 0x19,
+	0x73, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x5f, 0x74, 0x6f, 0x5f, 0x68, 0x6f, 0x73, 0x74, 0x5f, 0x61,
+	0x67, 0x67, 0x72, 0x65, 0x67, 0x61, 0x74, 0x6f, 0x72, 0x18, 0x04, 0x20, 0x01, 0x28, 0x0b, 0x32,
+	0x20, 0x2e, 0x68, 0x65, 0x79, 0x70, 0x2e, 0x70, 0x72, 0x6f, 0x74, 0x6f, 0x2e, 0x46, 0x6c, 0x6f,
+	0x77, 0x41, 0x67, 0x67, 0x72, 0x65, 0x67, 0x61, 0x74, 0x6f, 0x72, 0x43, 0x6f, 0x6e, 0x66, 0x69,
+	0x67, 0x52, 0x16, 0x73, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x54, 0x6f, 0x48, 0x6f, 0x73, 0x74, 0x41,
+	0x67, 0x67, 0x72, 0x65, 0x67, 0x61, 0x74, 0x6f, 0x72, 0x12, 0x57, 0x0a, 0x13, 0x66, 0x6c, 0x6f,
+	0x77, 0x5f, 0x73, 0x74, 0x61, 0x74, 0x65, 0x5f, 0x72, 0x65, 0x70, 0x6f, 0x72, 0x74, 0x65, 0x72,
+	0x18, 0x05, 0x20, 0x01, 0x28, 0x0b, 0x32, 0x27, 0x2e, 0x68, 0x65, 0x79, 0x70, 0x2e, 0x70, 0x72,
+	0x6f, 0x74, 0x6f, 0x2e, 0x48, 0x6f, 0x73, 0x74, 0x46, 0x6c, 0x6f, 0x77, 0x53, 0x74, 0x61, 0x74,
+	0x65, 0x52, 0x65, 0x70, 0x6f, 0x72, 0x74, 0x65, 0x72, 0x43, 0x6f, 0x6e, 0x66, 0x69, 0x67, 0x52,
+	0x11, 0x66, 0x6c, 0x6f, 0x77, 0x53, 0x74, 0x61, 0x74, 0x65, 0x52, 0x65, 0x70, 0x6f, 0x72, 0x74,
+	0x65, 0x72, 0x12, 0x3a, 0x0a, 0x08, 0x65, 0x6e, 0x66, 0x6f, 0x72, 0x63, 0x65, 0x72, 0x18, 0x06,
+	0x20, 0x01, 0x28, 0x0b, 0x32, 0x1e, 0x2e, 0x68, 0x65, 0x79, 0x70, 0x2e, 0x70, 0x72, 0x6f, 0x74,
+	0x6f, 0x2e, 0x48, 0x6f, 0x73, 0x74, 0x45, 0x6e, 0x66, 0x6f, 0x72, 0x63, 0x65, 0x72, 0x43, 0x6f,
+	0x6e, 0x66, 0x69, 0x67, 0x52, 0x08, 0x65, 0x6e, 0x66, 0x6f, 0x72, 0x63, 0x65, 0x72, 0x12, 0x34,
+	0x0a, 0x06, 0x64, 0x61, 0x65, 0x6d, 0x6f, 0x6e, 0x18, 0x07, 0x20, 0x01, 0x28, 0x0b, 0x32, 0x1c,
+	0x2e, 0x68, 0x65, 0x79, 0x70, 0x2e, 0x70, 0x72, 0x6f, 0x74, 0x6f, 0x2e, 0x48, 0x6f, 0x73, 0x74,
+	0x44, 0x61, 0x65, 0x6d, 0x6f, 0x6e, 0x43, 0x6f, 0x6e, 0x66, 0x69, 0x67, 0x52, 0x06, 0x64, 0x61,
+	0x65, 0x6d, 0x6f, 0x6e, 0x12, 0x3d, 0x0a, 0x09, 0x64, 0x63, 0x5f, 0x6d, 0x61, 0x70, 0x70, 0x65,
+	0x72, 0x18, 0x08, 0x20, 0x01, 0x28, 0x0b, 0x32, 0x20, 0x2e, 0x68, 0x65, 0x79, 0x70, 0x2e, 0x70,
+	0x72, 0x6f, 0x74, 0x6f, 0x2e, 0x53, 0x74, 0x61, 0x74, 0x69, 0x63, 0x44, 0x43, 0x4d, 0x61, 0x70,
+	0x70, 0x65, 0x72, 0x43, 0x6f, 0x6e, 0x66, 0x69, 0x67, 0x52, 0x08, 0x64, 0x63, 0x4d, 0x61, 0x70,
+	0x70, 0x65, 0x72, 0x12, 0x43, 0x0a, 0x0d, 0x73, 0x69, 0x6d, 0x75, 0x6c, 0x61, 0x74, 0x65, 0x64,
+	0x5f, 0x77, 0x61, 0x6e, 0x18, 0x09, 0x20, 0x01, 0x28, 0x0b, 0x32, 0x1e, 0x2e, 0x68, 0x65, 0x79,
+	0x70, 0x2e, 0x70, 0x72, 0x6f, 0x74, 0x6f, 0x2e, 0x53, 0x69, 0x6d, 0x75, 0x6c, 0x61, 0x74, 0x65,
+	0x64, 0x57, 0x61, 0x6e, 0x43, 0x6f, 0x6e, 0x66, 0x69, 0x67, 0x52, 0x0c, 0x73, 0x69, 0x6d, 0x75,
+	0x6c, 0x61, 0x74, 0x65, 0x64, 0x57, 0x61, 0x6e, 0x22, 0xaf, 0x03, 0x0a, 0x11, 0x44, 0x6f, 0x77,
+	0x6e, 0x67, 0x72, 0x61, 0x64, 0x65, 0x53, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x12, 0x48,
+	0x0a, 0x04, 0x74, 0x79, 0x70, 0x65, 0x18, 0x01, 0x20, 0x01, 0x28, 0x0e, 0x32, 0x21, 0x2e, 0x68,
+	0x65, 0x79, 0x70, 0x2e, 0x70, 0x72, 0x6f, 0x74, 0x6f, 0x2e, 0x44, 0x6f, 0x77, 0x6e, 0x67, 0x72,
+	0x61, 0x64, 0x65, 0x53, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x54, 0x79, 0x70, 0x65, 0x3a,
+	0x11, 0x44, 0x53, 0x5f, 0x48, 0x45, 0x59, 0x50, 0x5f, 0x53, 0x49, 0x47, 0x43, 0x4f, 0x4d, 0x4d,
+	0x32, 0x30, 0x52, 0x04, 0x74, 0x79, 0x70, 0x65, 0x12, 0x2d, 0x0a, 0x0f, 0x64, 0x6f, 0x77, 0x6e,
+	0x67, 0x72, 0x61, 0x64, 0x65, 0x5f, 0x75, 0x73, 0x61, 0x67, 0x65, 0x18, 0x02, 0x20, 0x01, 0x28,
+	0x08, 0x3a, 0x04, 0x74, 0x72, 0x75, 0x65, 0x52, 0x0e, 0x64, 0x6f, 0x77, 0x6e, 0x67, 0x72, 0x61,
+	0x64, 0x65, 0x55, 0x73, 0x61, 0x67, 0x65, 0x12, 0x2c, 0x0a, 0x0e, 0x64, 0x6f, 0x77, 0x6e, 0x67,
+	0x72, 0x61, 0x64, 0x65, 0x5f, 0x6a, 0x6f, 0x62, 0x73, 0x18, 0x03, 0x20, 0x01, 0x28, 0x08, 0x3a,
+	0x05, 0x66, 0x61, 0x6c, 0x73, 0x65, 0x52, 0x0d, 0x64, 0x6f, 0x77, 0x6e, 0x67, 0x72, 0x61, 0x64,
+	0x65, 0x4a, 0x6f, 0x62, 0x73, 0x12, 0x28, 0x0a, 0x0e, 0x74, 0x69, 0x6d, 0x65, 0x5f, 0x6c, 0x69,
+	0x6d, 0x69, 0x74, 0x5f, 0x73, 0x65, 0x63, 0x18, 0x04, 0x20, 0x01, 0x28, 0x01, 0x3a, 0x02, 0x2d,
+	0x31, 0x52, 0x0c, 0x74, 0x69, 0x6d, 0x65, 0x4c, 0x69, 0x6d, 0x69, 0x74, 0x53, 0x65, 0x63, 0x12,
+	0x58, 0x0a, 0x0e, 0x68, 0x79, 0x62, 0x72, 0x69, 0x64, 0x5f, 0x68, 0x61, 0x73, 0x68, 0x69, 0x6e,
+	0x67, 0x18, 0x05, 0x20, 0x01, 0x28, 0x0b, 0x32, 0x31, 0x2e, 0x68, 0x65, 0x79, 0x70, 0x2e, 0x70,
+	0x72, 0x6f, 0x74, 0x6f, 0x2e, 0x44, 0x6f, 0x77, 0x6e, 0x67, 0x72, 0x61, 0x64, 0x65, 0x53, 0x65,
+	0x6c, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x2e, 0x48, 0x79, 0x62, 0x72, 0x69, 0x64, 0x48, 0x61, 0x73,
+	0x68, 0x69, 0x6e, 0x67, 0x43, 0x6f, 0x6e, 0x66, 0x69, 0x67, 0x52, 0x0d, 0x68, 0x79, 0x62, 0x72,
+	0x69, 0x64, 0x48, 0x61, 0x73, 0x68, 0x69, 0x6e, 0x67, 0x1a, 0x6f, 0x0a, 0x13, 0x48, 0x79, 0x62,
+	0x72, 0x69, 0x64, 0x48, 0x61, 0x73, 0x68, 0x69, 0x6e, 0x67, 0x43, 0x6f, 0x6e, 0x66, 0x69, 0x67,
+	0x12, 0x2d, 0x0a, 0x10, 0x6e, 0x75, 0x6d, 0x5f, 0x64, 0x65, 0x6d, 0x61, 0x6e, 0x64, 0x5f, 0x61,
+	0x77, 0x61, 0x72, 0x65, 0x18, 0x01, 0x20, 0x01, 0x28, 0x05, 0x3a, 0x03, 0x31, 0x30, 0x30, 0x52,
+	0x0e, 0x6e, 0x75, 0x6d, 0x44, 0x65, 0x6d, 0x61, 0x6e, 0x64, 0x41, 0x77, 0x61, 0x72, 0x65, 0x12,
+	0x29, 0x0a, 0x0e, 0x6d, 0x69, 0x6e, 0x5f, 0x71, 0x6f, 0x73, 0x5f, 0x70, 0x69, 0x6e, 0x5f, 0x6d,
+	0x73, 0x18, 0x02, 0x20, 0x01, 0x28, 0x03, 0x3a, 0x04, 0x31, 0x30, 0x30, 0x30, 0x52, 0x0b, 0x6d,
+	0x69, 0x6e, 0x51, 0x6f, 0x73, 0x50, 0x69, 0x6e, 0x4d, 0x73, 0x22, 0xe0, 0x01, 0x0a, 0x17, 0x44,
+	0x6f, 0x77, 0x6e, 0x67, 0x72, 0x61, 0x64, 0x65, 0x46, 0x72, 0x61, 0x63, 0x43, 0x6f, 0x6e, 0x74,
+	0x72, 0x6f, 0x6c, 0x6c, 0x65, 0x72, 0x12, 0x1a, 0x0a, 0x07, 0x6d, 0x61, 0x78, 0x5f, 0x69, 0x6e,
+	0x63, 0x18, 0x01, 0x20, 0x01, 0x28, 0x01, 0x3a, 0x01, 0x31, 0x52, 0x06, 0x6d, 0x61, 0x78, 0x49,
+	0x6e, 0x63, 0x12, 0x21, 0x0a, 0x09, 0x70, 0x72, 0x6f, 0x70, 0x5f, 0x67, 0x61, 0x69, 0x6e, 0x18,
+	0x02, 0x20, 0x01, 0x28, 0x01, 0x3a, 0x04, 0x30, 0x2e, 0x37, 0x35, 0x52, 0x08, 0x70, 0x72, 0x6f,
+	0x70, 0x47, 0x61, 0x69, 0x6e, 0x12, 0x30, 0x0a, 0x14, 0x69, 0x67, 0x6e, 0x6f, 0x72, 0x65, 0x5f,
+	0x6f, 0x76, 0x65, 0x72, 0x61, 0x67, 0x65, 0x5f, 0x62, 0x65, 0x6c, 0x6f, 0x77, 0x18, 0x03, 0x20,
+	0x01, 0x28, 0x01, 0x52, 0x12, 0x69, 0x67, 0x6e, 0x6f, 0x72, 0x65, 0x4f, 0x76, 0x65, 0x72, 0x61,
+	0x67, 0x65, 0x42, 0x65, 0x6c, 0x6f, 0x77, 0x12, 0x54, 0x0a, 0x27, 0x69, 0x67, 0x6e, 0x6f, 0x72,
+	0x65, 0x5f, 0x6f, 0x76, 0x65, 0x72, 0x61, 0x67, 0x65, 0x5f, 0x62, 0x79, 0x5f, 0x63, 0x6f, 0x61,
+	0x72, 0x73, 0x65, 0x6e, 0x65, 0x73, 0x73, 0x5f, 0x6d, 0x75, 0x6c, 0x74, 0x69, 0x70, 0x6c, 0x69,
+	0x65, 0x72, 0x18, 0x04, 0x20, 0x01, 0x28, 0x01, 0x52, 0x23, 0x69, 0x67, 0x6e, 0x6f, 0x72, 0x65,
+	0x4f, 0x76, 0x65, 0x72, 0x61, 0x67, 0x65, 0x42, 0x79, 0x43, 0x6f, 0x61, 0x72, 0x73, 0x65, 0x6e,
+	0x65, 0x73, 0x73, 0x4d, 0x75, 0x6c, 0x74, 0x69, 0x70, 0x6c, 0x69, 0x65, 0x72, 0x22, 0xd7, 0x02,
+	0x0a, 0x16, 0x46, 0x69, 0x78, 0x65, 0x64, 0x43, 0x6c, 0x75, 0x73, 0x74, 0x65, 0x72, 0x48, 0x6f,
+	0x73, 0x74, 0x41, 0x6c, 0x6c, 0x6f, 0x63, 0x73, 0x12, 0x30, 0x0a, 0x07, 0x63, 0x6c, 0x75, 0x73,
+	0x74, 0x65, 0x72, 0x18, 0x01, 0x20, 0x01, 0x28, 0x0b, 0x32, 0x16, 0x2e, 0x68, 0x65, 0x79, 0x70,
+	0x2e, 0x70, 0x72, 0x6f, 0x74, 0x6f, 0x2e, 0x46, 0x6c, 0x6f, 0x77, 0x4d, 0x61, 0x72, 0x6b, 0x65,
+	0x72, 0x52, 0x07, 0x63, 0x6c, 0x75, 0x73, 0x74, 0x65, 0x72, 0x12, 0x49, 0x0a, 0x09, 0x73, 0x6e,
+	0x61, 0x70, 0x73, 0x68, 0x6f, 0x74, 0x73, 0x18, 0x02, 0x20, 0x03, 0x28, 0x0b, 0x32, 0x2b, 0x2e,
+	0x68, 0x65, 0x79, 0x70, 0x2e, 0x70, 0x72, 0x6f, 0x74, 0x6f, 0x2e, 0x46, 0x69, 0x78, 0x65, 0x64,
 	0x43, 0x6c, 0x75, 0x73, 0x74, 0x65, 0x72, 0x48, 0x6f, 0x73, 0x74, 0x41, 0x6c, 0x6c, 0x6f, 0x63,
-	0x73, 0x12, 0x30, 0x0a, 0x07, 0x63, 0x6c, 0x75, 0x73, 0x74, 0x65, 0x72, 0x18, 0x01, 0x20, 0x01,
-	0x28, 0x0b, 0x32, 0x16, 0x2e, 0x68, 0x65, 0x79, 0x70, 0x2e, 0x70, 0x72, 0x6f, 0x74, 0x6f, 0x2e,
-	0x46, 0x6c, 0x6f, 0x77, 0x4d, 0x61, 0x72, 0x6b, 0x65, 0x72, 0x52, 0x07, 0x63, 0x6c, 0x75, 0x73,
-	0x74, 0x65, 0x72, 0x12, 0x49, 0x0a, 0x09, 0x73, 0x6e, 0x61, 0x70, 0x73, 0x68, 0x6f, 0x74, 0x73,
-	0x18, 0x02, 0x20, 0x03, 0x28, 0x0b, 0x32, 0x2b, 0x2e, 0x68, 0x65, 0x79, 0x70, 0x2e, 0x70, 0x72,
-	0x6f, 0x74, 0x6f, 0x2e, 0x46, 0x69, 0x78, 0x65, 0x64, 0x43, 0x6c, 0x75, 0x73, 0x74, 0x65, 0x72,
-	0x48, 0x6f, 0x73, 0x74, 0x41, 0x6c, 0x6c, 0x6f, 0x63, 0x73, 0x2e, 0x53, 0x6e, 0x61, 0x70, 0x73,
-	0x68, 0x6f, 0x74, 0x52, 0x09, 0x73, 0x6e, 0x61, 0x70, 0x73, 0x68, 0x6f, 0x74, 0x73, 0x1a, 0x5d,
-	0x0a, 0x11, 0x46, 0x6c, 0x6f, 0x77, 0x41, 0x6c, 0x6c, 0x6f, 0x63, 0x41, 0x6e, 0x64, 0x43, 0x6f,
-	0x75, 0x6e, 0x74, 0x12, 0x2b, 0x0a, 0x05, 0x61, 0x6c, 0x6c, 0x6f, 0x63, 0x18, 0x01, 0x20, 0x01,
-	0x28, 0x0b, 0x32, 0x15, 0x2e, 0x68, 0x65, 0x79, 0x70, 0x2e, 0x70, 0x72, 0x6f, 0x74, 0x6f, 0x2e,
-	0x46, 0x6c, 0x6f, 0x77, 0x41, 0x6c, 0x6c, 0x6f, 0x63, 0x52, 0x05, 0x61, 0x6c, 0x6c, 0x6f, 0x63,
-	0x12, 0x1b, 0x0a, 0x09, 0x6e, 0x75, 0x6d, 0x5f, 0x68, 0x6f, 0x73, 0x74, 0x73, 0x18, 0x02, 0x20,
-	0x01, 0x28, 0x05, 0x52, 0x08, 0x6e, 0x75, 0x6d, 0x48, 0x6f, 0x73, 0x74, 0x73, 0x1a, 0x61, 0x0a,
-	0x08, 0x53, 0x6e, 0x61, 0x70, 0x73, 0x68, 0x6f, 0x74, 0x12, 0x55, 0x0a, 0x0b, 0x68, 0x6f, 0x73,
-	0x74, 0x5f, 0x61, 0x6c, 0x6c, 0x6f, 0x63, 0x73, 0x18, 0x01, 0x20, 0x03, 0x28, 0x0b, 0x32, 0x34,
+	0x73, 0x2e, 0x53, 0x6e, 0x61, 0x70, 0x73, 0x68, 0x6f, 0x74, 0x52, 0x09, 0x73, 0x6e, 0x61, 0x70,
+	0x73, 0x68, 0x6f, 0x74, 0x73, 0x1a, 0x5d, 0x0a, 0x11, 0x46, 0x6c, 0x6f, 0x77, 0x41, 0x6c, 0x6c,
+	0x6f, 0x63, 0x41, 0x6e, 0x64, 0x43, 0x6f, 0x75, 0x6e, 0x74, 0x12, 0x2b, 0x0a, 0x05, 0x61, 0x6c,
+	0x6c, 0x6f, 0x63, 0x18, 0x01, 0x20, 0x01, 0x28, 0x0b, 0x32, 0x15, 0x2e, 0x68, 0x65, 0x79, 0x70,
+	0x2e, 0x70, 0x72, 0x6f, 0x74, 0x6f, 0x2e, 0x46, 0x6c, 0x6f, 0x77, 0x41, 0x6c, 0x6c, 0x6f, 0x63,
+	0x52, 0x05, 0x61, 0x6c, 0x6c, 0x6f, 0x63, 0x12, 0x1b, 0x0a, 0x09, 0x6e, 0x75, 0x6d, 0x5f, 0x68,
+	0x6f, 0x73, 0x74, 0x73, 0x18, 0x02, 0x20, 0x01, 0x28, 0x05, 0x52, 0x08, 0x6e, 0x75, 0x6d, 0x48,
+	0x6f, 0x73, 0x74, 0x73, 0x1a, 0x61, 0x0a, 0x08, 0x53, 0x6e, 0x61, 0x70, 0x73, 0x68, 0x6f, 0x74,
+	0x12, 0x55, 0x0a, 0x0b, 0x68, 0x6f, 0x73, 0x74, 0x5f, 0x61, 0x6c, 0x6c, 0x6f, 0x63, 0x73, 0x18,
+	0x01, 0x20, 0x03, 0x28, 0x0b, 0x32, 0x34, 0x2e, 0x68, 0x65, 0x79, 0x70, 0x2e, 0x70, 0x72, 0x6f,
+	0x74, 0x6f, 0x2e, 0x46, 0x69, 0x78, 0x65, 0x64, 0x43, 0x6c, 0x75, 0x73, 0x74, 0x65, 0x72, 0x48,
+	0x6f, 0x73, 0x74, 0x41, 0x6c, 0x6c, 0x6f, 0x63, 0x73, 0x2e, 0x46, 0x6c, 0x6f, 0x77, 0x41, 0x6c,
+	0x6c, 0x6f, 0x63, 0x41, 0x6e, 0x64, 0x43, 0x6f, 0x75, 0x6e, 0x74, 0x52, 0x0a, 0x68, 0x6f, 0x73,
+	0x74, 0x41, 0x6c, 0x6c, 0x6f, 0x63, 0x73, 0x22, 0xa0, 0x06, 0x0a, 0x16, 0x43, 0x6c, 0x75, 0x73,
+	0x74, 0x65, 0x72, 0x41, 0x6c, 0x6c, 0x6f, 0x63, 0x61, 0x74, 0x6f, 0x72, 0x43, 0x6f, 0x6e, 0x66,
+	0x69, 0x67, 0x12, 0x3c, 0x0a, 0x04, 0x74, 0x79, 0x70, 0x65, 0x18, 0x01, 0x20, 0x01, 0x28, 0x0e,
+	0x32, 0x20, 0x2e, 0x68, 0x65, 0x79, 0x70, 0x2e, 0x70, 0x72, 0x6f, 0x74, 0x6f, 0x2e, 0x43, 0x6c,
+	0x75, 0x73, 0x74, 0x65, 0x72, 0x41, 0x6c, 0x6c, 0x6f, 0x63, 0x61, 0x74, 0x6f, 0x72, 0x54, 0x79,
+	0x70, 0x65, 0x3a, 0x06, 0x43, 0x41, 0x5f, 0x42, 0x57, 0x45, 0x52, 0x04, 0x74, 0x79, 0x70, 0x65,
+	0x12, 0x31, 0x0a, 0x11, 0x65, 0x6e, 0x61, 0x62, 0x6c, 0x65, 0x5f, 0x62, 0x75, 0x72, 0x73, 0x74,
+	0x69, 0x6e, 0x65, 0x73, 0x73, 0x18, 0x02, 0x20, 0x01, 0x28, 0x08, 0x3a, 0x04, 0x74, 0x72, 0x75,
+	0x65, 0x52, 0x10, 0x65, 0x6e, 0x61, 0x62, 0x6c, 0x65, 0x42, 0x75, 0x72, 0x73, 0x74, 0x69, 0x6e,
+	0x65, 0x73, 0x73, 0x12, 0x27, 0x0a, 0x0c, 0x65, 0x6e, 0x61, 0x62, 0x6c, 0x65, 0x5f, 0x62, 0x6f,
+	0x6e, 0x75, 0x73, 0x18, 0x03, 0x20, 0x01, 0x28, 0x08, 0x3a, 0x04, 0x74, 0x72, 0x75, 0x65, 0x52,
+	0x0b, 0x65, 0x6e, 0x61, 0x62, 0x6c, 0x65, 0x42, 0x6f, 0x6e, 0x75, 0x73, 0x12, 0x2b, 0x0a, 0x0e,
+	0x6f, 0x76, 0x65, 0x72, 0x73, 0x75, 0x62, 0x5f, 0x66, 0x61, 0x63, 0x74, 0x6f, 0x72, 0x18, 0x04,
+	0x20, 0x01, 0x28, 0x01, 0x3a, 0x04, 0x31, 0x2e, 0x31, 0x35, 0x52, 0x0d, 0x6f, 0x76, 0x65, 0x72,
+	0x73, 0x75, 0x62, 0x46, 0x61, 0x63, 0x74, 0x6f, 0x72, 0x12, 0x4c, 0x0a, 0x12, 0x64, 0x6f, 0x77,
+	0x6e, 0x67, 0x72, 0x61, 0x64, 0x65, 0x5f, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x18,
+	0x05, 0x20, 0x01, 0x28, 0x0b, 0x32, 0x1d, 0x2e, 0x68, 0x65, 0x79, 0x70, 0x2e, 0x70, 0x72, 0x6f,
+	0x74, 0x6f, 0x2e, 0x44, 0x6f, 0x77, 0x6e, 0x67, 0x72, 0x61, 0x64, 0x65, 0x53, 0x65, 0x6c, 0x65,
+	0x63, 0x74, 0x6f, 0x72, 0x52, 0x11, 0x64, 0x6f, 0x77, 0x6e, 0x67, 0x72, 0x61, 0x64, 0x65, 0x53,
+	0x65, 0x6c, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x12, 0x5f, 0x0a, 0x19, 0x64, 0x6f, 0x77, 0x6e, 0x67,
+	0x72, 0x61, 0x64, 0x65, 0x5f, 0x66, 0x72, 0x61, 0x63, 0x5f, 0x63, 0x6f, 0x6e, 0x74, 0x72, 0x6f,
+	0x6c, 0x6c, 0x65, 0x72, 0x18, 0x06, 0x20, 0x01, 0x28, 0x0b, 0x32, 0x23, 0x2e, 0x68, 0x65, 0x79,
+	0x70, 0x2e, 0x70, 0x72, 0x6f, 0x74, 0x6f, 0x2e, 0x44, 0x6f, 0x77, 0x6e, 0x67, 0x72, 0x61, 0x64,
+	0x65, 0x46, 0x72, 0x61, 0x63, 0x43, 0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x6c, 0x65, 0x72, 0x52,
+	0x17, 0x64, 0x6f, 0x77, 0x6e, 0x67, 0x72, 0x61, 0x64, 0x65, 0x46, 0x72, 0x61, 0x63, 0x43, 0x6f,
+	0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x6c, 0x65, 0x72, 0x12, 0x6d, 0x0a, 0x32, 0x68, 0x65, 0x79, 0x70,
+	0x5f, 0x61, 0x63, 0x63, 0x65, 0x70, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x5f, 0x6d, 0x65, 0x61, 0x73,
+	0x75, 0x72, 0x65, 0x64, 0x5f, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x5f, 0x6f, 0x76, 0x65, 0x72, 0x5f,
+	0x69, 0x6e, 0x74, 0x65, 0x6e, 0x64, 0x65, 0x64, 0x5f, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x18, 0x07,
+	0x20, 0x01, 0x28, 0x01, 0x3a, 0x03, 0x30, 0x2e, 0x39, 0x52, 0x2c, 0x68, 0x65, 0x79, 0x70, 0x41,
+	0x63, 0x63, 0x65, 0x70, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x4d, 0x65, 0x61, 0x73, 0x75, 0x72, 0x65,
+	0x64, 0x52, 0x61, 0x74, 0x69, 0x6f, 0x4f, 0x76, 0x65, 0x72, 0x49, 0x6e, 0x74, 0x65, 0x6e, 0x64,
+	0x65, 0x64, 0x52, 0x61, 0x74, 0x69, 0x6f, 0x12, 0x4a, 0x0a, 0x1f, 0x68, 0x65, 0x79, 0x70, 0x5f,
+	0x70, 0x72, 0x6f, 0x62, 0x65, 0x5f, 0x6c, 0x6f, 0x70, 0x72, 0x69, 0x5f, 0x77, 0x68, 0x65, 0x6e,
+	0x5f, 0x61, 0x6d, 0x62, 0x69, 0x67, 0x75, 0x6f, 0x75, 0x73, 0x18, 0x08, 0x20, 0x01, 0x28, 0x08,
+	0x3a, 0x04, 0x74, 0x72, 0x75, 0x65, 0x52, 0x1b, 0x68, 0x65, 0x79, 0x70, 0x50, 0x72, 0x6f, 0x62,
+	0x65, 0x4c, 0x6f, 0x70, 0x72, 0x69, 0x57, 0x68, 0x65, 0x6e, 0x41, 0x6d, 0x62, 0x69, 0x67, 0x75,
+	0x6f, 0x75, 0x73, 0x12, 0x76, 0x0a, 0x1f, 0x73, 0x69, 0x6d, 0x70, 0x6c, 0x65, 0x5f, 0x64, 0x6f,
+	0x77, 0x6e, 0x67, 0x72, 0x61, 0x64, 0x65, 0x5f, 0x74, 0x68, 0x72, 0x6f, 0x74, 0x74, 0x6c, 0x65,
+	0x5f, 0x68, 0x69, 0x70, 0x72, 0x69, 0x18, 0x09, 0x20, 0x01, 0x28, 0x0e, 0x32, 0x23, 0x2e, 0x68,
+	0x65, 0x79, 0x70, 0x2e, 0x70, 0x72, 0x6f, 0x74, 0x6f, 0x2e, 0x48, 0x69, 0x70, 0x72, 0x69, 0x54,
+	0x68, 0x72, 0x6f, 0x74, 0x74, 0x6c, 0x65, 0x43, 0x6f, 0x6e, 0x64, 0x69, 0x74, 0x69, 0x6f, 0x6e,
+	0x73, 0x3a, 0x0a, 0x48, 0x54, 0x43, 0x5f, 0x41, 0x4c, 0x57, 0x41, 0x59, 0x53, 0x52, 0x1c, 0x73,
+	0x69, 0x6d, 0x70, 0x6c, 0x65, 0x44, 0x6f, 0x77, 0x6e, 0x67, 0x72, 0x61, 0x64, 0x65, 0x54, 0x68,
+	0x72, 0x6f, 0x74, 0x74, 0x6c, 0x65, 0x48, 0x69, 0x70, 0x72, 0x69, 0x12, 0x5d, 0x0a, 0x19, 0x66,
+	0x69, 0x78, 0x65, 0x64, 0x5f, 0x68, 0x6f, 0x73, 0x74, 0x5f, 0x61, 0x6c, 0x6c, 0x6f, 0x63, 0x5f,
+	0x70, 0x61, 0x74, 0x74, 0x65, 0x72, 0x6e, 0x73, 0x18, 0x0a, 0x20, 0x03, 0x28, 0x0b, 0x32, 0x22,
 	0x2e, 0x68, 0x65, 0x79, 0x70, 0x2e, 0x70, 0x72, 0x6f, 0x74, 0x6f, 0x2e, 0x46, 0x69, 0x78, 0x65,
 	0x64, 0x43, 0x6c, 0x75, 0x73, 0x74, 0x65, 0x72, 0x48, 0x6f, 0x73, 0x74, 0x41, 0x6c, 0x6c, 0x6f,
-	0x63, 0x73, 0x2e, 0x46, 0x6c, 0x6f, 0x77, 0x41, 0x6c, 0x6c, 0x6f, 0x63, 0x41, 0x6e, 0x64, 0x43,
-	0x6f, 0x75, 0x6e, 0x74, 0x52, 0x0a, 0x68, 0x6f, 0x73, 0x74, 0x41, 0x6c, 0x6c, 0x6f, 0x63, 0x73,
-	0x22, 0xa0, 0x06, 0x0a, 0x16, 0x43, 0x6c, 0x75, 0x73, 0x74, 0x65, 0x72, 0x41, 0x6c, 0x6c, 0x6f,
-	0x63, 0x61, 0x74, 0x6f, 0x72, 0x43, 0x6f, 0x6e, 0x66, 0x69, 0x67, 0x12, 0x3c, 0x0a, 0x04, 0x74,
-	0x79, 0x70, 0x65, 0x18, 0x01, 0x20, 0x01, 0x28, 0x0e, 0x32, 0x20, 0x2e, 0x68, 0x65, 0x79, 0x70,
-	0x2e, 0x70, 0x72, 0x6f, 0x74, 0x6f, 0x2e, 0x43, 0x6c, 0x75, 0x73, 0x74, 0x65, 0x72, 0x41, 0x6c,
-	0x6c, 0x6f, 0x63, 0x61, 0x74, 0x6f, 0x72, 0x54, 0x79, 0x70, 0x65, 0x3a, 0x06, 0x43, 0x41, 0x5f,
-	0x42, 0x57, 0x45, 0x52, 0x04, 0x74, 0x79, 0x70, 0x65, 0x12, 0x31, 0x0a, 0x11, 0x65, 0x6e, 0x61,
-	0x62, 0x6c, 0x65, 0x5f, 0x62, 0x75, 0x72, 0x73, 0x74, 0x69, 0x6e, 0x65, 0x73, 0x73, 0x18, 0x02,
-	0x20, 0x01, 0x28, 0x08, 0x3a, 0x04, 0x74, 0x72, 0x75, 0x65, 0x52, 0x10, 0x65, 0x6e, 0x61, 0x62,
-	0x6c, 0x65, 0x42, 0x75, 0x72, 0x73, 0x74, 0x69, 0x6e, 0x65, 0x73, 0x73, 0x12, 0x27, 0x0a, 0x0c,
-	0x65, 0x6e, 0x61, 0x62, 0x6c, 0x65, 0x5f, 0x62, 0x6f, 0x6e, 0x75, 0x73, 0x18, 0x03, 0x20, 0x01,
-	0x28, 0x08, 0x3a, 0x04, 0x74, 0x72, 0x75, 0x65, 0x52, 0x0b, 0x65, 0x6e, 0x61, 0x62, 0x6c, 0x65,
-	0x42, 0x6f, 0x6e, 0x75, 0x73, 0x12, 0x2b, 0x0a, 0x0e, 0x6f, 0x76, 0x65, 0x72, 0x73, 0x75, 0x62,
-	0x5f, 0x66, 0x61, 0x63, 0x74, 0x6f, 0x72, 0x18, 0x04, 0x20, 0x01, 0x28, 0x01, 0x3a, 0x04, 0x31,
-	0x2e, 0x31, 0x35, 0x52, 0x0d, 0x6f, 0x76, 0x65, 0x72, 0x73, 0x75, 0x62, 0x46, 0x61, 0x63, 0x74,
-	0x6f, 0x72, 0x12, 0x4c, 0x0a, 0x12, 0x64, 0x6f, 0x77, 0x6e, 0x67, 0x72, 0x61, 0x64, 0x65, 0x5f,
-	0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x18, 0x05, 0x20, 0x01, 0x28, 0x0b, 0x32, 0x1d,
-	0x2e, 0x68, 0x65, 0x79, 0x70, 0x2e, 0x70, 0x72, 0x6f, 0x74, 0x6f, 0x2e, 0x44, 0x6f, 0x77, 0x6e,
-	0x67, 0x72, 0x61, 0x64, 0x65, 0x53, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x52, 0x11, 0x64,
-	0x6f, 0x77, 0x6e, 0x67, 0x72, 0x61, 0x64, 0x65, 0x53, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x6f, 0x72,
+	0x63, 0x73, 0x52, 0x16, 0x66, 0x69, 0x78, 0x65, 0x64, 0x48, 0x6f, 0x73, 0x74, 0x41, 0x6c, 0x6c,
+	0x6f, 0x63, 0x50, 0x61, 0x74, 0x74, 0x65, 0x72, 0x6e, 0x73, 0x22, 0x97, 0x02, 0x0a, 0x13, 0x43,
+	0x6c, 0x75, 0x73, 0x74, 0x65, 0x72, 0x53, 0x65, 0x72, 0x76, 0x65, 0x72, 0x43, 0x6f, 0x6e, 0x66,
+	0x69, 0x67, 0x12, 0x1c, 0x0a, 0x09, 0x61, 0x64, 0x64, 0x72, 0x65, 0x73, 0x73, 0x65, 0x73, 0x18,
+	0x01, 0x20, 0x03, 0x28, 0x09, 0x52, 0x09, 0x61, 0x64, 0x64, 0x72, 0x65, 0x73, 0x73, 0x65, 0x73,
+	0x12, 0x29, 0x0a, 0x0e, 0x63, 0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x5f, 0x70, 0x65, 0x72, 0x69,
+	0x6f, 0x64, 0x18, 0x02, 0x20, 0x01, 0x28, 0x09, 0x3a, 0x02, 0x35, 0x73, 0x52, 0x0d, 0x63, 0x6f,
+	0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x50, 0x65, 0x72, 0x69, 0x6f, 0x64, 0x12, 0x2f, 0x0a, 0x12, 0x6e,
+	0x75, 0x6d, 0x5f, 0x69, 0x6e, 0x67, 0x65, 0x73, 0x74, 0x5f, 0x77, 0x6f, 0x72, 0x6b, 0x65, 0x72,
+	0x73, 0x18, 0x03, 0x20, 0x01, 0x28, 0x05, 0x3a, 0x01, 0x30, 0x52, 0x10, 0x6e, 0x75, 0x6d, 0x49,
+	0x6e, 0x67, 0x65, 0x73, 0x74, 0x57, 0x6f, 0x72, 0x6b, 0x65, 0x72, 0x73, 0x12, 0x38, 0x0a, 0x15,
+	0x69, 0x6e, 0x67, 0x65, 0x73, 0x74, 0x5f, 0x71, 0x75, 0x65, 0x75, 0x65, 0x5f, 0x63, 0x61, 0x70,
+	0x61, 0x63, 0x69, 0x74, 0x79, 0x18, 0x04, 0x20, 0x01, 0x28, 0x05, 0x3a, 0x04, 0x34, 0x30, 0x39,
+	0x36, 0x52, 0x13, 0x69, 0x6e, 0x67, 0x65, 0x73, 0x74, 0x51, 0x75, 0x65, 0x75, 0x65, 0x43, 0x61,
+	0x70, 0x61, 0x63, 0x69, 0x74, 0x79, 0x12, 0x4c, 0x0a, 0x10, 0x61, 0x64, 0x61, 0x70, 0x74, 0x69,
+	0x76, 0x65, 0x5f, 0x63, 0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x18, 0x05, 0x20, 0x01, 0x28, 0x0b,
+	0x32, 0x21, 0x2e, 0x68, 0x65, 0x79, 0x70, 0x2e, 0x70, 0x72, 0x6f, 0x74, 0x6f, 0x2e, 0x41, 0x64,
+	0x61, 0x70, 0x74, 0x69, 0x76, 0x65, 0x43, 0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x43, 0x6f, 0x6e,
+	0x66, 0x69, 0x67, 0x52, 0x0f, 0x61, 0x64, 0x61, 0x70, 0x74, 0x69, 0x76, 0x65, 0x43, 0x6f, 0x6e,
+	0x74, 0x72, 0x6f, 0x6c, 0x22, 0xc2, 0x01, 0x0a, 0x15, 0x41, 0x64, 0x61, 0x70, 0x74, 0x69, 0x76,
+	0x65, 0x43, 0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x43, 0x6f, 0x6e, 0x66, 0x69, 0x67, 0x12, 0x24,
+	0x0a, 0x0a, 0x6d, 0x69, 0x6e, 0x5f, 0x70, 0x65, 0x72, 0x69, 0x6f, 0x64, 0x18, 0x01, 0x20, 0x01,
+	0x28, 0x09, 0x3a, 0x05, 0x31, 0x30, 0x30, 0x6d, 0x73, 0x52, 0x09, 0x6d, 0x69, 0x6e, 0x50, 0x65,
+	0x72, 0x69, 0x6f, 0x64, 0x12, 0x24, 0x0a, 0x0b, 0x72, 0x65, 0x70, 0x6f, 0x72, 0x74, 0x5f, 0x66,
+	0x72, 0x61, 0x63, 0x18, 0x02, 0x20, 0x01, 0x28, 0x01, 0x3a, 0x03, 0x30, 0x2e, 0x35, 0x52, 0x0a,
+	0x72, 0x65, 0x70, 0x6f, 0x72, 0x74, 0x46, 0x72, 0x61, 0x63, 0x12, 0x36, 0x0a, 0x14, 0x6f, 0x6e,
+	0x5f, 0x61, 0x70, 0x70, 0x72, 0x6f, 0x76, 0x61, 0x6c, 0x5f, 0x63, 0x72, 0x6f, 0x73, 0x73, 0x69,
+	0x6e, 0x67, 0x18, 0x03, 0x20, 0x01, 0x28, 0x08, 0x3a, 0x04, 0x74, 0x72, 0x75, 0x65, 0x52, 0x12,
+	0x6f, 0x6e, 0x41, 0x70, 0x70, 0x72, 0x6f, 0x76, 0x61, 0x6c, 0x43, 0x72, 0x6f, 0x73, 0x73, 0x69,
+	0x6e, 0x67, 0x12, 0x25, 0x0a, 0x0b, 0x70, 0x6f, 0x6c, 0x6c, 0x5f, 0x70, 0x65, 0x72, 0x69, 0x6f,
+	0x64, 0x18, 0x04, 0x20, 0x01, 0x28, 0x09, 0x3a, 0x04, 0x31, 0x30, 0x6d, 0x73, 0x52, 0x0a, 0x70,
+	0x6f, 0x6c, 0x6c, 0x50, 0x65, 0x72, 0x69, 0x6f, 0x64, 0x22, 0xaa, 0x05, 0x0a, 0x1b, 0x46, 0x61,
+	0x73, 0x74, 0x43, 0x6c, 0x75, 0x73, 0x74, 0x65, 0x72, 0x43, 0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c,
+	0x6c, 0x65, 0x72, 0x43, 0x6f, 0x6e, 0x66, 0x69, 0x67, 0x12, 0x31, 0x0a, 0x12, 0x74, 0x61, 0x72,
+	0x67, 0x65, 0x74, 0x5f, 0x6e, 0x75, 0x6d, 0x5f, 0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x73, 0x18,
+	0x01, 0x20, 0x01, 0x28, 0x05, 0x3a, 0x03, 0x32, 0x30, 0x30, 0x52, 0x10, 0x74, 0x61, 0x72, 0x67,
+	0x65, 0x74, 0x4e, 0x75, 0x6d, 0x53, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x73, 0x12, 0x22, 0x0a, 0x0b,
+	0x6e, 0x75, 0x6d, 0x5f, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x73, 0x18, 0x02, 0x20, 0x01, 0x28,
+	0x05, 0x3a, 0x01, 0x38, 0x52, 0x0a, 0x6e, 0x75, 0x6d, 0x54, 0x68, 0x72, 0x65, 0x61, 0x64, 0x73,
 	0x12, 0x5f, 0x0a, 0x19, 0x64, 0x6f, 0x77, 0x6e, 0x67, 0x72, 0x61, 0x64, 0x65, 0x5f, 0x66, 0x72,
-	0x61, 0x63, 0x5f, 0x63, 0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x6c, 0x65, 0x72, 0x18, 0x06, 0x20,
+	0x61, 0x63, 0x5f, 0x63, 0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x6c, 0x65, 0x72, 0x18, 0x03, 0x20,
 	0x01, 0x28, 0x0b, 0x32, 0x23, 0x2e, 0x68, 0x65, 0x79, 0x70, 0x2e, 0x70, 0x72, 0x6f, 0x74, 0x6f,
 	0x2e, 0x44, 0x6f, 0x77, 0x6e, 0x67, 0x72, 0x61, 0x64, 0x65, 0x46, 0x72, 0x61, 0x63, 0x43, 0x6f,
 	0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x6c, 0x65, 0x72, 0x52, 0x17, 0x64, 0x6f, 0x77, 0x6e, 0x67, 0x72,
 	0x61, 0x64, 0x65, 0x46, 0x72, 0x61, 0x63, 0x43, 0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x6c, 0x65,
-	0x72, 0x12, 0x6d, 0x0a, 0x32, 0x68, 0x65, 0x79, 0x70, 0x5f, 0x61, 0x63, 0x63, 0x65, 0x70, 0x74,
-	0x61, 0x62, 0x6c, 0x65, 0x5f, 0x6d, 0x65, 0x61, 0x73, 0x75, 0x72, 0x65, 0x64, 0x5f, 0x72, 0x61,
-	0x74, 0x69, 0x6f, 0x5f, 0x6f, 0x76, 0x65, 0x72, 0x5f, 0x69, 0x6e, 0x74, 0x65, 0x6e, 0x64, 0x65,
-	0x64, 0x5f, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x18, 0x07, 0x20, 0x01, 0x28, 0x01, 0x3a, 0x03, 0x30,
-	0x2e, 0x39, 0x52, 0x2c, 0x68, 0x65, 0x79, 0x70, 0x41, 0x63, 0x63, 0x65, 0x70, 0x74, 0x61, 0x62,
-	0x6c, 0x65, 0x4d, 0x65, 0x61, 0x73, 0x75, 0x72, 0x65, 0x64, 0x52, 0x61, 0x74, 0x69, 0x6f, 0x4f,
-	0x76, 0x65, 0x72, 0x49, 0x6e, 0x74, 0x65, 0x6e, 0x64, 0x65, 0x64, 0x52, 0x61, 0x74, 0x69, 0x6f,
-	0x12, 0x4a, 0x0a, 0x1f, 0x68, 0x65, 0x79, 0x70, 0x5f, 0x70, 0x72, 0x6f, 0x62, 0x65, 0x5f, 0x6c,
-	0x6f, 0x70, 0x72, 0x69, 0x5f, 0x77, 0x68, 0x65, 0x6e, 0x5f, 0x61, 0x6d, 0x62, 0x69, 0x67, 0x75,
-	0x6f, 0x75, 0x73, 0x18, 0x08, 0x20, 0x01, 0x28, 0x08, 0x3a, 0x04, 0x74, 0x72, 0x75, 0x65, 0x52,
-	0x1b, 0x68, 0x65, 0x79, 0x70, 0x50, 0x72, 0x6f, 0x62, 0x65, 0x4c, 0x6f, 0x70, 0x72, 0x69, 0x57,
-	0x68, 0x65, 0x6e, 0x41, 0x6d, 0x62, 0x69, 0x67, 0x75, 0x6f, 0x75, 0x73, 0x12, 0x76, 0x0a, 0x1f,
-	0x73, 0x69, 0x6d, 0x70, 0x6c, 0x65, 0x5f, 0x64, 0x6f, 0x77, 0x6e, 0x67, 0x72, 0x61, 0x64, 0x65,
-	0x5f, 0x74, 0x68, 0x72, 0x6f, 0x74, 0x74, 0x6c, 0x65, 0x5f, 0x68, 0x69, 0x70, 0x72, 0x69, 0x18,
-	0x09, 0x20, 0x01, 0x28, 0x0e, 0x32, 0x23, 0x2e, 0x68, 0x65, 0x79, 0x70, 0x2e, 0x70, 0x72, 0x6f,
-	0x74, 0x6f, 0x2e, 0x48, 0x69, 0x70, 0x72, 0x69, 0x54, 0x68, 0x72, 0x6f, 0x74, 0x74, 0x6c, 0x65,
-	0x43, 0x6f, 0x6e, 0x64, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x3a, 0x0a, 0x48, 0x54, 0x43, 0x5f,
-	0x41, 0x4c, 0x57, 0x41, 0x59, 0x53, 0x52, 0x1c, 0x73, 0x69, 0x6d, 0x70, 0x6c, 0x65, 0x44, 0x6f,
-	0x77, 0x6e, 0x67, 0x72, 0x61, 0x64, 0x65, 0x54, 0x68, 0x72, 0x6f, 0x74, 0x74, 0x6c, 0x65, 0x48,
-	0x69, 0x70, 0x72, 0x69, 0x12, 0x5d, 0x0a, 0x19, 0x66, 0x69, 0x78, 0x65, 0x64, 0x5f, 0x68, 0x6f,
-	0x73, 0x74, 0x5f, 0x61, 0x6c, 0x6c, 0x6f, 0x63, 0x5f, 0x70, 0x61, 0x74, 0x74, 0x65, 0x72, 0x6e,
-	0x73, 0x18, 0x0a, 0x20, 0x03, 0x28, 0x0b, 0x32, 0x22, 0x2e, 0x68, 0x65, 0x79, 0x70, 0x2e, 0x70,
-	0x72, 0x6f, 0x74, 0x6f, 0x2e, 0x46, 0x69, 0x78, 0x65, 0x64, 0x43, 0x6c, 0x75, 0x73, 0x74, 0x65,
-	0x72, 0x48, 0x6f, 0x73, 0x74, 0x41, 0x6c, 0x6c, 0x6f, 0x63, 0x73, 0x52, 0x16, 0x66, 0x69, 0x78,
-	0x65, 0x64, 0x48, 0x6f, 0x73, 0x74, 0x41, 0x6c, 0x6c, 0x6f, 0x63, 0x50, 0x61, 0x74, 0x74, 0x65,
-	0x72, 0x6e, 0x73, 0x22, 0x5e, 0x0a, 0x13, 0x43, 0x6c, 0x75, 0x73, 0x74, 0x65, 0x72, 0x53, 0x65,
-	0x72, 0x76, 0x65, 0x72, 0x43, 0x6f, 0x6e, 0x66, 0x69, 0x67, 0x12, 0x1c, 0x0a, 0x09, 0x61, 0x64,
-	0x64, 0x72, 0x65, 0x73, 0x73, 0x65, 0x73, 0x18, 0x01, 0x20, 0x03, 0x28, 0x09, 0x52, 0x09, 0x61,
-	0x64, 0x64, 0x72, 0x65, 0x73, 0x73, 0x65, 0x73, 0x12, 0x29, 0x0a, 0x0e, 0x63, 0x6f, 0x6e, 0x74,
-	0x72, 0x6f, 0x6c, 0x5f, 0x70, 0x65, 0x72, 0x69, 0x6f, 0x64, 0x18, 0x02, 0x20, 0x01, 0x28, 0x09,
-	0x3a, 0x02, 0x35, 0x73, 0x52, 0x0d, 0x63, 0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x50, 0x65, 0x72,
-	0x69, 0x6f, 0x64, 0x22, 0xd5, 0x01, 0x0a, 0x1b, 0x46, 0x61, 0x73, 0x74, 0x43, 0x6c, 0x75, 0x73,
-	0x74, 0x65, 0x72, 0x43, 0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x6c, 0x65, 0x72, 0x43, 0x6f, 0x6e,
-	0x66, 0x69, 0x67, 0x12, 0x31, 0x0a, 0x12, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x5f, 0x6e, 0x75,
-	0x6d, 0x5f, 0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x73, 0x18, 0x01, 0x20, 0x01, 0x28, 0x05, 0x3a,
-	0x03, 0x32, 0x30, 0x30, 0x52, 0x10, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x4e, 0x75, 0x6d, 0x53,
-	0x61, 0x6d, 0x70, 0x6c, 0x65, 0x73, 0x12, 0x22, 0x0a, 0x0b, 0x6e, 0x75, 0x6d, 0x5f, 0x74, 0x68,
-	0x72, 0x65, 0x61, 0x64, 0x73, 0x18, 0x02, 0x20, 0x01, 0x28, 0x05, 0x3a, 0x01, 0x38, 0x52, 0x0a,
-	0x6e, 0x75, 0x6d, 0x54, 0x68, 0x72, 0x65, 0x61, 0x64, 0x73, 0x12, 0x5f, 0x0a, 0x19, 0x64, 0x6f,
-	0x77, 0x6e, 0x67, 0x72, 0x61, 0x64, 0x65, 0x5f, 0x66, 0x72, 0x61, 0x63, 0x5f, 0x63, 0x6f, 0x6e,
-	0x74, 0x72, 0x6f, 0x6c, 0x6c, 0x65, 0x72, 0x18, 0x03, 0x20, 0x01, 0x28, 0x0b, 0x32, 0x23, 0x2e,
-	0x68, 0x65, 0x79, 0x70, 0x2e, 0x70, 0x72, 0x6f, 0x74, 0x6f, 0x2e, 0x44, 0x6f, 0x77, 0x6e, 0x67,
-	0x72, 0x61, 0x64, 0x65, 0x46, 0x72, 0x61, 0x63, 0x43, 0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x6c,
-	0x65, 0x72, 0x52, 0x17, 0x64, 0x6f, 0x77, 0x6e, 0x67, 0x72, 0x61, 0x64, 0x65, 0x46, 0x72, 0x61,
-	0x63, 0x43, 0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x6c, 0x65, 0x72, 0x22, 0x8e, 0x03, 0x0a, 0x12,
-	0x43, 0x6c, 0x75, 0x73, 0x74, 0x65, 0x72, 0x41, 0x67, 0x65, 0x6e, 0x74, 0x43, 0x6f, 0x6e, 0x66,
-	0x69, 0x67, 0x12, 0x53, 0x0a, 0x0f, 0x63, 0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x6c, 0x65, 0x72,
-	0x5f, 0x74, 0x79, 0x70, 0x65, 0x18, 0x01, 0x20, 0x01, 0x28, 0x0e, 0x32, 0x21, 0x2e, 0x68, 0x65,
-	0x79, 0x70, 0x2e, 0x70, 0x72, 0x6f, 0x74, 0x6f, 0x2e, 0x43, 0x6c, 0x75, 0x73, 0x74, 0x65, 0x72,
-	0x43, 0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x6c, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x3a, 0x07,
-	0x43, 0x43, 0x5f, 0x46, 0x55, 0x4c, 0x4c, 0x52, 0x0e, 0x63, 0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c,
-	0x6c, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x12, 0x37, 0x0a, 0x06, 0x73, 0x65, 0x72, 0x76, 0x65,
-	0x72, 0x18, 0x02, 0x20, 0x01, 0x28, 0x0b, 0x32, 0x1f, 0x2e, 0x68, 0x65, 0x79, 0x70, 0x2e, 0x70,
-	0x72, 0x6f, 0x74, 0x6f, 0x2e, 0x43, 0x6c, 0x75, 0x73, 0x74, 0x65, 0x72, 0x53, 0x65, 0x72, 0x76,
-	0x65, 0x72, 0x43, 0x6f, 0x6e, 0x66, 0x69, 0x67, 0x52, 0x06, 0x73, 0x65, 0x72, 0x76, 0x65, 0x72,
-	0x12, 0x49, 0x0a, 0x0f, 0x66, 0x6c, 0x6f, 0x77, 0x5f, 0x61, 0x67, 0x67, 0x72, 0x65, 0x67, 0x61,
-	0x74, 0x6f, 0x72, 0x18, 0x03, 0x20, 0x01, 0x28, 0x0b, 0x32, 0x20, 0x2e, 0x68, 0x65, 0x79, 0x70,
-	0x2e, 0x70, 0x72, 0x6f, 0x74, 0x6f, 0x2e, 0x46, 0x6c, 0x6f, 0x77, 0x41, 0x67, 0x67, 0x72, 0x65,
-	0x67, 0x61, 0x74, 0x6f, 0x72, 0x43, 0x6f, 0x6e, 0x66, 0x69, 0x67, 0x52, 0x0e, 0x66, 0x6c, 0x6f,
-	0x77, 0x41, 0x67, 0x67, 0x72, 0x65, 0x67, 0x61, 0x74, 0x6f, 0x72, 0x12, 0x40, 0x0a, 0x09, 0x61,
-	0x6c, 0x6c, 0x6f, 0x63, 0x61, 0x74, 0x6f, 0x72, 0x18, 0x04, 0x20, 0x01, 0x28, 0x0b, 0x32, 0x22,
-	0x2e, 0x68, 0x65, 0x79, 0x70, 0x2e, 0x70, 0x72, 0x6f, 0x74, 0x6f, 0x2e, 0x43, 0x6c, 0x75, 0x73,
-	0x74, 0x65, 0x72, 0x41, 0x6c, 0x6c, 0x6f, 0x63, 0x61, 0x74, 0x6f, 0x72, 0x43, 0x6f, 0x6e, 0x66,
-	0x69, 0x67, 0x52, 0x09, 0x61, 0x6c, 0x6c, 0x6f, 0x63, 0x61, 0x74, 0x6f, 0x72, 0x12, 0x5d, 0x0a,
-	0x16, 0x66, 0x61, 0x73, 0x74, 0x5f, 0x63, 0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x6c, 0x65, 0x72,
-	0x5f, 0x63, 0x6f, 0x6e, 0x66, 0x69, 0x67, 0x18, 0x05, 0x20, 0x01, 0x28, 0x0b, 0x32, 0x27, 0x2e,
-	0x68, 0x65, 0x79, 0x70, 0x2e, 0x70, 0x72, 0x6f, 0x74, 0x6f, 0x2e, 0x46, 0x61, 0x73, 0x74, 0x43,
+	0x72, 0x12, 0x26, 0x0a, 0x0f, 0x6e, 0x75, 0x6d, 0x5f, 0x69, 0x6e, 0x66, 0x6f, 0x5f, 0x73, 0x68,
+	0x61, 0x72, 0x64, 0x73, 0x18, 0x04, 0x20, 0x01, 0x28, 0x05, 0x52, 0x0d, 0x6e, 0x75, 0x6d, 0x49,
+	0x6e, 0x66, 0x6f, 0x53, 0x68, 0x61, 0x72, 0x64, 0x73, 0x12, 0x2e, 0x0a, 0x13, 0x69, 0x6e, 0x66,
+	0x6f, 0x5f, 0x73, 0x68, 0x61, 0x72, 0x64, 0x5f, 0x63, 0x61, 0x70, 0x61, 0x63, 0x69, 0x74, 0x79,
+	0x18, 0x05, 0x20, 0x01, 0x28, 0x05, 0x52, 0x11, 0x69, 0x6e, 0x66, 0x6f, 0x53, 0x68, 0x61, 0x72,
+	0x64, 0x43, 0x61, 0x70, 0x61, 0x63, 0x69, 0x74, 0x79, 0x12, 0x31, 0x0a, 0x11, 0x73, 0x65, 0x6e,
+	0x64, 0x5f, 0x64, 0x65, 0x6c, 0x74, 0x61, 0x5f, 0x61, 0x6c, 0x6c, 0x6f, 0x63, 0x73, 0x18, 0x06,
+	0x20, 0x01, 0x28, 0x08, 0x3a, 0x05, 0x66, 0x61, 0x6c, 0x73, 0x65, 0x52, 0x0f, 0x73, 0x65, 0x6e,
+	0x64, 0x44, 0x65, 0x6c, 0x74, 0x61, 0x41, 0x6c, 0x6c, 0x6f, 0x63, 0x73, 0x12, 0x33, 0x0a, 0x12,
+	0x68, 0x6f, 0x73, 0x74, 0x5f, 0x73, 0x69, 0x64, 0x65, 0x5f, 0x73, 0x61, 0x6d, 0x70, 0x6c, 0x69,
+	0x6e, 0x67, 0x18, 0x07, 0x20, 0x01, 0x28, 0x08, 0x3a, 0x05, 0x66, 0x61, 0x6c, 0x73, 0x65, 0x52,
+	0x10, 0x68, 0x6f, 0x73, 0x74, 0x53, 0x69, 0x64, 0x65, 0x53, 0x61, 0x6d, 0x70, 0x6c, 0x69, 0x6e,
+	0x67, 0x12, 0x43, 0x0a, 0x1c, 0x6d, 0x69, 0x6e, 0x5f, 0x72, 0x65, 0x70, 0x6f, 0x72, 0x74, 0x5f,
+	0x66, 0x72, 0x61, 0x63, 0x5f, 0x66, 0x6f, 0x72, 0x5f, 0x63, 0x72, 0x6f, 0x73, 0x73, 0x69, 0x6e,
+	0x67, 0x18, 0x08, 0x20, 0x01, 0x28, 0x01, 0x3a, 0x03, 0x30, 0x2e, 0x31, 0x52, 0x18, 0x6d, 0x69,
+	0x6e, 0x52, 0x65, 0x70, 0x6f, 0x72, 0x74, 0x46, 0x72, 0x61, 0x63, 0x46, 0x6f, 0x72, 0x43, 0x72,
+	0x6f, 0x73, 0x73, 0x69, 0x6e, 0x67, 0x12, 0x27, 0x0a, 0x0f, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x70,
+	0x6f, 0x69, 0x6e, 0x74, 0x5f, 0x66, 0x69, 0x6c, 0x65, 0x18, 0x09, 0x20, 0x01, 0x28, 0x09, 0x52,
+	0x0e, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x46, 0x69, 0x6c, 0x65, 0x12,
+	0x39, 0x0a, 0x17, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x5f, 0x65, 0x76,
+	0x65, 0x72, 0x79, 0x5f, 0x6e, 0x5f, 0x72, 0x75, 0x6e, 0x73, 0x18, 0x0a, 0x20, 0x01, 0x28, 0x05,
+	0x3a, 0x02, 0x31, 0x32, 0x52, 0x14, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x70, 0x6f, 0x69, 0x6e, 0x74,
+	0x45, 0x76, 0x65, 0x72, 0x79, 0x4e, 0x52, 0x75, 0x6e, 0x73, 0x12, 0x33, 0x0a, 0x12, 0x65, 0x78,
+	0x70, 0x65, 0x63, 0x74, 0x65, 0x64, 0x5f, 0x6e, 0x75, 0x6d, 0x5f, 0x68, 0x6f, 0x73, 0x74, 0x73,
+	0x18, 0x0b, 0x20, 0x01, 0x28, 0x05, 0x3a, 0x05, 0x35, 0x30, 0x30, 0x30, 0x30, 0x52, 0x10, 0x65,
+	0x78, 0x70, 0x65, 0x63, 0x74, 0x65, 0x64, 0x4e, 0x75, 0x6d, 0x48, 0x6f, 0x73, 0x74, 0x73, 0x12,
+	0x35, 0x0a, 0x13, 0x74, 0x72, 0x61, 0x63, 0x6b, 0x5f, 0x70, 0x65, 0x6e, 0x64, 0x69, 0x6e, 0x67,
+	0x5f, 0x75, 0x73, 0x61, 0x67, 0x65, 0x18, 0x0c, 0x20, 0x01, 0x28, 0x08, 0x3a, 0x05, 0x66, 0x61,
+	0x6c, 0x73, 0x65, 0x52, 0x11, 0x74, 0x72, 0x61, 0x63, 0x6b, 0x50, 0x65, 0x6e, 0x64, 0x69, 0x6e,
+	0x67, 0x55, 0x73, 0x61, 0x67, 0x65, 0x22, 0xe6, 0x01, 0x0a, 0x1b, 0x46, 0x75, 0x6c, 0x6c, 0x43,
 	0x6c, 0x75, 0x73, 0x74, 0x65, 0x72, 0x43, 0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x6c, 0x65, 0x72,
-	0x43, 0x6f, 0x6e, 0x66, 0x69, 0x67, 0x52, 0x14, 0x66, 0x61, 0x73, 0x74, 0x43, 0x6f, 0x6e, 0x74,
-	0x72, 0x6f, 0x6c, 0x6c, 0x65, 0x72, 0x43, 0x6f, 0x6e, 0x66, 0x69, 0x67, 0x2a, 0x72, 0x0a, 0x0e,
-	0x4e, 0x65, 0x74, 0x65, 0x6d, 0x44, 0x65, 0x6c, 0x61, 0x79, 0x44, 0x69, 0x73, 0x74, 0x12, 0x11,
-	0x0a, 0x0d, 0x4e, 0x45, 0x54, 0x45, 0x4d, 0x5f, 0x4e, 0x4f, 0x5f, 0x44, 0x49, 0x53, 0x54, 0x10,
-	0x00, 0x12, 0x10, 0x0a, 0x0c, 0x4e, 0x45, 0x54, 0x45, 0x4d, 0x5f, 0x4e, 0x4f, 0x52, 0x4d, 0x41,
-	0x4c, 0x10, 0x01, 0x12, 0x11, 0x0a, 0x0d, 0x4e, 0x45, 0x54, 0x45, 0x4d, 0x5f, 0x55, 0x4e, 0x49,
-	0x46, 0x4f, 0x52, 0x4d, 0x10, 0x02, 0x12, 0x10, 0x0a, 0x0c, 0x4e, 0x45, 0x54, 0x45, 0x4d, 0x5f,
-	0x50, 0x41, 0x52, 0x45, 0x54, 0x4f, 0x10, 0x03, 0x12, 0x16, 0x0a, 0x12, 0x4e, 0x45, 0x54, 0x45,
-	0x4d, 0x5f, 0x50, 0x41, 0x52, 0x45, 0x54, 0x4f, 0x4e, 0x4f, 0x52, 0x4d, 0x41, 0x4c, 0x10, 0x04,
-	0x2a, 0x79, 0x0a, 0x14, 0x43, 0x6c, 0x75, 0x73, 0x74, 0x65, 0x72, 0x41, 0x6c, 0x6c, 0x6f, 0x63,
-	0x61, 0x74, 0x6f, 0x72, 0x54, 0x79, 0x70, 0x65, 0x12, 0x0a, 0x0a, 0x06, 0x43, 0x41, 0x5f, 0x4e,
-	0x4f, 0x50, 0x10, 0x00, 0x12, 0x0a, 0x0a, 0x06, 0x43, 0x41, 0x5f, 0x42, 0x57, 0x45, 0x10, 0x01,
-	0x12, 0x15, 0x0a, 0x11, 0x43, 0x41, 0x5f, 0x48, 0x45, 0x59, 0x50, 0x5f, 0x53, 0x49, 0x47, 0x43,
-	0x4f, 0x4d, 0x4d, 0x32, 0x30, 0x10, 0x02, 0x12, 0x17, 0x0a, 0x13, 0x43, 0x41, 0x5f, 0x53, 0x49,
-	0x4d, 0x50, 0x4c, 0x45, 0x5f, 0x44, 0x4f, 0x57, 0x4e, 0x47, 0x52, 0x41, 0x44, 0x45, 0x10, 0x03,
-	0x12, 0x19, 0x0a, 0x15, 0x43, 0x41, 0x5f, 0x46, 0x49, 0x58, 0x45, 0x44, 0x5f, 0x48, 0x4f, 0x53,
-	0x54, 0x5f, 0x50, 0x41, 0x54, 0x54, 0x45, 0x52, 0x4e, 0x10, 0x04, 0x2a, 0x83, 0x01, 0x0a, 0x15,
-	0x44, 0x6f, 0x77, 0x6e, 0x67, 0x72, 0x61, 0x64, 0x65, 0x53, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x6f,
-	0x72, 0x54, 0x79, 0x70, 0x65, 0x12, 0x15, 0x0a, 0x11, 0x44, 0x53, 0x5f, 0x48, 0x45, 0x59, 0x50,
-	0x5f, 0x53, 0x49, 0x47, 0x43, 0x4f, 0x4d, 0x4d, 0x32, 0x30, 0x10, 0x00, 0x12, 0x0e, 0x0a, 0x0a,
-	0x44, 0x53, 0x5f, 0x48, 0x41, 0x53, 0x48, 0x49, 0x4e, 0x47, 0x10, 0x01, 0x12, 0x15, 0x0a, 0x11,
-	0x44, 0x53, 0x5f, 0x48, 0x59, 0x42, 0x52, 0x49, 0x44, 0x5f, 0x48, 0x41, 0x53, 0x48, 0x49, 0x4e,
-	0x47, 0x10, 0x02, 0x12, 0x16, 0x0a, 0x12, 0x44, 0x53, 0x5f, 0x4b, 0x4e, 0x41, 0x50, 0x53, 0x41,
-	0x43, 0x4b, 0x5f, 0x53, 0x4f, 0x4c, 0x56, 0x45, 0x52, 0x10, 0x03, 0x12, 0x14, 0x0a, 0x10, 0x44,
-	0x53, 0x5f, 0x4c, 0x41, 0x52, 0x47, 0x45, 0x53, 0x54, 0x5f, 0x46, 0x49, 0x52, 0x53, 0x54, 0x10,
-	0x04, 0x2a, 0x75, 0x0a, 0x17, 0x48, 0x69, 0x70, 0x72, 0x69, 0x54, 0x68, 0x72, 0x6f, 0x74, 0x74,
-	0x6c, 0x65, 0x43, 0x6f, 0x6e, 0x64, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x12, 0x0d, 0x0a, 0x09,
-	0x48, 0x54, 0x43, 0x5f, 0x4e, 0x45, 0x56, 0x45, 0x52, 0x10, 0x00, 0x12, 0x1e, 0x0a, 0x1a, 0x48,
-	0x54, 0x43, 0x5f, 0x57, 0x48, 0x45, 0x4e, 0x5f, 0x41, 0x42, 0x4f, 0x56, 0x45, 0x5f, 0x48, 0x49,
-	0x50, 0x52, 0x49, 0x5f, 0x4c, 0x49, 0x4d, 0x49, 0x54, 0x10, 0x01, 0x12, 0x1b, 0x0a, 0x17, 0x48,
-	0x54, 0x43, 0x5f, 0x57, 0x48, 0x45, 0x4e, 0x5f, 0x41, 0x53, 0x53, 0x49, 0x47, 0x4e, 0x45, 0x44,
-	0x5f, 0x4c, 0x4f, 0x50, 0x52, 0x49, 0x10, 0x02, 0x12, 0x0e, 0x0a, 0x0a, 0x48, 0x54, 0x43, 0x5f,
-	0x41, 0x4c, 0x57, 0x41, 0x59, 0x53, 0x10, 0x03, 0x2a, 0x31, 0x0a, 0x15, 0x43, 0x6c, 0x75, 0x73,
+	0x43, 0x6f, 0x6e, 0x66, 0x69, 0x67, 0x12, 0x22, 0x0a, 0x0b, 0x6e, 0x75, 0x6d, 0x5f, 0x74, 0x68,
+	0x72, 0x65, 0x61, 0x64, 0x73, 0x18, 0x01, 0x20, 0x01, 0x28, 0x05, 0x3a, 0x01, 0x34, 0x52, 0x0a,
+	0x6e, 0x75, 0x6d, 0x54, 0x68, 0x72, 0x65, 0x61, 0x64, 0x73, 0x12, 0x3b, 0x0a, 0x16, 0x73, 0x6b,
+	0x69, 0x70, 0x5f, 0x75, 0x6e, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x64, 0x5f, 0x62, 0x75, 0x6e,
+	0x64, 0x6c, 0x65, 0x73, 0x18, 0x02, 0x20, 0x01, 0x28, 0x08, 0x3a, 0x05, 0x66, 0x61, 0x6c, 0x73,
+	0x65, 0x52, 0x14, 0x73, 0x6b, 0x69, 0x70, 0x55, 0x6e, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x64,
+	0x42, 0x75, 0x6e, 0x64, 0x6c, 0x65, 0x73, 0x12, 0x33, 0x0a, 0x14, 0x72, 0x61, 0x74, 0x65, 0x5f,
+	0x6c, 0x69, 0x6d, 0x69, 0x74, 0x5f, 0x74, 0x6f, 0x6c, 0x65, 0x72, 0x61, 0x6e, 0x63, 0x65, 0x18,
+	0x03, 0x20, 0x01, 0x28, 0x01, 0x3a, 0x01, 0x30, 0x52, 0x12, 0x72, 0x61, 0x74, 0x65, 0x4c, 0x69,
+	0x6d, 0x69, 0x74, 0x54, 0x6f, 0x6c, 0x65, 0x72, 0x61, 0x6e, 0x63, 0x65, 0x12, 0x31, 0x0a, 0x13,
+	0x72, 0x65, 0x66, 0x72, 0x65, 0x73, 0x68, 0x5f, 0x61, 0x66, 0x74, 0x65, 0x72, 0x5f, 0x73, 0x6b,
+	0x69, 0x70, 0x73, 0x18, 0x04, 0x20, 0x01, 0x28, 0x05, 0x3a, 0x01, 0x30, 0x52, 0x11, 0x72, 0x65,
+	0x66, 0x72, 0x65, 0x73, 0x68, 0x41, 0x66, 0x74, 0x65, 0x72, 0x53, 0x6b, 0x69, 0x70, 0x73, 0x22,
+	0xec, 0x01, 0x0a, 0x15, 0x41, 0x67, 0x67, 0x72, 0x65, 0x67, 0x61, 0x74, 0x6f, 0x72, 0x41, 0x67,
+	0x65, 0x6e, 0x74, 0x43, 0x6f, 0x6e, 0x66, 0x69, 0x67, 0x12, 0x23, 0x0a, 0x0d, 0x61, 0x67, 0x67,
+	0x72, 0x65, 0x67, 0x61, 0x74, 0x6f, 0x72, 0x5f, 0x69, 0x64, 0x18, 0x01, 0x20, 0x01, 0x28, 0x04,
+	0x52, 0x0c, 0x61, 0x67, 0x67, 0x72, 0x65, 0x67, 0x61, 0x74, 0x6f, 0x72, 0x49, 0x64, 0x12, 0x1c,
+	0x0a, 0x09, 0x61, 0x64, 0x64, 0x72, 0x65, 0x73, 0x73, 0x65, 0x73, 0x18, 0x02, 0x20, 0x03, 0x28,
+	0x09, 0x52, 0x09, 0x61, 0x64, 0x64, 0x72, 0x65, 0x73, 0x73, 0x65, 0x73, 0x12, 0x32, 0x0a, 0x15,
+	0x63, 0x6c, 0x75, 0x73, 0x74, 0x65, 0x72, 0x5f, 0x61, 0x67, 0x65, 0x6e, 0x74, 0x5f, 0x61, 0x64,
+	0x64, 0x72, 0x65, 0x73, 0x73, 0x18, 0x03, 0x20, 0x01, 0x28, 0x09, 0x52, 0x13, 0x63, 0x6c, 0x75,
+	0x73, 0x74, 0x65, 0x72, 0x41, 0x67, 0x65, 0x6e, 0x74, 0x41, 0x64, 0x64, 0x72, 0x65, 0x73, 0x73,
+	0x12, 0x29, 0x0a, 0x0e, 0x66, 0x6f, 0x72, 0x77, 0x61, 0x72, 0x64, 0x5f, 0x70, 0x65, 0x72, 0x69,
+	0x6f, 0x64, 0x18, 0x04, 0x20, 0x01, 0x28, 0x09, 0x3a, 0x02, 0x31, 0x73, 0x52, 0x0d, 0x66, 0x6f,
+	0x72, 0x77, 0x61, 0x72, 0x64, 0x50, 0x65, 0x72, 0x69, 0x6f, 0x64, 0x12, 0x31, 0x0a, 0x12, 0x74,
+	0x61, 0x72, 0x67, 0x65, 0x74, 0x5f, 0x6e, 0x75, 0x6d, 0x5f, 0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65,
+	0x73, 0x18, 0x05, 0x20, 0x01, 0x28, 0x05, 0x3a, 0x03, 0x32, 0x30, 0x30, 0x52, 0x10, 0x74, 0x61,
+	0x72, 0x67, 0x65, 0x74, 0x4e, 0x75, 0x6d, 0x53, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x73, 0x22, 0x9f,
+	0x04, 0x0a, 0x12, 0x43, 0x6c, 0x75, 0x73, 0x74, 0x65, 0x72, 0x41, 0x67, 0x65, 0x6e, 0x74, 0x43,
+	0x6f, 0x6e, 0x66, 0x69, 0x67, 0x12, 0x53, 0x0a, 0x0f, 0x63, 0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c,
+	0x6c, 0x65, 0x72, 0x5f, 0x74, 0x79, 0x70, 0x65, 0x18, 0x01, 0x20, 0x01, 0x28, 0x0e, 0x32, 0x21,
+	0x2e, 0x68, 0x65, 0x79, 0x70, 0x2e, 0x70, 0x72, 0x6f, 0x74, 0x6f, 0x2e, 0x43, 0x6c, 0x75, 0x73,
 	0x74, 0x65, 0x72, 0x43, 0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x6c, 0x65, 0x72, 0x54, 0x79, 0x70,
-	0x65, 0x12, 0x0b, 0x0a, 0x07, 0x43, 0x43, 0x5f, 0x46, 0x55, 0x4c, 0x4c, 0x10, 0x00, 0x12, 0x0b,
-	0x0a, 0x07, 0x43, 0x43, 0x5f, 0x46, 0x41, 0x53, 0x54, 0x10, 0x01, 0x42, 0x25, 0x5a, 0x23, 0x67,
-	0x69, 0x74, 0x68, 0x75, 0x62, 0x2e, 0x63, 0x6f, 0x6d, 0x2f, 0x75, 0x6c, 0x75, 0x79, 0x6f, 0x6c,
-	0x2f, 0x68, 0x65, 0x79, 0x70, 0x2d, 0x61, 0x67, 0x65, 0x6e, 0x74, 0x73, 0x2f, 0x67, 0x6f, 0x2f,
-	0x70, 0x62,
+	0x65, 0x3a, 0x07, 0x43, 0x43, 0x5f, 0x46, 0x55, 0x4c, 0x4c, 0x52, 0x0e, 0x63, 0x6f, 0x6e, 0x74,
+	0x72, 0x6f, 0x6c, 0x6c, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x12, 0x37, 0x0a, 0x06, 0x73, 0x65,
+	0x72, 0x76, 0x65, 0x72, 0x18, 0x02, 0x20, 0x01, 0x28, 0x0b, 0x32, 0x1f, 0x2e, 0x68, 0x65, 0x79,
+	0x70, 0x2e, 0x70, 0x72, 0x6f, 0x74, 0x6f, 0x2e, 0x43, 0x6c, 0x75, 0x73, 0x74, 0x65, 0x72, 0x53,
+	0x65, 0x72, 0x76, 0x65, 0x72, 0x43, 0x6f, 0x6e, 0x66, 0x69, 0x67, 0x52, 0x06, 0x73, 0x65, 0x72,
+	0x76, 0x65, 0x72, 0x12, 0x49, 0x0a, 0x0f, 0x66, 0x6c, 0x6f, 0x77, 0x5f, 0x61, 0x67, 0x67, 0x72,
+	0x65, 0x67, 0x61, 0x74, 0x6f, 0x72, 0x18, 0x03, 0x20, 0x01, 0x28, 0x0b, 0x32, 0x20, 0x2e, 0x68,
+	0x65, 0x79, 0x70, 0x2e, 0x70, 0x72, 0x6f, 0x74, 0x6f, 0x2e, 0x46, 0x6c, 0x6f, 0x77, 0x41, 0x67,
+	0x67, 0x72, 0x65, 0x67, 0x61, 0x74, 0x6f, 0x72, 0x43, 0x6f, 0x6e, 0x66, 0x69, 0x67, 0x52, 0x0e,
+	0x66, 0x6c, 0x6f, 0x77, 0x41, 0x67, 0x67, 0x72, 0x65, 0x67, 0x61, 0x74, 0x6f, 0x72, 0x12, 0x40,
+	0x0a, 0x09, 0x61, 0x6c, 0x6c, 0x6f, 0x63, 0x61, 0x74, 0x6f, 0x72, 0x18, 0x04, 0x20, 0x01, 0x28,
+	0x0b, 0x32, 0x22, 0x2e, 0x68, 0x65, 0x79, 0x70, 0x2e, 0x70, 0x72, 0x6f, 0x74, 0x6f, 0x2e, 0x43,
+	0x6c, 0x75, 0x73, 0x74, 0x65, 0x72, 0x41, 0x6c, 0x6c, 0x6f, 0x63, 0x61, 0x74, 0x6f, 0x72, 0x43,
+	0x6f, 0x6e, 0x66, 0x69, 0x67, 0x52, 0x09, 0x61, 0x6c, 0x6c, 0x6f, 0x63, 0x61, 0x74, 0x6f, 0x72,
+	0x12, 0x5d, 0x0a, 0x16, 0x66, 0x75, 0x6c, 0x6c, 0x5f, 0x63, 0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c,
+	0x6c, 0x65, 0x72, 0x5f, 0x63, 0x6f, 0x6e, 0x66, 0x69, 0x67, 0x18, 0x06, 0x20, 0x01, 0x28, 0x0b,
+	0x32, 0x27, 0x2e, 0x68, 0x65, 0x79, 0x70, 0x2e, 0x70, 0x72, 0x6f, 0x74, 0x6f, 0x2e, 0x46, 0x75,
+	0x6c, 0x6c, 0x43, 0x6c, 0x75, 0x73, 0x74, 0x65, 0x72, 0x43, 0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c,
+	0x6c, 0x65, 0x72, 0x43, 0x6f, 0x6e, 0x66, 0x69, 0x67, 0x52, 0x14, 0x66, 0x75, 0x6c, 0x6c, 0x43,
+	0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x6c, 0x65, 0x72, 0x43, 0x6f, 0x6e, 0x66, 0x69, 0x67, 0x12,
+	0x5d, 0x0a, 0x16, 0x66, 0x61, 0x73, 0x74, 0x5f, 0x63, 0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x6c,
+	0x65, 0x72, 0x5f, 0x63, 0x6f, 0x6e, 0x66, 0x69, 0x67, 0x18, 0x05, 0x20, 0x01, 0x28, 0x0b, 0x32,
+	0x27, 0x2e, 0x68, 0x65, 0x79, 0x70, 0x2e, 0x70, 0x72, 0x6f, 0x74, 0x6f, 0x2e, 0x46, 0x61, 0x73,
+	0x74, 0x43, 0x6c, 0x75, 0x73, 0x74, 0x65, 0x72, 0x43, 0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x6c,
+	0x65, 0x72, 0x43, 0x6f, 0x6e, 0x66, 0x69, 0x67, 0x52, 0x14, 0x66, 0x61, 0x73, 0x74, 0x43, 0x6f,
+	0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x6c, 0x65, 0x72, 0x43, 0x6f, 0x6e, 0x66, 0x69, 0x67, 0x12, 0x30,
+	0x0a, 0x14, 0x6c, 0x69, 0x6d, 0x69, 0x74, 0x73, 0x5f, 0x72, 0x65, 0x6c, 0x6f, 0x61, 0x64, 0x5f,
+	0x70, 0x65, 0x72, 0x69, 0x6f, 0x64, 0x18, 0x07, 0x20, 0x01, 0x28, 0x09, 0x52, 0x12, 0x6c, 0x69,
+	0x6d, 0x69, 0x74, 0x73, 0x52, 0x65, 0x6c, 0x6f, 0x61, 0x64, 0x50, 0x65, 0x72, 0x69, 0x6f, 0x64,
+	0x2a, 0x54, 0x0a, 0x13, 0x44, 0x65, 0x6d, 0x61, 0x6e, 0x64, 0x50, 0x72, 0x65, 0x64, 0x69, 0x63,
+	0x74, 0x6f, 0x72, 0x54, 0x79, 0x70, 0x65, 0x12, 0x0a, 0x0a, 0x06, 0x44, 0x50, 0x5f, 0x42, 0x57,
+	0x45, 0x10, 0x00, 0x12, 0x13, 0x0a, 0x0f, 0x44, 0x50, 0x5f, 0x44, 0x45, 0x43, 0x41, 0x59, 0x45,
+	0x44, 0x5f, 0x50, 0x45, 0x41, 0x4b, 0x10, 0x01, 0x12, 0x0f, 0x0a, 0x0b, 0x44, 0x50, 0x5f, 0x51,
+	0x55, 0x41, 0x4e, 0x54, 0x49, 0x4c, 0x45, 0x10, 0x02, 0x12, 0x0b, 0x0a, 0x07, 0x44, 0x50, 0x5f,
+	0x48, 0x4f, 0x4c, 0x54, 0x10, 0x03, 0x2a, 0x72, 0x0a, 0x0e, 0x4e, 0x65, 0x74, 0x65, 0x6d, 0x44,
+	0x65, 0x6c, 0x61, 0x79, 0x44, 0x69, 0x73, 0x74, 0x12, 0x11, 0x0a, 0x0d, 0x4e, 0x45, 0x54, 0x45,
+	0x4d, 0x5f, 0x4e, 0x4f, 0x5f, 0x44, 0x49, 0x53, 0x54, 0x10, 0x00, 0x12, 0x10, 0x0a, 0x0c, 0x4e,
+	0x45, 0x54, 0x45, 0x4d, 0x5f, 0x4e, 0x4f, 0x52, 0x4d, 0x41, 0x4c, 0x10, 0x01, 0x12, 0x11, 0x0a,
+	0x0d, 0x4e, 0x45, 0x54, 0x45, 0x4d, 0x5f, 0x55, 0x4e, 0x49, 0x46, 0x4f, 0x52, 0x4d, 0x10, 0x02,
+	0x12, 0x10, 0x0a, 0x0c, 0x4e, 0x45, 0x54, 0x45, 0x4d, 0x5f, 0x50, 0x41, 0x52, 0x45, 0x54, 0x4f,
+	0x10, 0x03, 0x12, 0x16, 0x0a, 0x12, 0x4e, 0x45, 0x54, 0x45, 0x4d, 0x5f, 0x50, 0x41, 0x52, 0x45,
+	0x54, 0x4f, 0x4e, 0x4f, 0x52, 0x4d, 0x41, 0x4c, 0x10, 0x04, 0x2a, 0x79, 0x0a, 0x14, 0x43, 0x6c,
+	0x75, 0x73, 0x74, 0x65, 0x72, 0x41, 0x6c, 0x6c, 0x6f, 0x63, 0x61, 0x74, 0x6f, 0x72, 0x54, 0x79,
+	0x70, 0x65, 0x12, 0x0a, 0x0a, 0x06, 0x43, 0x41, 0x5f, 0x4e, 0x4f, 0x50, 0x10, 0x00, 0x12, 0x0a,
+	0x0a, 0x06, 0x43, 0x41, 0x5f, 0x42, 0x57, 0x45, 0x10, 0x01, 0x12, 0x15, 0x0a, 0x11, 0x43, 0x41,
+	0x5f, 0x48, 0x45, 0x59, 0x50, 0x5f, 0x53, 0x49, 0x47, 0x43, 0x4f, 0x4d, 0x4d, 0x32, 0x30, 0x10,
+	0x02, 0x12, 0x17, 0x0a, 0x13, 0x43, 0x41, 0x5f, 0x53, 0x49, 0x4d, 0x50, 0x4c, 0x45, 0x5f, 0x44,
+	0x4f, 0x57, 0x4e, 0x47, 0x52, 0x41, 0x44, 0x45, 0x10, 0x03, 0x12, 0x19, 0x0a, 0x15, 0x43, 0x41,
+	0x5f, 0x46, 0x49, 0x58, 0x45, 0x44, 0x5f, 0x48, 0x4f, 0x53, 0x54, 0x5f, 0x50, 0x41, 0x54, 0x54,
+	0x45, 0x52, 0x4e, 0x10, 0x04, 0x2a, 0x83, 0x01, 0x0a, 0x15, 0x44, 0x6f, 0x77, 0x6e, 0x67, 0x72,
+	0x61, 0x64, 0x65, 0x53, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x54, 0x79, 0x70, 0x65, 0x12,
+	0x15, 0x0a, 0x11, 0x44, 0x53, 0x5f, 0x48, 0x45, 0x59, 0x50, 0x5f, 0x53, 0x49, 0x47, 0x43, 0x4f,
+	0x4d, 0x4d, 0x32, 0x30, 0x10, 0x00, 0x12, 0x0e, 0x0a, 0x0a, 0x44, 0x53, 0x5f, 0x48, 0x41, 0x53,
+	0x48, 0x49, 0x4e, 0x47, 0x10, 0x01, 0x12, 0x15, 0x0a, 0x11, 0x44, 0x53, 0x5f, 0x48, 0x59, 0x42,
+	0x52, 0x49, 0x44, 0x5f, 0x48, 0x41, 0x53, 0x48, 0x49, 0x4e, 0x47, 0x10, 0x02, 0x12, 0x16, 0x0a,
+	0x12, 0x44, 0x53, 0x5f, 0x4b, 0x4e, 0x41, 0x50, 0x53, 0x41, 0x43, 0x4b, 0x5f, 0x53, 0x4f, 0x4c,
+	0x56, 0x45, 0x52, 0x10, 0x03, 0x12, 0x14, 0x0a, 0x10, 0x44, 0x53, 0x5f, 0x4c, 0x41, 0x52, 0x47,
+	0x45, 0x53, 0x54, 0x5f, 0x46, 0x49, 0x52, 0x53, 0x54, 0x10, 0x04, 0x2a, 0x75, 0x0a, 0x17, 0x48,
+	0x69, 0x70, 0x72, 0x69, 0x54, 0x68, 0x72, 0x6f, 0x74, 0x74, 0x6c, 0x65, 0x43, 0x6f, 0x6e, 0x64,
+	0x69, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x12, 0x0d, 0x0a, 0x09, 0x48, 0x54, 0x43, 0x5f, 0x4e, 0x45,
+	0x56, 0x45, 0x52, 0x10, 0x00, 0x12, 0x1e, 0x0a, 0x1a, 0x48, 0x54, 0x43, 0x5f, 0x57, 0x48, 0x45,
+	0x4e, 0x5f, 0x41, 0x42, 0x4f, 0x56, 0x45, 0x5f, 0x48, 0x49, 0x50, 0x52, 0x49, 0x5f, 0x4c, 0x49,
+	0x4d, 0x49, 0x54, 0x10, 0x01, 0x12, 0x1b, 0x0a, 0x17, 0x48, 0x54, 0x43, 0x5f, 0x57, 0x48, 0x45,
+	0x4e, 0x5f, 0x41, 0x53, 0x53, 0x49, 0x47, 0x4e, 0x45, 0x44, 0x5f, 0x4c, 0x4f, 0x50, 0x52, 0x49,
+	0x10, 0x02, 0x12, 0x0e, 0x0a, 0x0a, 0x48, 0x54, 0x43, 0x5f, 0x41, 0x4c, 0x57, 0x41, 0x59, 0x53,
+	0x10, 0x03, 0x2a, 0x31, 0x0a, 0x15, 0x43, 0x6c, 0x75, 0x73, 0x74, 0x65, 0x72, 0x43, 0x6f, 0x6e,
+	0x74, 0x72, 0x6f, 0x6c, 0x6c, 0x65, 0x72, 0x54, 0x79, 0x70, 0x65, 0x12, 0x0b, 0x0a, 0x07, 0x43,
+	0x43, 0x5f, 0x46, 0x55, 0x4c, 0x4c, 0x10, 0x00, 0x12, 0x0b, 0x0a, 0x07, 0x43, 0x43, 0x5f, 0x46,
+	0x41, 0x53, 0x54, 0x10, 0x01, 0x42, 0x25, 0x5a, 0x23, 0x67, 0x69, 0x74, 0x68, 0x75, 0x62, 0x2e,
+	0x63, 0x6f, 0x6d, 0x2f, 0x75, 0x6c, 0x75, 0x79, 0x6f, 0x6c, 0x2f, 0x68, 0x65, 0x79, 0x70, 0x2d,
+	0x61, 0x67, 0x65, 0x6e, 0x74, 0x73, 0x2f, 0x67, 0x6f, 0x2f, 0x70, 0x62,
 }
 
 var (
@@ -2365,78 +2989,85 @@ func file_heyp_proto_config_proto_rawDescGZIP() []byte {
 	return file_heyp_proto_config_proto_rawDescData
 }
 
-var file_heyp_proto_config_proto_enumTypes = make([]protoimpl.EnumInfo, 5)
-var file_heyp_proto_config_proto_msgTypes = make([]protoimpl.MessageInfo, 23)
+var file_heyp_proto_config_proto_enumTypes = make([]protoimpl.EnumInfo, 6)
+var file_heyp_proto_config_proto_msgTypes = make([]protoimpl.MessageInfo, 26)
 var file_heyp_proto_config_proto_goTypes = []interface{}{
-	(NetemDelayDist)(0),                              // 0: heyp.proto.NetemDelayDist
-	(ClusterAllocatorType)(0),                        // 1: heyp.proto.ClusterAllocatorType
-	(DowngradeSelectorType)(0),                       // 2: heyp.proto.DowngradeSelectorType
-	(HipriThrottleConditions)(0),                     // 3: heyp.proto.HipriThrottleConditions
-	(ClusterControllerType)(0),                       // 4: heyp.proto.ClusterControllerType
-	(*DemandPredictorConfig)(nil),                    // 5: heyp.proto.DemandPredictorConfig
-	(*HostFlowTrackerConfig)(nil),                    // 6: heyp.proto.HostFlowTrackerConfig
-	(*FlowAggregatorConfig)(nil),                     // 7: heyp.proto.FlowAggregatorConfig
-	(*HostFlowStateReporterConfig)(nil),              // 8: heyp.proto.HostFlowStateReporterConfig
-	(*HostEnforcerConfig)(nil),                       // 9: heyp.proto.HostEnforcerConfig
-	(*HostDaemonConfig)(nil),                         // 10: heyp.proto.HostDaemonConfig
-	(*DCMapping)(nil),                                // 11: heyp.proto.DCMapping
-	(*StaticDCMapperConfig)(nil),                     // 12: heyp.proto.StaticDCMapperConfig
-	(*NetemConfig)(nil),                              // 13: heyp.proto.NetemConfig
-	(*SimulatedWanConfig)(nil),                       // 14: heyp.proto.SimulatedWanConfig
-	(*HostAgentConfig)(nil),                          // 15: heyp.proto.HostAgentConfig
-	(*DowngradeSelector)(nil),                        // 16: heyp.proto.DowngradeSelector
-	(*DowngradeFracController)(nil),                  // 17: heyp.proto.DowngradeFracController
-	(*FixedClusterHostAllocs)(nil),                   // 18: heyp.proto.FixedClusterHostAllocs
-	(*ClusterAllocatorConfig)(nil),                   // 19: heyp.proto.ClusterAllocatorConfig
-	(*ClusterServerConfig)(nil),                      // 20: heyp.proto.ClusterServerConfig
-	(*FastClusterControllerConfig)(nil),              // 21: heyp.proto.FastClusterControllerConfig
-	(*ClusterAgentConfig)(nil),                       // 22: heyp.proto.ClusterAgentConfig
-	(*DCMapping_Entry)(nil),                          // 23: heyp.proto.DCMapping.Entry
-	(*SimulatedWanConfig_Pair)(nil),                  // 24: heyp.proto.SimulatedWanConfig.Pair
-	(*DowngradeSelector_HybridHashingConfig)(nil),    // 25: heyp.proto.DowngradeSelector.HybridHashingConfig
-	(*FixedClusterHostAllocs_FlowAllocAndCount)(nil), // 26: heyp.proto.FixedClusterHostAllocs.FlowAllocAndCount
-	(*FixedClusterHostAllocs_Snapshot)(nil),          // 27: heyp.proto.FixedClusterHostAllocs.Snapshot
-	(*FlowMarker)(nil),                               // 28: heyp.proto.FlowMarker
-	(*FlowAlloc)(nil),                                // 29: heyp.proto.FlowAlloc
+	(DemandPredictorType)(0),                         // 0: heyp.proto.DemandPredictorType
+	(NetemDelayDist)(0),                              // 1: heyp.proto.NetemDelayDist
+	(ClusterAllocatorType)(0),                        // 2: heyp.proto.ClusterAllocatorType
+	(DowngradeSelectorType)(0),                       // 3: heyp.proto.DowngradeSelectorType
+	(HipriThrottleConditions)(0),                     // 4: heyp.proto.HipriThrottleConditions
+	(ClusterControllerType)(0),                       // 5: heyp.proto.ClusterControllerType
+	(*DemandPredictorConfig)(nil),                    // 6: heyp.proto.DemandPredictorConfig
+	(*HostFlowTrackerConfig)(nil),                    // 7: heyp.proto.HostFlowTrackerConfig
+	(*FlowAggregatorConfig)(nil),                     // 8: heyp.proto.FlowAggregatorConfig
+	(*HostFlowStateReporterConfig)(nil),              // 9: heyp.proto.HostFlowStateReporterConfig
+	(*HostEnforcerConfig)(nil),                       // 10: heyp.proto.HostEnforcerConfig
+	(*HostDaemonConfig)(nil),                         // 11: heyp.proto.HostDaemonConfig
+	(*DCMapping)(nil),                                // 12: heyp.proto.DCMapping
+	(*StaticDCMapperConfig)(nil),                     // 13: heyp.proto.StaticDCMapperConfig
+	(*NetemConfig)(nil),                              // 14: heyp.proto.NetemConfig
+	(*SimulatedWanConfig)(nil),                       // 15: heyp.proto.SimulatedWanConfig
+	(*HostAgentConfig)(nil),                          // 16: heyp.proto.HostAgentConfig
+	(*DowngradeSelector)(nil),                        // 17: heyp.proto.DowngradeSelector
+	(*DowngradeFracController)(nil),                  // 18: heyp.proto.DowngradeFracController
+	(*FixedClusterHostAllocs)(nil),                   // 19: heyp.proto.FixedClusterHostAllocs
+	(*ClusterAllocatorConfig)(nil),                   // 20: heyp.proto.ClusterAllocatorConfig
+	(*ClusterServerConfig)(nil),                      // 21: heyp.proto.ClusterServerConfig
+	(*AdaptiveControlConfig)(nil),                    // 22: heyp.proto.AdaptiveControlConfig
+	(*FastClusterControllerConfig)(nil),              // 23: heyp.proto.FastClusterControllerConfig
+	(*FullClusterControllerConfig)(nil),              // 24: heyp.proto.FullClusterControllerConfig
+	(*AggregatorAgentConfig)(nil),                    // 25: heyp.proto.AggregatorAgentConfig
+	(*ClusterAgentConfig)(nil),                       // 26: heyp.proto.ClusterAgentConfig
+	(*DCMapping_Entry)(nil),                          // 27: heyp.proto.DCMapping.Entry
+	(*SimulatedWanConfig_Pair)(nil),                  // 28: heyp.proto.SimulatedWanConfig.Pair
+	(*DowngradeSelector_HybridHashingConfig)(nil),    // 29: heyp.proto.DowngradeSelector.HybridHashingConfig
+	(*FixedClusterHostAllocs_FlowAllocAndCount)(nil), // 30: heyp.proto.FixedClusterHostAllocs.FlowAllocAndCount
+	(*FixedClusterHostAllocs_Snapshot)(nil),          // 31: heyp.proto.FixedClusterHostAllocs.Snapshot
+	(*FlowMarker)(nil),                               // 32: heyp.proto.FlowMarker
+	(*FlowAlloc)(nil),                                // 33: heyp.proto.FlowAlloc
 }
 var file_heyp_proto_config_proto_depIdxs = []int32{
-	5,  // 0: heyp.proto.HostFlowTrackerConfig.demand_predictor:type_name -> heyp.proto.DemandPredictorConfig
-	5,  // 1: heyp.proto.FlowAggregatorConfig.demand_predictor:type_name -> heyp.proto.DemandPredictorConfig
-	23, // 2: heyp.proto.DCMapping.entries:type_name -> heyp.proto.DCMapping.Entry
-	11, // 3: heyp.proto.StaticDCMapperConfig.mapping:type_name -> heyp.proto.DCMapping
-	0,  // 4: heyp.proto.NetemConfig.delay_dist:type_name -> heyp.proto.NetemDelayDist
-	24, // 5: heyp.proto.SimulatedWanConfig.dc_pairs:type_name -> heyp.proto.SimulatedWanConfig.Pair
-	6,  // 6: heyp.proto.HostAgentConfig.flow_tracker:type_name -> heyp.proto.HostFlowTrackerConfig
-	7,  // 7: heyp.proto.HostAgentConfig.socket_to_host_aggregator:type_name -> heyp.proto.FlowAggregatorConfig
-	8,  // 8: heyp.proto.HostAgentConfig.flow_state_reporter:type_name -> heyp.proto.HostFlowStateReporterConfig
-	9,  // 9: heyp.proto.HostAgentConfig.enforcer:type_name -> heyp.proto.HostEnforcerConfig
-	10, // 10: heyp.proto.HostAgentConfig.daemon:type_name -> heyp.proto.HostDaemonConfig
-	12, // 11: heyp.proto.HostAgentConfig.dc_mapper:type_name -> heyp.proto.StaticDCMapperConfig
-	14, // 12: heyp.proto.HostAgentConfig.simulated_wan:type_name -> heyp.proto.SimulatedWanConfig
-	2,  // 13: heyp.proto.DowngradeSelector.type:type_name -> heyp.proto.DowngradeSelectorType
-	25, // 14: heyp.proto.DowngradeSelector.hybrid_hashing:type_name -> heyp.proto.DowngradeSelector.HybridHashingConfig
-	28, // 15: heyp.proto.FixedClusterHostAllocs.cluster:type_name -> heyp.proto.FlowMarker
-	27, // 16: heyp.proto.FixedClusterHostAllocs.snapshots:type_name -> heyp.proto.FixedClusterHostAllocs.Snapshot
-	1,  // 17: heyp.proto.ClusterAllocatorConfig.type:type_name -> heyp.proto.ClusterAllocatorType
-	16, // 18: heyp.proto.ClusterAllocatorConfig.downgrade_selector:type_name -> heyp.proto.DowngradeSelector
-	17, // 19: heyp.proto.ClusterAllocatorConfig.downgrade_frac_controller:type_name -> heyp.proto.DowngradeFracController
-	3,  // 20: heyp.proto.ClusterAllocatorConfig.simple_downgrade_throttle_hipri:type_name -> heyp.proto.HipriThrottleConditions
-	18, // 21: heyp.proto.ClusterAllocatorConfig.fixed_host_alloc_patterns:type_name -> heyp.proto.FixedClusterHostAllocs
-	17, // 22: heyp.proto.FastClusterControllerConfig.downgrade_frac_controller:type_name -> heyp.proto.DowngradeFracController
-	4,  // 23: heyp.proto.ClusterAgentConfig.controller_type:type_name -> heyp.proto.ClusterControllerType
-	20, // 24: heyp.proto.ClusterAgentConfig.server:type_name -> heyp.proto.ClusterServerConfig
-	7,  // 25: heyp.proto.ClusterAgentConfig.flow_aggregator:type_name -> heyp.proto.FlowAggregatorConfig
-	19, // 26: heyp.proto.ClusterAgentConfig.allocator:type_name -> heyp.proto.ClusterAllocatorConfig
-	21, // 27: heyp.proto.ClusterAgentConfig.fast_controller_config:type_name -> heyp.proto.FastClusterControllerConfig
-	13, // 28: heyp.proto.SimulatedWanConfig.Pair.netem:type_name -> heyp.proto.NetemConfig
-	13, // 29: heyp.proto.SimulatedWanConfig.Pair.netem_lopri:type_name -> heyp.proto.NetemConfig
-	29, // 30: heyp.proto.FixedClusterHostAllocs.FlowAllocAndCount.alloc:type_name -> heyp.proto.FlowAlloc
-	26, // 31: heyp.proto.FixedClusterHostAllocs.Snapshot.host_allocs:type_name -> heyp.proto.FixedClusterHostAllocs.FlowAllocAndCount
-	32, // [32:32] is the sub-list for method output_type
-	32, // [32:32] is the sub-list for method input_type
-	32, // [32:32] is the sub-list for extension type_name
-	32, // [32:32] is the sub-list for extension extendee
-	0,  // [0:32] is the sub-list for field type_name
+	0,  // 0: heyp.proto.DemandPredictorConfig.type:type_name -> heyp.proto.DemandPredictorType
+	6,  // 1: heyp.proto.HostFlowTrackerConfig.demand_predictor:type_name -> heyp.proto.DemandPredictorConfig
+	6,  // 2: heyp.proto.FlowAggregatorConfig.demand_predictor:type_name -> heyp.proto.DemandPredictorConfig
+	27, // 3: heyp.proto.DCMapping.entries:type_name -> heyp.proto.DCMapping.Entry
+	12, // 4: heyp.proto.StaticDCMapperConfig.mapping:type_name -> heyp.proto.DCMapping
+	1,  // 5: heyp.proto.NetemConfig.delay_dist:type_name -> heyp.proto.NetemDelayDist
+	28, // 6: heyp.proto.SimulatedWanConfig.dc_pairs:type_name -> heyp.proto.SimulatedWanConfig.Pair
+	7,  // 7: heyp.proto.HostAgentConfig.flow_tracker:type_name -> heyp.proto.HostFlowTrackerConfig
+	8,  // 8: heyp.proto.HostAgentConfig.socket_to_host_aggregator:type_name -> heyp.proto.FlowAggregatorConfig
+	9,  // 9: heyp.proto.HostAgentConfig.flow_state_reporter:type_name -> heyp.proto.HostFlowStateReporterConfig
+	10, // 10: heyp.proto.HostAgentConfig.enforcer:type_name -> heyp.proto.HostEnforcerConfig
+	11, // 11: heyp.proto.HostAgentConfig.daemon:type_name -> heyp.proto.HostDaemonConfig
+	13, // 12: heyp.proto.HostAgentConfig.dc_mapper:type_name -> heyp.proto.StaticDCMapperConfig
+	15, // 13: heyp.proto.HostAgentConfig.simulated_wan:type_name -> heyp.proto.SimulatedWanConfig
+	3,  // 14: heyp.proto.DowngradeSelector.type:type_name -> heyp.proto.DowngradeSelectorType
+	29, // 15: heyp.proto.DowngradeSelector.hybrid_hashing:type_name -> heyp.proto.DowngradeSelector.HybridHashingConfig
+	32, // 16: heyp.proto.FixedClusterHostAllocs.cluster:type_name -> heyp.proto.FlowMarker
+	31, // 17: heyp.proto.FixedClusterHostAllocs.snapshots:type_name -> heyp.proto.FixedClusterHostAllocs.Snapshot
+	2,  // 18: heyp.proto.ClusterAllocatorConfig.type:type_name -> heyp.proto.ClusterAllocatorType
+	17, // 19: heyp.proto.ClusterAllocatorConfig.downgrade_selector:type_name -> heyp.proto.DowngradeSelector
+	18, // 20: heyp.proto.ClusterAllocatorConfig.downgrade_frac_controller:type_name -> heyp.proto.DowngradeFracController
+	4,  // 21: heyp.proto.ClusterAllocatorConfig.simple_downgrade_throttle_hipri:type_name -> heyp.proto.HipriThrottleConditions
+	19, // 22: heyp.proto.ClusterAllocatorConfig.fixed_host_alloc_patterns:type_name -> heyp.proto.FixedClusterHostAllocs
+	22, // 23: heyp.proto.ClusterServerConfig.adaptive_control:type_name -> heyp.proto.AdaptiveControlConfig
+	18, // 24: heyp.proto.FastClusterControllerConfig.downgrade_frac_controller:type_name -> heyp.proto.DowngradeFracController
+	5,  // 25: heyp.proto.ClusterAgentConfig.controller_type:type_name -> heyp.proto.ClusterControllerType
+	21, // 26: heyp.proto.ClusterAgentConfig.server:type_name -> heyp.proto.ClusterServerConfig
+	8,  // 27: heyp.proto.ClusterAgentConfig.flow_aggregator:type_name -> heyp.proto.FlowAggregatorConfig
+	20, // 28: heyp.proto.ClusterAgentConfig.allocator:type_name -> heyp.proto.ClusterAllocatorConfig
+	24, // 29: heyp.proto.ClusterAgentConfig.full_controller_config:type_name -> heyp.proto.FullClusterControllerConfig
+	23, // 30: heyp.proto.ClusterAgentConfig.fast_controller_config:type_name -> heyp.proto.FastClusterControllerConfig
+	14, // 31: heyp.proto.SimulatedWanConfig.Pair.netem:type_name -> heyp.proto.NetemConfig
+	14, // 32: heyp.proto.SimulatedWanConfig.Pair.netem_lopri:type_name -> heyp.proto.NetemConfig
+	33, // 33: heyp.proto.FixedClusterHostAllocs.FlowAllocAndCount.alloc:type_name -> heyp.proto.FlowAlloc
+	30, // 34: heyp.proto.FixedClusterHostAllocs.Snapshot.host_allocs:type_name -> heyp.proto.FixedClusterHostAllocs.FlowAllocAndCount
+	35, // [35:35] is the sub-list for method output_type
+	35, // [35:35] is the sub-list for method input_type
+	35, // [35:35] is the sub-list for extension type_name
+	35, // [35:35] is the sub-list for extension extendee
+	0,  // [0:35] is the sub-list for field type_name
 }
 
 func init() { file_heyp_proto_config_proto_init() }
@@ -2639,7 +3270,7 @@ func file_heyp_proto_config_proto_init() {
 			}
 		}
 		file_heyp_proto_config_proto_msgTypes[16].Exporter = func(v interface{}, i int) interface{} {
-			switch v := v.(*FastClusterControllerConfig); i {
+			switch v := v.(*AdaptiveControlConfig); i {
 			case 0:
 				return &v.state
 			case 1:
@@ -2651,7 +3282,7 @@ func file_heyp_proto_config_proto_init() {
 			}
 		}
 		file_heyp_proto_config_proto_msgTypes[17].Exporter = func(v interface{}, i int) interface{} {
-			switch v := v.(*ClusterAgentConfig); i {
+			switch v := v.(*FastClusterControllerConfig); i {
 			case 0:
 				return &v.state
 			case 1:
@@ -2663,7 +3294,7 @@ func file_heyp_proto_config_proto_init() {
 			}
 		}
 		file_heyp_proto_config_proto_msgTypes[18].Exporter = func(v interface{}, i int) interface{} {
-			switch v := v.(*DCMapping_Entry); i {
+			switch v := v.(*FullClusterControllerConfig); i {
 			case 0:
 				return &v.state
 			case 1:
@@ -2675,7 +3306,7 @@ func file_heyp_proto_config_proto_init() {
 			}
 		}
 		file_heyp_proto_config_proto_msgTypes[19].Exporter = func(v interface{}, i int) interface{} {
-			switch v := v.(*SimulatedWanConfig_Pair); i {
+			switch v := v.(*AggregatorAgentConfig); i {
 			case 0:
 				return &v.state
 			case 1:
@@ -2687,7 +3318,7 @@ func file_heyp_proto_config_proto_init() {
 			}
 		}
 		file_heyp_proto_config_proto_msgTypes[20].Exporter = func(v interface{}, i int) interface{} {
-			switch v := v.(*DowngradeSelector_HybridHashingConfig); i {
+			switch v := v.(*ClusterAgentConfig); i {
 			case 0:
 				return &v.state
 			case 1:
@@ -2699,7 +3330,7 @@ func file_heyp_proto_config_proto_init() {
 			}
 		}
 		file_heyp_proto_config_proto_msgTypes[21].Exporter = func(v interface{}, i int) interface{} {
-			switch v := v.(*FixedClusterHostAllocs_FlowAllocAndCount); i {
+			switch v := v.(*DCMapping_Entry); i {
 			case 0:
 				return &v.state
 			case 1:
@@ -2711,6 +3342,42 @@ func file_heyp_proto_config_proto_init() {
 			}
 		}
 		file_heyp_proto_config_proto_msgTypes[22].Exporter = func(v interface{}, i int) interface{} {
+			switch v := v.(*SimulatedWanConfig_Pair); i {
+			case 0:
+				return &v.state
+			case 1:
+				return &v.sizeCache
+			case 2:
+				return &v.unknownFields
+			default:
+				return nil
+			}
+		}
+		file_heyp_proto_config_proto_msgTypes[23].Exporter = func(v interface{}, i int) interface{} {
+			switch v := v.(*DowngradeSelector_HybridHashingConfig); i {
+			case 0:
+				return &v.state
+			case 1:
+				return &v.sizeCache
+			case 2:
+				return &v.unknownFields
+			default:
+				return nil
+			}
+		}
+		file_heyp_proto_config_proto_msgTypes[24].Exporter = func(v interface{}, i int) interface{} {
+			switch v := v.(*FixedClusterHostAllocs_FlowAllocAndCount); i {
+			case 0:
+				return &v.state
+			case 1:
+				return &v.sizeCache
+			case 2:
+				return &v.unknownFields
+			default:
+				return nil
+			}
+		}
+		file_heyp_proto_config_proto_msgTypes[25].Exporter = func(v interface{}, i int) interface{} {
 			switch v := v.(*FixedClusterHostAllocs_Snapshot); i {
 			case 0:
 				return &v.state
@@ -2728,8 +3395,8 @@ func file_heyp_proto_config_proto_init() {
 		File: protoimpl.DescBuilder{
 			GoPackagePath: reflect.TypeOf(x{}).PkgPath(),
 			RawDescriptor: file_heyp_proto_config_proto_rawDesc,
-			NumEnums:      5,
-			NumMessages:   23,
+			NumEnums:      6,
+			NumMessages:   26,
 			NumExtensions: 0,
 			NumServices:   0,
 		},
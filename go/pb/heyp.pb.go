@@ -1,7 +1,7 @@
 // Code generated by protoc-gen-go. DO NOT EDIT.
 // versions:
 // 	protoc-gen-go v1.27.1
-// 	protoc        v3.15.6
+// 	protoc        v3.21.12
 // source: heyp/proto/heyp.proto
 
 package pb
@@ -210,6 +210,11 @@ type FlowInfo struct {
 	// aux contains additional info that may not always be present.
 	// Primarily used to dump data for later analysis.
 	Aux *FlowInfo_AuxInfo `protobuf:"bytes,20,opt,name=aux,proto3" json:"aux,omitempty"`
+	// If non-zero, the id of flow's cluster-level FG, as assigned by the
+	// fg_dictionary that the cluster agent sent in an AllocBundle.
+	// Lets the cluster agent skip hashing flow's src_dc and dst_dc. It still checks
+	// them against the id's FG, so ids from an old dictionary are ignored.
+	FgId uint32 `protobuf:"varint,21,opt,name=fg_id,json=fgId,proto3" json:"fg_id,omitempty"`
 }
 
 func (x *FlowInfo) Reset() {
@@ -314,6 +319,13 @@ func (x *FlowInfo) GetAux() *FlowInfo_AuxInfo {
 	return nil
 }
 
+func (x *FlowInfo) GetFgId() uint32 {
+	if x != nil {
+		return x.FgId
+	}
+	return 0
+}
+
 type AggInfo struct {
 	state         protoimpl.MessageState
 	sizeCache     protoimpl.SizeCache
@@ -378,6 +390,9 @@ type InfoBundle struct {
 	Timestamp *timestamppb.Timestamp `protobuf:"bytes,3,opt,name=timestamp,proto3" json:"timestamp,omitempty"`
 	Gen       int64                  `protobuf:"varint,4,opt,name=gen,proto3" json:"gen,omitempty"`
 	FlowInfos []*FlowInfo            `protobuf:"bytes,2,rep,name=flow_infos,json=flowInfos,proto3" json:"flow_infos,omitempty"`
+	// Set if the host could not apply a delta AllocBundle (see
+	// AllocBundle.delta_base_seq) and needs a full one.
+	NeedsFullAlloc bool `protobuf:"varint,5,opt,name=needs_full_alloc,json=needsFullAlloc,proto3" json:"needs_full_alloc,omitempty"`
 }
 
 func (x *InfoBundle) Reset() {
@@ -440,6 +455,13 @@ func (x *InfoBundle) GetFlowInfos() []*FlowInfo {
 	return nil
 }
 
+func (x *InfoBundle) GetNeedsFullAlloc() bool {
+	if x != nil {
+		return x.NeedsFullAlloc
+	}
+	return false
+}
+
 type FlowAlloc struct {
 	state         protoimpl.MessageState
 	sizeCache     protoimpl.SizeCache
@@ -503,6 +525,128 @@ func (x *FlowAlloc) GetLopriRateLimitBps() int64 {
 	return 0
 }
 
+// Parameters of a ThresholdSampler.
+type ThresholdSamplingParams struct {
+	state         protoimpl.MessageState
+	sizeCache     protoimpl.SizeCache
+	unknownFields protoimpl.UnknownFields
+
+	NumSamplesAtApproval float64 `protobuf:"fixed64,1,opt,name=num_samples_at_approval,json=numSamplesAtApproval,proto3" json:"num_samples_at_approval,omitempty"`
+	ApprovalBps          int64   `protobuf:"varint,2,opt,name=approval_bps,json=approvalBps,proto3" json:"approval_bps,omitempty"`
+}
+
+func (x *ThresholdSamplingParams) Reset() {
+	*x = ThresholdSamplingParams{}
+	if protoimpl.UnsafeEnabled {
+		mi := &file_heyp_proto_heyp_proto_msgTypes[5]
+		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
+		ms.StoreMessageInfo(mi)
+	}
+}
+
+func (x *ThresholdSamplingParams) String() string {
+	return protoimpl.X.MessageStringOf(x)
+}
+
+func (*ThresholdSamplingParams) ProtoMessage() {}
+
+func (x *ThresholdSamplingParams) ProtoReflect() protoreflect.Message {
+	mi := &file_heyp_proto_heyp_proto_msgTypes[5]
+	if protoimpl.UnsafeEnabled && x != nil {
+		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
+		if ms.LoadMessageInfo() == nil {
+			ms.StoreMessageInfo(mi)
+		}
+		return ms
+	}
+	return mi.MessageOf(x)
+}
+
+// Deprecated: Use ThresholdSamplingParams.ProtoReflect.Descriptor instead.
+func (*ThresholdSamplingParams) Descriptor() ([]byte, []int) {
+	return file_heyp_proto_heyp_proto_rawDescGZIP(), []int{5}
+}
+
+func (x *ThresholdSamplingParams) GetNumSamplesAtApproval() float64 {
+	if x != nil {
+		return x.NumSamplesAtApproval
+	}
+	return 0
+}
+
+func (x *ThresholdSamplingParams) GetApprovalBps() int64 {
+	if x != nil {
+		return x.ApprovalBps
+	}
+	return 0
+}
+
+type FGDictionaryEntry struct {
+	state         protoimpl.MessageState
+	sizeCache     protoimpl.SizeCache
+	unknownFields protoimpl.UnknownFields
+
+	Flow *FlowMarker `protobuf:"bytes,1,opt,name=flow,proto3" json:"flow,omitempty"` // only src_dc and dst_dc are set
+	Id   uint32      `protobuf:"varint,2,opt,name=id,proto3" json:"id,omitempty"`    // always > 0
+	// If set, hosts only report usage of this FG when it is picked by threshold
+	// sampling. The cluster agent weighs each report by the inverse of its sampling
+	// probability.
+	Sampling *ThresholdSamplingParams `protobuf:"bytes,3,opt,name=sampling,proto3" json:"sampling,omitempty"`
+}
+
+func (x *FGDictionaryEntry) Reset() {
+	*x = FGDictionaryEntry{}
+	if protoimpl.UnsafeEnabled {
+		mi := &file_heyp_proto_heyp_proto_msgTypes[6]
+		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
+		ms.StoreMessageInfo(mi)
+	}
+}
+
+func (x *FGDictionaryEntry) String() string {
+	return protoimpl.X.MessageStringOf(x)
+}
+
+func (*FGDictionaryEntry) ProtoMessage() {}
+
+func (x *FGDictionaryEntry) ProtoReflect() protoreflect.Message {
+	mi := &file_heyp_proto_heyp_proto_msgTypes[6]
+	if protoimpl.UnsafeEnabled && x != nil {
+		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
+		if ms.LoadMessageInfo() == nil {
+			ms.StoreMessageInfo(mi)
+		}
+		return ms
+	}
+	return mi.MessageOf(x)
+}
+
+// Deprecated: Use FGDictionaryEntry.ProtoReflect.Descriptor instead.
+func (*FGDictionaryEntry) Descriptor() ([]byte, []int) {
+	return file_heyp_proto_heyp_proto_rawDescGZIP(), []int{6}
+}
+
+func (x *FGDictionaryEntry) GetFlow() *FlowMarker {
+	if x != nil {
+		return x.Flow
+	}
+	return nil
+}
+
+func (x *FGDictionaryEntry) GetId() uint32 {
+	if x != nil {
+		return x.Id
+	}
+	return 0
+}
+
+func (x *FGDictionaryEntry) GetSampling() *ThresholdSamplingParams {
+	if x != nil {
+		return x.Sampling
+	}
+	return nil
+}
+
 type AllocBundle struct {
 	state         protoimpl.MessageState
 	sizeCache     protoimpl.SizeCache
@@ -510,12 +654,23 @@ type AllocBundle struct {
 
 	FlowAllocs []*FlowAlloc `protobuf:"bytes,1,rep,name=flow_allocs,json=flowAllocs,proto3" json:"flow_allocs,omitempty"`
 	Gen        int64        `protobuf:"varint,2,opt,name=gen,proto3" json:"gen,omitempty"`
+	// Entries of the cluster agent's FG dictionary, in id order.
+	// The first AllocBundle of each stream carries the full dictionary (starting at
+	// id 1), which replaces whatever the host had. Later bundles may append entries
+	// as new FGs are seen.
+	FgDictionary []*FGDictionaryEntry `protobuf:"bytes,3,rep,name=fg_dictionary,json=fgDictionary,proto3" json:"fg_dictionary,omitempty"`
+	// Bundles sent in delta mode are numbered 1, 2, ... on each stream.
+	// Zero means that the bundle is unnumbered (and full).
+	Seq uint64 `protobuf:"varint,4,opt,name=seq,proto3" json:"seq,omitempty"`
+	// If non-zero, this bundle is a delta: flow_allocs only holds the allocs that
+	// changed since the bundle numbered delta_base_seq, and the others carry over.
+	DeltaBaseSeq uint64 `protobuf:"varint,5,opt,name=delta_base_seq,json=deltaBaseSeq,proto3" json:"delta_base_seq,omitempty"`
 }
 
 func (x *AllocBundle) Reset() {
 	*x = AllocBundle{}
 	if protoimpl.UnsafeEnabled {
-		mi := &file_heyp_proto_heyp_proto_msgTypes[5]
+		mi := &file_heyp_proto_heyp_proto_msgTypes[7]
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		ms.StoreMessageInfo(mi)
 	}
@@ -528,7 +683,7 @@ func (x *AllocBundle) String() string {
 func (*AllocBundle) ProtoMessage() {}
 
 func (x *AllocBundle) ProtoReflect() protoreflect.Message {
-	mi := &file_heyp_proto_heyp_proto_msgTypes[5]
+	mi := &file_heyp_proto_heyp_proto_msgTypes[7]
 	if protoimpl.UnsafeEnabled && x != nil {
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		if ms.LoadMessageInfo() == nil {
@@ -541,7 +696,7 @@ func (x *AllocBundle) ProtoReflect() protoreflect.Message {
 
 // Deprecated: Use AllocBundle.ProtoReflect.Descriptor instead.
 func (*AllocBundle) Descriptor() ([]byte, []int) {
-	return file_heyp_proto_heyp_proto_rawDescGZIP(), []int{5}
+	return file_heyp_proto_heyp_proto_rawDescGZIP(), []int{7}
 }
 
 func (x *AllocBundle) GetFlowAllocs() []*FlowAlloc {
@@ -558,6 +713,339 @@ func (x *AllocBundle) GetGen() int64 {
 	return 0
 }
 
+func (x *AllocBundle) GetFgDictionary() []*FGDictionaryEntry {
+	if x != nil {
+		return x.FgDictionary
+	}
+	return nil
+}
+
+func (x *AllocBundle) GetSeq() uint64 {
+	if x != nil {
+		return x.Seq
+	}
+	return 0
+}
+
+func (x *AllocBundle) GetDeltaBaseSeq() uint64 {
+	if x != nil {
+		return x.DeltaBaseSeq
+	}
+	return 0
+}
+
+// Usage of one cluster-level FG, summarized by an aggregator-agent over the hosts
+// that report to it.
+type AggregatedFGInfo struct {
+	state         protoimpl.MessageState
+	sizeCache     protoimpl.SizeCache
+	unknownFields protoimpl.UnknownFields
+
+	Flow *FlowMarker `protobuf:"bytes,1,opt,name=flow,proto3" json:"flow,omitempty"` // only src_dc and dst_dc are set
+	// Total usage of all children (not only the sampled ones).
+	HipriUsageBps int64 `protobuf:"varint,2,opt,name=hipri_usage_bps,json=hipriUsageBps,proto3" json:"hipri_usage_bps,omitempty"`
+	LopriUsageBps int64 `protobuf:"varint,3,opt,name=lopri_usage_bps,json=lopriUsageBps,proto3" json:"lopri_usage_bps,omitempty"`
+	// Children picked by threshold sampling.
+	SampledChildren []*AggregatedFGInfo_Child `protobuf:"bytes,4,rep,name=sampled_children,json=sampledChildren,proto3" json:"sampled_children,omitempty"`
+}
+
+func (x *AggregatedFGInfo) Reset() {
+	*x = AggregatedFGInfo{}
+	if protoimpl.UnsafeEnabled {
+		mi := &file_heyp_proto_heyp_proto_msgTypes[8]
+		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
+		ms.StoreMessageInfo(mi)
+	}
+}
+
+func (x *AggregatedFGInfo) String() string {
+	return protoimpl.X.MessageStringOf(x)
+}
+
+func (*AggregatedFGInfo) ProtoMessage() {}
+
+func (x *AggregatedFGInfo) ProtoReflect() protoreflect.Message {
+	mi := &file_heyp_proto_heyp_proto_msgTypes[8]
+	if protoimpl.UnsafeEnabled && x != nil {
+		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
+		if ms.LoadMessageInfo() == nil {
+			ms.StoreMessageInfo(mi)
+		}
+		return ms
+	}
+	return mi.MessageOf(x)
+}
+
+// Deprecated: Use AggregatedFGInfo.ProtoReflect.Descriptor instead.
+func (*AggregatedFGInfo) Descriptor() ([]byte, []int) {
+	return file_heyp_proto_heyp_proto_rawDescGZIP(), []int{8}
+}
+
+func (x *AggregatedFGInfo) GetFlow() *FlowMarker {
+	if x != nil {
+		return x.Flow
+	}
+	return nil
+}
+
+func (x *AggregatedFGInfo) GetHipriUsageBps() int64 {
+	if x != nil {
+		return x.HipriUsageBps
+	}
+	return 0
+}
+
+func (x *AggregatedFGInfo) GetLopriUsageBps() int64 {
+	if x != nil {
+		return x.LopriUsageBps
+	}
+	return 0
+}
+
+func (x *AggregatedFGInfo) GetSampledChildren() []*AggregatedFGInfo_Child {
+	if x != nil {
+		return x.SampledChildren
+	}
+	return nil
+}
+
+type HostGen struct {
+	state         protoimpl.MessageState
+	sizeCache     protoimpl.SizeCache
+	unknownFields protoimpl.UnknownFields
+
+	HostId         uint64 `protobuf:"varint,1,opt,name=host_id,json=hostId,proto3" json:"host_id,omitempty"`
+	Gen            int64  `protobuf:"varint,2,opt,name=gen,proto3" json:"gen,omitempty"`
+	NeedsFullAlloc bool   `protobuf:"varint,3,opt,name=needs_full_alloc,json=needsFullAlloc,proto3" json:"needs_full_alloc,omitempty"` // see InfoBundle.needs_full_alloc
+}
+
+func (x *HostGen) Reset() {
+	*x = HostGen{}
+	if protoimpl.UnsafeEnabled {
+		mi := &file_heyp_proto_heyp_proto_msgTypes[9]
+		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
+		ms.StoreMessageInfo(mi)
+	}
+}
+
+func (x *HostGen) String() string {
+	return protoimpl.X.MessageStringOf(x)
+}
+
+func (*HostGen) ProtoMessage() {}
+
+func (x *HostGen) ProtoReflect() protoreflect.Message {
+	mi := &file_heyp_proto_heyp_proto_msgTypes[9]
+	if protoimpl.UnsafeEnabled && x != nil {
+		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
+		if ms.LoadMessageInfo() == nil {
+			ms.StoreMessageInfo(mi)
+		}
+		return ms
+	}
+	return mi.MessageOf(x)
+}
+
+// Deprecated: Use HostGen.ProtoReflect.Descriptor instead.
+func (*HostGen) Descriptor() ([]byte, []int) {
+	return file_heyp_proto_heyp_proto_rawDescGZIP(), []int{9}
+}
+
+func (x *HostGen) GetHostId() uint64 {
+	if x != nil {
+		return x.HostId
+	}
+	return 0
+}
+
+func (x *HostGen) GetGen() int64 {
+	if x != nil {
+		return x.Gen
+	}
+	return 0
+}
+
+func (x *HostGen) GetNeedsFullAlloc() bool {
+	if x != nil {
+		return x.NeedsFullAlloc
+	}
+	return false
+}
+
+type AggregatedInfoBundle struct {
+	state         protoimpl.MessageState
+	sizeCache     protoimpl.SizeCache
+	unknownFields protoimpl.UnknownFields
+
+	Aggregator *FlowMarker         `protobuf:"bytes,1,opt,name=aggregator,proto3" json:"aggregator,omitempty"` // host_id identifies the aggregator-agent
+	Gen        int64               `protobuf:"varint,2,opt,name=gen,proto3" json:"gen,omitempty"`
+	FgInfos    []*AggregatedFGInfo `protobuf:"bytes,3,rep,name=fg_infos,json=fgInfos,proto3" json:"fg_infos,omitempty"`
+	// Hosts that reported since the previous AggregatedInfoBundle.
+	HostGens []*HostGen `protobuf:"bytes,4,rep,name=host_gens,json=hostGens,proto3" json:"host_gens,omitempty"`
+}
+
+func (x *AggregatedInfoBundle) Reset() {
+	*x = AggregatedInfoBundle{}
+	if protoimpl.UnsafeEnabled {
+		mi := &file_heyp_proto_heyp_proto_msgTypes[10]
+		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
+		ms.StoreMessageInfo(mi)
+	}
+}
+
+func (x *AggregatedInfoBundle) String() string {
+	return protoimpl.X.MessageStringOf(x)
+}
+
+func (*AggregatedInfoBundle) ProtoMessage() {}
+
+func (x *AggregatedInfoBundle) ProtoReflect() protoreflect.Message {
+	mi := &file_heyp_proto_heyp_proto_msgTypes[10]
+	if protoimpl.UnsafeEnabled && x != nil {
+		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
+		if ms.LoadMessageInfo() == nil {
+			ms.StoreMessageInfo(mi)
+		}
+		return ms
+	}
+	return mi.MessageOf(x)
+}
+
+// Deprecated: Use AggregatedInfoBundle.ProtoReflect.Descriptor instead.
+func (*AggregatedInfoBundle) Descriptor() ([]byte, []int) {
+	return file_heyp_proto_heyp_proto_rawDescGZIP(), []int{10}
+}
+
+func (x *AggregatedInfoBundle) GetAggregator() *FlowMarker {
+	if x != nil {
+		return x.Aggregator
+	}
+	return nil
+}
+
+func (x *AggregatedInfoBundle) GetGen() int64 {
+	if x != nil {
+		return x.Gen
+	}
+	return 0
+}
+
+func (x *AggregatedInfoBundle) GetFgInfos() []*AggregatedFGInfo {
+	if x != nil {
+		return x.FgInfos
+	}
+	return nil
+}
+
+func (x *AggregatedInfoBundle) GetHostGens() []*HostGen {
+	if x != nil {
+		return x.HostGens
+	}
+	return nil
+}
+
+type RelayedAllocBundle struct {
+	state         protoimpl.MessageState
+	sizeCache     protoimpl.SizeCache
+	unknownFields protoimpl.UnknownFields
+
+	HostId uint64 `protobuf:"varint,1,opt,name=host_id,json=hostId,proto3" json:"host_id,omitempty"`
+	Bundle []byte `protobuf:"bytes,2,opt,name=bundle,proto3" json:"bundle,omitempty"` // serialized AllocBundle, passed through to the host as is
+}
+
+func (x *RelayedAllocBundle) Reset() {
+	*x = RelayedAllocBundle{}
+	if protoimpl.UnsafeEnabled {
+		mi := &file_heyp_proto_heyp_proto_msgTypes[11]
+		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
+		ms.StoreMessageInfo(mi)
+	}
+}
+
+func (x *RelayedAllocBundle) String() string {
+	return protoimpl.X.MessageStringOf(x)
+}
+
+func (*RelayedAllocBundle) ProtoMessage() {}
+
+func (x *RelayedAllocBundle) ProtoReflect() protoreflect.Message {
+	mi := &file_heyp_proto_heyp_proto_msgTypes[11]
+	if protoimpl.UnsafeEnabled && x != nil {
+		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
+		if ms.LoadMessageInfo() == nil {
+			ms.StoreMessageInfo(mi)
+		}
+		return ms
+	}
+	return mi.MessageOf(x)
+}
+
+// Deprecated: Use RelayedAllocBundle.ProtoReflect.Descriptor instead.
+func (*RelayedAllocBundle) Descriptor() ([]byte, []int) {
+	return file_heyp_proto_heyp_proto_rawDescGZIP(), []int{11}
+}
+
+func (x *RelayedAllocBundle) GetHostId() uint64 {
+	if x != nil {
+		return x.HostId
+	}
+	return 0
+}
+
+func (x *RelayedAllocBundle) GetBundle() []byte {
+	if x != nil {
+		return x.Bundle
+	}
+	return nil
+}
+
+type RelayedAllocBatch struct {
+	state         protoimpl.MessageState
+	sizeCache     protoimpl.SizeCache
+	unknownFields protoimpl.UnknownFields
+
+	Allocs []*RelayedAllocBundle `protobuf:"bytes,1,rep,name=allocs,proto3" json:"allocs,omitempty"`
+}
+
+func (x *RelayedAllocBatch) Reset() {
+	*x = RelayedAllocBatch{}
+	if protoimpl.UnsafeEnabled {
+		mi := &file_heyp_proto_heyp_proto_msgTypes[12]
+		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
+		ms.StoreMessageInfo(mi)
+	}
+}
+
+func (x *RelayedAllocBatch) String() string {
+	return protoimpl.X.MessageStringOf(x)
+}
+
+func (*RelayedAllocBatch) ProtoMessage() {}
+
+func (x *RelayedAllocBatch) ProtoReflect() protoreflect.Message {
+	mi := &file_heyp_proto_heyp_proto_msgTypes[12]
+	if protoimpl.UnsafeEnabled && x != nil {
+		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
+		if ms.LoadMessageInfo() == nil {
+			ms.StoreMessageInfo(mi)
+		}
+		return ms
+	}
+	return mi.MessageOf(x)
+}
+
+// Deprecated: Use RelayedAllocBatch.ProtoReflect.Descriptor instead.
+func (*RelayedAllocBatch) Descriptor() ([]byte, []int) {
+	return file_heyp_proto_heyp_proto_rawDescGZIP(), []int{12}
+}
+
+func (x *RelayedAllocBatch) GetAllocs() []*RelayedAllocBundle {
+	if x != nil {
+		return x.Allocs
+	}
+	return nil
+}
+
 type FlowInfo_AuxInfo struct {
 	state         protoimpl.MessageState
 	sizeCache     protoimpl.SizeCache
@@ -619,7 +1107,7 @@ type FlowInfo_AuxInfo struct {
 func (x *FlowInfo_AuxInfo) Reset() {
 	*x = FlowInfo_AuxInfo{}
 	if protoimpl.UnsafeEnabled {
-		mi := &file_heyp_proto_heyp_proto_msgTypes[6]
+		mi := &file_heyp_proto_heyp_proto_msgTypes[13]
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		ms.StoreMessageInfo(mi)
 	}
@@ -632,7 +1120,7 @@ func (x *FlowInfo_AuxInfo) String() string {
 func (*FlowInfo_AuxInfo) ProtoMessage() {}
 
 func (x *FlowInfo_AuxInfo) ProtoReflect() protoreflect.Message {
-	mi := &file_heyp_proto_heyp_proto_msgTypes[6]
+	mi := &file_heyp_proto_heyp_proto_msgTypes[13]
 	if protoimpl.UnsafeEnabled && x != nil {
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		if ms.LoadMessageInfo() == nil {
@@ -1005,6 +1493,69 @@ func (x *FlowInfo_AuxInfo) GetUnacked() int64 {
 	return 0
 }
 
+type AggregatedFGInfo_Child struct {
+	state         protoimpl.MessageState
+	sizeCache     protoimpl.SizeCache
+	unknownFields protoimpl.UnknownFields
+
+	HostId         uint64 `protobuf:"varint,1,opt,name=host_id,json=hostId,proto3" json:"host_id,omitempty"`
+	EwmaUsageBps   int64  `protobuf:"varint,2,opt,name=ewma_usage_bps,json=ewmaUsageBps,proto3" json:"ewma_usage_bps,omitempty"`
+	CurrentlyLopri bool   `protobuf:"varint,3,opt,name=currently_lopri,json=currentlyLopri,proto3" json:"currently_lopri,omitempty"`
+}
+
+func (x *AggregatedFGInfo_Child) Reset() {
+	*x = AggregatedFGInfo_Child{}
+	if protoimpl.UnsafeEnabled {
+		mi := &file_heyp_proto_heyp_proto_msgTypes[14]
+		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
+		ms.StoreMessageInfo(mi)
+	}
+}
+
+func (x *AggregatedFGInfo_Child) String() string {
+	return protoimpl.X.MessageStringOf(x)
+}
+
+func (*AggregatedFGInfo_Child) ProtoMessage() {}
+
+func (x *AggregatedFGInfo_Child) ProtoReflect() protoreflect.Message {
+	mi := &file_heyp_proto_heyp_proto_msgTypes[14]
+	if protoimpl.UnsafeEnabled && x != nil {
+		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
+		if ms.LoadMessageInfo() == nil {
+			ms.StoreMessageInfo(mi)
+		}
+		return ms
+	}
+	return mi.MessageOf(x)
+}
+
+// Deprecated: Use AggregatedFGInfo_Child.ProtoReflect.Descriptor instead.
+func (*AggregatedFGInfo_Child) Descriptor() ([]byte, []int) {
+	return file_heyp_proto_heyp_proto_rawDescGZIP(), []int{8, 0}
+}
+
+func (x *AggregatedFGInfo_Child) GetHostId() uint64 {
+	if x != nil {
+		return x.HostId
+	}
+	return 0
+}
+
+func (x *AggregatedFGInfo_Child) GetEwmaUsageBps() int64 {
+	if x != nil {
+		return x.EwmaUsageBps
+	}
+	return 0
+}
+
+func (x *AggregatedFGInfo_Child) GetCurrentlyLopri() bool {
+	if x != nil {
+		return x.CurrentlyLopri
+	}
+	return false
+}
+
 var File_heyp_proto_heyp_proto protoreflect.FileDescriptor
 
 var file_heyp_proto_heyp_proto_rawDesc = []byte{
@@ -1030,7 +1581,7 @@ var file_heyp_proto_heyp_proto_rawDesc = []byte{
 	0x19, 0x0a, 0x08, 0x64, 0x73, 0x74, 0x5f, 0x70, 0x6f, 0x72, 0x74, 0x18, 0x08, 0x20, 0x01, 0x28,
 	0x05, 0x52, 0x07, 0x64, 0x73, 0x74, 0x50, 0x6f, 0x72, 0x74, 0x12, 0x16, 0x0a, 0x06, 0x73, 0x65,
 	0x71, 0x6e, 0x75, 0x6d, 0x18, 0x09, 0x20, 0x01, 0x28, 0x04, 0x52, 0x06, 0x73, 0x65, 0x71, 0x6e,
-	0x75, 0x6d, 0x22, 0xde, 0x0f, 0x0a, 0x08, 0x46, 0x6c, 0x6f, 0x77, 0x49, 0x6e, 0x66, 0x6f, 0x12,
+	0x75, 0x6d, 0x22, 0xf3, 0x0f, 0x0a, 0x08, 0x46, 0x6c, 0x6f, 0x77, 0x49, 0x6e, 0x66, 0x6f, 0x12,
 	0x2a, 0x0a, 0x04, 0x66, 0x6c, 0x6f, 0x77, 0x18, 0x01, 0x20, 0x01, 0x28, 0x0b, 0x32, 0x16, 0x2e,
 	0x68, 0x65, 0x79, 0x70, 0x2e, 0x70, 0x72, 0x6f, 0x74, 0x6f, 0x2e, 0x46, 0x6c, 0x6f, 0x77, 0x4d,
 	0x61, 0x72, 0x6b, 0x65, 0x72, 0x52, 0x04, 0x66, 0x6c, 0x6f, 0x77, 0x12, 0x30, 0x0a, 0x14, 0x70,
@@ -1059,149 +1610,232 @@ var file_heyp_proto_heyp_proto_rawDesc = []byte{
 	0x72, 0x72, 0x65, 0x6e, 0x74, 0x6c, 0x79, 0x4c, 0x6f, 0x70, 0x72, 0x69, 0x12, 0x2e, 0x0a, 0x03,
 	0x61, 0x75, 0x78, 0x18, 0x14, 0x20, 0x01, 0x28, 0x0b, 0x32, 0x1c, 0x2e, 0x68, 0x65, 0x79, 0x70,
 	0x2e, 0x70, 0x72, 0x6f, 0x74, 0x6f, 0x2e, 0x46, 0x6c, 0x6f, 0x77, 0x49, 0x6e, 0x66, 0x6f, 0x2e,
-	0x41, 0x75, 0x78, 0x49, 0x6e, 0x66, 0x6f, 0x52, 0x03, 0x61, 0x75, 0x78, 0x1a, 0x84, 0x0c, 0x0a,
-	0x07, 0x41, 0x75, 0x78, 0x49, 0x6e, 0x66, 0x6f, 0x12, 0x1f, 0x0a, 0x0b, 0x61, 0x70, 0x70, 0x5f,
-	0x6c, 0x69, 0x6d, 0x69, 0x74, 0x65, 0x64, 0x18, 0x01, 0x20, 0x01, 0x28, 0x08, 0x52, 0x0a, 0x61,
-	0x70, 0x70, 0x4c, 0x69, 0x6d, 0x69, 0x74, 0x65, 0x64, 0x12, 0x15, 0x0a, 0x06, 0x61, 0x74, 0x6f,
-	0x5f, 0x6d, 0x73, 0x18, 0x02, 0x20, 0x01, 0x28, 0x01, 0x52, 0x05, 0x61, 0x74, 0x6f, 0x4d, 0x73,
-	0x12, 0x22, 0x0a, 0x0d, 0x62, 0x62, 0x72, 0x5f, 0x63, 0x77, 0x6e, 0x64, 0x5f, 0x67, 0x61, 0x69,
-	0x6e, 0x18, 0x03, 0x20, 0x01, 0x28, 0x01, 0x52, 0x0b, 0x62, 0x62, 0x72, 0x43, 0x77, 0x6e, 0x64,
-	0x47, 0x61, 0x69, 0x6e, 0x12, 0x23, 0x0a, 0x0e, 0x62, 0x62, 0x72, 0x5f, 0x6d, 0x69, 0x6e, 0x5f,
-	0x72, 0x74, 0x74, 0x5f, 0x6d, 0x73, 0x18, 0x04, 0x20, 0x01, 0x28, 0x01, 0x52, 0x0b, 0x62, 0x62,
-	0x72, 0x4d, 0x69, 0x6e, 0x52, 0x74, 0x74, 0x4d, 0x73, 0x12, 0x26, 0x0a, 0x0f, 0x62, 0x62, 0x72,
-	0x5f, 0x70, 0x61, 0x63, 0x69, 0x6e, 0x67, 0x5f, 0x67, 0x61, 0x69, 0x6e, 0x18, 0x05, 0x20, 0x01,
-	0x28, 0x01, 0x52, 0x0d, 0x62, 0x62, 0x72, 0x50, 0x61, 0x63, 0x69, 0x6e, 0x67, 0x47, 0x61, 0x69,
-	0x6e, 0x12, 0x1c, 0x0a, 0x0a, 0x6d, 0x69, 0x6e, 0x5f, 0x72, 0x74, 0x74, 0x5f, 0x6d, 0x73, 0x18,
-	0x06, 0x20, 0x01, 0x28, 0x01, 0x52, 0x08, 0x6d, 0x69, 0x6e, 0x52, 0x74, 0x74, 0x4d, 0x73, 0x12,
-	0x1c, 0x0a, 0x0a, 0x72, 0x63, 0x76, 0x5f, 0x72, 0x74, 0x74, 0x5f, 0x6d, 0x73, 0x18, 0x07, 0x20,
-	0x01, 0x28, 0x01, 0x52, 0x08, 0x72, 0x63, 0x76, 0x52, 0x74, 0x74, 0x4d, 0x73, 0x12, 0x15, 0x0a,
-	0x06, 0x72, 0x74, 0x6f, 0x5f, 0x6d, 0x73, 0x18, 0x08, 0x20, 0x01, 0x28, 0x01, 0x52, 0x05, 0x72,
-	0x74, 0x6f, 0x4d, 0x73, 0x12, 0x15, 0x0a, 0x06, 0x72, 0x74, 0x74, 0x5f, 0x6d, 0x73, 0x18, 0x09,
-	0x20, 0x01, 0x28, 0x01, 0x52, 0x05, 0x72, 0x74, 0x74, 0x4d, 0x73, 0x12, 0x1c, 0x0a, 0x0a, 0x72,
-	0x74, 0x74, 0x5f, 0x76, 0x61, 0x72, 0x5f, 0x6d, 0x73, 0x18, 0x0a, 0x20, 0x01, 0x28, 0x01, 0x52,
-	0x08, 0x72, 0x74, 0x74, 0x56, 0x61, 0x72, 0x4d, 0x73, 0x12, 0x16, 0x0a, 0x06, 0x61, 0x64, 0x76,
-	0x6d, 0x73, 0x73, 0x18, 0x0b, 0x20, 0x01, 0x28, 0x03, 0x52, 0x06, 0x61, 0x64, 0x76, 0x6d, 0x73,
-	0x73, 0x12, 0x18, 0x0a, 0x07, 0x62, 0x61, 0x63, 0x6b, 0x6f, 0x66, 0x66, 0x18, 0x0c, 0x20, 0x01,
-	0x28, 0x03, 0x52, 0x07, 0x62, 0x61, 0x63, 0x6b, 0x6f, 0x66, 0x66, 0x12, 0x15, 0x0a, 0x06, 0x62,
-	0x62, 0x72, 0x5f, 0x62, 0x77, 0x18, 0x0d, 0x20, 0x01, 0x28, 0x03, 0x52, 0x05, 0x62, 0x62, 0x72,
-	0x42, 0x77, 0x12, 0x20, 0x0a, 0x0c, 0x62, 0x75, 0x73, 0x79, 0x5f, 0x74, 0x69, 0x6d, 0x65, 0x5f,
-	0x6d, 0x73, 0x18, 0x0e, 0x20, 0x01, 0x28, 0x03, 0x52, 0x0a, 0x62, 0x75, 0x73, 0x79, 0x54, 0x69,
-	0x6d, 0x65, 0x4d, 0x73, 0x12, 0x1f, 0x0a, 0x0b, 0x62, 0x79, 0x74, 0x65, 0x73, 0x5f, 0x61, 0x63,
-	0x6b, 0x65, 0x64, 0x18, 0x0f, 0x20, 0x01, 0x28, 0x03, 0x52, 0x0a, 0x62, 0x79, 0x74, 0x65, 0x73,
-	0x41, 0x63, 0x6b, 0x65, 0x64, 0x12, 0x25, 0x0a, 0x0e, 0x62, 0x79, 0x74, 0x65, 0x73, 0x5f, 0x72,
-	0x65, 0x63, 0x65, 0x69, 0x76, 0x65, 0x64, 0x18, 0x10, 0x20, 0x01, 0x28, 0x03, 0x52, 0x0d, 0x62,
-	0x79, 0x74, 0x65, 0x73, 0x52, 0x65, 0x63, 0x65, 0x69, 0x76, 0x65, 0x64, 0x12, 0x23, 0x0a, 0x0d,
-	0x62, 0x79, 0x74, 0x65, 0x73, 0x5f, 0x72, 0x65, 0x74, 0x72, 0x61, 0x6e, 0x73, 0x18, 0x11, 0x20,
-	0x01, 0x28, 0x03, 0x52, 0x0c, 0x62, 0x79, 0x74, 0x65, 0x73, 0x52, 0x65, 0x74, 0x72, 0x61, 0x6e,
-	0x73, 0x12, 0x12, 0x0a, 0x04, 0x63, 0x77, 0x6e, 0x64, 0x18, 0x12, 0x20, 0x01, 0x28, 0x03, 0x52,
-	0x04, 0x63, 0x77, 0x6e, 0x64, 0x12, 0x20, 0x0a, 0x0c, 0x64, 0x61, 0x74, 0x61, 0x5f, 0x73, 0x65,
-	0x67, 0x73, 0x5f, 0x69, 0x6e, 0x18, 0x13, 0x20, 0x01, 0x28, 0x03, 0x52, 0x0a, 0x64, 0x61, 0x74,
-	0x61, 0x53, 0x65, 0x67, 0x73, 0x49, 0x6e, 0x12, 0x22, 0x0a, 0x0d, 0x64, 0x61, 0x74, 0x61, 0x5f,
-	0x73, 0x65, 0x67, 0x73, 0x5f, 0x6f, 0x75, 0x74, 0x18, 0x14, 0x20, 0x01, 0x28, 0x03, 0x52, 0x0b,
-	0x64, 0x61, 0x74, 0x61, 0x53, 0x65, 0x67, 0x73, 0x4f, 0x75, 0x74, 0x12, 0x1c, 0x0a, 0x09, 0x64,
-	0x65, 0x6c, 0x69, 0x76, 0x65, 0x72, 0x65, 0x64, 0x18, 0x15, 0x20, 0x01, 0x28, 0x03, 0x52, 0x09,
-	0x64, 0x65, 0x6c, 0x69, 0x76, 0x65, 0x72, 0x65, 0x64, 0x12, 0x21, 0x0a, 0x0c, 0x64, 0x65, 0x6c,
-	0x69, 0x76, 0x65, 0x72, 0x65, 0x64, 0x5f, 0x63, 0x65, 0x18, 0x16, 0x20, 0x01, 0x28, 0x03, 0x52,
-	0x0b, 0x64, 0x65, 0x6c, 0x69, 0x76, 0x65, 0x72, 0x65, 0x64, 0x43, 0x65, 0x12, 0x23, 0x0a, 0x0d,
-	0x64, 0x65, 0x6c, 0x69, 0x76, 0x65, 0x72, 0x79, 0x5f, 0x72, 0x61, 0x74, 0x65, 0x18, 0x17, 0x20,
-	0x01, 0x28, 0x03, 0x52, 0x0c, 0x64, 0x65, 0x6c, 0x69, 0x76, 0x65, 0x72, 0x79, 0x52, 0x61, 0x74,
-	0x65, 0x12, 0x1d, 0x0a, 0x0a, 0x64, 0x73, 0x61, 0x63, 0x6b, 0x5f, 0x64, 0x75, 0x70, 0x73, 0x18,
-	0x18, 0x20, 0x01, 0x28, 0x03, 0x52, 0x09, 0x64, 0x73, 0x61, 0x63, 0x6b, 0x44, 0x75, 0x70, 0x73,
-	0x12, 0x18, 0x0a, 0x07, 0x66, 0x61, 0x63, 0x6b, 0x65, 0x74, 0x73, 0x18, 0x19, 0x20, 0x01, 0x28,
-	0x03, 0x52, 0x07, 0x66, 0x61, 0x63, 0x6b, 0x65, 0x74, 0x73, 0x12, 0x1d, 0x0a, 0x0a, 0x6c, 0x61,
-	0x73, 0x74, 0x61, 0x63, 0x6b, 0x5f, 0x6d, 0x73, 0x18, 0x1a, 0x20, 0x01, 0x28, 0x03, 0x52, 0x09,
-	0x6c, 0x61, 0x73, 0x74, 0x61, 0x63, 0x6b, 0x4d, 0x73, 0x12, 0x1d, 0x0a, 0x0a, 0x6c, 0x61, 0x73,
-	0x74, 0x72, 0x63, 0x76, 0x5f, 0x6d, 0x73, 0x18, 0x1b, 0x20, 0x01, 0x28, 0x03, 0x52, 0x09, 0x6c,
-	0x61, 0x73, 0x74, 0x72, 0x63, 0x76, 0x4d, 0x73, 0x12, 0x1d, 0x0a, 0x0a, 0x6c, 0x61, 0x73, 0x74,
-	0x73, 0x6e, 0x64, 0x5f, 0x6d, 0x73, 0x18, 0x1c, 0x20, 0x01, 0x28, 0x03, 0x52, 0x09, 0x6c, 0x61,
-	0x73, 0x74, 0x73, 0x6e, 0x64, 0x4d, 0x73, 0x12, 0x12, 0x0a, 0x04, 0x6c, 0x6f, 0x73, 0x74, 0x18,
-	0x1d, 0x20, 0x01, 0x28, 0x03, 0x52, 0x04, 0x6c, 0x6f, 0x73, 0x74, 0x12, 0x10, 0x0a, 0x03, 0x6d,
-	0x73, 0x73, 0x18, 0x1e, 0x20, 0x01, 0x28, 0x03, 0x52, 0x03, 0x6d, 0x73, 0x73, 0x12, 0x19, 0x0a,
-	0x08, 0x6e, 0x6f, 0x74, 0x5f, 0x73, 0x65, 0x6e, 0x74, 0x18, 0x1f, 0x20, 0x01, 0x28, 0x03, 0x52,
-	0x07, 0x6e, 0x6f, 0x74, 0x53, 0x65, 0x6e, 0x74, 0x12, 0x1f, 0x0a, 0x0b, 0x70, 0x61, 0x63, 0x69,
-	0x6e, 0x67, 0x5f, 0x72, 0x61, 0x74, 0x65, 0x18, 0x20, 0x20, 0x01, 0x28, 0x03, 0x52, 0x0a, 0x70,
-	0x61, 0x63, 0x69, 0x6e, 0x67, 0x52, 0x61, 0x74, 0x65, 0x12, 0x26, 0x0a, 0x0f, 0x70, 0x61, 0x63,
-	0x69, 0x6e, 0x67, 0x5f, 0x72, 0x61, 0x74, 0x65, 0x5f, 0x6d, 0x61, 0x78, 0x18, 0x21, 0x20, 0x01,
-	0x28, 0x03, 0x52, 0x0d, 0x70, 0x61, 0x63, 0x69, 0x6e, 0x67, 0x52, 0x61, 0x74, 0x65, 0x4d, 0x61,
-	0x78, 0x12, 0x12, 0x0a, 0x04, 0x70, 0x6d, 0x74, 0x75, 0x18, 0x22, 0x20, 0x01, 0x28, 0x03, 0x52,
-	0x04, 0x70, 0x6d, 0x74, 0x75, 0x12, 0x12, 0x0a, 0x04, 0x71, 0x61, 0x63, 0x6b, 0x18, 0x23, 0x20,
-	0x01, 0x28, 0x03, 0x52, 0x04, 0x71, 0x61, 0x63, 0x6b, 0x12, 0x1b, 0x0a, 0x09, 0x72, 0x63, 0x76,
-	0x5f, 0x73, 0x70, 0x61, 0x63, 0x65, 0x18, 0x24, 0x20, 0x01, 0x28, 0x03, 0x52, 0x08, 0x72, 0x63,
-	0x76, 0x53, 0x70, 0x61, 0x63, 0x65, 0x12, 0x21, 0x0a, 0x0c, 0x72, 0x63, 0x76, 0x5f, 0x73, 0x73,
-	0x74, 0x68, 0x72, 0x65, 0x73, 0x68, 0x18, 0x25, 0x20, 0x01, 0x28, 0x03, 0x52, 0x0b, 0x72, 0x63,
-	0x76, 0x53, 0x73, 0x74, 0x68, 0x72, 0x65, 0x73, 0x68, 0x12, 0x1d, 0x0a, 0x0a, 0x72, 0x63, 0x76,
-	0x5f, 0x77, 0x73, 0x63, 0x61, 0x6c, 0x65, 0x18, 0x26, 0x20, 0x01, 0x28, 0x03, 0x52, 0x09, 0x72,
-	0x63, 0x76, 0x57, 0x73, 0x63, 0x61, 0x6c, 0x65, 0x12, 0x16, 0x0a, 0x06, 0x72, 0x63, 0x76, 0x6d,
-	0x73, 0x73, 0x18, 0x27, 0x20, 0x01, 0x28, 0x03, 0x52, 0x06, 0x72, 0x63, 0x76, 0x6d, 0x73, 0x73,
-	0x12, 0x1d, 0x0a, 0x0a, 0x72, 0x65, 0x6f, 0x72, 0x64, 0x5f, 0x73, 0x65, 0x65, 0x6e, 0x18, 0x28,
-	0x20, 0x01, 0x28, 0x03, 0x52, 0x09, 0x72, 0x65, 0x6f, 0x72, 0x64, 0x53, 0x65, 0x65, 0x6e, 0x12,
-	0x1e, 0x0a, 0x0a, 0x72, 0x65, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x69, 0x6e, 0x67, 0x18, 0x29, 0x20,
-	0x01, 0x28, 0x03, 0x52, 0x0a, 0x72, 0x65, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x69, 0x6e, 0x67, 0x12,
-	0x18, 0x0a, 0x07, 0x72, 0x65, 0x74, 0x72, 0x61, 0x6e, 0x73, 0x18, 0x2a, 0x20, 0x01, 0x28, 0x03,
-	0x52, 0x07, 0x72, 0x65, 0x74, 0x72, 0x61, 0x6e, 0x73, 0x12, 0x23, 0x0a, 0x0d, 0x72, 0x65, 0x74,
-	0x72, 0x61, 0x6e, 0x73, 0x5f, 0x74, 0x6f, 0x74, 0x61, 0x6c, 0x18, 0x2b, 0x20, 0x01, 0x28, 0x03,
-	0x52, 0x0c, 0x72, 0x65, 0x74, 0x72, 0x61, 0x6e, 0x73, 0x54, 0x6f, 0x74, 0x61, 0x6c, 0x12, 0x26,
-	0x0a, 0x0f, 0x72, 0x77, 0x6e, 0x64, 0x5f, 0x6c, 0x69, 0x6d, 0x69, 0x74, 0x65, 0x64, 0x5f, 0x6d,
-	0x73, 0x18, 0x2c, 0x20, 0x01, 0x28, 0x03, 0x52, 0x0d, 0x72, 0x77, 0x6e, 0x64, 0x4c, 0x69, 0x6d,
-	0x69, 0x74, 0x65, 0x64, 0x4d, 0x73, 0x12, 0x16, 0x0a, 0x06, 0x73, 0x61, 0x63, 0x6b, 0x65, 0x64,
-	0x18, 0x2d, 0x20, 0x01, 0x28, 0x03, 0x52, 0x06, 0x73, 0x61, 0x63, 0x6b, 0x65, 0x64, 0x12, 0x17,
-	0x0a, 0x07, 0x73, 0x65, 0x67, 0x73, 0x5f, 0x69, 0x6e, 0x18, 0x2e, 0x20, 0x01, 0x28, 0x03, 0x52,
-	0x06, 0x73, 0x65, 0x67, 0x73, 0x49, 0x6e, 0x12, 0x19, 0x0a, 0x08, 0x73, 0x65, 0x67, 0x73, 0x5f,
-	0x6f, 0x75, 0x74, 0x18, 0x2f, 0x20, 0x01, 0x28, 0x03, 0x52, 0x07, 0x73, 0x65, 0x67, 0x73, 0x4f,
-	0x75, 0x74, 0x12, 0x1d, 0x0a, 0x0a, 0x73, 0x6e, 0x64, 0x5f, 0x77, 0x73, 0x63, 0x61, 0x6c, 0x65,
-	0x18, 0x30, 0x20, 0x01, 0x28, 0x03, 0x52, 0x09, 0x73, 0x6e, 0x64, 0x57, 0x73, 0x63, 0x61, 0x6c,
-	0x65, 0x12, 0x2a, 0x0a, 0x11, 0x73, 0x6e, 0x64, 0x62, 0x75, 0x66, 0x5f, 0x6c, 0x69, 0x6d, 0x69,
-	0x74, 0x65, 0x64, 0x5f, 0x6d, 0x73, 0x18, 0x31, 0x20, 0x01, 0x28, 0x03, 0x52, 0x0f, 0x73, 0x6e,
-	0x64, 0x62, 0x75, 0x66, 0x4c, 0x69, 0x6d, 0x69, 0x74, 0x65, 0x64, 0x4d, 0x73, 0x12, 0x1a, 0x0a,
-	0x08, 0x73, 0x73, 0x74, 0x68, 0x72, 0x65, 0x73, 0x68, 0x18, 0x32, 0x20, 0x01, 0x28, 0x03, 0x52,
-	0x08, 0x73, 0x73, 0x74, 0x68, 0x72, 0x65, 0x73, 0x68, 0x12, 0x18, 0x0a, 0x07, 0x75, 0x6e, 0x61,
-	0x63, 0x6b, 0x65, 0x64, 0x18, 0x33, 0x20, 0x01, 0x28, 0x03, 0x52, 0x07, 0x75, 0x6e, 0x61, 0x63,
-	0x6b, 0x65, 0x64, 0x22, 0x69, 0x0a, 0x07, 0x41, 0x67, 0x67, 0x49, 0x6e, 0x66, 0x6f, 0x12, 0x2c,
-	0x0a, 0x06, 0x70, 0x61, 0x72, 0x65, 0x6e, 0x74, 0x18, 0x01, 0x20, 0x01, 0x28, 0x0b, 0x32, 0x14,
-	0x2e, 0x68, 0x65, 0x79, 0x70, 0x2e, 0x70, 0x72, 0x6f, 0x74, 0x6f, 0x2e, 0x46, 0x6c, 0x6f, 0x77,
-	0x49, 0x6e, 0x66, 0x6f, 0x52, 0x06, 0x70, 0x61, 0x72, 0x65, 0x6e, 0x74, 0x12, 0x30, 0x0a, 0x08,
-	0x63, 0x68, 0x69, 0x6c, 0x64, 0x72, 0x65, 0x6e, 0x18, 0x02, 0x20, 0x03, 0x28, 0x0b, 0x32, 0x14,
-	0x2e, 0x68, 0x65, 0x79, 0x70, 0x2e, 0x70, 0x72, 0x6f, 0x74, 0x6f, 0x2e, 0x46, 0x6c, 0x6f, 0x77,
-	0x49, 0x6e, 0x66, 0x6f, 0x52, 0x08, 0x63, 0x68, 0x69, 0x6c, 0x64, 0x72, 0x65, 0x6e, 0x22, 0xbf,
-	0x01, 0x0a, 0x0a, 0x49, 0x6e, 0x66, 0x6f, 0x42, 0x75, 0x6e, 0x64, 0x6c, 0x65, 0x12, 0x30, 0x0a,
-	0x07, 0x62, 0x75, 0x6e, 0x64, 0x6c, 0x65, 0x72, 0x18, 0x01, 0x20, 0x01, 0x28, 0x0b, 0x32, 0x16,
-	0x2e, 0x68, 0x65, 0x79, 0x70, 0x2e, 0x70, 0x72, 0x6f, 0x74, 0x6f, 0x2e, 0x46, 0x6c, 0x6f, 0x77,
-	0x4d, 0x61, 0x72, 0x6b, 0x65, 0x72, 0x52, 0x07, 0x62, 0x75, 0x6e, 0x64, 0x6c, 0x65, 0x72, 0x12,
-	0x38, 0x0a, 0x09, 0x74, 0x69, 0x6d, 0x65, 0x73, 0x74, 0x61, 0x6d, 0x70, 0x18, 0x03, 0x20, 0x01,
-	0x28, 0x0b, 0x32, 0x1a, 0x2e, 0x67, 0x6f, 0x6f, 0x67, 0x6c, 0x65, 0x2e, 0x70, 0x72, 0x6f, 0x74,
-	0x6f, 0x62, 0x75, 0x66, 0x2e, 0x54, 0x69, 0x6d, 0x65, 0x73, 0x74, 0x61, 0x6d, 0x70, 0x52, 0x09,
-	0x74, 0x69, 0x6d, 0x65, 0x73, 0x74, 0x61, 0x6d, 0x70, 0x12, 0x10, 0x0a, 0x03, 0x67, 0x65, 0x6e,
-	0x18, 0x04, 0x20, 0x01, 0x28, 0x03, 0x52, 0x03, 0x67, 0x65, 0x6e, 0x12, 0x33, 0x0a, 0x0a, 0x66,
-	0x6c, 0x6f, 0x77, 0x5f, 0x69, 0x6e, 0x66, 0x6f, 0x73, 0x18, 0x02, 0x20, 0x03, 0x28, 0x0b, 0x32,
-	0x14, 0x2e, 0x68, 0x65, 0x79, 0x70, 0x2e, 0x70, 0x72, 0x6f, 0x74, 0x6f, 0x2e, 0x46, 0x6c, 0x6f,
-	0x77, 0x49, 0x6e, 0x66, 0x6f, 0x52, 0x09, 0x66, 0x6c, 0x6f, 0x77, 0x49, 0x6e, 0x66, 0x6f, 0x73,
-	0x22, 0x99, 0x01, 0x0a, 0x09, 0x46, 0x6c, 0x6f, 0x77, 0x41, 0x6c, 0x6c, 0x6f, 0x63, 0x12, 0x2a,
+	0x41, 0x75, 0x78, 0x49, 0x6e, 0x66, 0x6f, 0x52, 0x03, 0x61, 0x75, 0x78, 0x12, 0x13, 0x0a, 0x05,
+	0x66, 0x67, 0x5f, 0x69, 0x64, 0x18, 0x15, 0x20, 0x01, 0x28, 0x0d, 0x52, 0x04, 0x66, 0x67, 0x49,
+	0x64, 0x1a, 0x84, 0x0c, 0x0a, 0x07, 0x41, 0x75, 0x78, 0x49, 0x6e, 0x66, 0x6f, 0x12, 0x1f, 0x0a,
+	0x0b, 0x61, 0x70, 0x70, 0x5f, 0x6c, 0x69, 0x6d, 0x69, 0x74, 0x65, 0x64, 0x18, 0x01, 0x20, 0x01,
+	0x28, 0x08, 0x52, 0x0a, 0x61, 0x70, 0x70, 0x4c, 0x69, 0x6d, 0x69, 0x74, 0x65, 0x64, 0x12, 0x15,
+	0x0a, 0x06, 0x61, 0x74, 0x6f, 0x5f, 0x6d, 0x73, 0x18, 0x02, 0x20, 0x01, 0x28, 0x01, 0x52, 0x05,
+	0x61, 0x74, 0x6f, 0x4d, 0x73, 0x12, 0x22, 0x0a, 0x0d, 0x62, 0x62, 0x72, 0x5f, 0x63, 0x77, 0x6e,
+	0x64, 0x5f, 0x67, 0x61, 0x69, 0x6e, 0x18, 0x03, 0x20, 0x01, 0x28, 0x01, 0x52, 0x0b, 0x62, 0x62,
+	0x72, 0x43, 0x77, 0x6e, 0x64, 0x47, 0x61, 0x69, 0x6e, 0x12, 0x23, 0x0a, 0x0e, 0x62, 0x62, 0x72,
+	0x5f, 0x6d, 0x69, 0x6e, 0x5f, 0x72, 0x74, 0x74, 0x5f, 0x6d, 0x73, 0x18, 0x04, 0x20, 0x01, 0x28,
+	0x01, 0x52, 0x0b, 0x62, 0x62, 0x72, 0x4d, 0x69, 0x6e, 0x52, 0x74, 0x74, 0x4d, 0x73, 0x12, 0x26,
+	0x0a, 0x0f, 0x62, 0x62, 0x72, 0x5f, 0x70, 0x61, 0x63, 0x69, 0x6e, 0x67, 0x5f, 0x67, 0x61, 0x69,
+	0x6e, 0x18, 0x05, 0x20, 0x01, 0x28, 0x01, 0x52, 0x0d, 0x62, 0x62, 0x72, 0x50, 0x61, 0x63, 0x69,
+	0x6e, 0x67, 0x47, 0x61, 0x69, 0x6e, 0x12, 0x1c, 0x0a, 0x0a, 0x6d, 0x69, 0x6e, 0x5f, 0x72, 0x74,
+	0x74, 0x5f, 0x6d, 0x73, 0x18, 0x06, 0x20, 0x01, 0x28, 0x01, 0x52, 0x08, 0x6d, 0x69, 0x6e, 0x52,
+	0x74, 0x74, 0x4d, 0x73, 0x12, 0x1c, 0x0a, 0x0a, 0x72, 0x63, 0x76, 0x5f, 0x72, 0x74, 0x74, 0x5f,
+	0x6d, 0x73, 0x18, 0x07, 0x20, 0x01, 0x28, 0x01, 0x52, 0x08, 0x72, 0x63, 0x76, 0x52, 0x74, 0x74,
+	0x4d, 0x73, 0x12, 0x15, 0x0a, 0x06, 0x72, 0x74, 0x6f, 0x5f, 0x6d, 0x73, 0x18, 0x08, 0x20, 0x01,
+	0x28, 0x01, 0x52, 0x05, 0x72, 0x74, 0x6f, 0x4d, 0x73, 0x12, 0x15, 0x0a, 0x06, 0x72, 0x74, 0x74,
+	0x5f, 0x6d, 0x73, 0x18, 0x09, 0x20, 0x01, 0x28, 0x01, 0x52, 0x05, 0x72, 0x74, 0x74, 0x4d, 0x73,
+	0x12, 0x1c, 0x0a, 0x0a, 0x72, 0x74, 0x74, 0x5f, 0x76, 0x61, 0x72, 0x5f, 0x6d, 0x73, 0x18, 0x0a,
+	0x20, 0x01, 0x28, 0x01, 0x52, 0x08, 0x72, 0x74, 0x74, 0x56, 0x61, 0x72, 0x4d, 0x73, 0x12, 0x16,
+	0x0a, 0x06, 0x61, 0x64, 0x76, 0x6d, 0x73, 0x73, 0x18, 0x0b, 0x20, 0x01, 0x28, 0x03, 0x52, 0x06,
+	0x61, 0x64, 0x76, 0x6d, 0x73, 0x73, 0x12, 0x18, 0x0a, 0x07, 0x62, 0x61, 0x63, 0x6b, 0x6f, 0x66,
+	0x66, 0x18, 0x0c, 0x20, 0x01, 0x28, 0x03, 0x52, 0x07, 0x62, 0x61, 0x63, 0x6b, 0x6f, 0x66, 0x66,
+	0x12, 0x15, 0x0a, 0x06, 0x62, 0x62, 0x72, 0x5f, 0x62, 0x77, 0x18, 0x0d, 0x20, 0x01, 0x28, 0x03,
+	0x52, 0x05, 0x62, 0x62, 0x72, 0x42, 0x77, 0x12, 0x20, 0x0a, 0x0c, 0x62, 0x75, 0x73, 0x79, 0x5f,
+	0x74, 0x69, 0x6d, 0x65, 0x5f, 0x6d, 0x73, 0x18, 0x0e, 0x20, 0x01, 0x28, 0x03, 0x52, 0x0a, 0x62,
+	0x75, 0x73, 0x79, 0x54, 0x69, 0x6d, 0x65, 0x4d, 0x73, 0x12, 0x1f, 0x0a, 0x0b, 0x62, 0x79, 0x74,
+	0x65, 0x73, 0x5f, 0x61, 0x63, 0x6b, 0x65, 0x64, 0x18, 0x0f, 0x20, 0x01, 0x28, 0x03, 0x52, 0x0a,
+	0x62, 0x79, 0x74, 0x65, 0x73, 0x41, 0x63, 0x6b, 0x65, 0x64, 0x12, 0x25, 0x0a, 0x0e, 0x62, 0x79,
+	0x74, 0x65, 0x73, 0x5f, 0x72, 0x65, 0x63, 0x65, 0x69, 0x76, 0x65, 0x64, 0x18, 0x10, 0x20, 0x01,
+	0x28, 0x03, 0x52, 0x0d, 0x62, 0x79, 0x74, 0x65, 0x73, 0x52, 0x65, 0x63, 0x65, 0x69, 0x76, 0x65,
+	0x64, 0x12, 0x23, 0x0a, 0x0d, 0x62, 0x79, 0x74, 0x65, 0x73, 0x5f, 0x72, 0x65, 0x74, 0x72, 0x61,
+	0x6e, 0x73, 0x18, 0x11, 0x20, 0x01, 0x28, 0x03, 0x52, 0x0c, 0x62, 0x79, 0x74, 0x65, 0x73, 0x52,
+	0x65, 0x74, 0x72, 0x61, 0x6e, 0x73, 0x12, 0x12, 0x0a, 0x04, 0x63, 0x77, 0x6e, 0x64, 0x18, 0x12,
+	0x20, 0x01, 0x28, 0x03, 0x52, 0x04, 0x63, 0x77, 0x6e, 0x64, 0x12, 0x20, 0x0a, 0x0c, 0x64, 0x61,
+	0x74, 0x61, 0x5f, 0x73, 0x65, 0x67, 0x73, 0x5f, 0x69, 0x6e, 0x18, 0x13, 0x20, 0x01, 0x28, 0x03,
+	0x52, 0x0a, 0x64, 0x61, 0x74, 0x61, 0x53, 0x65, 0x67, 0x73, 0x49, 0x6e, 0x12, 0x22, 0x0a, 0x0d,
+	0x64, 0x61, 0x74, 0x61, 0x5f, 0x73, 0x65, 0x67, 0x73, 0x5f, 0x6f, 0x75, 0x74, 0x18, 0x14, 0x20,
+	0x01, 0x28, 0x03, 0x52, 0x0b, 0x64, 0x61, 0x74, 0x61, 0x53, 0x65, 0x67, 0x73, 0x4f, 0x75, 0x74,
+	0x12, 0x1c, 0x0a, 0x09, 0x64, 0x65, 0x6c, 0x69, 0x76, 0x65, 0x72, 0x65, 0x64, 0x18, 0x15, 0x20,
+	0x01, 0x28, 0x03, 0x52, 0x09, 0x64, 0x65, 0x6c, 0x69, 0x76, 0x65, 0x72, 0x65, 0x64, 0x12, 0x21,
+	0x0a, 0x0c, 0x64, 0x65, 0x6c, 0x69, 0x76, 0x65, 0x72, 0x65, 0x64, 0x5f, 0x63, 0x65, 0x18, 0x16,
+	0x20, 0x01, 0x28, 0x03, 0x52, 0x0b, 0x64, 0x65, 0x6c, 0x69, 0x76, 0x65, 0x72, 0x65, 0x64, 0x43,
+	0x65, 0x12, 0x23, 0x0a, 0x0d, 0x64, 0x65, 0x6c, 0x69, 0x76, 0x65, 0x72, 0x79, 0x5f, 0x72, 0x61,
+	0x74, 0x65, 0x18, 0x17, 0x20, 0x01, 0x28, 0x03, 0x52, 0x0c, 0x64, 0x65, 0x6c, 0x69, 0x76, 0x65,
+	0x72, 0x79, 0x52, 0x61, 0x74, 0x65, 0x12, 0x1d, 0x0a, 0x0a, 0x64, 0x73, 0x61, 0x63, 0x6b, 0x5f,
+	0x64, 0x75, 0x70, 0x73, 0x18, 0x18, 0x20, 0x01, 0x28, 0x03, 0x52, 0x09, 0x64, 0x73, 0x61, 0x63,
+	0x6b, 0x44, 0x75, 0x70, 0x73, 0x12, 0x18, 0x0a, 0x07, 0x66, 0x61, 0x63, 0x6b, 0x65, 0x74, 0x73,
+	0x18, 0x19, 0x20, 0x01, 0x28, 0x03, 0x52, 0x07, 0x66, 0x61, 0x63, 0x6b, 0x65, 0x74, 0x73, 0x12,
+	0x1d, 0x0a, 0x0a, 0x6c, 0x61, 0x73, 0x74, 0x61, 0x63, 0x6b, 0x5f, 0x6d, 0x73, 0x18, 0x1a, 0x20,
+	0x01, 0x28, 0x03, 0x52, 0x09, 0x6c, 0x61, 0x73, 0x74, 0x61, 0x63, 0x6b, 0x4d, 0x73, 0x12, 0x1d,
+	0x0a, 0x0a, 0x6c, 0x61, 0x73, 0x74, 0x72, 0x63, 0x76, 0x5f, 0x6d, 0x73, 0x18, 0x1b, 0x20, 0x01,
+	0x28, 0x03, 0x52, 0x09, 0x6c, 0x61, 0x73, 0x74, 0x72, 0x63, 0x76, 0x4d, 0x73, 0x12, 0x1d, 0x0a,
+	0x0a, 0x6c, 0x61, 0x73, 0x74, 0x73, 0x6e, 0x64, 0x5f, 0x6d, 0x73, 0x18, 0x1c, 0x20, 0x01, 0x28,
+	0x03, 0x52, 0x09, 0x6c, 0x61, 0x73, 0x74, 0x73, 0x6e, 0x64, 0x4d, 0x73, 0x12, 0x12, 0x0a, 0x04,
+	0x6c, 0x6f, 0x73, 0x74, 0x18, 0x1d, 0x20, 0x01, 0x28, 0x03, 0x52, 0x04, 0x6c, 0x6f, 0x73, 0x74,
+	0x12, 0x10, 0x0a, 0x03, 0x6d, 0x73, 0x73, 0x18, 0x1e, 0x20, 0x01, 0x28, 0x03, 0x52, 0x03, 0x6d,
+	0x73, 0x73, 0x12, 0x19, 0x0a, 0x08, 0x6e, 0x6f, 0x74, 0x5f, 0x73, 0x65, 0x6e, 0x74, 0x18, 0x1f,
+	0x20, 0x01, 0x28, 0x03, 0x52, 0x07, 0x6e, 0x6f, 0x74, 0x53, 0x65, 0x6e, 0x74, 0x12, 0x1f, 0x0a,
+	0x0b, 0x70, 0x61, 0x63, 0x69, 0x6e, 0x67, 0x5f, 0x72, 0x61, 0x74, 0x65, 0x18, 0x20, 0x20, 0x01,
+	0x28, 0x03, 0x52, 0x0a, 0x70, 0x61, 0x63, 0x69, 0x6e, 0x67, 0x52, 0x61, 0x74, 0x65, 0x12, 0x26,
+	0x0a, 0x0f, 0x70, 0x61, 0x63, 0x69, 0x6e, 0x67, 0x5f, 0x72, 0x61, 0x74, 0x65, 0x5f, 0x6d, 0x61,
+	0x78, 0x18, 0x21, 0x20, 0x01, 0x28, 0x03, 0x52, 0x0d, 0x70, 0x61, 0x63, 0x69, 0x6e, 0x67, 0x52,
+	0x61, 0x74, 0x65, 0x4d, 0x61, 0x78, 0x12, 0x12, 0x0a, 0x04, 0x70, 0x6d, 0x74, 0x75, 0x18, 0x22,
+	0x20, 0x01, 0x28, 0x03, 0x52, 0x04, 0x70, 0x6d, 0x74, 0x75, 0x12, 0x12, 0x0a, 0x04, 0x71, 0x61,
+	0x63, 0x6b, 0x18, 0x23, 0x20, 0x01, 0x28, 0x03, 0x52, 0x04, 0x71, 0x61, 0x63, 0x6b, 0x12, 0x1b,
+	0x0a, 0x09, 0x72, 0x63, 0x76, 0x5f, 0x73, 0x70, 0x61, 0x63, 0x65, 0x18, 0x24, 0x20, 0x01, 0x28,
+	0x03, 0x52, 0x08, 0x72, 0x63, 0x76, 0x53, 0x70, 0x61, 0x63, 0x65, 0x12, 0x21, 0x0a, 0x0c, 0x72,
+	0x63, 0x76, 0x5f, 0x73, 0x73, 0x74, 0x68, 0x72, 0x65, 0x73, 0x68, 0x18, 0x25, 0x20, 0x01, 0x28,
+	0x03, 0x52, 0x0b, 0x72, 0x63, 0x76, 0x53, 0x73, 0x74, 0x68, 0x72, 0x65, 0x73, 0x68, 0x12, 0x1d,
+	0x0a, 0x0a, 0x72, 0x63, 0x76, 0x5f, 0x77, 0x73, 0x63, 0x61, 0x6c, 0x65, 0x18, 0x26, 0x20, 0x01,
+	0x28, 0x03, 0x52, 0x09, 0x72, 0x63, 0x76, 0x57, 0x73, 0x63, 0x61, 0x6c, 0x65, 0x12, 0x16, 0x0a,
+	0x06, 0x72, 0x63, 0x76, 0x6d, 0x73, 0x73, 0x18, 0x27, 0x20, 0x01, 0x28, 0x03, 0x52, 0x06, 0x72,
+	0x63, 0x76, 0x6d, 0x73, 0x73, 0x12, 0x1d, 0x0a, 0x0a, 0x72, 0x65, 0x6f, 0x72, 0x64, 0x5f, 0x73,
+	0x65, 0x65, 0x6e, 0x18, 0x28, 0x20, 0x01, 0x28, 0x03, 0x52, 0x09, 0x72, 0x65, 0x6f, 0x72, 0x64,
+	0x53, 0x65, 0x65, 0x6e, 0x12, 0x1e, 0x0a, 0x0a, 0x72, 0x65, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x69,
+	0x6e, 0x67, 0x18, 0x29, 0x20, 0x01, 0x28, 0x03, 0x52, 0x0a, 0x72, 0x65, 0x6f, 0x72, 0x64, 0x65,
+	0x72, 0x69, 0x6e, 0x67, 0x12, 0x18, 0x0a, 0x07, 0x72, 0x65, 0x74, 0x72, 0x61, 0x6e, 0x73, 0x18,
+	0x2a, 0x20, 0x01, 0x28, 0x03, 0x52, 0x07, 0x72, 0x65, 0x74, 0x72, 0x61, 0x6e, 0x73, 0x12, 0x23,
+	0x0a, 0x0d, 0x72, 0x65, 0x74, 0x72, 0x61, 0x6e, 0x73, 0x5f, 0x74, 0x6f, 0x74, 0x61, 0x6c, 0x18,
+	0x2b, 0x20, 0x01, 0x28, 0x03, 0x52, 0x0c, 0x72, 0x65, 0x74, 0x72, 0x61, 0x6e, 0x73, 0x54, 0x6f,
+	0x74, 0x61, 0x6c, 0x12, 0x26, 0x0a, 0x0f, 0x72, 0x77, 0x6e, 0x64, 0x5f, 0x6c, 0x69, 0x6d, 0x69,
+	0x74, 0x65, 0x64, 0x5f, 0x6d, 0x73, 0x18, 0x2c, 0x20, 0x01, 0x28, 0x03, 0x52, 0x0d, 0x72, 0x77,
+	0x6e, 0x64, 0x4c, 0x69, 0x6d, 0x69, 0x74, 0x65, 0x64, 0x4d, 0x73, 0x12, 0x16, 0x0a, 0x06, 0x73,
+	0x61, 0x63, 0x6b, 0x65, 0x64, 0x18, 0x2d, 0x20, 0x01, 0x28, 0x03, 0x52, 0x06, 0x73, 0x61, 0x63,
+	0x6b, 0x65, 0x64, 0x12, 0x17, 0x0a, 0x07, 0x73, 0x65, 0x67, 0x73, 0x5f, 0x69, 0x6e, 0x18, 0x2e,
+	0x20, 0x01, 0x28, 0x03, 0x52, 0x06, 0x73, 0x65, 0x67, 0x73, 0x49, 0x6e, 0x12, 0x19, 0x0a, 0x08,
+	0x73, 0x65, 0x67, 0x73, 0x5f, 0x6f, 0x75, 0x74, 0x18, 0x2f, 0x20, 0x01, 0x28, 0x03, 0x52, 0x07,
+	0x73, 0x65, 0x67, 0x73, 0x4f, 0x75, 0x74, 0x12, 0x1d, 0x0a, 0x0a, 0x73, 0x6e, 0x64, 0x5f, 0x77,
+	0x73, 0x63, 0x61, 0x6c, 0x65, 0x18, 0x30, 0x20, 0x01, 0x28, 0x03, 0x52, 0x09, 0x73, 0x6e, 0x64,
+	0x57, 0x73, 0x63, 0x61, 0x6c, 0x65, 0x12, 0x2a, 0x0a, 0x11, 0x73, 0x6e, 0x64, 0x62, 0x75, 0x66,
+	0x5f, 0x6c, 0x69, 0x6d, 0x69, 0x74, 0x65, 0x64, 0x5f, 0x6d, 0x73, 0x18, 0x31, 0x20, 0x01, 0x28,
+	0x03, 0x52, 0x0f, 0x73, 0x6e, 0x64, 0x62, 0x75, 0x66, 0x4c, 0x69, 0x6d, 0x69, 0x74, 0x65, 0x64,
+	0x4d, 0x73, 0x12, 0x1a, 0x0a, 0x08, 0x73, 0x73, 0x74, 0x68, 0x72, 0x65, 0x73, 0x68, 0x18, 0x32,
+	0x20, 0x01, 0x28, 0x03, 0x52, 0x08, 0x73, 0x73, 0x74, 0x68, 0x72, 0x65, 0x73, 0x68, 0x12, 0x18,
+	0x0a, 0x07, 0x75, 0x6e, 0x61, 0x63, 0x6b, 0x65, 0x64, 0x18, 0x33, 0x20, 0x01, 0x28, 0x03, 0x52,
+	0x07, 0x75, 0x6e, 0x61, 0x63, 0x6b, 0x65, 0x64, 0x22, 0x69, 0x0a, 0x07, 0x41, 0x67, 0x67, 0x49,
+	0x6e, 0x66, 0x6f, 0x12, 0x2c, 0x0a, 0x06, 0x70, 0x61, 0x72, 0x65, 0x6e, 0x74, 0x18, 0x01, 0x20,
+	0x01, 0x28, 0x0b, 0x32, 0x14, 0x2e, 0x68, 0x65, 0x79, 0x70, 0x2e, 0x70, 0x72, 0x6f, 0x74, 0x6f,
+	0x2e, 0x46, 0x6c, 0x6f, 0x77, 0x49, 0x6e, 0x66, 0x6f, 0x52, 0x06, 0x70, 0x61, 0x72, 0x65, 0x6e,
+	0x74, 0x12, 0x30, 0x0a, 0x08, 0x63, 0x68, 0x69, 0x6c, 0x64, 0x72, 0x65, 0x6e, 0x18, 0x02, 0x20,
+	0x03, 0x28, 0x0b, 0x32, 0x14, 0x2e, 0x68, 0x65, 0x79, 0x70, 0x2e, 0x70, 0x72, 0x6f, 0x74, 0x6f,
+	0x2e, 0x46, 0x6c, 0x6f, 0x77, 0x49, 0x6e, 0x66, 0x6f, 0x52, 0x08, 0x63, 0x68, 0x69, 0x6c, 0x64,
+	0x72, 0x65, 0x6e, 0x22, 0xe9, 0x01, 0x0a, 0x0a, 0x49, 0x6e, 0x66, 0x6f, 0x42, 0x75, 0x6e, 0x64,
+	0x6c, 0x65, 0x12, 0x30, 0x0a, 0x07, 0x62, 0x75, 0x6e, 0x64, 0x6c, 0x65, 0x72, 0x18, 0x01, 0x20,
+	0x01, 0x28, 0x0b, 0x32, 0x16, 0x2e, 0x68, 0x65, 0x79, 0x70, 0x2e, 0x70, 0x72, 0x6f, 0x74, 0x6f,
+	0x2e, 0x46, 0x6c, 0x6f, 0x77, 0x4d, 0x61, 0x72, 0x6b, 0x65, 0x72, 0x52, 0x07, 0x62, 0x75, 0x6e,
+	0x64, 0x6c, 0x65, 0x72, 0x12, 0x38, 0x0a, 0x09, 0x74, 0x69, 0x6d, 0x65, 0x73, 0x74, 0x61, 0x6d,
+	0x70, 0x18, 0x03, 0x20, 0x01, 0x28, 0x0b, 0x32, 0x1a, 0x2e, 0x67, 0x6f, 0x6f, 0x67, 0x6c, 0x65,
+	0x2e, 0x70, 0x72, 0x6f, 0x74, 0x6f, 0x62, 0x75, 0x66, 0x2e, 0x54, 0x69, 0x6d, 0x65, 0x73, 0x74,
+	0x61, 0x6d, 0x70, 0x52, 0x09, 0x74, 0x69, 0x6d, 0x65, 0x73, 0x74, 0x61, 0x6d, 0x70, 0x12, 0x10,
+	0x0a, 0x03, 0x67, 0x65, 0x6e, 0x18, 0x04, 0x20, 0x01, 0x28, 0x03, 0x52, 0x03, 0x67, 0x65, 0x6e,
+	0x12, 0x33, 0x0a, 0x0a, 0x66, 0x6c, 0x6f, 0x77, 0x5f, 0x69, 0x6e, 0x66, 0x6f, 0x73, 0x18, 0x02,
+	0x20, 0x03, 0x28, 0x0b, 0x32, 0x14, 0x2e, 0x68, 0x65, 0x79, 0x70, 0x2e, 0x70, 0x72, 0x6f, 0x74,
+	0x6f, 0x2e, 0x46, 0x6c, 0x6f, 0x77, 0x49, 0x6e, 0x66, 0x6f, 0x52, 0x09, 0x66, 0x6c, 0x6f, 0x77,
+	0x49, 0x6e, 0x66, 0x6f, 0x73, 0x12, 0x28, 0x0a, 0x10, 0x6e, 0x65, 0x65, 0x64, 0x73, 0x5f, 0x66,
+	0x75, 0x6c, 0x6c, 0x5f, 0x61, 0x6c, 0x6c, 0x6f, 0x63, 0x18, 0x05, 0x20, 0x01, 0x28, 0x08, 0x52,
+	0x0e, 0x6e, 0x65, 0x65, 0x64, 0x73, 0x46, 0x75, 0x6c, 0x6c, 0x41, 0x6c, 0x6c, 0x6f, 0x63, 0x22,
+	0x99, 0x01, 0x0a, 0x09, 0x46, 0x6c, 0x6f, 0x77, 0x41, 0x6c, 0x6c, 0x6f, 0x63, 0x12, 0x2a, 0x0a,
+	0x04, 0x66, 0x6c, 0x6f, 0x77, 0x18, 0x01, 0x20, 0x01, 0x28, 0x0b, 0x32, 0x16, 0x2e, 0x68, 0x65,
+	0x79, 0x70, 0x2e, 0x70, 0x72, 0x6f, 0x74, 0x6f, 0x2e, 0x46, 0x6c, 0x6f, 0x77, 0x4d, 0x61, 0x72,
+	0x6b, 0x65, 0x72, 0x52, 0x04, 0x66, 0x6c, 0x6f, 0x77, 0x12, 0x2f, 0x0a, 0x14, 0x68, 0x69, 0x70,
+	0x72, 0x69, 0x5f, 0x72, 0x61, 0x74, 0x65, 0x5f, 0x6c, 0x69, 0x6d, 0x69, 0x74, 0x5f, 0x62, 0x70,
+	0x73, 0x18, 0x02, 0x20, 0x01, 0x28, 0x03, 0x52, 0x11, 0x68, 0x69, 0x70, 0x72, 0x69, 0x52, 0x61,
+	0x74, 0x65, 0x4c, 0x69, 0x6d, 0x69, 0x74, 0x42, 0x70, 0x73, 0x12, 0x2f, 0x0a, 0x14, 0x6c, 0x6f,
+	0x70, 0x72, 0x69, 0x5f, 0x72, 0x61, 0x74, 0x65, 0x5f, 0x6c, 0x69, 0x6d, 0x69, 0x74, 0x5f, 0x62,
+	0x70, 0x73, 0x18, 0x03, 0x20, 0x01, 0x28, 0x03, 0x52, 0x11, 0x6c, 0x6f, 0x70, 0x72, 0x69, 0x52,
+	0x61, 0x74, 0x65, 0x4c, 0x69, 0x6d, 0x69, 0x74, 0x42, 0x70, 0x73, 0x22, 0x73, 0x0a, 0x17, 0x54,
+	0x68, 0x72, 0x65, 0x73, 0x68, 0x6f, 0x6c, 0x64, 0x53, 0x61, 0x6d, 0x70, 0x6c, 0x69, 0x6e, 0x67,
+	0x50, 0x61, 0x72, 0x61, 0x6d, 0x73, 0x12, 0x35, 0x0a, 0x17, 0x6e, 0x75, 0x6d, 0x5f, 0x73, 0x61,
+	0x6d, 0x70, 0x6c, 0x65, 0x73, 0x5f, 0x61, 0x74, 0x5f, 0x61, 0x70, 0x70, 0x72, 0x6f, 0x76, 0x61,
+	0x6c, 0x18, 0x01, 0x20, 0x01, 0x28, 0x01, 0x52, 0x14, 0x6e, 0x75, 0x6d, 0x53, 0x61, 0x6d, 0x70,
+	0x6c, 0x65, 0x73, 0x41, 0x74, 0x41, 0x70, 0x70, 0x72, 0x6f, 0x76, 0x61, 0x6c, 0x12, 0x21, 0x0a,
+	0x0c, 0x61, 0x70, 0x70, 0x72, 0x6f, 0x76, 0x61, 0x6c, 0x5f, 0x62, 0x70, 0x73, 0x18, 0x02, 0x20,
+	0x01, 0x28, 0x03, 0x52, 0x0b, 0x61, 0x70, 0x70, 0x72, 0x6f, 0x76, 0x61, 0x6c, 0x42, 0x70, 0x73,
+	0x22, 0x90, 0x01, 0x0a, 0x11, 0x46, 0x47, 0x44, 0x69, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x72,
+	0x79, 0x45, 0x6e, 0x74, 0x72, 0x79, 0x12, 0x2a, 0x0a, 0x04, 0x66, 0x6c, 0x6f, 0x77, 0x18, 0x01,
+	0x20, 0x01, 0x28, 0x0b, 0x32, 0x16, 0x2e, 0x68, 0x65, 0x79, 0x70, 0x2e, 0x70, 0x72, 0x6f, 0x74,
+	0x6f, 0x2e, 0x46, 0x6c, 0x6f, 0x77, 0x4d, 0x61, 0x72, 0x6b, 0x65, 0x72, 0x52, 0x04, 0x66, 0x6c,
+	0x6f, 0x77, 0x12, 0x0e, 0x0a, 0x02, 0x69, 0x64, 0x18, 0x02, 0x20, 0x01, 0x28, 0x0d, 0x52, 0x02,
+	0x69, 0x64, 0x12, 0x3f, 0x0a, 0x08, 0x73, 0x61, 0x6d, 0x70, 0x6c, 0x69, 0x6e, 0x67, 0x18, 0x03,
+	0x20, 0x01, 0x28, 0x0b, 0x32, 0x23, 0x2e, 0x68, 0x65, 0x79, 0x70, 0x2e, 0x70, 0x72, 0x6f, 0x74,
+	0x6f, 0x2e, 0x54, 0x68, 0x72, 0x65, 0x73, 0x68, 0x6f, 0x6c, 0x64, 0x53, 0x61, 0x6d, 0x70, 0x6c,
+	0x69, 0x6e, 0x67, 0x50, 0x61, 0x72, 0x61, 0x6d, 0x73, 0x52, 0x08, 0x73, 0x61, 0x6d, 0x70, 0x6c,
+	0x69, 0x6e, 0x67, 0x22, 0xd3, 0x01, 0x0a, 0x0b, 0x41, 0x6c, 0x6c, 0x6f, 0x63, 0x42, 0x75, 0x6e,
+	0x64, 0x6c, 0x65, 0x12, 0x36, 0x0a, 0x0b, 0x66, 0x6c, 0x6f, 0x77, 0x5f, 0x61, 0x6c, 0x6c, 0x6f,
+	0x63, 0x73, 0x18, 0x01, 0x20, 0x03, 0x28, 0x0b, 0x32, 0x15, 0x2e, 0x68, 0x65, 0x79, 0x70, 0x2e,
+	0x70, 0x72, 0x6f, 0x74, 0x6f, 0x2e, 0x46, 0x6c, 0x6f, 0x77, 0x41, 0x6c, 0x6c, 0x6f, 0x63, 0x52,
+	0x0a, 0x66, 0x6c, 0x6f, 0x77, 0x41, 0x6c, 0x6c, 0x6f, 0x63, 0x73, 0x12, 0x10, 0x0a, 0x03, 0x67,
+	0x65, 0x6e, 0x18, 0x02, 0x20, 0x01, 0x28, 0x03, 0x52, 0x03, 0x67, 0x65, 0x6e, 0x12, 0x42, 0x0a,
+	0x0d, 0x66, 0x67, 0x5f, 0x64, 0x69, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x72, 0x79, 0x18, 0x03,
+	0x20, 0x03, 0x28, 0x0b, 0x32, 0x1d, 0x2e, 0x68, 0x65, 0x79, 0x70, 0x2e, 0x70, 0x72, 0x6f, 0x74,
+	0x6f, 0x2e, 0x46, 0x47, 0x44, 0x69, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x72, 0x79, 0x45, 0x6e,
+	0x74, 0x72, 0x79, 0x52, 0x0c, 0x66, 0x67, 0x44, 0x69, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x72,
+	0x79, 0x12, 0x10, 0x0a, 0x03, 0x73, 0x65, 0x71, 0x18, 0x04, 0x20, 0x01, 0x28, 0x04, 0x52, 0x03,
+	0x73, 0x65, 0x71, 0x12, 0x24, 0x0a, 0x0e, 0x64, 0x65, 0x6c, 0x74, 0x61, 0x5f, 0x62, 0x61, 0x73,
+	0x65, 0x5f, 0x73, 0x65, 0x71, 0x18, 0x05, 0x20, 0x01, 0x28, 0x04, 0x52, 0x0c, 0x64, 0x65, 0x6c,
+	0x74, 0x61, 0x42, 0x61, 0x73, 0x65, 0x53, 0x65, 0x71, 0x22, 0xce, 0x02, 0x0a, 0x10, 0x41, 0x67,
+	0x67, 0x72, 0x65, 0x67, 0x61, 0x74, 0x65, 0x64, 0x46, 0x47, 0x49, 0x6e, 0x66, 0x6f, 0x12, 0x2a,
 	0x0a, 0x04, 0x66, 0x6c, 0x6f, 0x77, 0x18, 0x01, 0x20, 0x01, 0x28, 0x0b, 0x32, 0x16, 0x2e, 0x68,
 	0x65, 0x79, 0x70, 0x2e, 0x70, 0x72, 0x6f, 0x74, 0x6f, 0x2e, 0x46, 0x6c, 0x6f, 0x77, 0x4d, 0x61,
-	0x72, 0x6b, 0x65, 0x72, 0x52, 0x04, 0x66, 0x6c, 0x6f, 0x77, 0x12, 0x2f, 0x0a, 0x14, 0x68, 0x69,
-	0x70, 0x72, 0x69, 0x5f, 0x72, 0x61, 0x74, 0x65, 0x5f, 0x6c, 0x69, 0x6d, 0x69, 0x74, 0x5f, 0x62,
-	0x70, 0x73, 0x18, 0x02, 0x20, 0x01, 0x28, 0x03, 0x52, 0x11, 0x68, 0x69, 0x70, 0x72, 0x69, 0x52,
-	0x61, 0x74, 0x65, 0x4c, 0x69, 0x6d, 0x69, 0x74, 0x42, 0x70, 0x73, 0x12, 0x2f, 0x0a, 0x14, 0x6c,
-	0x6f, 0x70, 0x72, 0x69, 0x5f, 0x72, 0x61, 0x74, 0x65, 0x5f, 0x6c, 0x69, 0x6d, 0x69, 0x74, 0x5f,
-	0x62, 0x70, 0x73, 0x18, 0x03, 0x20, 0x01, 0x28, 0x03, 0x52, 0x11, 0x6c, 0x6f, 0x70, 0x72, 0x69,
-	0x52, 0x61, 0x74, 0x65, 0x4c, 0x69, 0x6d, 0x69, 0x74, 0x42, 0x70, 0x73, 0x22, 0x57, 0x0a, 0x0b,
-	0x41, 0x6c, 0x6c, 0x6f, 0x63, 0x42, 0x75, 0x6e, 0x64, 0x6c, 0x65, 0x12, 0x36, 0x0a, 0x0b, 0x66,
-	0x6c, 0x6f, 0x77, 0x5f, 0x61, 0x6c, 0x6c, 0x6f, 0x63, 0x73, 0x18, 0x01, 0x20, 0x03, 0x28, 0x0b,
-	0x32, 0x15, 0x2e, 0x68, 0x65, 0x79, 0x70, 0x2e, 0x70, 0x72, 0x6f, 0x74, 0x6f, 0x2e, 0x46, 0x6c,
-	0x6f, 0x77, 0x41, 0x6c, 0x6c, 0x6f, 0x63, 0x52, 0x0a, 0x66, 0x6c, 0x6f, 0x77, 0x41, 0x6c, 0x6c,
-	0x6f, 0x63, 0x73, 0x12, 0x10, 0x0a, 0x03, 0x67, 0x65, 0x6e, 0x18, 0x02, 0x20, 0x01, 0x28, 0x03,
-	0x52, 0x03, 0x67, 0x65, 0x6e, 0x2a, 0x27, 0x0a, 0x08, 0x50, 0x72, 0x6f, 0x74, 0x6f, 0x63, 0x6f,
-	0x6c, 0x12, 0x09, 0x0a, 0x05, 0x55, 0x4e, 0x53, 0x45, 0x54, 0x10, 0x00, 0x12, 0x07, 0x0a, 0x03,
-	0x54, 0x43, 0x50, 0x10, 0x01, 0x12, 0x07, 0x0a, 0x03, 0x55, 0x44, 0x50, 0x10, 0x02, 0x32, 0x55,
-	0x0a, 0x0c, 0x43, 0x6c, 0x75, 0x73, 0x74, 0x65, 0x72, 0x41, 0x67, 0x65, 0x6e, 0x74, 0x12, 0x45,
-	0x0a, 0x0c, 0x52, 0x65, 0x67, 0x69, 0x73, 0x74, 0x65, 0x72, 0x48, 0x6f, 0x73, 0x74, 0x12, 0x16,
-	0x2e, 0x68, 0x65, 0x79, 0x70, 0x2e, 0x70, 0x72, 0x6f, 0x74, 0x6f, 0x2e, 0x49, 0x6e, 0x66, 0x6f,
-	0x42, 0x75, 0x6e, 0x64, 0x6c, 0x65, 0x1a, 0x17, 0x2e, 0x68, 0x65, 0x79, 0x70, 0x2e, 0x70, 0x72,
-	0x6f, 0x74, 0x6f, 0x2e, 0x41, 0x6c, 0x6c, 0x6f, 0x63, 0x42, 0x75, 0x6e, 0x64, 0x6c, 0x65, 0x22,
-	0x00, 0x28, 0x01, 0x30, 0x01, 0x42, 0x25, 0x5a, 0x23, 0x67, 0x69, 0x74, 0x68, 0x75, 0x62, 0x2e,
-	0x63, 0x6f, 0x6d, 0x2f, 0x75, 0x6c, 0x75, 0x79, 0x6f, 0x6c, 0x2f, 0x68, 0x65, 0x79, 0x70, 0x2d,
-	0x61, 0x67, 0x65, 0x6e, 0x74, 0x73, 0x2f, 0x67, 0x6f, 0x2f, 0x70, 0x62, 0x62, 0x06, 0x70, 0x72,
-	0x6f, 0x74, 0x6f, 0x33,
+	0x72, 0x6b, 0x65, 0x72, 0x52, 0x04, 0x66, 0x6c, 0x6f, 0x77, 0x12, 0x26, 0x0a, 0x0f, 0x68, 0x69,
+	0x70, 0x72, 0x69, 0x5f, 0x75, 0x73, 0x61, 0x67, 0x65, 0x5f, 0x62, 0x70, 0x73, 0x18, 0x02, 0x20,
+	0x01, 0x28, 0x03, 0x52, 0x0d, 0x68, 0x69, 0x70, 0x72, 0x69, 0x55, 0x73, 0x61, 0x67, 0x65, 0x42,
+	0x70, 0x73, 0x12, 0x26, 0x0a, 0x0f, 0x6c, 0x6f, 0x70, 0x72, 0x69, 0x5f, 0x75, 0x73, 0x61, 0x67,
+	0x65, 0x5f, 0x62, 0x70, 0x73, 0x18, 0x03, 0x20, 0x01, 0x28, 0x03, 0x52, 0x0d, 0x6c, 0x6f, 0x70,
+	0x72, 0x69, 0x55, 0x73, 0x61, 0x67, 0x65, 0x42, 0x70, 0x73, 0x12, 0x4d, 0x0a, 0x10, 0x73, 0x61,
+	0x6d, 0x70, 0x6c, 0x65, 0x64, 0x5f, 0x63, 0x68, 0x69, 0x6c, 0x64, 0x72, 0x65, 0x6e, 0x18, 0x04,
+	0x20, 0x03, 0x28, 0x0b, 0x32, 0x22, 0x2e, 0x68, 0x65, 0x79, 0x70, 0x2e, 0x70, 0x72, 0x6f, 0x74,
+	0x6f, 0x2e, 0x41, 0x67, 0x67, 0x72, 0x65, 0x67, 0x61, 0x74, 0x65, 0x64, 0x46, 0x47, 0x49, 0x6e,
+	0x66, 0x6f, 0x2e, 0x43, 0x68, 0x69, 0x6c, 0x64, 0x52, 0x0f, 0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65,
+	0x64, 0x43, 0x68, 0x69, 0x6c, 0x64, 0x72, 0x65, 0x6e, 0x1a, 0x6f, 0x0a, 0x05, 0x43, 0x68, 0x69,
+	0x6c, 0x64, 0x12, 0x17, 0x0a, 0x07, 0x68, 0x6f, 0x73, 0x74, 0x5f, 0x69, 0x64, 0x18, 0x01, 0x20,
+	0x01, 0x28, 0x04, 0x52, 0x06, 0x68, 0x6f, 0x73, 0x74, 0x49, 0x64, 0x12, 0x24, 0x0a, 0x0e, 0x65,
+	0x77, 0x6d, 0x61, 0x5f, 0x75, 0x73, 0x61, 0x67, 0x65, 0x5f, 0x62, 0x70, 0x73, 0x18, 0x02, 0x20,
+	0x01, 0x28, 0x03, 0x52, 0x0c, 0x65, 0x77, 0x6d, 0x61, 0x55, 0x73, 0x61, 0x67, 0x65, 0x42, 0x70,
+	0x73, 0x12, 0x27, 0x0a, 0x0f, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x6c, 0x79, 0x5f, 0x6c,
+	0x6f, 0x70, 0x72, 0x69, 0x18, 0x03, 0x20, 0x01, 0x28, 0x08, 0x52, 0x0e, 0x63, 0x75, 0x72, 0x72,
+	0x65, 0x6e, 0x74, 0x6c, 0x79, 0x4c, 0x6f, 0x70, 0x72, 0x69, 0x22, 0x5e, 0x0a, 0x07, 0x48, 0x6f,
+	0x73, 0x74, 0x47, 0x65, 0x6e, 0x12, 0x17, 0x0a, 0x07, 0x68, 0x6f, 0x73, 0x74, 0x5f, 0x69, 0x64,
+	0x18, 0x01, 0x20, 0x01, 0x28, 0x04, 0x52, 0x06, 0x68, 0x6f, 0x73, 0x74, 0x49, 0x64, 0x12, 0x10,
+	0x0a, 0x03, 0x67, 0x65, 0x6e, 0x18, 0x02, 0x20, 0x01, 0x28, 0x03, 0x52, 0x03, 0x67, 0x65, 0x6e,
+	0x12, 0x28, 0x0a, 0x10, 0x6e, 0x65, 0x65, 0x64, 0x73, 0x5f, 0x66, 0x75, 0x6c, 0x6c, 0x5f, 0x61,
+	0x6c, 0x6c, 0x6f, 0x63, 0x18, 0x03, 0x20, 0x01, 0x28, 0x08, 0x52, 0x0e, 0x6e, 0x65, 0x65, 0x64,
+	0x73, 0x46, 0x75, 0x6c, 0x6c, 0x41, 0x6c, 0x6c, 0x6f, 0x63, 0x22, 0xcb, 0x01, 0x0a, 0x14, 0x41,
+	0x67, 0x67, 0x72, 0x65, 0x67, 0x61, 0x74, 0x65, 0x64, 0x49, 0x6e, 0x66, 0x6f, 0x42, 0x75, 0x6e,
+	0x64, 0x6c, 0x65, 0x12, 0x36, 0x0a, 0x0a, 0x61, 0x67, 0x67, 0x72, 0x65, 0x67, 0x61, 0x74, 0x6f,
+	0x72, 0x18, 0x01, 0x20, 0x01, 0x28, 0x0b, 0x32, 0x16, 0x2e, 0x68, 0x65, 0x79, 0x70, 0x2e, 0x70,
+	0x72, 0x6f, 0x74, 0x6f, 0x2e, 0x46, 0x6c, 0x6f, 0x77, 0x4d, 0x61, 0x72, 0x6b, 0x65, 0x72, 0x52,
+	0x0a, 0x61, 0x67, 0x67, 0x72, 0x65, 0x67, 0x61, 0x74, 0x6f, 0x72, 0x12, 0x10, 0x0a, 0x03, 0x67,
+	0x65, 0x6e, 0x18, 0x02, 0x20, 0x01, 0x28, 0x03, 0x52, 0x03, 0x67, 0x65, 0x6e, 0x12, 0x37, 0x0a,
+	0x08, 0x66, 0x67, 0x5f, 0x69, 0x6e, 0x66, 0x6f, 0x73, 0x18, 0x03, 0x20, 0x03, 0x28, 0x0b, 0x32,
+	0x1c, 0x2e, 0x68, 0x65, 0x79, 0x70, 0x2e, 0x70, 0x72, 0x6f, 0x74, 0x6f, 0x2e, 0x41, 0x67, 0x67,
+	0x72, 0x65, 0x67, 0x61, 0x74, 0x65, 0x64, 0x46, 0x47, 0x49, 0x6e, 0x66, 0x6f, 0x52, 0x07, 0x66,
+	0x67, 0x49, 0x6e, 0x66, 0x6f, 0x73, 0x12, 0x30, 0x0a, 0x09, 0x68, 0x6f, 0x73, 0x74, 0x5f, 0x67,
+	0x65, 0x6e, 0x73, 0x18, 0x04, 0x20, 0x03, 0x28, 0x0b, 0x32, 0x13, 0x2e, 0x68, 0x65, 0x79, 0x70,
+	0x2e, 0x70, 0x72, 0x6f, 0x74, 0x6f, 0x2e, 0x48, 0x6f, 0x73, 0x74, 0x47, 0x65, 0x6e, 0x52, 0x08,
+	0x68, 0x6f, 0x73, 0x74, 0x47, 0x65, 0x6e, 0x73, 0x22, 0x45, 0x0a, 0x12, 0x52, 0x65, 0x6c, 0x61,
+	0x79, 0x65, 0x64, 0x41, 0x6c, 0x6c, 0x6f, 0x63, 0x42, 0x75, 0x6e, 0x64, 0x6c, 0x65, 0x12, 0x17,
+	0x0a, 0x07, 0x68, 0x6f, 0x73, 0x74, 0x5f, 0x69, 0x64, 0x18, 0x01, 0x20, 0x01, 0x28, 0x04, 0x52,
+	0x06, 0x68, 0x6f, 0x73, 0x74, 0x49, 0x64, 0x12, 0x16, 0x0a, 0x06, 0x62, 0x75, 0x6e, 0x64, 0x6c,
+	0x65, 0x18, 0x02, 0x20, 0x01, 0x28, 0x0c, 0x52, 0x06, 0x62, 0x75, 0x6e, 0x64, 0x6c, 0x65, 0x22,
+	0x4b, 0x0a, 0x11, 0x52, 0x65, 0x6c, 0x61, 0x79, 0x65, 0x64, 0x41, 0x6c, 0x6c, 0x6f, 0x63, 0x42,
+	0x61, 0x74, 0x63, 0x68, 0x12, 0x36, 0x0a, 0x06, 0x61, 0x6c, 0x6c, 0x6f, 0x63, 0x73, 0x18, 0x01,
+	0x20, 0x03, 0x28, 0x0b, 0x32, 0x1e, 0x2e, 0x68, 0x65, 0x79, 0x70, 0x2e, 0x70, 0x72, 0x6f, 0x74,
+	0x6f, 0x2e, 0x52, 0x65, 0x6c, 0x61, 0x79, 0x65, 0x64, 0x41, 0x6c, 0x6c, 0x6f, 0x63, 0x42, 0x75,
+	0x6e, 0x64, 0x6c, 0x65, 0x52, 0x06, 0x61, 0x6c, 0x6c, 0x6f, 0x63, 0x73, 0x2a, 0x27, 0x0a, 0x08,
+	0x50, 0x72, 0x6f, 0x74, 0x6f, 0x63, 0x6f, 0x6c, 0x12, 0x09, 0x0a, 0x05, 0x55, 0x4e, 0x53, 0x45,
+	0x54, 0x10, 0x00, 0x12, 0x07, 0x0a, 0x03, 0x54, 0x43, 0x50, 0x10, 0x01, 0x12, 0x07, 0x0a, 0x03,
+	0x55, 0x44, 0x50, 0x10, 0x02, 0x32, 0xb2, 0x01, 0x0a, 0x0c, 0x43, 0x6c, 0x75, 0x73, 0x74, 0x65,
+	0x72, 0x41, 0x67, 0x65, 0x6e, 0x74, 0x12, 0x45, 0x0a, 0x0c, 0x52, 0x65, 0x67, 0x69, 0x73, 0x74,
+	0x65, 0x72, 0x48, 0x6f, 0x73, 0x74, 0x12, 0x16, 0x2e, 0x68, 0x65, 0x79, 0x70, 0x2e, 0x70, 0x72,
+	0x6f, 0x74, 0x6f, 0x2e, 0x49, 0x6e, 0x66, 0x6f, 0x42, 0x75, 0x6e, 0x64, 0x6c, 0x65, 0x1a, 0x17,
+	0x2e, 0x68, 0x65, 0x79, 0x70, 0x2e, 0x70, 0x72, 0x6f, 0x74, 0x6f, 0x2e, 0x41, 0x6c, 0x6c, 0x6f,
+	0x63, 0x42, 0x75, 0x6e, 0x64, 0x6c, 0x65, 0x22, 0x00, 0x28, 0x01, 0x30, 0x01, 0x12, 0x5b, 0x0a,
+	0x12, 0x52, 0x65, 0x67, 0x69, 0x73, 0x74, 0x65, 0x72, 0x41, 0x67, 0x67, 0x72, 0x65, 0x67, 0x61,
+	0x74, 0x6f, 0x72, 0x12, 0x20, 0x2e, 0x68, 0x65, 0x79, 0x70, 0x2e, 0x70, 0x72, 0x6f, 0x74, 0x6f,
+	0x2e, 0x41, 0x67, 0x67, 0x72, 0x65, 0x67, 0x61, 0x74, 0x65, 0x64, 0x49, 0x6e, 0x66, 0x6f, 0x42,
+	0x75, 0x6e, 0x64, 0x6c, 0x65, 0x1a, 0x1d, 0x2e, 0x68, 0x65, 0x79, 0x70, 0x2e, 0x70, 0x72, 0x6f,
+	0x74, 0x6f, 0x2e, 0x52, 0x65, 0x6c, 0x61, 0x79, 0x65, 0x64, 0x41, 0x6c, 0x6c, 0x6f, 0x63, 0x42,
+	0x61, 0x74, 0x63, 0x68, 0x22, 0x00, 0x28, 0x01, 0x30, 0x01, 0x42, 0x25, 0x5a, 0x23, 0x67, 0x69,
+	0x74, 0x68, 0x75, 0x62, 0x2e, 0x63, 0x6f, 0x6d, 0x2f, 0x75, 0x6c, 0x75, 0x79, 0x6f, 0x6c, 0x2f,
+	0x68, 0x65, 0x79, 0x70, 0x2d, 0x61, 0x67, 0x65, 0x6e, 0x74, 0x73, 0x2f, 0x67, 0x6f, 0x2f, 0x70,
+	0x62, 0x62, 0x06, 0x70, 0x72, 0x6f, 0x74, 0x6f, 0x33,
 }
 
 var (
@@ -1217,36 +1851,55 @@ func file_heyp_proto_heyp_proto_rawDescGZIP() []byte {
 }
 
 var file_heyp_proto_heyp_proto_enumTypes = make([]protoimpl.EnumInfo, 1)
-var file_heyp_proto_heyp_proto_msgTypes = make([]protoimpl.MessageInfo, 7)
+var file_heyp_proto_heyp_proto_msgTypes = make([]protoimpl.MessageInfo, 15)
 var file_heyp_proto_heyp_proto_goTypes = []interface{}{
-	(Protocol)(0),                 // 0: heyp.proto.Protocol
-	(*FlowMarker)(nil),            // 1: heyp.proto.FlowMarker
-	(*FlowInfo)(nil),              // 2: heyp.proto.FlowInfo
-	(*AggInfo)(nil),               // 3: heyp.proto.AggInfo
-	(*InfoBundle)(nil),            // 4: heyp.proto.InfoBundle
-	(*FlowAlloc)(nil),             // 5: heyp.proto.FlowAlloc
-	(*AllocBundle)(nil),           // 6: heyp.proto.AllocBundle
-	(*FlowInfo_AuxInfo)(nil),      // 7: heyp.proto.FlowInfo.AuxInfo
-	(*timestamppb.Timestamp)(nil), // 8: google.protobuf.Timestamp
+	(Protocol)(0),                   // 0: heyp.proto.Protocol
+	(*FlowMarker)(nil),              // 1: heyp.proto.FlowMarker
+	(*FlowInfo)(nil),                // 2: heyp.proto.FlowInfo
+	(*AggInfo)(nil),                 // 3: heyp.proto.AggInfo
+	(*InfoBundle)(nil),              // 4: heyp.proto.InfoBundle
+	(*FlowAlloc)(nil),               // 5: heyp.proto.FlowAlloc
+	(*ThresholdSamplingParams)(nil), // 6: heyp.proto.ThresholdSamplingParams
+	(*FGDictionaryEntry)(nil),       // 7: heyp.proto.FGDictionaryEntry
+	(*AllocBundle)(nil),             // 8: heyp.proto.AllocBundle
+	(*AggregatedFGInfo)(nil),        // 9: heyp.proto.AggregatedFGInfo
+	(*HostGen)(nil),                 // 10: heyp.proto.HostGen
+	(*AggregatedInfoBundle)(nil),    // 11: heyp.proto.AggregatedInfoBundle
+	(*RelayedAllocBundle)(nil),      // 12: heyp.proto.RelayedAllocBundle
+	(*RelayedAllocBatch)(nil),       // 13: heyp.proto.RelayedAllocBatch
+	(*FlowInfo_AuxInfo)(nil),        // 14: heyp.proto.FlowInfo.AuxInfo
+	(*AggregatedFGInfo_Child)(nil),  // 15: heyp.proto.AggregatedFGInfo.Child
+	(*timestamppb.Timestamp)(nil),   // 16: google.protobuf.Timestamp
 }
 var file_heyp_proto_heyp_proto_depIdxs = []int32{
 	0,  // 0: heyp.proto.FlowMarker.protocol:type_name -> heyp.proto.Protocol
 	1,  // 1: heyp.proto.FlowInfo.flow:type_name -> heyp.proto.FlowMarker
-	7,  // 2: heyp.proto.FlowInfo.aux:type_name -> heyp.proto.FlowInfo.AuxInfo
+	14, // 2: heyp.proto.FlowInfo.aux:type_name -> heyp.proto.FlowInfo.AuxInfo
 	2,  // 3: heyp.proto.AggInfo.parent:type_name -> heyp.proto.FlowInfo
 	2,  // 4: heyp.proto.AggInfo.children:type_name -> heyp.proto.FlowInfo
 	1,  // 5: heyp.proto.InfoBundle.bundler:type_name -> heyp.proto.FlowMarker
-	8,  // 6: heyp.proto.InfoBundle.timestamp:type_name -> google.protobuf.Timestamp
+	16, // 6: heyp.proto.InfoBundle.timestamp:type_name -> google.protobuf.Timestamp
 	2,  // 7: heyp.proto.InfoBundle.flow_infos:type_name -> heyp.proto.FlowInfo
 	1,  // 8: heyp.proto.FlowAlloc.flow:type_name -> heyp.proto.FlowMarker
-	5,  // 9: heyp.proto.AllocBundle.flow_allocs:type_name -> heyp.proto.FlowAlloc
-	4,  // 10: heyp.proto.ClusterAgent.RegisterHost:input_type -> heyp.proto.InfoBundle
-	6,  // 11: heyp.proto.ClusterAgent.RegisterHost:output_type -> heyp.proto.AllocBundle
-	11, // [11:12] is the sub-list for method output_type
-	10, // [10:11] is the sub-list for method input_type
-	10, // [10:10] is the sub-list for extension type_name
-	10, // [10:10] is the sub-list for extension extendee
-	0,  // [0:10] is the sub-list for field type_name
+	1,  // 9: heyp.proto.FGDictionaryEntry.flow:type_name -> heyp.proto.FlowMarker
+	6,  // 10: heyp.proto.FGDictionaryEntry.sampling:type_name -> heyp.proto.ThresholdSamplingParams
+	5,  // 11: heyp.proto.AllocBundle.flow_allocs:type_name -> heyp.proto.FlowAlloc
+	7,  // 12: heyp.proto.AllocBundle.fg_dictionary:type_name -> heyp.proto.FGDictionaryEntry
+	1,  // 13: heyp.proto.AggregatedFGInfo.flow:type_name -> heyp.proto.FlowMarker
+	15, // 14: heyp.proto.AggregatedFGInfo.sampled_children:type_name -> heyp.proto.AggregatedFGInfo.Child
+	1,  // 15: heyp.proto.AggregatedInfoBundle.aggregator:type_name -> heyp.proto.FlowMarker
+	9,  // 16: heyp.proto.AggregatedInfoBundle.fg_infos:type_name -> heyp.proto.AggregatedFGInfo
+	10, // 17: heyp.proto.AggregatedInfoBundle.host_gens:type_name -> heyp.proto.HostGen
+	12, // 18: heyp.proto.RelayedAllocBatch.allocs:type_name -> heyp.proto.RelayedAllocBundle
+	4,  // 19: heyp.proto.ClusterAgent.RegisterHost:input_type -> heyp.proto.InfoBundle
+	11, // 20: heyp.proto.ClusterAgent.RegisterAggregator:input_type -> heyp.proto.AggregatedInfoBundle
+	8,  // 21: heyp.proto.ClusterAgent.RegisterHost:output_type -> heyp.proto.AllocBundle
+	13, // 22: heyp.proto.ClusterAgent.RegisterAggregator:output_type -> heyp.proto.RelayedAllocBatch
+	21, // [21:23] is the sub-list for method output_type
+	19, // [19:21] is the sub-list for method input_type
+	19, // [19:19] is the sub-list for extension type_name
+	19, // [19:19] is the sub-list for extension extendee
+	0,  // [0:19] is the sub-list for field type_name
 }
 
 func init() { file_heyp_proto_heyp_proto_init() }
@@ -1316,7 +1969,7 @@ func file_heyp_proto_heyp_proto_init() {
 			}
 		}
 		file_heyp_proto_heyp_proto_msgTypes[5].Exporter = func(v interface{}, i int) interface{} {
-			switch v := v.(*AllocBundle); i {
+			switch v := v.(*ThresholdSamplingParams); i {
 			case 0:
 				return &v.state
 			case 1:
@@ -1328,6 +1981,90 @@ func file_heyp_proto_heyp_proto_init() {
 			}
 		}
 		file_heyp_proto_heyp_proto_msgTypes[6].Exporter = func(v interface{}, i int) interface{} {
+			switch v := v.(*FGDictionaryEntry); i {
+			case 0:
+				return &v.state
+			case 1:
+				return &v.sizeCache
+			case 2:
+				return &v.unknownFields
+			default:
+				return nil
+			}
+		}
+		file_heyp_proto_heyp_proto_msgTypes[7].Exporter = func(v interface{}, i int) interface{} {
+			switch v := v.(*AllocBundle); i {
+			case 0:
+				return &v.state
+			case 1:
+				return &v.sizeCache
+			case 2:
+				return &v.unknownFields
+			default:
+				return nil
+			}
+		}
+		file_heyp_proto_heyp_proto_msgTypes[8].Exporter = func(v interface{}, i int) interface{} {
+			switch v := v.(*AggregatedFGInfo); i {
+			case 0:
+				return &v.state
+			case 1:
+				return &v.sizeCache
+			case 2:
+				return &v.unknownFields
+			default:
+				return nil
+			}
+		}
+		file_heyp_proto_heyp_proto_msgTypes[9].Exporter = func(v interface{}, i int) interface{} {
+			switch v := v.(*HostGen); i {
+			case 0:
+				return &v.state
+			case 1:
+				return &v.sizeCache
+			case 2:
+				return &v.unknownFields
+			default:
+				return nil
+			}
+		}
+		file_heyp_proto_heyp_proto_msgTypes[10].Exporter = func(v interface{}, i int) interface{} {
+			switch v := v.(*AggregatedInfoBundle); i {
+			case 0:
+				return &v.state
+			case 1:
+				return &v.sizeCache
+			case 2:
+				return &v.unknownFields
+			default:
+				return nil
+			}
+		}
+		file_heyp_proto_heyp_proto_msgTypes[11].Exporter = func(v interface{}, i int) interface{} {
+			switch v := v.(*RelayedAllocBundle); i {
+			case 0:
+				return &v.state
+			case 1:
+				return &v.sizeCache
+			case 2:
+				return &v.unknownFields
+			default:
+				return nil
+			}
+		}
+		file_heyp_proto_heyp_proto_msgTypes[12].Exporter = func(v interface{}, i int) interface{} {
+			switch v := v.(*RelayedAllocBatch); i {
+			case 0:
+				return &v.state
+			case 1:
+				return &v.sizeCache
+			case 2:
+				return &v.unknownFields
+			default:
+				return nil
+			}
+		}
+		file_heyp_proto_heyp_proto_msgTypes[13].Exporter = func(v interface{}, i int) interface{} {
 			switch v := v.(*FlowInfo_AuxInfo); i {
 			case 0:
 				return &v.state
@@ -1339,6 +2076,18 @@ func file_heyp_proto_heyp_proto_init() {
 				return nil
 			}
 		}
+		file_heyp_proto_heyp_proto_msgTypes[14].Exporter = func(v interface{}, i int) interface{} {
+			switch v := v.(*AggregatedFGInfo_Child); i {
+			case 0:
+				return &v.state
+			case 1:
+				return &v.sizeCache
+			case 2:
+				return &v.unknownFields
+			default:
+				return nil
+			}
+		}
 	}
 	type x struct{}
 	out := protoimpl.TypeBuilder{
@@ -1346,7 +2095,7 @@ func file_heyp_proto_heyp_proto_init() {
 			GoPackagePath: reflect.TypeOf(x{}).PkgPath(),
 			RawDescriptor: file_heyp_proto_heyp_proto_rawDesc,
 			NumEnums:      1,
-			NumMessages:   7,
+			NumMessages:   15,
 			NumExtensions: 0,
 			NumServices:   1,
 		},
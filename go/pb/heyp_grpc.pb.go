@@ -19,6 +19,8 @@ const _ = grpc.SupportPackageIsVersion7
 // For semantics around ctx use and closing/ending streaming RPCs, please refer to https://pkg.go.dev/google.golang.org/grpc/?tab=doc#ClientConn.NewStream.
 type ClusterAgentClient interface {
 	RegisterHost(ctx context.Context, opts ...grpc.CallOption) (ClusterAgent_RegisterHostClient, error)
+	// Used by aggregator-agents, which stand in for many hosts on a single stream.
+	RegisterAggregator(ctx context.Context, opts ...grpc.CallOption) (ClusterAgent_RegisterAggregatorClient, error)
 }
 
 type clusterAgentClient struct {
@@ -60,11 +62,44 @@ func (x *clusterAgentRegisterHostClient) Recv() (*AllocBundle, error) {
 	return m, nil
 }
 
+func (c *clusterAgentClient) RegisterAggregator(ctx context.Context, opts ...grpc.CallOption) (ClusterAgent_RegisterAggregatorClient, error) {
+	stream, err := c.cc.NewStream(ctx, &ClusterAgent_ServiceDesc.Streams[1], "/heyp.proto.ClusterAgent/RegisterAggregator", opts...)
+	if err != nil {
+		return nil, err
+	}
+	x := &clusterAgentRegisterAggregatorClient{stream}
+	return x, nil
+}
+
+type ClusterAgent_RegisterAggregatorClient interface {
+	Send(*AggregatedInfoBundle) error
+	Recv() (*RelayedAllocBatch, error)
+	grpc.ClientStream
+}
+
+type clusterAgentRegisterAggregatorClient struct {
+	grpc.ClientStream
+}
+
+func (x *clusterAgentRegisterAggregatorClient) Send(m *AggregatedInfoBundle) error {
+	return x.ClientStream.SendMsg(m)
+}
+
+func (x *clusterAgentRegisterAggregatorClient) Recv() (*RelayedAllocBatch, error) {
+	m := new(RelayedAllocBatch)
+	if err := x.ClientStream.RecvMsg(m); err != nil {
+		return nil, err
+	}
+	return m, nil
+}
+
 // ClusterAgentServer is the server API for ClusterAgent service.
 // All implementations must embed UnimplementedClusterAgentServer
 // for forward compatibility
 type ClusterAgentServer interface {
 	RegisterHost(ClusterAgent_RegisterHostServer) error
+	// Used by aggregator-agents, which stand in for many hosts on a single stream.
+	RegisterAggregator(ClusterAgent_RegisterAggregatorServer) error
 	mustEmbedUnimplementedClusterAgentServer()
 }
 
@@ -75,6 +110,9 @@ type UnimplementedClusterAgentServer struct {
 func (UnimplementedClusterAgentServer) RegisterHost(ClusterAgent_RegisterHostServer) error {
 	return status.Errorf(codes.Unimplemented, "method RegisterHost not implemented")
 }
+func (UnimplementedClusterAgentServer) RegisterAggregator(ClusterAgent_RegisterAggregatorServer) error {
+	return status.Errorf(codes.Unimplemented, "method RegisterAggregator not implemented")
+}
 func (UnimplementedClusterAgentServer) mustEmbedUnimplementedClusterAgentServer() {}
 
 // UnsafeClusterAgentServer may be embedded to opt out of forward compatibility for this service.
@@ -114,6 +152,32 @@ func (x *clusterAgentRegisterHostServer) Recv() (*InfoBundle, error) {
 	return m, nil
 }
 
+func _ClusterAgent_RegisterAggregator_Handler(srv interface{}, stream grpc.ServerStream) error {
+	return srv.(ClusterAgentServer).RegisterAggregator(&clusterAgentRegisterAggregatorServer{stream})
+}
+
+type ClusterAgent_RegisterAggregatorServer interface {
+	Send(*RelayedAllocBatch) error
+	Recv() (*AggregatedInfoBundle, error)
+	grpc.ServerStream
+}
+
+type clusterAgentRegisterAggregatorServer struct {
+	grpc.ServerStream
+}
+
+func (x *clusterAgentRegisterAggregatorServer) Send(m *RelayedAllocBatch) error {
+	return x.ServerStream.SendMsg(m)
+}
+
+func (x *clusterAgentRegisterAggregatorServer) Recv() (*AggregatedInfoBundle, error) {
+	m := new(AggregatedInfoBundle)
+	if err := x.ServerStream.RecvMsg(m); err != nil {
+		return nil, err
+	}
+	return m, nil
+}
+
 // ClusterAgent_ServiceDesc is the grpc.ServiceDesc for ClusterAgent service.
 // It's only intended for direct use with grpc.RegisterService,
 // and not to be introspected or modified (even as a copy)
@@ -128,6 +192,12 @@ var ClusterAgent_ServiceDesc = grpc.ServiceDesc{
 			ServerStreams: true,
 			ClientStreams: true,
 		},
+		{
+			StreamName:    "RegisterAggregator",
+			Handler:       _ClusterAgent_RegisterAggregator_Handler,
+			ServerStreams: true,
+			ClientStreams: true,
+		},
 	},
 	Metadata: "heyp/proto/heyp.proto",
 }
@@ -0,0 +1,106 @@
+#include <csignal>
+#include <iostream>
+#include <string>
+
+#include "absl/status/status.h"
+#include "absl/strings/numbers.h"
+#include "absl/strings/str_split.h"
+#include "absl/time/time.h"
+#include "grpcpp/grpcpp.h"
+#include "heyp/aggregator-agent/pre-aggregator.h"
+#include "heyp/aggregator-agent/relay-controller.h"
+#include "heyp/cli/parse.h"
+#include "heyp/cluster-agent/server.h"
+#include "heyp/init/init.h"
+#include "heyp/log/spdlog.h"
+#include "heyp/proto/config.pb.h"
+#include "heyp/proto/fileio.h"
+#include "heyp/threads/set-name.h"
+
+static std::atomic<bool> should_exit_flag{false};
+
+static void InterruptHandler(int signal) {
+  if (signal == SIGINT) {
+    should_exit_flag.store(true);
+  }
+}
+
+namespace heyp {
+namespace {
+
+absl::Status Run(const proto::AggregatorAgentConfig& c,
+                 const proto::AllocBundle& allocs) {
+  auto forward_period_or = ParseAbslDuration(c.forward_period(), "forward period");
+  if (!forward_period_or.ok()) {
+    return forward_period_or.status();
+  }
+
+  auto controller = std::make_shared<RelayController>(
+      std::make_unique<PreAggregator>(c.aggregator_id(), allocs, c.target_num_samples()),
+      proto::ClusterAgent::NewStub(grpc::CreateChannel(
+          c.cluster_agent_address(), grpc::InsecureChannelCredentials())));
+
+  auto logger = MakeLogger("main");
+  std::vector<std::unique_ptr<ClusterAgentService>> services;
+  std::vector<std::unique_ptr<grpc::Server>> servers;
+  services.reserve(c.addresses_size());
+  servers.reserve(c.addresses_size());
+  for (const auto& address : c.addresses()) {
+    std::vector<std::string> parts = absl::StrSplit(address, ":");
+    int id = 0;
+    if (!absl::SimpleAtoi(parts[parts.size() - 1], &id)) {
+      SPDLOG_LOGGER_INFO(
+          &logger, "failed to parse port in {}: service ids may not be useful", address);
+    }
+
+    auto service = std::make_unique<ClusterAgentService>(controller, id);
+    servers.push_back(grpc::ServerBuilder()
+                          .AddListeningPort(address, grpc::InsecureServerCredentials())
+                          .RegisterService(service.get())
+                          .BuildAndStart());
+    services.push_back(std::move(service));
+    SPDLOG_LOGGER_INFO(&logger, "Server listening on {}", address);
+  }
+  SPDLOG_LOGGER_INFO(&logger, "Forwarding to cluster agent at {}",
+                     c.cluster_agent_address());
+
+  SetCurThreadName("fwd-loop");
+  RunLoop(controller, *forward_period_or, &should_exit_flag, &logger);
+
+  for (std::unique_ptr<grpc::Server>& server : servers) {
+    server->Shutdown();
+    server->Wait();
+  }
+  return absl::OkStatus();
+}
+
+}  // namespace
+}  // namespace heyp
+
+int main(int argc, char** argv) {
+  heyp::MainInit(&argc, &argv);
+  std::signal(SIGINT, InterruptHandler);
+
+  if (argc != 3) {
+    std::cerr << "usage: " << argv[0] << " config_path.textproto limits_path.textproto\n";
+    return 1;
+  }
+
+  heyp::proto::AggregatorAgentConfig config;
+  if (!heyp::ReadTextProtoFromFile(std::string(argv[1]), &config)) {
+    std::cerr << "failed to read config file\n";
+    return 2;
+  }
+
+  heyp::proto::AllocBundle limits;
+  if (!heyp::ReadTextProtoFromFile(std::string(argv[2]), &limits)) {
+    std::cerr << "failed to read limit file\n";
+    return 2;
+  }
+
+  absl::Status s = heyp::Run(config, limits);
+  if (!s.ok()) {
+    std::cerr << "failed to run: " << s << "\n";
+    return 3;
+  }
+}
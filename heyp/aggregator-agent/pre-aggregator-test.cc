@@ -0,0 +1,144 @@
+#include "heyp/aggregator-agent/pre-aggregator.h"
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "heyp/proto/heyp.pb.h"
+#include "heyp/proto/parse-text.h"
+#include "heyp/proto/testing.h"
+
+namespace heyp {
+namespace {
+
+proto::AllocBundle TestLimits() {
+  return ParseTextProto<proto::AllocBundle>(R"(
+    flow_allocs {
+      flow { src_dc: "chicago" dst_dc: "new_york" }
+      hipri_rate_limit_bps: 1000
+    }
+    flow_allocs {
+      flow { src_dc: "chicago" dst_dc: "detroit" }
+      hipri_rate_limit_bps: 500
+    }
+  )");
+}
+
+TEST(PreAggregatorTest, SumsExactlyAndSamples) {
+  // With this many target samples, every child is sampled.
+  PreAggregator agg(77, TestLimits(), 100000);
+
+  agg.UpdateInfo(ParseTextProto<proto::InfoBundle>(R"(
+    bundler { host_id: 1 }
+    gen: 3
+    flow_infos {
+      flow { src_dc: "chicago" dst_dc: "detroit" job: "UNSET" host_id: 1 }
+      ewma_usage_bps: 100
+      currently_lopri: true
+    }
+    flow_infos {
+      flow { src_dc: "chicago" dst_dc: "new_york" job: "UNSET" host_id: 1 }
+      ewma_usage_bps: 200
+    }
+    flow_infos {
+      flow { src_dc: "chicago" dst_dc: "unknown" job: "UNSET" host_id: 1 }
+      ewma_usage_bps: 999
+    }
+  )"));
+  agg.UpdateInfo(ParseTextProto<proto::InfoBundle>(R"(
+    bundler { host_id: 2 }
+    gen: 5
+    needs_full_alloc: true
+    flow_infos {
+      flow { src_dc: "chicago" dst_dc: "detroit" job: "UNSET" host_id: 2 }
+      ewma_usage_bps: 30
+    }
+  )"));
+  // Replaces the previous info but keeps the resync request.
+  agg.UpdateInfo(ParseTextProto<proto::InfoBundle>(R"(
+    bundler { host_id: 2 }
+    gen: 6
+    flow_infos {
+      flow { src_dc: "chicago" dst_dc: "detroit" job: "UNSET" host_id: 2 }
+      ewma_usage_bps: 40
+    }
+  )"));
+
+  proto::AggregatedInfoBundle got;
+  agg.Flush(&got);
+  EXPECT_EQ(got.aggregator().host_id(), 77);
+  EXPECT_EQ(got.gen(), 1);
+  EXPECT_THAT(got.host_gens(),
+              testing::UnorderedElementsAre(EqProto(ParseTextProto<proto::HostGen>(R"(
+                                              host_id: 1 gen: 3
+                                            )")),
+                                            EqProto(ParseTextProto<proto::HostGen>(R"(
+                                              host_id: 2 gen: 6 needs_full_alloc: true
+                                            )"))));
+  ASSERT_EQ(got.fg_infos_size(), 2);
+
+  // FGs are emitted in limit order.
+  const proto::AggregatedFGInfo& ny = got.fg_infos(0);
+  EXPECT_EQ(ny.flow().dst_dc(), "new_york");
+  EXPECT_EQ(ny.hipri_usage_bps(), 200);
+  EXPECT_EQ(ny.lopri_usage_bps(), 0);
+  EXPECT_THAT(ny.sampled_children(),
+              testing::ElementsAre(EqProto(ParseTextProto<proto::AggregatedFGInfo::Child>(
+                  R"(host_id: 1 ewma_usage_bps: 200)"))));
+
+  const proto::AggregatedFGInfo& det = got.fg_infos(1);
+  EXPECT_EQ(det.flow().dst_dc(), "detroit");
+  EXPECT_EQ(det.hipri_usage_bps(), 40);
+  EXPECT_EQ(det.lopri_usage_bps(), 100);
+  EXPECT_EQ(det.sampled_children_size(), 2);
+
+  // Nothing is carried over to the next flush.
+  agg.Flush(&got);
+  EXPECT_EQ(got.gen(), 2);
+  EXPECT_EQ(got.host_gens_size(), 0);
+  EXPECT_EQ(got.fg_infos_size(), 0);
+}
+
+TEST(PreAggregatorTest, IgnoresClusterAgentFGIds) {
+  PreAggregator agg(1, TestLimits(), 100000);
+
+  // The cluster agent numbers FGs in its own order, which differs from ours.
+  agg.UpdateInfo(ParseTextProto<proto::InfoBundle>(R"(
+    bundler { host_id: 1 }
+    flow_infos {
+      flow { src_dc: "chicago" dst_dc: "detroit" job: "UNSET" host_id: 1 }
+      fg_id: 1
+      ewma_usage_bps: 100
+    }
+  )"));
+
+  proto::AggregatedInfoBundle got;
+  agg.Flush(&got);
+  ASSERT_EQ(got.fg_infos_size(), 1);
+  EXPECT_EQ(got.fg_infos(0).flow().dst_dc(), "detroit");
+  EXPECT_EQ(got.fg_infos(0).hipri_usage_bps(), 100);
+}
+
+TEST(PreAggregatorTest, SamplesFewSmallChildren) {
+  PreAggregator agg(1, TestLimits(), 1);
+
+  constexpr int kNumHosts = 1000;
+  for (int i = 0; i < kNumHosts; ++i) {
+    proto::InfoBundle info;
+    info.mutable_bundler()->set_host_id(i);
+    proto::FlowInfo* fi = info.add_flow_infos();
+    fi->mutable_flow()->set_src_dc("chicago");
+    fi->mutable_flow()->set_dst_dc("new_york");
+    fi->set_ewma_usage_bps(1);
+    agg.UpdateInfo(info);
+  }
+
+  proto::AggregatedInfoBundle got;
+  agg.Flush(&got);
+  ASSERT_EQ(got.fg_infos_size(), 1);
+  EXPECT_EQ(got.fg_infos(0).hipri_usage_bps(), kNumHosts);
+  // Expect ~1 sample (1 per 1000 bps of usage).
+  EXPECT_LT(got.fg_infos(0).sampled_children_size(), 20);
+  EXPECT_EQ(got.host_gens_size(), kNumHosts);
+}
+
+}  // namespace
+}  // namespace heyp
@@ -0,0 +1,90 @@
+#include "heyp/aggregator-agent/pre-aggregator.h"
+
+#include "heyp/flows/agg-marker.h"
+
+namespace heyp {
+
+PreAggregator::PreAggregator(uint64_t aggregator_id,
+                             const proto::AllocBundle& cluster_wide_allocs,
+                             int target_num_samples)
+    : aggregator_id_(aggregator_id), gen_(0) {
+  for (const proto::FlowAlloc& a : cluster_wide_allocs.flow_allocs()) {
+    flow2id_[a.flow()] = id2flow_.size();
+    id2flow_.push_back(ToClusterFlow(a.flow()));
+    samplers_.emplace_back(target_num_samples, a.hipri_rate_limit_bps());
+  }
+  summaries_.resize(id2flow_.size());
+}
+
+void PreAggregator::UpdateInfo(const proto::InfoBundle& info) {
+  absl::MutexLock l(&mu_);
+  HostState& state = hosts_[info.bundler().host_id()];
+  state.gen = info.gen();
+  // A resync request must survive later infos that arrive before the next Flush.
+  state.needs_full_alloc = state.needs_full_alloc || info.needs_full_alloc();
+  state.usage.clear();
+  for (const proto::FlowInfo& fi : info.flow_infos()) {
+    // Match on the flow, not fi.fg_id: hosts are tagged with the cluster agent's FG
+    // ids, which need not follow the order of our limits.
+    auto iter = flow2id_.find(fi.flow());
+    if (iter == flow2id_.end()) {
+      continue;
+    }
+    state.usage.push_back(FGUsage{
+        .agg_id = iter->second,
+        .usage_bps = fi.ewma_usage_bps(),
+        .currently_lopri = fi.currently_lopri(),
+    });
+  }
+}
+
+void PreAggregator::Flush(proto::AggregatedInfoBundle* out) {
+  out->Clear();
+  out->mutable_aggregator()->set_host_id(aggregator_id_);
+
+  absl::MutexLock l(&mu_);
+  out->set_gen(++gen_);
+  for (const auto& [host_id, state] : hosts_) {
+    proto::HostGen* hg = out->add_host_gens();
+    hg->set_host_id(host_id);
+    hg->set_gen(state.gen);
+    hg->set_needs_full_alloc(state.needs_full_alloc);
+
+    for (const FGUsage& u : state.usage) {
+      FGSummary& s = summaries_[u.agg_id];
+      s.seen = true;
+      if (u.currently_lopri) {
+        s.lopri_usage_bps += u.usage_bps;
+      } else {
+        s.hipri_usage_bps += u.usage_bps;
+      }
+      if (samplers_[u.agg_id].ShouldInclude(rng_, u.usage_bps)) {
+        proto::AggregatedFGInfo::Child& c = s.sampled.emplace_back();
+        c.set_host_id(host_id);
+        c.set_ewma_usage_bps(u.usage_bps);
+        c.set_currently_lopri(u.currently_lopri);
+      }
+    }
+  }
+  hosts_.clear();
+
+  for (size_t agg_id = 0; agg_id < summaries_.size(); ++agg_id) {
+    FGSummary& s = summaries_[agg_id];
+    if (!s.seen) {
+      continue;
+    }
+    proto::AggregatedFGInfo* fg = out->add_fg_infos();
+    *fg->mutable_flow() = id2flow_[agg_id];
+    fg->set_hipri_usage_bps(s.hipri_usage_bps);
+    fg->set_lopri_usage_bps(s.lopri_usage_bps);
+    for (proto::AggregatedFGInfo::Child& c : s.sampled) {
+      fg->add_sampled_children()->Swap(&c);
+    }
+    s.hipri_usage_bps = 0;
+    s.lopri_usage_bps = 0;
+    s.sampled.clear();
+    s.seen = false;
+  }
+}
+
+}  // namespace heyp
@@ -0,0 +1,69 @@
+#ifndef HEYP_AGGREGATOR_AGENT_PRE_AGGREGATOR_H_
+#define HEYP_AGGREGATOR_AGENT_PRE_AGGREGATOR_H_
+
+#include <cstdint>
+#include <vector>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
+#include "absl/random/random.h"
+#include "absl/synchronization/mutex.h"
+#include "heyp/alg/sampler.h"
+#include "heyp/flows/map.h"
+#include "heyp/proto/heyp.pb.h"
+
+namespace heyp {
+
+// PreAggregator summarizes the InfoBundles of the hosts behind an aggregator-agent
+// into AggregatedInfoBundles for the cluster agent.
+//
+// Since it sees every host, per-FG HIPRI and LOPRI usage is summed exactly. Only a
+// threshold sample of the hosts is forwarded individually (for the cluster agent to
+// pick which hosts to downgrade).
+class PreAggregator {
+ public:
+  // FGs are numbered in the order of cluster_wide_allocs, as in FastClusterController.
+  PreAggregator(uint64_t aggregator_id, const proto::AllocBundle& cluster_wide_allocs,
+                int target_num_samples);
+
+  // Keeps the latest info of each host. Thread-safe.
+  void UpdateInfo(const proto::InfoBundle& info);
+
+  // Summarizes the infos received since the previous call to Flush. Thread-safe.
+  void Flush(proto::AggregatedInfoBundle* out);
+
+ private:
+  struct FGUsage {
+    int64_t agg_id;
+    int64_t usage_bps;
+    bool currently_lopri;
+  };
+
+  struct HostState {
+    int64_t gen = 0;
+    bool needs_full_alloc = false;
+    std::vector<FGUsage> usage;
+  };
+
+  struct FGSummary {
+    int64_t hipri_usage_bps = 0;
+    int64_t lopri_usage_bps = 0;
+    std::vector<proto::AggregatedFGInfo::Child> sampled;
+    bool seen = false;
+  };
+
+  const uint64_t aggregator_id_;
+  ClusterFlowMap<int64_t> flow2id_;
+  std::vector<proto::FlowMarker> id2flow_;
+  std::vector<ThresholdSampler> samplers_;
+
+  absl::Mutex mu_;
+  int64_t gen_ ABSL_GUARDED_BY(mu_);
+  absl::flat_hash_map<uint64_t, HostState> hosts_ ABSL_GUARDED_BY(mu_);
+  std::vector<FGSummary> summaries_ ABSL_GUARDED_BY(mu_);
+  absl::BitGen rng_ ABSL_GUARDED_BY(mu_);
+};
+
+}  // namespace heyp
+
+#endif  // HEYP_AGGREGATOR_AGENT_PRE_AGGREGATOR_H_
@@ -0,0 +1,128 @@
+#include "heyp/aggregator-agent/relay-controller.h"
+
+#include <array>
+#include <atomic>
+#include <thread>
+
+#include "absl/time/clock.h"
+#include "gmock/gmock.h"
+#include "grpcpp/grpcpp.h"
+#include "gtest/gtest.h"
+#include "heyp/cluster-agent/fast-controller.h"
+#include "heyp/cluster-agent/server.h"
+#include "heyp/host-agent/cluster-agent-channel.h"
+#include "heyp/proto/config.pb.h"
+#include "heyp/proto/heyp.pb.h"
+#include "heyp/proto/parse-text.h"
+
+namespace heyp {
+namespace {
+
+proto::AllocBundle TestLimits() {
+  return ParseTextProto<proto::AllocBundle>(R"(
+    flow_allocs {
+      flow { src_dc: "chicago" dst_dc: "new_york" }
+      hipri_rate_limit_bps: 1000
+    }
+    flow_allocs {
+      flow { src_dc: "chicago" dst_dc: "detroit" }
+      hipri_rate_limit_bps: 500
+    }
+  )");
+}
+
+proto::InfoBundle MakeInfo(uint64_t host_id, int64_t gen) {
+  proto::InfoBundle b;
+  b.mutable_bundler()->set_host_id(host_id);
+  b.set_gen(gen);
+  // FastClusterController only sends bundles when allocations change, so ask for
+  // a full bundle every time.
+  b.set_needs_full_alloc(true);
+  proto::FlowInfo* fi = b.add_flow_infos();
+  fi->mutable_flow()->set_src_dc("chicago");
+  fi->mutable_flow()->set_dst_dc("new_york");
+  fi->mutable_flow()->set_host_id(host_id);
+  fi->set_predicted_demand_bps(300);
+  fi->set_ewma_usage_bps(300);
+  return b;
+}
+
+struct TestHost {
+  TestHost(std::unique_ptr<proto::ClusterAgent::Stub> stub, uint64_t id)
+      : ch(std::move(stub)), id(id), got_alloc(false) {
+    reader = std::thread([this] {
+      proto::AllocBundle b;
+      while (ch.Read(&b).ok()) {
+        if (b.flow_allocs_size() > 0) {
+          got_alloc.store(true);
+        }
+      }
+    });
+  }
+
+  ClusterAgentChannel ch;
+  const uint64_t id;
+  std::atomic<bool> got_alloc;
+  std::thread reader;
+};
+
+TEST(RelayControllerTest, HostsGetAllocsThroughAggregator) {
+  proto::FastClusterControllerConfig cluster_config;
+  cluster_config.set_target_num_samples(10);
+  cluster_config.set_num_threads(2);
+  std::shared_ptr<FastClusterController> cluster_controller =
+      FastClusterController::Create(cluster_config, TestLimits());
+  ClusterAgentService cluster_service(cluster_controller, 0);
+  std::unique_ptr<grpc::Server> cluster_server =
+      grpc::ServerBuilder().RegisterService(&cluster_service).BuildAndStart();
+
+  auto relay = std::make_shared<RelayController>(
+      std::make_unique<PreAggregator>(99, TestLimits(), 10),
+      proto::ClusterAgent::NewStub(cluster_server->InProcessChannel({})));
+  auto agg_service = std::make_unique<ClusterAgentService>(relay, 1);
+  std::unique_ptr<grpc::Server> agg_server =
+      grpc::ServerBuilder().RegisterService(agg_service.get()).BuildAndStart();
+
+  std::array hosts{
+      std::make_unique<TestHost>(
+          proto::ClusterAgent::NewStub(agg_server->InProcessChannel({})), 1),
+      std::make_unique<TestHost>(
+          proto::ClusterAgent::NewStub(agg_server->InProcessChannel({})), 2),
+      std::make_unique<TestHost>(
+          proto::ClusterAgent::NewStub(agg_server->InProcessChannel({})), 3),
+  };
+
+  const absl::Time deadline = absl::Now() + absl::Seconds(20);
+  bool all_got_alloc = false;
+  for (int64_t gen = 1; !all_got_alloc && absl::Now() < deadline; ++gen) {
+    for (auto& h : hosts) {
+      ASSERT_TRUE(h->ch.Write(MakeInfo(h->id, gen)).ok());
+    }
+    absl::SleepFor(absl::Milliseconds(20));
+    relay->ComputeAndBroadcast();
+    absl::SleepFor(absl::Milliseconds(20));
+    cluster_controller->ComputeAndBroadcast();
+    absl::SleepFor(absl::Milliseconds(20));
+
+    all_got_alloc = true;
+    for (auto& h : hosts) {
+      all_got_alloc = all_got_alloc && h->got_alloc.load();
+    }
+  }
+  EXPECT_TRUE(all_got_alloc);
+
+  for (auto& h : hosts) {
+    h->ch.WritesDone();
+    h->ch.TryCancel();
+    h->reader.join();
+  }
+  agg_server->Shutdown();
+  agg_server->Wait();
+  agg_service = nullptr;
+  relay = nullptr;
+  cluster_server->Shutdown();
+  cluster_server->Wait();
+}
+
+}  // namespace
+}  // namespace heyp
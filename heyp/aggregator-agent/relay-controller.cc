@@ -0,0 +1,117 @@
+#include "heyp/aggregator-agent/relay-controller.h"
+
+#include "heyp/cluster-agent/encoded-bundle.h"
+
+namespace heyp {
+
+RelayController::RelayController(std::unique_ptr<PreAggregator> pre_aggregator,
+                                 std::unique_ptr<proto::ClusterAgent::Stub> upstream)
+    : pre_aggregator_(std::move(pre_aggregator)),
+      upstream_(std::move(upstream)),
+      logger_(MakeLogger("relay-controller")) {}
+
+RelayController::~RelayController() { CloseStream(); }
+
+void RelayController::CloseStream() {
+  if (stream_ == nullptr) {
+    return;
+  }
+  stream_->ctx.TryCancel();
+  stream_->reader.join();
+  grpc::Status st = stream_->stream->Finish();
+  if (!st.ok()) {
+    SPDLOG_LOGGER_WARN(&logger_, "upstream stream finished with error: {}",
+                       st.error_message());
+  }
+  stream_ = nullptr;
+}
+
+void RelayController::UpdateInfo(ParID bundler_id, const proto::InfoBundle& info) {
+  pre_aggregator_->UpdateInfo(info);
+}
+
+void RelayController::ComputeAndBroadcast() {
+  pre_aggregator_->Flush(&info_);
+
+  if (stream_ != nullptr && stream_->failed.load()) {
+    CloseStream();
+  }
+  if (stream_ == nullptr) {
+    stream_ = std::make_unique<Stream>();
+    stream_->stream = upstream_->RegisterAggregator(&stream_->ctx);
+    stream_->reader = std::thread([this, s = stream_.get()] { ReadLoop(s); });
+  }
+  if (!stream_->stream->Write(info_)) {
+    SPDLOG_LOGGER_WARN(&logger_, "failed to write to cluster agent; will reconnect");
+    stream_->failed.store(true);
+  }
+}
+
+void RelayController::ReadLoop(Stream* s) {
+  proto::RelayedAllocBatch batch;
+  while (s->stream->Read(&batch)) {
+    for (proto::RelayedAllocBundle& relayed : *batch.mutable_allocs()) {
+      Relay(&relayed);
+    }
+  }
+  s->failed.store(true);
+}
+
+void RelayController::Relay(proto::RelayedAllocBundle* relayed) {
+  absl::MutexLock l(&mu_);
+  auto iter = listeners_.find(relayed->host_id());
+  if (iter == listeners_.end()) {
+    return;
+  }
+
+  // Pass the bytes through as is; only parse if some listener needs a proto.
+  EncodedAllocBundle encoded =
+      EncodedAllocBundle::FromSerialized(std::move(*relayed->mutable_bundle()));
+  proto::AllocBundle bundle;
+  bool parsed = false;
+  const SendBundleAux aux{.compute_start = std::chrono::steady_clock::now()};
+  for (const auto& [lis_id, funcs] : iter->second) {
+    if (funcs.on_encoded_bundle) {
+      funcs.on_encoded_bundle(encoded, aux);
+      continue;
+    }
+    if (!parsed) {
+      if (!encoded.ParseTo(&bundle)) {
+        SPDLOG_LOGGER_ERROR(&logger_, "failed to parse alloc for host {}",
+                            relayed->host_id());
+        return;
+      }
+      parsed = true;
+    }
+    funcs.on_bundle(bundle, aux);
+  }
+}
+
+std::unique_ptr<ClusterController::Listener> RelayController::AddListener(
+    uint64_t host_id, ListenerFuncs funcs) {
+  absl::MutexLock l(&mu_);
+  const int64_t lis_id = next_lis_id_++;
+  listeners_[host_id][lis_id] = std::move(funcs);
+  return std::make_unique<ListenerImpl>(this, host_id, lis_id);
+}
+
+std::unique_ptr<ClusterController::Listener> RelayController::RegisterListener(
+    uint64_t host_id, const OnNewBundleFunc& on_new_bundle_func) {
+  return AddListener(host_id, ListenerFuncs{.on_bundle = on_new_bundle_func});
+}
+
+std::unique_ptr<ClusterController::Listener> RelayController::RegisterEncodedListener(
+    uint64_t host_id, const OnNewEncodedBundleFunc& on_new_bundle_func) {
+  return AddListener(host_id, ListenerFuncs{.on_encoded_bundle = on_new_bundle_func});
+}
+
+RelayController::ListenerImpl::~ListenerImpl() {
+  absl::MutexLock l(&controller_->mu_);
+  auto iter = controller_->listeners_.find(host_id_);
+  iter->second.erase(lis_id_);
+  if (iter->second.empty()) {
+    controller_->listeners_.erase(iter);
+  }
+}
+
+}  // namespace heyp
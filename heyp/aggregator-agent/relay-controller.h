@@ -0,0 +1,96 @@
+#ifndef HEYP_AGGREGATOR_AGENT_RELAY_CONTROLLER_H_
+#define HEYP_AGGREGATOR_AGENT_RELAY_CONTROLLER_H_
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <thread>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
+#include "absl/synchronization/mutex.h"
+#include "grpcpp/grpcpp.h"
+#include "heyp/aggregator-agent/pre-aggregator.h"
+#include "heyp/cluster-agent/controller-iface.h"
+#include "heyp/log/spdlog.h"
+#include "heyp/proto/heyp.grpc.pb.h"
+#include "heyp/proto/heyp.pb.h"
+
+namespace heyp {
+
+// RelayController is the ClusterController of an aggregator-agent.
+//
+// Instead of computing allocations, it forwards summaries of host infos to the cluster
+// agent over a single RegisterAggregator stream and relays the per-host allocations
+// it gets back to the hosts' listeners. This lets ClusterAgentService serve hosts
+// unchanged.
+class RelayController : public ClusterController {
+ public:
+  RelayController(std::unique_ptr<PreAggregator> pre_aggregator,
+                  std::unique_ptr<proto::ClusterAgent::Stub> upstream);
+  ~RelayController();
+
+  void UpdateInfo(ParID bundler_id, const proto::InfoBundle& info) override;
+
+  // Forwards a summary to the cluster agent, (re)connecting if needed.
+  void ComputeAndBroadcast() override;
+
+  std::unique_ptr<ClusterController::Listener> RegisterListener(
+      uint64_t host_id, const OnNewBundleFunc& on_new_bundle_func) override;
+
+  std::unique_ptr<ClusterController::Listener> RegisterEncodedListener(
+      uint64_t host_id, const OnNewEncodedBundleFunc& on_new_bundle_func) override;
+
+  // Bundler IDs are not used.
+  ParID GetBundlerID(const proto::FlowMarker& bundler) override { return 0; }
+
+ private:
+  struct Stream {
+    grpc::ClientContext ctx;
+    std::unique_ptr<grpc::ClientReaderWriter<proto::AggregatedInfoBundle,
+                                             proto::RelayedAllocBatch>>
+        stream;
+    std::thread reader;
+    std::atomic<bool> failed{false};
+  };
+
+  struct ListenerFuncs {
+    OnNewBundleFunc on_bundle;
+    OnNewEncodedBundleFunc on_encoded_bundle;
+  };
+
+  class ListenerImpl : public ClusterController::Listener {
+   public:
+    ListenerImpl(RelayController* controller, uint64_t host_id, int64_t lis_id)
+        : controller_(controller), host_id_(host_id), lis_id_(lis_id) {}
+    ~ListenerImpl();
+
+   private:
+    RelayController* controller_;
+    const uint64_t host_id_;
+    const int64_t lis_id_;
+  };
+
+  std::unique_ptr<ClusterController::Listener> AddListener(uint64_t host_id,
+                                                           ListenerFuncs funcs);
+  void ReadLoop(Stream* s);
+  void Relay(proto::RelayedAllocBundle* relayed);
+  void CloseStream();
+
+  const std::unique_ptr<PreAggregator> pre_aggregator_;
+  const std::unique_ptr<proto::ClusterAgent::Stub> upstream_;
+  spdlog::logger logger_;
+
+  // Only used by ComputeAndBroadcast and the destructor.
+  std::unique_ptr<Stream> stream_;
+  proto::AggregatedInfoBundle info_;
+
+  absl::Mutex mu_;
+  int64_t next_lis_id_ ABSL_GUARDED_BY(mu_) = 0;
+  absl::flat_hash_map<uint64_t, absl::flat_hash_map<int64_t, ListenerFuncs>> listeners_
+      ABSL_GUARDED_BY(mu_);
+};
+
+}  // namespace heyp
+
+#endif  // HEYP_AGGREGATOR_AGENT_RELAY_CONTROLLER_H_
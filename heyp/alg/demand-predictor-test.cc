@@ -1,5 +1,9 @@
 #include "heyp/alg/demand-predictor.h"
 
+#include <random>
+#include <vector>
+
+#include "absl/random/random.h"
 #include "absl/time/clock.h"
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
@@ -49,5 +53,74 @@ TEST(BweDemandPredictorTest, Basic) {
             4'800'000);
 }
 
+absl::Time T(int64_t secs) { return absl::UnixEpoch() + absl::Seconds(secs); }
+
+TEST(DecayedPeakDemandPredictorTest, Basic) {
+  DecayedPeakDemandPredictor predictor(absl::Seconds(10), 1.0, 50);
+  auto state = predictor.NewState();
+  EXPECT_EQ(state->Update({T(0), 1000}), 1000);
+  EXPECT_EQ(state->Update({T(10), 100}), 500);
+  EXPECT_EQ(state->Update({T(20), 600}), 600);
+  EXPECT_EQ(state->Update({T(20), 0}), 600);
+  EXPECT_EQ(state->Update({T(100), 0}), 50);
+}
+
+TEST(QuantileDemandPredictorTest, Basic) {
+  QuantileDemandPredictor predictor(absl::Seconds(10), 0.5, 2.0, 0);
+  auto state = predictor.NewState();
+  for (int i = 0; i < 5; ++i) {
+    state->Update({T(i), i});
+  }
+  EXPECT_EQ(state->Update({T(5), 2}), 4);
+
+  // Once the older estimator only covers [10, 20], old usage is forgotten.
+  for (int i = 10; i < 20; ++i) {
+    state->Update({T(i), 100});
+  }
+  EXPECT_EQ(state->Update({T(20), 100}), 200);
+
+  // Both estimators are restarted after a long gap.
+  EXPECT_EQ(state->Update({T(100), 7}), 14);
+}
+
+TEST(HoltDemandPredictorTest, FollowsTrend) {
+  HoltDemandPredictor predictor(absl::Seconds(10), 0.2, 1.0, 0);
+  auto state = predictor.NewState();
+  int64_t demand = 0;
+  for (int i = 0; i < 500; ++i) {
+    demand = state->Update({T(i), 1'000'000 + 1000 * i});
+  }
+  // Usage 10s after the last sample is 1'000'000 + 1000 * 509.
+  EXPECT_NEAR(demand, 1'509'000, 5'000);
+
+  auto flat = predictor.NewState();
+  for (int i = 0; i < 100; ++i) {
+    demand = flat->Update({T(i), 777});
+  }
+  EXPECT_EQ(demand, 777);
+}
+
+TEST(StreamingDemandPredictorTest, FromUsageMatchesState) {
+  std::mt19937_64 rng(0);
+  DecayedPeakDemandPredictor decayed_peak(absl::Seconds(5), 1.1, 100);
+  QuantileDemandPredictor quantile(absl::Seconds(5), 0.9, 1.1, 100);
+  HoltDemandPredictor holt(absl::Seconds(5), 0.3, 1.1, 100);
+  for (const StreamingDemandPredictor* predictor :
+       std::vector<const StreamingDemandPredictor*>{&decayed_peak, &quantile, &holt}) {
+    EXPECT_EQ(predictor->FromUsage(T(0), {}), 100);
+
+    auto state = predictor->NewState();
+    const size_t bytes_used = state->BytesUsed();
+    std::vector<UsageHistoryEntry> history;
+    absl::Time now = T(0);
+    for (int i = 0; i < 100; ++i) {
+      now += absl::Milliseconds(absl::Uniform(rng, 0, 1000));
+      history.push_back({now, absl::Uniform<int64_t>(rng, 0, 10'000)});
+      ASSERT_EQ(state->Update(history.back()), predictor->FromUsage(now, history));
+      ASSERT_EQ(state->BytesUsed(), bytes_used);
+    }
+  }
+}
+
 }  // namespace
 }  // namespace heyp
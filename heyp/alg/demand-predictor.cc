@@ -1,5 +1,8 @@
 #include "heyp/alg/demand-predictor.h"
 
+#include <algorithm>
+#include <cmath>
+
 #include "absl/base/macros.h"
 
 namespace heyp {
@@ -23,18 +26,200 @@ BweDemandPredictor::BweDemandPredictor(absl::Duration time_window,
 
 int64_t BweDemandPredictor::FromUsage(
     absl::Time now, absl::Span<const UsageHistoryEntry> usage_history) const {
-  double max_usage_bps = 0;
+  int64_t max_usage_bps = 0;
   for (ssize_t i = usage_history.size() - 1; i >= 0; i--) {
     if (usage_history[i].time >= now - time_window_) {
-      max_usage_bps = std::max<double>(max_usage_bps, usage_history[i].bps);
+      max_usage_bps = std::max(max_usage_bps, usage_history[i].bps);
+    }
+  }
+  return FromMaxUsage(max_usage_bps);
+}
+
+int64_t BweDemandPredictor::FromMaxUsage(int64_t max_usage_bps) const {
+  double est = static_cast<double>(max_usage_bps) * usage_multiplier_;
+  if (est > min_demand_bps_) {
+    return est;
+  }
+  return min_demand_bps_;
+}
+
+class BweDemandPredictor::State : public DemandPredictorState {
+ public:
+  explicit State(const BweDemandPredictor* predictor)
+      : predictor_(predictor), max_usage_(predictor->time_window_) {}
+
+  int64_t Update(UsageHistoryEntry e) override {
+    return predictor_->FromMaxUsage(max_usage_.Add(e.time, e.bps));
+  }
+
+  size_t BytesUsed() const override { return sizeof(*this) + max_usage_.buffer_bytes(); }
+
+ private:
+  const BweDemandPredictor* predictor_;
+  WindowedMaxUsage max_usage_;
+};
+
+std::unique_ptr<DemandPredictorState> BweDemandPredictor::NewState() const {
+  return std::make_unique<State>(this);
+}
+
+StreamingDemandPredictor::StreamingDemandPredictor(absl::Duration time_window,
+                                                   double usage_multiplier,
+                                                   int64_t min_demand_bps)
+    : time_window_(time_window),
+      usage_multiplier_(usage_multiplier),
+      min_demand_bps_(min_demand_bps) {
+  ABSL_ASSERT(time_window_ > absl::ZeroDuration());
+  ABSL_ASSERT(usage_multiplier_ > 0);
+  ABSL_ASSERT(min_demand_bps_ >= 0);
+}
+
+int64_t StreamingDemandPredictor::FromUsage(
+    absl::Time now, absl::Span<const UsageHistoryEntry> usage_history) const {
+  std::unique_ptr<DemandPredictorState> state = NewState();
+  int64_t demand = Scale(0);
+  for (const UsageHistoryEntry& e : usage_history) {
+    if (e.time > now) {
+      break;
     }
+    demand = state->Update(e);
   }
+  return demand;
+}
 
-  double est = max_usage_bps * usage_multiplier_;
+int64_t StreamingDemandPredictor::Scale(double usage_bps) const {
+  double est = usage_bps * usage_multiplier_;
   if (est > min_demand_bps_) {
     return est;
   }
   return min_demand_bps_;
 }
 
-}  // namespace heyp
\ No newline at end of file
+class DecayedPeakDemandPredictor::State : public DemandPredictorState {
+ public:
+  explicit State(const DecayedPeakDemandPredictor* predictor) : predictor_(predictor) {}
+
+  int64_t Update(UsageHistoryEntry e) override {
+    if (last_time_ != absl::InfinitePast()) {
+      ABSL_ASSERT(last_time_ <= e.time);
+      peak_bps_ *= std::exp2(-absl::FDivDuration(e.time - last_time_,
+                                                 predictor_->time_window_));
+    }
+    peak_bps_ = std::max<double>(peak_bps_, e.bps);
+    last_time_ = e.time;
+    return predictor_->Scale(peak_bps_);
+  }
+
+  size_t BytesUsed() const override { return sizeof(*this); }
+
+ private:
+  const DecayedPeakDemandPredictor* predictor_;
+  absl::Time last_time_ = absl::InfinitePast();
+  double peak_bps_ = 0;
+};
+
+std::unique_ptr<DemandPredictorState> DecayedPeakDemandPredictor::NewState() const {
+  return std::make_unique<State>(this);
+}
+
+QuantileDemandPredictor::QuantileDemandPredictor(absl::Duration time_window,
+                                                 double quantile,
+                                                 double usage_multiplier,
+                                                 int64_t min_demand_bps)
+    : StreamingDemandPredictor(time_window, usage_multiplier, min_demand_bps),
+      quantile_(quantile) {
+  ABSL_ASSERT(quantile_ >= 0 && quantile_ <= 1);
+}
+
+class QuantileDemandPredictor::State : public DemandPredictorState {
+ public:
+  explicit State(const QuantileDemandPredictor* predictor)
+      : predictor_(predictor),
+        estimators_{P2Quantile(predictor->quantile_), P2Quantile(predictor->quantile_)} {}
+
+  int64_t Update(UsageHistoryEntry e) override {
+    const absl::Duration window = predictor_->time_window_;
+    if (newer_start_ == absl::InfinitePast() || e.time - newer_start_ >= 2 * window) {
+      // Both estimators are stale.
+      estimators_[0].Clear();
+      estimators_[1].Clear();
+      newer_ = 0;
+      newer_start_ = e.time;
+    } else if (e.time - newer_start_ >= window) {
+      newer_ = 1 - newer_;
+      estimators_[newer_].Clear();
+      newer_start_ = e.time;
+    }
+    ABSL_ASSERT(newer_start_ <= e.time);
+
+    estimators_[0].Add(e.bps);
+    estimators_[1].Add(e.bps);
+
+    const P2Quantile& older = estimators_[1 - newer_];
+    if (older.count() > 0) {
+      return predictor_->Scale(older.Value());
+    }
+    return predictor_->Scale(estimators_[newer_].Value());
+  }
+
+  size_t BytesUsed() const override { return sizeof(*this); }
+
+ private:
+  const QuantileDemandPredictor* predictor_;
+  P2Quantile estimators_[2];
+  int newer_ = 0;
+  absl::Time newer_start_ = absl::InfinitePast();
+};
+
+std::unique_ptr<DemandPredictorState> QuantileDemandPredictor::NewState() const {
+  return std::make_unique<State>(this);
+}
+
+HoltDemandPredictor::HoltDemandPredictor(absl::Duration time_window,
+                                         double trend_smoothing, double usage_multiplier,
+                                         int64_t min_demand_bps)
+    : StreamingDemandPredictor(time_window, usage_multiplier, min_demand_bps),
+      trend_smoothing_(trend_smoothing) {
+  ABSL_ASSERT(trend_smoothing_ > 0 && trend_smoothing_ <= 1);
+}
+
+class HoltDemandPredictor::State : public DemandPredictorState {
+ public:
+  explicit State(const HoltDemandPredictor* predictor) : predictor_(predictor) {}
+
+  int64_t Update(UsageHistoryEntry e) override {
+    ABSL_ASSERT(last_time_ <= e.time);
+    const double window_sec = absl::ToDoubleSeconds(predictor_->time_window_);
+    if (last_time_ == absl::InfinitePast()) {
+      level_bps_ = e.bps;
+      last_time_ = e.time;
+    } else if (e.time > last_time_) {
+      const double dt_sec = absl::ToDoubleSeconds(e.time - last_time_);
+      const double alpha = 1 - std::exp(-dt_sec / window_sec);
+      const double beta = predictor_->trend_smoothing_;
+      const double prev_level_bps = level_bps_;
+      level_bps_ =
+          alpha * e.bps + (1 - alpha) * (level_bps_ + trend_bps_per_sec_ * dt_sec);
+      trend_bps_per_sec_ =
+          beta * (level_bps_ - prev_level_bps) / dt_sec + (1 - beta) * trend_bps_per_sec_;
+      last_time_ = e.time;
+    }
+
+    return predictor_->Scale(
+        std::max<double>(0, level_bps_ + trend_bps_per_sec_ * window_sec));
+  }
+
+  size_t BytesUsed() const override { return sizeof(*this); }
+
+ private:
+  const HoltDemandPredictor* predictor_;
+  absl::Time last_time_ = absl::InfinitePast();
+  double level_bps_ = 0;
+  double trend_bps_per_sec_ = 0;
+};
+
+std::unique_ptr<DemandPredictorState> HoltDemandPredictor::NewState() const {
+  return std::make_unique<State>(this);
+}
+
+}  // namespace heyp
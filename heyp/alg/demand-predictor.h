@@ -2,10 +2,13 @@
 #define HEYP_ALG_DEMAND_PREDICTOR_H_
 
 #include <cstdint>
+#include <memory>
 #include <ostream>
 
 #include "absl/time/time.h"
 #include "absl/types/span.h"
+#include "heyp/alg/p2-quantile.h"
+#include "heyp/alg/windowed-max.h"
 
 namespace heyp {
 
@@ -18,12 +21,30 @@ bool operator==(const UsageHistoryEntry& lhs, const UsageHistoryEntry& rhs);
 
 std::ostream& operator<<(std::ostream& os, const UsageHistoryEntry& e);
 
+// DemandPredictorState predicts the demand of a single flow from a stream of usage
+// samples without keeping the full usage history around.
+class DemandPredictorState {
+ public:
+  virtual ~DemandPredictorState(){};
+
+  // Adds a usage sample, which must be no older than previous ones, and returns the
+  // predicted demand. Matches FromUsage over all samples seen so far.
+  virtual int64_t Update(UsageHistoryEntry e) = 0;
+
+  // Returns the memory used by the state, including this object.
+  virtual size_t BytesUsed() const = 0;
+};
+
 class DemandPredictor {
  public:
   virtual ~DemandPredictor(){};
 
   virtual int64_t FromUsage(absl::Time now,
                             absl::Span<const UsageHistoryEntry> usage_history) const = 0;
+
+  // Returns per-flow state to incrementally compute predictions, or nullptr if the
+  // predictor only supports FromUsage. The state must not outlive the predictor.
+  virtual std::unique_ptr<DemandPredictorState> NewState() const { return nullptr; }
 };
 
 class BweDemandPredictor : public DemandPredictor {
@@ -34,12 +55,87 @@ class BweDemandPredictor : public DemandPredictor {
   int64_t FromUsage(absl::Time now,
                     absl::Span<const UsageHistoryEntry> usage_history) const override;
 
+  std::unique_ptr<DemandPredictorState> NewState() const override;
+
  private:
+  class State;
+
+  int64_t FromMaxUsage(int64_t max_usage_bps) const;
+
+  const absl::Duration time_window_;
+  const double usage_multiplier_;
+  const int64_t min_demand_bps_;
+};
+
+// StreamingDemandPredictor is the base for predictors that only keep O(1) state per
+// flow. FromUsage replays usage_history through a new state.
+//
+// Like BweDemandPredictor, predictions are scaled by usage_multiplier and are at
+// least min_demand_bps.
+class StreamingDemandPredictor : public DemandPredictor {
+ public:
+  StreamingDemandPredictor(absl::Duration time_window, double usage_multiplier,
+                           int64_t min_demand_bps);
+
+  int64_t FromUsage(absl::Time now,
+                    absl::Span<const UsageHistoryEntry> usage_history) const override;
+
+ protected:
+  int64_t Scale(double usage_bps) const;
+
   const absl::Duration time_window_;
   const double usage_multiplier_;
   const int64_t min_demand_bps_;
 };
 
+// DecayedPeakDemandPredictor tracks the peak usage, which decays by half every
+// time_window unless a new sample exceeds it.
+class DecayedPeakDemandPredictor : public StreamingDemandPredictor {
+ public:
+  using StreamingDemandPredictor::StreamingDemandPredictor;
+
+  std::unique_ptr<DemandPredictorState> NewState() const override;
+
+ private:
+  class State;
+};
+
+// QuantileDemandPredictor predicts the given quantile of usage over the last one to
+// two time_windows.
+//
+// Two P² estimators are restarted in turn every time_window so that the older one
+// always covers at least one full window.
+class QuantileDemandPredictor : public StreamingDemandPredictor {
+ public:
+  QuantileDemandPredictor(absl::Duration time_window, double quantile,
+                          double usage_multiplier, int64_t min_demand_bps);
+
+  std::unique_ptr<DemandPredictorState> NewState() const override;
+
+ private:
+  class State;
+
+  const double quantile_;
+};
+
+// HoltDemandPredictor uses Holt's linear trend method (double exponential
+// smoothing) to forecast usage one time_window ahead.
+//
+// The level is smoothed with time constant time_window and the trend with
+// trend_smoothing in (0, 1].
+class HoltDemandPredictor : public StreamingDemandPredictor {
+ public:
+  HoltDemandPredictor(absl::Duration time_window, double trend_smoothing,
+                      double usage_multiplier, int64_t min_demand_bps);
+
+  std::unique_ptr<DemandPredictorState> NewState() const override;
+
+ private:
+  class State;
+
+  const double trend_smoothing_;
+};
+
 class NopDemandPredictor : public DemandPredictor {
  public:
   int64_t FromUsage(absl::Time now,
@@ -46,6 +46,11 @@ std::ostream& operator<<(std::ostream& os, const RangeDiff& d);
 
 class HashRing {
  public:
+  HashRing() = default;
+
+  // Restores a ring with the given state (e.g. from a checkpoint).
+  HashRing(uint64_t start, double frac) : start_(start), frac_(frac) {}
+
   RangeDiff Add(double frac_diff);
   RangeDiff Sub(double frac_diff);
   RangeDiff UpdateFrac(double frac);
@@ -53,6 +58,9 @@ class HashRing {
   RingRanges MatchingRanges() const;
   std::string ToString() const;
 
+  uint64_t start() const { return start_; }
+  double frac() const { return frac_; }
+
   // Exposed for testing
   static absl::uint128 FracToRing(double frac);
   static RangeDiff ComputeRangeDiff(uint64_t old_start, double old_frac,
@@ -18,6 +18,9 @@ class HashingDowngradeSelector : public DiffDowngradeSelectorImpl {
     return lopri_.MatchingRanges().Contains(child_id);
   }
 
+  const HashRing& lopri_ring() const { return lopri_; }
+  void set_lopri_ring(const HashRing& ring) { lopri_ = ring; }
+
  private:
   HashRing lopri_;
 };
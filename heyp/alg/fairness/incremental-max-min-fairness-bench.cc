@@ -0,0 +1,67 @@
+#include <stdint.h>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "absl/random/random.h"
+#include "benchmark/benchmark.h"
+#include "heyp/alg/fairness/incremental-max-min-fairness.h"
+#include "heyp/alg/fairness/max-min-fairness.h"
+
+namespace heyp {
+namespace {
+
+// Each iteration changes state.range(1) percent of state.range(0) demands by up to
+// ±10% and then recomputes the waterlevel, with capacity set to about half of the
+// total demand.
+
+constexpr int64_t kMaxDemand = 1'000'000;
+
+int64_t Perturb(std::mt19937_64& rng, int64_t demand) {
+  return std::max<int64_t>(0, demand + absl::Uniform<int64_t>(rng, -demand / 10,
+                                                              demand / 10 + 1));
+}
+
+static void BM_Incremental(benchmark::State& state) {
+  const int64_t num_children = state.range(0);
+  const int64_t num_changes = std::max<int64_t>(1, num_children * state.range(1) / 100);
+  std::mt19937_64 rng(0);
+  IncrementalSingleLinkMaxMinFairnessProblem problem;
+  for (int64_t i = 0; i < num_children; ++i) {
+    problem.SetDemand(i, absl::Uniform<int64_t>(rng, 0, kMaxDemand));
+  }
+  const int64_t capacity = num_children * kMaxDemand / 4;
+  for (auto _ : state) {
+    for (int64_t i = 0; i < num_changes; ++i) {
+      const uint64_t child = absl::Uniform<int64_t>(rng, 0, num_children);
+      problem.SetDemand(child, Perturb(rng, problem.demand(child)));
+    }
+    benchmark::DoNotOptimize(problem.ComputeWaterlevel(capacity));
+  }
+}
+
+static void BM_Recompute(benchmark::State& state) {
+  const int64_t num_children = state.range(0);
+  const int64_t num_changes = std::max<int64_t>(1, num_children * state.range(1) / 100);
+  std::mt19937_64 rng(0);
+  SingleLinkMaxMinFairnessProblem problem;
+  std::vector<int64_t> demands(num_children, 0);
+  for (int64_t& d : demands) {
+    d = absl::Uniform<int64_t>(rng, 0, kMaxDemand);
+  }
+  const int64_t capacity = num_children * kMaxDemand / 4;
+  for (auto _ : state) {
+    for (int64_t i = 0; i < num_changes; ++i) {
+      int64_t& d = demands[absl::Uniform<int64_t>(rng, 0, num_children)];
+      d = Perturb(rng, d);
+    }
+    benchmark::DoNotOptimize(problem.ComputeWaterlevel(capacity, demands));
+  }
+}
+
+BENCHMARK(BM_Incremental)->RangeMultiplier(10)->Ranges({{1'000, 100'000}, {1, 100}});
+BENCHMARK(BM_Recompute)->RangeMultiplier(10)->Ranges({{1'000, 100'000}, {1, 100}});
+
+}  // namespace
+}  // namespace heyp
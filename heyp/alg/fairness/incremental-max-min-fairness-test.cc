@@ -0,0 +1,98 @@
+#include "heyp/alg/fairness/incremental-max-min-fairness.h"
+
+#include <limits>
+#include <random>
+
+#include "absl/random/random.h"
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "heyp/alg/fairness/max-min-fairness.h"
+
+namespace heyp {
+namespace {
+
+TEST(IncrementalSingleLinkMaxMinFairnessProblemTest, Basic) {
+  IncrementalSingleLinkMaxMinFairnessProblem problem;
+  EXPECT_EQ(problem.ComputeWaterlevel(100), 0);
+
+  problem.SetDemand(1, 7);
+  problem.SetDemand(2, 20);
+  problem.SetDemand(3, 23);
+  problem.SetDemand(4, 51);
+  problem.SetDemand(5, 299);
+  EXPECT_EQ(problem.num_children(), 5);
+  EXPECT_EQ(problem.ComputeWaterlevel(100), 25);
+  EXPECT_EQ(problem.ComputeWaterlevel(1000), 299);
+
+  problem.AddDemand(5, -290);
+  EXPECT_EQ(problem.demand(5), 9);
+  EXPECT_EQ(problem.ComputeWaterlevel(100), 41);
+
+  EXPECT_TRUE(problem.RemoveChild(4));
+  EXPECT_FALSE(problem.RemoveChild(4));
+  EXPECT_EQ(problem.demand(4), 0);
+  EXPECT_EQ(problem.ComputeWaterlevel(40), 12);
+
+  problem.SetDemand(std::numeric_limits<uint64_t>::max(), 0);
+  EXPECT_TRUE(problem.RemoveChild(std::numeric_limits<uint64_t>::max()));
+
+  problem.Clear();
+  EXPECT_EQ(problem.num_children(), 0);
+  EXPECT_EQ(problem.ComputeWaterlevel(100), 0);
+}
+
+TEST(IncrementalSingleLinkMaxMinFairnessProblemTest, MatchesSingleLinkProblem) {
+  constexpr int kNumChildren = 200;
+  IncrementalSingleLinkMaxMinFairnessProblem incremental;
+  SingleLinkMaxMinFairnessProblem partial_sort;
+  SingleLinkMaxMinFairnessProblem full_sort(
+      {.solve_method = SingleLinkMaxMinFairnessProblemOptions::kFullSort,
+       .enable_tiny_flow_opt = false});
+
+  std::mt19937_64 rng(0);
+  std::vector<int64_t> demands(kNumChildren, -1);  // -1 if absent
+  std::vector<int64_t> present;
+  for (int iter = 0; iter < 3000; ++iter) {
+    const int num_changes = absl::Uniform<int>(rng, 1, 20);
+    for (int i = 0; i < num_changes; ++i) {
+      const int child = absl::Uniform<int>(rng, 0, kNumChildren);
+      // Small demands have many duplicates.
+      const int64_t max_demand = absl::Bernoulli(rng, 0.5) ? 10 : 1'000'000;
+      switch (absl::Uniform<int>(rng, 0, 4)) {
+        case 0:
+          EXPECT_EQ(incremental.RemoveChild(child), demands[child] >= 0);
+          demands[child] = -1;
+          break;
+        case 1:
+          if (demands[child] >= 0) {
+            const int64_t delta =
+                absl::Uniform<int64_t>(rng, -demands[child], max_demand);
+            incremental.AddDemand(child, delta);
+            demands[child] += delta;
+            break;
+          }
+          [[fallthrough]];
+        default:
+          demands[child] = absl::Uniform<int64_t>(rng, 0, max_demand);
+          incremental.SetDemand(child, demands[child]);
+      }
+    }
+
+    present.clear();
+    int64_t total = 0;
+    for (int64_t d : demands) {
+      if (d >= 0) {
+        present.push_back(d);
+        total += d;
+      }
+    }
+    ASSERT_EQ(incremental.num_children(), present.size());
+    const int64_t capacity = absl::Uniform<int64_t>(rng, 0, total * 5 / 4 + 2);
+    const int64_t got = incremental.ComputeWaterlevel(capacity);
+    ASSERT_EQ(got, partial_sort.ComputeWaterlevel(capacity, present)) << "iter " << iter;
+    ASSERT_EQ(got, full_sort.ComputeWaterlevel(capacity, present)) << "iter " << iter;
+  }
+}
+
+}  // namespace
+}  // namespace heyp
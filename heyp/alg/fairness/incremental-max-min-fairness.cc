@@ -0,0 +1,183 @@
+#include "heyp/alg/fairness/incremental-max-min-fairness.h"
+
+#include "absl/base/macros.h"
+
+namespace heyp {
+
+bool IncrementalSingleLinkMaxMinFairnessProblem::Less(int32_t a, int64_t demand,
+                                                      uint64_t child_id) const {
+  const Node& n = nodes_[a];
+  return n.demand < demand || (n.demand == demand && n.child_id < child_id);
+}
+
+void IncrementalSingleLinkMaxMinFairnessProblem::Pull(int32_t n) {
+  Node& node = nodes_[n];
+  node.size = 1 + size(node.left) + size(node.right);
+  node.sum = node.demand + sum(node.left) + sum(node.right);
+}
+
+void IncrementalSingleLinkMaxMinFairnessProblem::Split(int32_t t, int64_t demand,
+                                                       uint64_t child_id, int32_t* lo,
+                                                       int32_t* hi) {
+  if (t == kNil) {
+    *lo = kNil;
+    *hi = kNil;
+    return;
+  }
+  if (Less(t, demand, child_id)) {
+    Split(nodes_[t].right, demand, child_id, &nodes_[t].right, hi);
+    *lo = t;
+  } else {
+    Split(nodes_[t].left, demand, child_id, lo, &nodes_[t].left);
+    *hi = t;
+  }
+  Pull(t);
+}
+
+int32_t IncrementalSingleLinkMaxMinFairnessProblem::Merge(int32_t a, int32_t b) {
+  if (a == kNil) {
+    return b;
+  }
+  if (b == kNil) {
+    return a;
+  }
+  if (nodes_[a].priority > nodes_[b].priority) {
+    nodes_[a].right = Merge(nodes_[a].right, b);
+    Pull(a);
+    return a;
+  }
+  nodes_[b].left = Merge(a, nodes_[b].left);
+  Pull(b);
+  return b;
+}
+
+// Insert and Erase only restructure the tree below n, which has O(1) expected size.
+// Above it, the new (or removed) demand is added to (or subtracted from) the
+// subtrees on the search path.
+
+void IncrementalSingleLinkMaxMinFairnessProblem::Insert(int32_t n) {
+  const int64_t demand = nodes_[n].demand;
+  const uint64_t child_id = nodes_[n].child_id;
+  int32_t* link = &root_;
+  while (*link != kNil && nodes_[*link].priority > nodes_[n].priority) {
+    Node& t = nodes_[*link];
+    t.size++;
+    t.sum += demand;
+    link = Less(*link, demand, child_id) ? &t.right : &t.left;
+  }
+  Split(*link, demand, child_id, &nodes_[n].left, &nodes_[n].right);
+  Pull(n);
+  *link = n;
+}
+
+void IncrementalSingleLinkMaxMinFairnessProblem::Erase(int32_t n) {
+  const int64_t demand = nodes_[n].demand;
+  const uint64_t child_id = nodes_[n].child_id;
+  int32_t* link = &root_;
+  while (*link != n) {
+    ABSL_ASSERT(*link != kNil);
+    Node& t = nodes_[*link];
+    t.size--;
+    t.sum -= demand;
+    link = Less(*link, demand, child_id) ? &t.right : &t.left;
+  }
+  *link = Merge(nodes_[n].left, nodes_[n].right);
+}
+
+void IncrementalSingleLinkMaxMinFairnessProblem::SetDemand(uint64_t child_id,
+                                                           int64_t demand) {
+  ABSL_ASSERT(demand >= 0);
+  auto [iter, inserted] = child_to_node_.insert({child_id, kNil});
+  if (inserted) {
+    if (free_nodes_.empty()) {
+      iter->second = nodes_.size();
+      nodes_.emplace_back();
+    } else {
+      iter->second = free_nodes_.back();
+      free_nodes_.pop_back();
+    }
+  } else {
+    if (nodes_[iter->second].demand == demand) {
+      return;
+    }
+    Erase(iter->second);
+  }
+  Node& node = nodes_[iter->second];
+  if (inserted) {
+    node.child_id = child_id;
+    node.priority = rng_();
+  }
+  node.demand = demand;
+  Insert(iter->second);
+}
+
+void IncrementalSingleLinkMaxMinFairnessProblem::AddDemand(uint64_t child_id,
+                                                           int64_t delta) {
+  SetDemand(child_id, demand(child_id) + delta);
+}
+
+bool IncrementalSingleLinkMaxMinFairnessProblem::RemoveChild(uint64_t child_id) {
+  auto iter = child_to_node_.find(child_id);
+  if (iter == child_to_node_.end()) {
+    return false;
+  }
+  Erase(iter->second);
+  free_nodes_.push_back(iter->second);
+  child_to_node_.erase(iter);
+  return true;
+}
+
+void IncrementalSingleLinkMaxMinFairnessProblem::Clear() {
+  nodes_.clear();
+  free_nodes_.clear();
+  child_to_node_.clear();
+  root_ = kNil;
+}
+
+int64_t IncrementalSingleLinkMaxMinFairnessProblem::demand(uint64_t child_id) const {
+  auto iter = child_to_node_.find(child_id);
+  if (iter == child_to_node_.end()) {
+    return 0;
+  }
+  return nodes_[iter->second].demand;
+}
+
+int64_t IncrementalSingleLinkMaxMinFairnessProblem::ComputeWaterlevel(
+    int64_t capacity) const {
+  ABSL_ASSERT(capacity >= 0);
+  const int64_t n = size(root_);
+  if (n == 0) {
+    return 0;
+  }
+
+  // Sorted, demand k is satisfied iff
+  //     ∑[i<k] demand(i) + demand(k) * (N - k) <= capacity
+  // and the left side only grows with k. So we can walk down the tree to find the
+  // last satisfied demand.
+  int64_t num_satisfied = 0;
+  int64_t sum_satisfied = 0;
+  int64_t max_satisfied = 0;
+  int32_t t = root_;
+  while (t != kNil) {
+    const Node& node = nodes_[t];
+    const int64_t k = num_satisfied + size(node.left);
+    const int64_t sum_before = sum_satisfied + sum(node.left);
+    if (sum_before + node.demand * (n - k) <= capacity) {
+      num_satisfied = k + 1;
+      sum_satisfied = sum_before + node.demand;
+      max_satisfied = node.demand;
+      t = node.right;
+    } else {
+      t = node.left;
+    }
+  }
+
+  if (num_satisfied == n) {
+    return max_satisfied;
+  }
+  // Evenly divide the remaining capacity across the unsatisfied demands. This is
+  // the same as adding the remainder to the last satisfied demand.
+  return (capacity - sum_satisfied) / (n - num_satisfied);
+}
+
+}  // namespace heyp
@@ -0,0 +1,80 @@
+#ifndef HEYP_ALG_FAIRNESS_INCREMENTAL_MAX_MIN_FAIRNESS_H_
+#define HEYP_ALG_FAIRNESS_INCREMENTAL_MAX_MIN_FAIRNESS_H_
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "absl/container/flat_hash_map.h"
+
+namespace heyp {
+
+// IncrementalSingleLinkMaxMinFairnessProblem solves the same problem as
+// SingleLinkMaxMinFairnessProblem, but keeps the demands of each child across calls.
+// It is meant for allocators where only a few demands change between control periods.
+//
+// Demands are kept in a treap ordered by (demand, child id), where every node also
+// tracks the number and sum of the demands in its subtree. Updating a demand takes
+// O(log N) time and ComputeWaterlevel takes O(log N) time, instead of the O(N) that
+// it takes to re-partition all demands.
+//
+// Each update is a few cache misses, so this only wins when a small fraction of the
+// demands (a few percent) change between calls.
+class IncrementalSingleLinkMaxMinFairnessProblem {
+ public:
+  IncrementalSingleLinkMaxMinFairnessProblem() = default;
+
+  // Sets the demand of child (adding it if needed). demand must be non-negative.
+  void SetDemand(uint64_t child_id, int64_t demand);
+
+  // Adds delta to the demand of child. Unknown children start with a demand of 0.
+  void AddDemand(uint64_t child_id, int64_t delta);
+
+  // Removes child. Returns false if it wasn't present.
+  bool RemoveChild(uint64_t child_id);
+
+  void Clear();
+
+  // Returns the demand of child, or 0 if it isn't present.
+  int64_t demand(uint64_t child_id) const;
+  size_t num_children() const { return child_to_node_.size(); }
+
+  // Computes the max-min fair waterlevel. The result is identical to
+  // SingleLinkMaxMinFairnessProblem::ComputeWaterlevel on the current demands.
+  int64_t ComputeWaterlevel(int64_t capacity) const;
+
+ private:
+  struct Node {
+    int64_t demand;
+    uint64_t child_id;
+    uint32_t priority;
+    int32_t left;
+    int32_t right;
+    int32_t size;  // of the subtree
+    int64_t sum;   // of the demands in the subtree
+  };
+
+  static constexpr int32_t kNil = -1;
+
+  bool Less(int32_t a, int64_t demand, uint64_t child_id) const;
+  int32_t size(int32_t n) const { return n == kNil ? 0 : nodes_[n].size; }
+  int64_t sum(int32_t n) const { return n == kNil ? 0 : nodes_[n].sum; }
+  void Pull(int32_t n);
+
+  // Splits t into nodes ordered before (demand, child_id) and the rest.
+  void Split(int32_t t, int64_t demand, uint64_t child_id, int32_t* lo, int32_t* hi);
+  int32_t Merge(int32_t a, int32_t b);
+
+  void Insert(int32_t n);
+  void Erase(int32_t n);
+
+  std::vector<Node> nodes_;
+  std::vector<int32_t> free_nodes_;
+  absl::flat_hash_map<uint64_t, int32_t> child_to_node_;
+  int32_t root_ = kNil;
+  std::mt19937 rng_;
+};
+
+}  // namespace heyp
+
+#endif  // HEYP_ALG_FAIRNESS_INCREMENTAL_MAX_MIN_FAIRNESS_H_
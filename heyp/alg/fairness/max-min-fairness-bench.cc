@@ -99,5 +99,124 @@ BENCHMARK(BM_SingleLinkMaxMinFairnessProblem_NoTinyOpt_Demand_Eq_HalfLimit)
     ->RangeMultiplier(10)
     ->Range(10, 10000);
 
+// Solve Methods and Kernels //
+//
+// Capacity is set to half of the total demand throughout.
+
+static void BenchSolve(benchmark::State& state,
+                       SingleLinkMaxMinFairnessProblemOptions options) {
+  if (options.kernel && !CPUSupports(*options.kernel)) {
+    state.SkipWithError("kernel is unsupported by this CPU");
+    return;
+  }
+  SingleLinkMaxMinFairnessProblem problem(options);
+  std::vector<int64_t> demands(state.range(0), 0);
+  std::mt19937_64 rng(0);
+  int64_t total = 0;
+  for (size_t i = 0; i < demands.size(); i++) {
+    demands[i] = absl::Uniform<int64_t>(rng, 0, 1'000'000);
+    total += demands[i];
+  }
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(problem.ComputeWaterlevel(total / 2, demands));
+  }
+  state.SetItemsProcessed(state.iterations() * demands.size());
+}
+
+static void BM_Solve_PartialSort(benchmark::State& state) {
+  BenchSolve(state, {.solve_method = SingleLinkMaxMinFairnessProblemOptions::kPartialSort,
+                     .enable_tiny_flow_opt = false});
+}
+
+static void BM_Solve_Partition_Scalar(benchmark::State& state) {
+  BenchSolve(state, {.solve_method = SingleLinkMaxMinFairnessProblemOptions::kPartition,
+                     .kernel = WaterlevelKernel::kScalar});
+}
+
+static void BM_Solve_Partition_SSE42(benchmark::State& state) {
+  BenchSolve(state, {.solve_method = SingleLinkMaxMinFairnessProblemOptions::kPartition,
+                     .kernel = WaterlevelKernel::kSSE42});
+}
+
+static void BM_Solve_Partition_AVX2(benchmark::State& state) {
+  BenchSolve(state, {.solve_method = SingleLinkMaxMinFairnessProblemOptions::kPartition,
+                     .kernel = WaterlevelKernel::kAVX2});
+}
+
+BENCHMARK(BM_Solve_PartialSort)->RangeMultiplier(10)->Range(100, 1'000'000);
+BENCHMARK(BM_Solve_Partition_Scalar)->RangeMultiplier(10)->Range(100, 1'000'000);
+BENCHMARK(BM_Solve_Partition_SSE42)->RangeMultiplier(10)->Range(100, 1'000'000);
+BENCHMARK(BM_Solve_Partition_AVX2)->RangeMultiplier(10)->Range(100, 1'000'000);
+
+// Batched //
+//
+// Solves many FGs with 100 demands each (range(0) is the total number of demands),
+// either one call at a time or with one call to ComputeWaterlevels.
+
+struct BatchInput {
+  std::vector<int64_t> capacities;
+  std::vector<int64_t> demands;
+  std::vector<size_t> offsets{0};
+};
+
+static BatchInput MakeBatchInput(int64_t num_demands) {
+  constexpr int64_t kDemandsPerFG = 100;
+  BatchInput in;
+  std::mt19937_64 rng(0);
+  for (int64_t fg = 0; fg < num_demands / kDemandsPerFG; ++fg) {
+    int64_t total = 0;
+    for (int64_t i = 0; i < kDemandsPerFG; ++i) {
+      in.demands.push_back(absl::Uniform<int64_t>(rng, 0, 1'000'000));
+      total += in.demands.back();
+    }
+    in.capacities.push_back(total / 2);
+    in.offsets.push_back(in.demands.size());
+  }
+  return in;
+}
+
+static void BenchLooped(benchmark::State& state,
+                        SingleLinkMaxMinFairnessProblemOptions options) {
+  SingleLinkMaxMinFairnessProblem problem(options);
+  const BatchInput in = MakeBatchInput(state.range(0));
+  std::vector<int64_t> waterlevels(in.capacities.size(), 0);
+  for (auto _ : state) {
+    for (size_t i = 0; i < in.capacities.size(); ++i) {
+      const size_t n = in.offsets[i + 1] - in.offsets[i];
+      waterlevels[i] = problem.ComputeWaterlevel(
+          in.capacities[i], absl::MakeConstSpan(in.demands).subspan(in.offsets[i], n));
+    }
+    benchmark::DoNotOptimize(waterlevels);
+  }
+  state.SetItemsProcessed(state.iterations() * in.demands.size());
+}
+
+static void BM_Batch_LoopedPartialSort(benchmark::State& state) {
+  BenchLooped(state,
+              {.solve_method = SingleLinkMaxMinFairnessProblemOptions::kPartialSort,
+               .enable_tiny_flow_opt = false});
+}
+
+static void BM_Batch_LoopedPartition(benchmark::State& state) {
+  BenchLooped(state,
+              {.solve_method = SingleLinkMaxMinFairnessProblemOptions::kPartition});
+}
+
+static void BM_Batch_Partition(benchmark::State& state) {
+  SingleLinkMaxMinFairnessProblem problem(
+      {.solve_method = SingleLinkMaxMinFairnessProblemOptions::kPartition});
+  const BatchInput in = MakeBatchInput(state.range(0));
+  std::vector<int64_t> waterlevels;
+  for (auto _ : state) {
+    problem.ComputeWaterlevels(in.capacities, in.demands, in.offsets, &waterlevels);
+    benchmark::DoNotOptimize(waterlevels);
+  }
+  state.SetItemsProcessed(state.iterations() * in.demands.size());
+}
+
+BENCHMARK(BM_Batch_LoopedPartialSort)->RangeMultiplier(10)->Range(100, 1'000'000);
+BENCHMARK(BM_Batch_LoopedPartition)->RangeMultiplier(10)->Range(100, 1'000'000);
+BENCHMARK(BM_Batch_Partition)->RangeMultiplier(10)->Range(100, 1'000'000);
+
 }  // namespace
 }  // namespace heyp
\ No newline at end of file
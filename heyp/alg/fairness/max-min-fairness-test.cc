@@ -1,6 +1,10 @@
 #include "heyp/alg/fairness/max-min-fairness.h"
 
+#include <random>
+
 #include "absl/algorithm/container.h"
+#include "absl/random/random.h"
+#include "absl/strings/str_join.h"
 #include "absl/strings/substitute.h"
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
@@ -123,6 +127,28 @@ TEST_P(SingleLinkMaxMinFairnessProblemTest, HalfSatisfied) {
   EXPECT_THAT(result_, Eq(std::vector<int64_t>{7, 20, 23, 25, 25}));
 }
 
+TEST_P(SingleLinkMaxMinFairnessProblemTest, Batched) {
+  std::vector<int64_t> capacities;
+  std::vector<int64_t> arena;
+  std::vector<size_t> offsets{0};
+  std::vector<int64_t> want;
+  for (std::vector<int64_t> demands : BasicDemands()) {
+    for (int64_t capacity : {0LL, 17LL, absl::c_accumulate(demands, 0LL)}) {
+      want.push_back(problem_.ComputeWaterlevel(capacity, demands));
+      capacities.push_back(capacity);
+      arena.insert(arena.end(), demands.begin(), demands.end());
+      offsets.push_back(arena.size());
+    }
+  }
+  capacities.push_back(100);  // no demands
+  offsets.push_back(arena.size());
+  want.push_back(0);
+
+  std::vector<int64_t> got{-1};
+  problem_.ComputeWaterlevels(capacities, arena, offsets, &got);
+  EXPECT_THAT(got, Eq(want));
+}
+
 INSTANTIATE_TEST_SUITE_P(
     AllSolvingMethods, SingleLinkMaxMinFairnessProblemTest,
     testing::ValuesIn(std::vector<SingleLinkMaxMinFairnessProblemOptions>{
@@ -144,7 +170,49 @@ INSTANTIATE_TEST_SUITE_P(
             .solve_method = SingleLinkMaxMinFairnessProblemOptions::kPartialSort,
             .enable_tiny_flow_opt = true,
         },
+        /* Partition */
+        {
+            .solve_method = SingleLinkMaxMinFairnessProblemOptions::kPartition,
+            .kernel = WaterlevelKernel::kScalar,
+        },
+        {
+            .solve_method = SingleLinkMaxMinFairnessProblemOptions::kPartition,
+        },
     }));
 
+TEST(WaterlevelKernelTest, MatchesFullSort) {
+  SingleLinkMaxMinFairnessProblem full_sort(
+      {.solve_method = SingleLinkMaxMinFairnessProblemOptions::kFullSort,
+       .enable_tiny_flow_opt = false});
+  std::mt19937_64 rng(0);
+  std::vector<int64_t> demands;
+  std::vector<int64_t> buf;
+  std::vector<int64_t> scratch;
+  for (int iter = 0; iter < 2000; ++iter) {
+    demands.resize(absl::Uniform<int>(rng, 0, 300));
+    // Small ranges have many duplicates.
+    const int64_t max_demand = absl::Uniform<int>(rng, 0, 2) == 0 ? 10 : 1'000'000;
+    for (int64_t& d : demands) {
+      d = absl::Uniform<int64_t>(rng, 0, max_demand);
+    }
+    const int64_t capacity =
+        absl::Uniform<int64_t>(rng, 0, absl::c_accumulate(demands, 0LL) * 5 / 4 + 2);
+    const int64_t want = full_sort.ComputeWaterlevel(capacity, demands);
+    for (WaterlevelKernel kernel :
+         {WaterlevelKernel::kScalar, WaterlevelKernel::kSSE42, WaterlevelKernel::kAVX2}) {
+      if (!CPUSupports(kernel)) {
+        continue;
+      }
+      buf = demands;
+      scratch.assign(demands.size(), -1);
+      EXPECT_EQ(PartitionWaterlevel(kernel, capacity, absl::MakeSpan(buf),
+                                    absl::MakeSpan(scratch)),
+                want)
+          << "kernel: " << ToString(kernel) << " capacity: " << capacity
+          << " demands: " << absl::StrJoin(demands, " ");
+    }
+  }
+}
+
 }  // namespace
 }  // namespace heyp
@@ -16,7 +16,7 @@ constexpr bool kDebugAllocator = false;
 
 // Simpler, slower allocation method. Used for testing / comparison.
 int64_t SolveFullSort(int64_t capacity, int64_t waterlevel,
-                      const std::vector<int64_t>& demands,
+                      absl::Span<const int64_t> demands,
                       absl::Span<int64_t> sorted_demands) {
   absl::c_sort(sorted_demands);
 
@@ -49,7 +49,7 @@ int64_t SolveFullSort(int64_t capacity, int64_t waterlevel,
 class PartialSortAllocator {
  public:
   PartialSortAllocator(int64_t original_capacity, int64_t capacity, int64_t waterlevel,
-                       const std::vector<int64_t>& demands,
+                       absl::Span<const int64_t> demands,
                        absl::Span<int64_t> sorted_demands)
       : capacity_(original_capacity),
         demands_(demands),
@@ -69,7 +69,7 @@ class PartialSortAllocator {
   bool PrintInvariantViolations();
 
   const int64_t capacity_;
-  const std::vector<int64_t>& demands_;
+  const absl::Span<const int64_t> demands_;
   const absl::Span<int64_t> sorted_demands_;
 
   // Current area of interest is [lower_limit, upper_limit].
@@ -247,7 +247,7 @@ int64_t PartialSortAllocator::ComputeWaterlevel() {
 
 // Faster allocation method.
 int64_t SolvePartialSort(int64_t original_capacity, int64_t capacity, int64_t waterlevel,
-                         const std::vector<int64_t>& demands,
+                         absl::Span<const int64_t> demands,
                          absl::Span<int64_t> sorted_demands) {
   PartialSortAllocator allocator(original_capacity, capacity, waterlevel, demands,
                                  sorted_demands);
@@ -258,12 +258,22 @@ int64_t SolvePartialSort(int64_t original_capacity, int64_t capacity, int64_t wa
 
 SingleLinkMaxMinFairnessProblem::SingleLinkMaxMinFairnessProblem(
     SingleLinkMaxMinFairnessProblemOptions options)
-    : options_(std::move(options)) {}
+    : options_(std::move(options)),
+      kernel_(options_.kernel.value_or(BestWaterlevelKernel())) {
+  ABSL_ASSERT(CPUSupports(kernel_));
+}
 
 int64_t SingleLinkMaxMinFairnessProblem::ComputeWaterlevel(
-    int64_t capacity, const std::vector<int64_t>& demands) {
+    int64_t capacity, absl::Span<const int64_t> demands) {
   ABSL_ASSERT(capacity >= 0);
 
+  if (options_.solve_method == SingleLinkMaxMinFairnessProblemOptions::kPartition) {
+    sorted_demands_buf_.assign(demands.begin(), demands.end());
+    scratch_buf_.resize(demands.size());
+    return PartitionWaterlevel(kernel_, capacity, absl::MakeSpan(sorted_demands_buf_),
+                               absl::MakeSpan(scratch_buf_));
+  }
+
   int64_t num_demands = demands.size();
 
   // Sort all demands in increasing order to make it easy to track how many
@@ -303,11 +313,42 @@ int64_t SingleLinkMaxMinFairnessProblem::ComputeWaterlevel(
           capacity_without_tiny, capacity, waterlevel, demands,
           absl::MakeSpan(sorted_demands_buf_).subspan(0, num_unfiltered));
       break;
+    case SingleLinkMaxMinFairnessProblemOptions::kPartition:
+      break;  // handled above
   }
 
   return waterlevel;
 }
 
+void SingleLinkMaxMinFairnessProblem::ComputeWaterlevels(
+    absl::Span<const int64_t> capacities, absl::Span<const int64_t> demands,
+    absl::Span<const size_t> offsets, std::vector<int64_t>* waterlevels) {
+  ABSL_ASSERT(offsets.size() == capacities.size() + 1);
+  ABSL_ASSERT(offsets.back() <= demands.size());
+  waterlevels->resize(capacities.size(), 0);
+
+  if (options_.solve_method != SingleLinkMaxMinFairnessProblemOptions::kPartition) {
+    for (size_t i = 0; i < capacities.size(); ++i) {
+      (*waterlevels)[i] = ComputeWaterlevel(
+          capacities[i], demands.subspan(offsets[i], offsets[i + 1] - offsets[i]));
+    }
+    return;
+  }
+
+  sorted_demands_buf_.assign(demands.begin(), demands.begin() + offsets.back());
+  scratch_buf_.resize(sorted_demands_buf_.size());
+  absl::Span<int64_t> all_demands = absl::MakeSpan(sorted_demands_buf_);
+  absl::Span<int64_t> all_scratch = absl::MakeSpan(scratch_buf_);
+  for (size_t i = 0; i < capacities.size(); ++i) {
+    ABSL_ASSERT(capacities[i] >= 0);
+    ABSL_ASSERT(offsets[i] <= offsets[i + 1]);
+    const size_t n = offsets[i + 1] - offsets[i];
+    (*waterlevels)[i] =
+        PartitionWaterlevel(kernel_, capacities[i], all_demands.subspan(offsets[i], n),
+                            all_scratch.subspan(offsets[i], n));
+  }
+}
+
 void SingleLinkMaxMinFairnessProblem::SetAllocations(int64_t waterlevel,
                                                      const std::vector<int64_t>& demands,
                                                      std::vector<int64_t>* allocations) {
@@ -327,9 +368,14 @@ std::ostream& operator<<(std::ostream& os,
     case SingleLinkMaxMinFairnessProblemOptions::kPartialSort:
       solve_method = "kPartialSort";
       break;
+    case SingleLinkMaxMinFairnessProblemOptions::kPartition:
+      solve_method = "kPartition";
+      break;
   }
-  return os << absl::Substitute("{solve_method: $0, enable_tiny_flow_opt; $1}",
-                                solve_method, options.enable_tiny_flow_opt);
+  return os << absl::Substitute(
+             "{solve_method: $0, enable_tiny_flow_opt; $1, kernel: $2}", solve_method,
+             options.enable_tiny_flow_opt,
+             options.kernel ? ToString(*options.kernel) : "default");
 }
 
 }  // namespace heyp
@@ -4,8 +4,12 @@
 #include <cassert>
 #include <cstddef>
 #include <cstdint>
+#include <optional>
 #include <vector>
 
+#include "absl/types/span.h"
+#include "heyp/alg/fairness/waterlevel-kernel.h"
+
 #define RB_DEBUG_MAX_MIN_FAIRNESS 0
 
 namespace heyp {
@@ -14,14 +18,19 @@ struct SingleLinkMaxMinFairnessProblemOptions {
   enum SolveMethod {
     kFullSort,
     kPartialSort,
+    kPartition,  // partitions and sums in one pass, with SIMD when available
   };
 
   // Runtime complexity is O(N * log(N)) if set to kFullSort
-  // or O(N) if set to kPartialSort [where N = demands.size()].
+  // or O(N) if set to kPartialSort or kPartition [where N = demands.size()].
   SolveMethod solve_method = kPartialSort;
 
-  // Enables fast path for handling tiny flows.
+  // Enables fast path for handling tiny flows. Ignored by kPartition, whose first
+  // pass already separates them.
   bool enable_tiny_flow_opt = true;
+
+  // Kernel used by kPartition. Defaults to the best one the CPU supports.
+  std::optional<WaterlevelKernel> kernel;
 };
 
 std::ostream& operator<<(std::ostream& os,
@@ -38,7 +47,18 @@ class SingleLinkMaxMinFairnessProblem {
           SingleLinkMaxMinFairnessProblemOptions());
 
   // Computes the max-min fair waterlevel.
-  int64_t ComputeWaterlevel(int64_t capacity, const std::vector<int64_t>& demands);
+  int64_t ComputeWaterlevel(int64_t capacity, absl::Span<const int64_t> demands);
+
+  // Computes the waterlevels of many independent problems in one call. Problem i
+  // shares capacities[i] among demands[offsets[i], offsets[i+1]), so offsets must
+  // have capacities.size() + 1 entries.
+  //
+  // With kPartition, the demand arena is copied once and every problem is solved in
+  // place, which avoids per-call overhead when there are many small problems.
+  void ComputeWaterlevels(absl::Span<const int64_t> capacities,
+                          absl::Span<const int64_t> demands,
+                          absl::Span<const size_t> offsets,
+                          std::vector<int64_t>* waterlevels);
 
   // Sets allocations[i][j] = min(demands[i][j], waterlevel).
   void SetAllocations(int64_t waterlevel, const std::vector<int64_t>& demands,
@@ -46,7 +66,9 @@ class SingleLinkMaxMinFairnessProblem {
 
  private:
   const SingleLinkMaxMinFairnessProblemOptions options_;
+  const WaterlevelKernel kernel_;
   std::vector<int64_t> sorted_demands_buf_;
+  std::vector<int64_t> scratch_buf_;
 };
 
 }  // namespace heyp
@@ -0,0 +1,66 @@
+#include <stdint.h>
+
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "absl/random/random.h"
+#include "benchmark/benchmark.h"
+#include "heyp/alg/fairness/multi-link-max-min-fairness.h"
+
+namespace heyp {
+namespace {
+
+// Solves a problem with state.range(0) FGs that each cross 2-4 of state.range(1)
+// links (e.g. a src→dst path through the WAN), using state.range(2) worker threads.
+static void BM_MultiLinkMaxMinFairnessProblem(benchmark::State& state) {
+  const int64_t num_fgs = state.range(0);
+  const int64_t num_links = state.range(1);
+  const int num_threads = state.range(2);
+
+  std::mt19937_64 rng(0);
+  std::vector<int64_t> demands;
+  std::vector<size_t> offsets{0};
+  std::vector<int32_t> links;
+  for (int64_t fg = 0; fg < num_fgs; ++fg) {
+    demands.push_back(absl::Uniform<int64_t>(rng, 0, 1'000'000));
+    const int num_hops = absl::Uniform<int>(rng, 2, 5);
+    for (int i = 0; i < num_hops; ++i) {
+      const int32_t l = absl::Uniform<int32_t>(rng, 0, num_links);
+      if (std::find(links.begin() + offsets.back(), links.end(), l) == links.end()) {
+        links.push_back(l);
+      }
+    }
+    offsets.push_back(links.size());
+  }
+  // Each link can carry about a third of the demand crossing it.
+  std::vector<int64_t> capacities(num_links, 0);
+  for (int64_t fg = 0; fg < num_fgs; ++fg) {
+    for (size_t i = offsets[fg]; i < offsets[fg + 1]; ++i) {
+      capacities[links[i]] += demands[fg] / 3;
+    }
+  }
+
+  std::unique_ptr<WorkStealingExecutor> exec;
+  if (num_threads > 0) {
+    exec = std::make_unique<WorkStealingExecutor>(num_threads);
+  }
+  MultiLinkMaxMinFairnessProblem problem({.links_per_chunk = 128}, exec.get());
+  std::vector<int64_t> allocs;
+  for (auto _ : state) {
+    problem.Solve(demands, capacities, offsets, links, &allocs);
+    benchmark::DoNotOptimize(allocs);
+  }
+}
+
+BENCHMARK(BM_MultiLinkMaxMinFairnessProblem)
+    ->Args({1'000, 100, 0})
+    ->Args({10'000, 1'000, 0})
+    ->Args({10'000, 1'000, 4})
+    ->Args({100'000, 10'000, 0})
+    ->Args({100'000, 10'000, 4})
+    ->Unit(benchmark::kMillisecond);
+
+}  // namespace
+}  // namespace heyp
@@ -0,0 +1,145 @@
+#include "heyp/alg/fairness/multi-link-max-min-fairness.h"
+
+#include <random>
+
+#include "absl/random/random.h"
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "heyp/alg/fairness/max-min-fairness.h"
+
+namespace heyp {
+namespace {
+
+using ::testing::ElementsAre;
+
+struct Instance {
+  std::vector<int64_t> demands;
+  std::vector<int64_t> capacities;
+  std::vector<size_t> offsets{0};
+  std::vector<int32_t> links;
+
+  void AddFG(int64_t demand, std::vector<int32_t> fg_links) {
+    demands.push_back(demand);
+    links.insert(links.end(), fg_links.begin(), fg_links.end());
+    offsets.push_back(links.size());
+  }
+};
+
+Instance RandomInstance(std::mt19937_64& rng, int num_fgs, int num_links) {
+  Instance in;
+  for (int l = 0; l < num_links; ++l) {
+    in.capacities.push_back(absl::Uniform<int64_t>(rng, 0, 1000));
+  }
+  std::vector<int32_t> path;
+  for (int fg = 0; fg < num_fgs; ++fg) {
+    path.clear();
+    for (int l = 0; l < num_links; ++l) {
+      if (absl::Bernoulli(rng, 0.3)) {
+        path.push_back(l);
+      }
+    }
+    in.AddFG(absl::Uniform<int64_t>(rng, 0, 500), path);
+  }
+  return in;
+}
+
+std::vector<int64_t> Solve(MultiLinkMaxMinFairnessProblem& problem, const Instance& in) {
+  std::vector<int64_t> allocs;
+  problem.Solve(in.demands, in.capacities, in.offsets, in.links, &allocs);
+  return allocs;
+}
+
+TEST(MultiLinkMaxMinFairnessProblemTest, Basic) {
+  MultiLinkMaxMinFairnessProblem problem;
+  Instance in;
+  in.capacities = {10, 4};
+  in.AddFG(100, {0});
+  in.AddFG(100, {0, 1});
+  in.AddFG(100, {1});
+  in.AddFG(1, {0});
+  in.AddFG(7, {});
+  EXPECT_THAT(Solve(problem, in), ElementsAre(7, 2, 2, 1, 7));
+
+  EXPECT_THAT(Solve(problem, Instance()), ElementsAre());
+}
+
+TEST(MultiLinkMaxMinFairnessProblemTest, MatchesSingleLink) {
+  std::mt19937_64 rng(0);
+  MultiLinkMaxMinFairnessProblem problem;
+  SingleLinkMaxMinFairnessProblem single_link;
+  std::vector<int64_t> want;
+  for (int iter = 0; iter < 500; ++iter) {
+    Instance in;
+    in.capacities = {absl::Uniform<int64_t>(rng, 0, 5000)};
+    const int num_fgs = absl::Uniform<int>(rng, 0, 50);
+    for (int fg = 0; fg < num_fgs; ++fg) {
+      in.AddFG(absl::Uniform<int64_t>(rng, 0, 300), {0});
+    }
+    single_link.SetAllocations(
+        single_link.ComputeWaterlevel(in.capacities[0], in.demands), in.demands, &want);
+    ASSERT_EQ(Solve(problem, in), want) << "iter " << iter;
+  }
+}
+
+// Checks that allocs are feasible and max-min fair: every FG either gets its demand
+// or crosses a link that has too little capacity left to raise the allocation of
+// every FG that has the largest allocation on it.
+void ExpectMaxMinFair(const Instance& in, const std::vector<int64_t>& allocs) {
+  const int num_links = in.capacities.size();
+  std::vector<int64_t> used(num_links, 0);
+  std::vector<int64_t> max_alloc(num_links, 0);
+  for (size_t fg = 0; fg < in.demands.size(); ++fg) {
+    ASSERT_GE(allocs[fg], 0);
+    ASSERT_LE(allocs[fg], in.demands[fg]);
+    for (size_t i = in.offsets[fg]; i < in.offsets[fg + 1]; ++i) {
+      used[in.links[i]] += allocs[fg];
+      max_alloc[in.links[i]] = std::max(max_alloc[in.links[i]], allocs[fg]);
+    }
+  }
+  std::vector<int64_t> num_at_max(num_links, 0);
+  for (size_t fg = 0; fg < in.demands.size(); ++fg) {
+    for (size_t i = in.offsets[fg]; i < in.offsets[fg + 1]; ++i) {
+      num_at_max[in.links[i]] += allocs[fg] == max_alloc[in.links[i]];
+    }
+  }
+  for (int l = 0; l < num_links; ++l) {
+    ASSERT_LE(used[l], in.capacities[l]) << "link " << l;
+  }
+  for (size_t fg = 0; fg < in.demands.size(); ++fg) {
+    if (allocs[fg] == in.demands[fg]) {
+      continue;
+    }
+    bool bottlenecked = false;
+    for (size_t i = in.offsets[fg]; i < in.offsets[fg + 1]; ++i) {
+      const int32_t l = in.links[i];
+      bottlenecked = bottlenecked || (allocs[fg] == max_alloc[l] &&
+                                      in.capacities[l] - used[l] < num_at_max[l]);
+    }
+    EXPECT_TRUE(bottlenecked) << "FG " << fg << " could get more";
+  }
+}
+
+TEST(MultiLinkMaxMinFairnessProblemTest, RandomIsMaxMinFair) {
+  std::mt19937_64 rng(0);
+  MultiLinkMaxMinFairnessProblem problem;
+  for (int iter = 0; iter < 300; ++iter) {
+    SCOPED_TRACE(iter);
+    const Instance in = RandomInstance(rng, absl::Uniform<int>(rng, 0, 60),
+                                       absl::Uniform<int>(rng, 1, 12));
+    ExpectMaxMinFair(in, Solve(problem, in));
+  }
+}
+
+TEST(MultiLinkMaxMinFairnessProblemTest, ParallelMatchesSerial) {
+  std::mt19937_64 rng(0);
+  WorkStealingExecutor exec(4);
+  MultiLinkMaxMinFairnessProblem serial;
+  MultiLinkMaxMinFairnessProblem parallel({.links_per_chunk = 3}, &exec);
+  for (int iter = 0; iter < 100; ++iter) {
+    const Instance in = RandomInstance(rng, 200, 40);
+    ASSERT_EQ(Solve(parallel, in), Solve(serial, in)) << "iter " << iter;
+  }
+}
+
+}  // namespace
+}  // namespace heyp
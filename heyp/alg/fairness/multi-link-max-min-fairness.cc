@@ -0,0 +1,192 @@
+#include "heyp/alg/fairness/multi-link-max-min-fairness.h"
+
+#include <algorithm>
+#include <functional>
+#include <limits>
+
+#include "absl/algorithm/container.h"
+#include "absl/base/macros.h"
+
+namespace heyp {
+
+namespace {
+
+constexpr int64_t kNoLevel = std::numeric_limits<int64_t>::max();
+
+}  // namespace
+
+MultiLinkMaxMinFairnessProblem::MultiLinkMaxMinFairnessProblem(
+    MultiLinkMaxMinFairnessProblemOptions options, WorkStealingExecutor* exec)
+    : options_(options), exec_(exec) {
+  ABSL_ASSERT(options_.links_per_chunk > 0);
+}
+
+int64_t MultiLinkMaxMinFairnessProblem::ComputeLevel(int32_t l) const {
+  return link_num_active_[l] > 0 ? link_residual_[l] / link_num_active_[l] : kNoLevel;
+}
+
+void MultiLinkMaxMinFairnessProblem::Freeze(int32_t fg, int64_t alloc,
+                                            absl::Span<const size_t> fg_offsets,
+                                            absl::Span<const int32_t> fg_links,
+                                            std::vector<int64_t>* allocations) {
+  frozen_[fg] = true;
+  (*allocations)[fg] = alloc;
+  --num_active_fgs_;
+  for (size_t i = fg_offsets[fg]; i < fg_offsets[fg + 1]; ++i) {
+    const int32_t l = fg_links[i];
+    --link_num_active_[l];
+    link_residual_[l] -= alloc;
+    if (!link_dirty_[l]) {
+      link_dirty_[l] = 1;
+      chunks_[l / options_.links_per_chunk].dirty_links.push_back(l);
+    }
+  }
+}
+
+void MultiLinkMaxMinFairnessProblem::UpdateChunk(Chunk* chunk) {
+  for (int32_t l : chunk->dirty_links) {
+    link_level_[l] = ComputeLevel(l);
+    link_dirty_[l] = 0;
+    if (link_level_[l] != kNoLevel) {
+      chunk->heap.push_back({link_level_[l], l});
+      absl::c_push_heap(chunk->heap, std::greater<LevelEntry>());
+    }
+  }
+  chunk->dirty_links.clear();
+
+  while (!chunk->heap.empty() &&
+         chunk->heap.front().level != link_level_[chunk->heap.front().link]) {
+    absl::c_pop_heap(chunk->heap, std::greater<LevelEntry>());
+    chunk->heap.pop_back();
+  }
+  chunk->min_level = chunk->heap.empty() ? kNoLevel : chunk->heap.front().level;
+}
+
+void MultiLinkMaxMinFairnessProblem::Solve(absl::Span<const int64_t> demands,
+                                           absl::Span<const int64_t> link_capacities,
+                                           absl::Span<const size_t> fg_offsets,
+                                           absl::Span<const int32_t> fg_links,
+                                           std::vector<int64_t>* allocations) {
+  const int32_t num_fgs = demands.size();
+  const int32_t num_links = link_capacities.size();
+  ABSL_ASSERT(fg_offsets.size() == demands.size() + 1);
+  ABSL_ASSERT(fg_offsets.back() <= fg_links.size());
+  allocations->assign(num_fgs, 0);
+
+  // Transpose the incidence so that we can find the FGs crossing each link.
+  link_offsets_.assign(num_links + 1, 0);
+  link_num_active_.assign(num_links, 0);
+  for (size_t i = 0; i < fg_offsets.back(); ++i) {
+    ABSL_ASSERT(fg_links[i] >= 0 && fg_links[i] < num_links);
+    ++link_num_active_[fg_links[i]];
+  }
+  size_t end = 0;
+  for (int32_t l = 0; l < num_links; ++l) {
+    end += link_num_active_[l];
+    link_offsets_[l] = end;
+  }
+  link_offsets_[num_links] = end;
+  link_fgs_.resize(end);
+  for (int32_t fg = num_fgs - 1; fg >= 0; --fg) {
+    for (size_t i = fg_offsets[fg]; i < fg_offsets[fg + 1]; ++i) {
+      link_fgs_[--link_offsets_[fg_links[i]]] = fg;
+    }
+  }
+
+  const int64_t per_chunk = options_.links_per_chunk;
+  const int64_t num_chunks =
+      std::max<int64_t>(1, (num_links + per_chunk - 1) / per_chunk);
+  chunks_.resize(num_chunks);
+  for (Chunk& chunk : chunks_) {
+    chunk.heap.clear();
+    chunk.dirty_links.clear();
+  }
+
+  link_residual_.assign(link_capacities.begin(), link_capacities.end());
+  link_level_.assign(num_links, kNoLevel);
+  link_dirty_.assign(num_links, 0);
+  frozen_.assign(num_fgs, false);
+  num_active_fgs_ = num_fgs;
+
+  // FGs that want nothing or cross no links are done before we start.
+  by_demand_.clear();
+  for (int32_t fg = 0; fg < num_fgs; ++fg) {
+    ABSL_ASSERT(demands[fg] >= 0);
+    if (demands[fg] == 0 || fg_offsets[fg] == fg_offsets[fg + 1]) {
+      Freeze(fg, demands[fg], fg_offsets, fg_links, allocations);
+    } else {
+      by_demand_.push_back(fg);
+    }
+  }
+  absl::c_sort(by_demand_,
+               [&demands](int32_t a, int32_t b) { return demands[a] < demands[b]; });
+
+  // Fill the heaps with the levels of all links.
+  for (int32_t l = 0; l < num_links; ++l) {
+    ABSL_ASSERT(link_capacities[l] >= 0);
+    link_dirty_[l] = 0;
+    link_level_[l] = ComputeLevel(l);
+    if (link_level_[l] != kNoLevel) {
+      chunks_[l / per_chunk].heap.push_back({link_level_[l], l});
+    }
+  }
+  for (Chunk& chunk : chunks_) {
+    chunk.dirty_links.clear();
+    absl::c_make_heap(chunk.heap, std::greater<LevelEntry>());
+  }
+
+  auto update_chunk = [this](int64_t c) { UpdateChunk(&chunks_[c]); };
+
+  size_t next_by_demand = 0;
+  while (num_active_fgs_ > 0) {
+    // Find the level at which the next links saturate.
+    if (exec_ != nullptr && num_chunks > 1) {
+      exec_->ParallelFor(0, num_chunks, /*grain=*/1, update_chunk);
+    } else {
+      for (int64_t c = 0; c < num_chunks; ++c) {
+        update_chunk(c);
+      }
+    }
+    int64_t level = kNoLevel;
+    for (const Chunk& chunk : chunks_) {
+      level = std::min(level, chunk.min_level);
+    }
+
+    // Every unfrozen FG crosses some link, so level is finite.
+    ABSL_ASSERT(level != kNoLevel);
+
+    // FGs with demands up to level are satisfied before any link saturates.
+    // Freezing them at their demand (<= level) can't lower the level of any link,
+    // so they can all be frozen at once.
+    while (next_by_demand < by_demand_.size() &&
+           demands[by_demand_[next_by_demand]] <= level) {
+      const int32_t fg = by_demand_[next_by_demand++];
+      if (!frozen_[fg]) {
+        Freeze(fg, demands[fg], fg_offsets, fg_links, allocations);
+      }
+    }
+
+    // Freeze the FGs crossing saturated links. Freezing FGs may leave a link with
+    // enough leftover capacity (due to rounding) to go past level, so recheck
+    // each one. Popped links always have an FG frozen, so they are marked dirty and
+    // pushed back with their new level by the next UpdateChunk.
+    for (Chunk& chunk : chunks_) {
+      while (!chunk.heap.empty() && chunk.heap.front().level == level) {
+        const int32_t l = chunk.heap.front().link;
+        const bool stale = link_level_[l] != level;
+        absl::c_pop_heap(chunk.heap, std::greater<LevelEntry>());
+        chunk.heap.pop_back();
+        if (stale || ComputeLevel(l) != level) {
+          continue;
+        }
+        for (size_t i = link_offsets_[l]; i < link_offsets_[l + 1]; ++i) {
+          if (!frozen_[link_fgs_[i]]) {
+            Freeze(link_fgs_[i], level, fg_offsets, fg_links, allocations);
+          }
+        }
+      }
+    }
+  }
+}
+
+}  // namespace heyp
@@ -0,0 +1,96 @@
+#ifndef HEYP_ALG_FAIRNESS_MULTI_LINK_MAX_MIN_FAIRNESS_H_
+#define HEYP_ALG_FAIRNESS_MULTI_LINK_MAX_MIN_FAIRNESS_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "absl/types/span.h"
+#include "heyp/threads/work-stealing-executor.h"
+
+namespace heyp {
+
+struct MultiLinkMaxMinFairnessProblemOptions {
+  // Links are split into chunks of this size, each with its own heap of saturation
+  // levels. Chunks are updated in parallel when there is more than one and an
+  // executor is available.
+  int64_t links_per_chunk = 4096;
+};
+
+// MultiLinkMaxMinFairnessProblem computes a max-min fair allocation of the capacity
+// of many links to FGs that each cross one or more of them.
+//
+// It uses progressive filling: all unfrozen FGs grow at the same rate until either
+// an FG reaches its demand or a link saturates, at which point every FG crossing
+// that link is frozen. Per-link state (number of unfrozen FGs and unallocated
+// capacity) is updated incrementally as FGs freeze, and link saturation levels are
+// kept in per-chunk min-heaps, so each round only touches the links whose FGs were
+// frozen. All FGs whose demands are met before the next saturation are frozen
+// together, but a round may still freeze a single FG, so there are up to
+// links + FGs rounds. Solve takes O((links + FGs) * chunks + I * log(links)) time
+// for I FG-link crossings.
+class MultiLinkMaxMinFairnessProblem {
+ public:
+  // exec may be null, in which case everything runs on the calling thread.
+  explicit MultiLinkMaxMinFairnessProblem(
+      MultiLinkMaxMinFairnessProblemOptions options =
+          MultiLinkMaxMinFairnessProblemOptions(),
+      WorkStealingExecutor* exec = nullptr);
+
+  // Sets (*allocations)[i] to the allocation of FG i.
+  //
+  // FG i crosses links fg_links[fg_offsets[i], fg_offsets[i+1]) (each at most once),
+  // so fg_offsets must have demands.size() + 1 entries. FGs that don't cross any
+  // link get their full demand. Demands and capacities must be non-negative.
+  void Solve(absl::Span<const int64_t> demands, absl::Span<const int64_t> link_capacities,
+             absl::Span<const size_t> fg_offsets, absl::Span<const int32_t> fg_links,
+             std::vector<int64_t>* allocations);
+
+ private:
+  struct LevelEntry {
+    int64_t level;
+    int32_t link;
+
+    // Ties are broken by link so that saturated links are always visited in the same
+    // order, however the links are chunked.
+    bool operator>(const LevelEntry& other) const {
+      return level != other.level ? level > other.level : link > other.link;
+    }
+  };
+
+  struct Chunk {
+    // Min-heap of link levels. Entries whose level no longer matches link_level_
+    // are stale and skipped.
+    std::vector<LevelEntry> heap;
+    std::vector<int32_t> dirty_links;  // levels to recompute before the next round
+    int64_t min_level;
+  };
+
+  int64_t ComputeLevel(int32_t l) const;
+  void Freeze(int32_t fg, int64_t alloc, absl::Span<const size_t> fg_offsets,
+              absl::Span<const int32_t> fg_links, std::vector<int64_t>* allocations);
+  // Recomputes the levels of the chunk's dirty links and sets min_level.
+  void UpdateChunk(Chunk* chunk);
+
+  const MultiLinkMaxMinFairnessProblemOptions options_;
+  WorkStealingExecutor* exec_;
+
+  // Links in CSR form: link l is crossed by FGs link_fgs_[link_offsets_[l], ...).
+  std::vector<size_t> link_offsets_;
+  std::vector<int32_t> link_fgs_;
+
+  int64_t num_active_fgs_ = 0;
+  std::vector<bool> frozen_;
+  std::vector<int32_t> by_demand_;
+  std::vector<int64_t> link_num_active_;
+  std::vector<int64_t> link_residual_;
+  std::vector<int64_t> link_level_;  // residual / num_active, or max if no FGs
+  // Bytes rather than a vector<bool> since chunks clear their links' flags in
+  // parallel.
+  std::vector<uint8_t> link_dirty_;
+  std::vector<Chunk> chunks_;
+};
+
+}  // namespace heyp
+
+#endif  // HEYP_ALG_FAIRNESS_MULTI_LINK_MAX_MIN_FAIRNESS_H_
@@ -0,0 +1,291 @@
+#include "heyp/alg/fairness/waterlevel-kernel.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "absl/base/macros.h"
+
+#if defined(__x86_64__)
+#include <immintrin.h>
+#endif
+
+namespace heyp {
+
+namespace {
+
+// State of one partition pass. Demands <= thresh are appended at out[l] and the others
+// are prepended at out[r - 1], so each side ends up in arbitrary order.
+struct PartitionState {
+  int64_t* out;
+  int64_t l;
+  int64_t r;
+  int64_t sum_le;
+  int64_t max_le;
+};
+
+using PartitionFn = void (*)(const int64_t* in, int64_t n, int64_t thresh,
+                             PartitionState* p);
+
+// Branch-free so that it doesn't mispredict on random demands. Both candidate slots
+// are written: the slot that isn't kept is still unclaimed (r - l >= 1 before each
+// demand), so a later demand overwrites it.
+void PartitionScalar(const int64_t* in, int64_t n, int64_t thresh, PartitionState* p) {
+  int64_t* out = p->out;
+  int64_t l = p->l;
+  int64_t r = p->r;
+  int64_t sum = 0;
+  int64_t max = p->max_le;
+  for (int64_t i = 0; i < n; ++i) {
+    const int64_t d = in[i];
+    const bool le = d <= thresh;
+    out[l] = d;
+    out[r - 1] = d;
+    l += le;
+    r -= !le;
+    sum += le ? d : 0;
+    max = (le && d > max) ? d : max;
+  }
+  p->l = l;
+  p->r = r;
+  p->sum_le += sum;
+  p->max_le = max;
+}
+
+#if defined(__x86_64__)
+
+struct CompressTable {
+  // idx[mask] moves the 64-bit lanes set in mask to the front (as 32-bit lane pairs).
+  alignas(32) int32_t idx[16][8];
+  // prefix[k] selects the first k 64-bit lanes.
+  alignas(32) int64_t prefix[5][4];
+};
+
+constexpr CompressTable MakeCompressTable() {
+  CompressTable t{};
+  for (int mask = 0; mask < 16; ++mask) {
+    int pos = 0;
+    for (int lane = 0; lane < 4; ++lane) {
+      if ((mask >> lane) & 1) {
+        t.idx[mask][2 * pos] = 2 * lane;
+        t.idx[mask][2 * pos + 1] = 2 * lane + 1;
+        ++pos;
+      }
+    }
+  }
+  for (int k = 0; k <= 4; ++k) {
+    for (int lane = 0; lane < 4; ++lane) {
+      t.prefix[k][lane] = lane < k ? -1 : 0;
+    }
+  }
+  return t;
+}
+
+constexpr CompressTable kCompressTable = MakeCompressTable();
+
+// Only the compares and sums are vectorized: with two lanes, compressing isn't
+// worth it and the stores stay scalar.
+__attribute__((target("sse4.2"))) void PartitionSSE42(const int64_t* in, int64_t n,
+                                                      int64_t thresh,
+                                                      PartitionState* p) {
+  int64_t* out = p->out;
+  int64_t l = p->l;
+  int64_t r = p->r;
+  const __m128i thresh_v = _mm_set1_epi64x(thresh);
+  __m128i sum_v = _mm_setzero_si128();
+  __m128i max_v = _mm_set1_epi64x(p->max_le);
+  int64_t i = 0;
+  for (; i + 2 <= n; i += 2) {
+    const __m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+    const __m128i gt = _mm_cmpgt_epi64(d, thresh_v);
+    const __m128i d_le = _mm_andnot_si128(gt, d);  // demands are >= 0
+    sum_v = _mm_add_epi64(sum_v, d_le);
+    max_v = _mm_blendv_epi8(max_v, d_le, _mm_cmpgt_epi64(d_le, max_v));
+
+    const int gt_mask = _mm_movemask_pd(_mm_castsi128_pd(gt));
+    for (int lane = 0; lane < 2; ++lane) {
+      const int is_gt = (gt_mask >> lane) & 1;
+      out[l] = in[i + lane];
+      out[r - 1] = in[i + lane];
+      l += 1 - is_gt;
+      r -= is_gt;
+    }
+  }
+  p->l = l;
+  p->r = r;
+  p->sum_le += _mm_extract_epi64(sum_v, 0) + _mm_extract_epi64(sum_v, 1);
+  p->max_le = std::max(_mm_extract_epi64(max_v, 0), _mm_extract_epi64(max_v, 1));
+  PartitionScalar(in + i, n - i, thresh, p);
+}
+
+__attribute__((target("avx2,popcnt"))) void PartitionAVX2(const int64_t* in, int64_t n,
+                                                           int64_t thresh,
+                                                           PartitionState* p) {
+  long long* out = reinterpret_cast<long long*>(p->out);
+  int64_t l = p->l;
+  int64_t r = p->r;
+  const __m256i thresh_v = _mm256_set1_epi64x(thresh);
+  __m256i sum_v = _mm256_setzero_si256();
+  __m256i max_v = _mm256_set1_epi64x(p->max_le);
+  int64_t i = 0;
+  for (; i + 4 <= n; i += 4) {
+    const __m256i d = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + i));
+    const __m256i gt = _mm256_cmpgt_epi64(d, thresh_v);
+    const __m256i d_le = _mm256_andnot_si256(gt, d);  // demands are >= 0
+    sum_v = _mm256_add_epi64(sum_v, d_le);
+    max_v = _mm256_blendv_epi8(max_v, d_le, _mm256_cmpgt_epi64(d_le, max_v));
+
+    // Masked stores only touch the claimed slots, so the two sides can't clobber
+    // each other when they meet.
+    const int gt_mask = _mm256_movemask_pd(_mm256_castsi256_pd(gt));
+    const int le_mask = ~gt_mask & 0xf;
+    const int num_le = __builtin_popcount(le_mask);
+    const __m256i le_vals = _mm256_permutevar8x32_epi32(
+        d, _mm256_load_si256(
+               reinterpret_cast<const __m256i*>(kCompressTable.idx[le_mask])));
+    _mm256_maskstore_epi64(out + l,
+                           _mm256_load_si256(reinterpret_cast<const __m256i*>(
+                               kCompressTable.prefix[num_le])),
+                           le_vals);
+    l += num_le;
+
+    const __m256i gt_vals = _mm256_permutevar8x32_epi32(
+        d, _mm256_load_si256(
+               reinterpret_cast<const __m256i*>(kCompressTable.idx[gt_mask])));
+    r -= 4 - num_le;
+    _mm256_maskstore_epi64(out + r,
+                           _mm256_load_si256(reinterpret_cast<const __m256i*>(
+                               kCompressTable.prefix[4 - num_le])),
+                           gt_vals);
+  }
+  alignas(32) int64_t sums[4];
+  alignas(32) int64_t maxes[4];
+  _mm256_store_si256(reinterpret_cast<__m256i*>(sums), sum_v);
+  _mm256_store_si256(reinterpret_cast<__m256i*>(maxes), max_v);
+  p->l = l;
+  p->r = r;
+  p->sum_le += sums[0] + sums[1] + sums[2] + sums[3];
+  p->max_le = std::max({maxes[0], maxes[1], maxes[2], maxes[3]});
+  PartitionScalar(in + i, n - i, thresh, p);
+}
+
+#endif  // defined(__x86_64__)
+
+int64_t MedianOf3(int64_t a, int64_t b, int64_t c) {
+  return std::max(std::min(a, b), std::min(std::max(a, b), c));
+}
+
+// Demands are satisfied smallest first. Sorted, demand k is satisfied iff
+//     ∑[i<k] demand(i) + demand(k) * (N - k) <= capacity
+// and the left side only grows with k. So if the largest demand of a prefix is
+// satisfied, so is the entire prefix.
+int64_t Solve(PartitionFn partition, int64_t capacity, absl::Span<int64_t> demands,
+              absl::Span<int64_t> scratch) {
+  const int64_t n = demands.size();
+  if (n == 0) {
+    return 0;
+  }
+  ABSL_ASSERT(scratch.size() >= demands.size());
+
+  // Undecided demands are in cur[lo, hi). Partitions are written to the same
+  // positions in the other buffer.
+  int64_t* cur = demands.data();
+  int64_t* next = scratch.data();
+  int64_t lo = 0;
+  int64_t hi = n;
+
+  int64_t num_satisfied = 0;
+  int64_t sum_satisfied = 0;
+  int64_t max_satisfied = 0;
+  while (lo < hi) {
+    const int64_t pivot = MedianOf3(cur[lo], cur[lo + (hi - lo) / 2], cur[hi - 1]);
+    PartitionState p{.out = next, .l = lo, .r = hi, .sum_le = 0, .max_le = 0};
+    partition(cur + lo, hi - lo, pivot, &p);
+    std::swap(cur, next);
+
+    // The pivot is <= itself, so the low side is never empty.
+    const int64_t k = num_satisfied + (p.l - lo);
+    const int64_t sum = sum_satisfied + p.sum_le;
+    if (sum + p.max_le * (n - k) <= capacity) {
+      num_satisfied = k;
+      sum_satisfied = sum;
+      max_satisfied = p.max_le;
+      lo = p.l;
+    } else if (p.l < hi) {
+      hi = p.l;
+    } else {
+      // Every demand left is <= pivot, and the ones equal to the pivot are
+      // satisfied together or not at all (their conditions are the same). So they
+      // aren't, and we continue with the smaller ones.
+      p = PartitionState{.out = next, .l = lo, .r = hi, .sum_le = 0, .max_le = 0};
+      partition(cur + lo, hi - lo, pivot - 1, &p);
+      std::swap(cur, next);
+      hi = p.l;
+    }
+  }
+
+  if (num_satisfied == n) {
+    return max_satisfied;
+  }
+  // Evenly divide the remaining capacity across the unsatisfied demands.
+  return (capacity - sum_satisfied) / (n - num_satisfied);
+}
+
+}  // namespace
+
+bool CPUSupports(WaterlevelKernel kernel) {
+  switch (kernel) {
+    case WaterlevelKernel::kScalar:
+      return true;
+#if defined(__x86_64__)
+    case WaterlevelKernel::kSSE42:
+      return __builtin_cpu_supports("sse4.2");
+    case WaterlevelKernel::kAVX2:
+      return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("popcnt");
+#endif
+    default:
+      return false;
+  }
+}
+
+WaterlevelKernel BestWaterlevelKernel() {
+  static const WaterlevelKernel kBest = [] {
+    if (CPUSupports(WaterlevelKernel::kAVX2)) {
+      return WaterlevelKernel::kAVX2;
+    }
+    if (CPUSupports(WaterlevelKernel::kSSE42)) {
+      return WaterlevelKernel::kSSE42;
+    }
+    return WaterlevelKernel::kScalar;
+  }();
+  return kBest;
+}
+
+const char* ToString(WaterlevelKernel kernel) {
+  switch (kernel) {
+    case WaterlevelKernel::kScalar:
+      return "scalar";
+    case WaterlevelKernel::kSSE42:
+      return "sse4.2";
+    case WaterlevelKernel::kAVX2:
+      return "avx2";
+  }
+  return "unknown";
+}
+
+int64_t PartitionWaterlevel(WaterlevelKernel kernel, int64_t capacity,
+                            absl::Span<int64_t> demands, absl::Span<int64_t> scratch) {
+  ABSL_ASSERT(capacity >= 0);
+  ABSL_ASSERT(CPUSupports(kernel));
+  switch (kernel) {
+#if defined(__x86_64__)
+    case WaterlevelKernel::kSSE42:
+      return Solve(PartitionSSE42, capacity, demands, scratch);
+    case WaterlevelKernel::kAVX2:
+      return Solve(PartitionAVX2, capacity, demands, scratch);
+#endif
+    default:
+      return Solve(PartitionScalar, capacity, demands, scratch);
+  }
+}
+
+}  // namespace heyp
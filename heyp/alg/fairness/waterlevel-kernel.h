@@ -0,0 +1,37 @@
+#ifndef HEYP_ALG_FAIRNESS_WATERLEVEL_KERNEL_H_
+#define HEYP_ALG_FAIRNESS_WATERLEVEL_KERNEL_H_
+
+#include <cstdint>
+
+#include "absl/types/span.h"
+
+namespace heyp {
+
+// Instruction sets that PartitionWaterlevel can use.
+enum class WaterlevelKernel {
+  kScalar,
+  kSSE42,  // vectorized compares and sums
+  kAVX2,   // also compresses each partition side with permutes and masked stores
+};
+
+// Returns the fastest kernel that this CPU supports.
+WaterlevelKernel BestWaterlevelKernel();
+
+bool CPUSupports(WaterlevelKernel kernel);
+
+const char* ToString(WaterlevelKernel kernel);
+
+// Computes the max-min fair waterlevel for sharing capacity among demands (which must
+// be non-negative). The result matches SingleLinkMaxMinFairnessProblem's.
+//
+// Each step partitions the remaining demands around a pivot while summing the smaller
+// side, and then keeps only one side, so this takes O(N) expected time.
+//
+// demands is used as scratch space and left reordered. scratch must be at least as
+// large as demands. kernel must be supported by the CPU.
+int64_t PartitionWaterlevel(WaterlevelKernel kernel, int64_t capacity,
+                            absl::Span<int64_t> demands, absl::Span<int64_t> scratch);
+
+}  // namespace heyp
+
+#endif  // HEYP_ALG_FAIRNESS_WATERLEVEL_KERNEL_H_
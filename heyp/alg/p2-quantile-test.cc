@@ -0,0 +1,64 @@
+#include "heyp/alg/p2-quantile.h"
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "absl/random/random.h"
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+namespace heyp {
+namespace {
+
+TEST(P2QuantileTest, FewSamples) {
+  P2Quantile median(0.5);
+  EXPECT_EQ(median.Value(), 0);
+  median.Add(7);
+  EXPECT_EQ(median.Value(), 7);
+  median.Add(1);
+  median.Add(4);
+  EXPECT_EQ(median.Value(), 4);
+  EXPECT_EQ(median.count(), 3);
+
+  median.Clear();
+  EXPECT_EQ(median.count(), 0);
+  median.Add(2);
+  EXPECT_EQ(median.Value(), 2);
+}
+
+TEST(P2QuantileTest, Constant) {
+  P2Quantile p95(0.95);
+  for (int i = 0; i < 1000; ++i) {
+    p95.Add(42);
+  }
+  EXPECT_EQ(p95.Value(), 42);
+}
+
+double ExactQuantile(std::vector<double> xs, double p) {
+  std::sort(xs.begin(), xs.end());
+  return xs[static_cast<size_t>(p * (xs.size() - 1))];
+}
+
+TEST(P2QuantileTest, CloseToExact) {
+  std::mt19937_64 rng(0);
+  for (double p : {0.1, 0.5, 0.9, 0.95, 0.99}) {
+    SCOPED_TRACE(testing::Message() << "p = " << p);
+    P2Quantile uniform(p);
+    P2Quantile exponential(p);
+    std::vector<double> uniform_xs;
+    std::vector<double> exponential_xs;
+    for (int i = 0; i < 20'000; ++i) {
+      uniform_xs.push_back(absl::Uniform(rng, 0.0, 1000.0));
+      exponential_xs.push_back(absl::Exponential(rng, 0.01));
+      uniform.Add(uniform_xs.back());
+      exponential.Add(exponential_xs.back());
+    }
+    EXPECT_NEAR(uniform.Value(), ExactQuantile(uniform_xs, p), 10);
+    const double want = ExactQuantile(exponential_xs, p);
+    EXPECT_NEAR(exponential.Value(), want, 0.05 * want);
+  }
+}
+
+}  // namespace
+}  // namespace heyp
@@ -0,0 +1,94 @@
+#include "heyp/alg/p2-quantile.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "absl/base/macros.h"
+
+namespace heyp {
+
+P2Quantile::P2Quantile(double p) : p_(p) { ABSL_ASSERT(p_ >= 0 && p_ <= 1); }
+
+void P2Quantile::Add(double x) {
+  if (count_ < 5) {
+    q_[count_++] = x;
+    if (count_ == 5) {
+      std::sort(q_, q_ + 5);
+      for (int i = 0; i < 5; ++i) {
+        n_[i] = i;
+      }
+      np_[0] = 0;
+      np_[1] = 2 * p_;
+      np_[2] = 4 * p_;
+      np_[3] = 2 + 2 * p_;
+      np_[4] = 4;
+    }
+    return;
+  }
+
+  // Find the cell containing x and extend the extreme markers if needed.
+  int k;
+  if (x < q_[0]) {
+    q_[0] = x;
+    k = 0;
+  } else if (x >= q_[4]) {
+    q_[4] = std::max(q_[4], x);
+    k = 3;
+  } else {
+    k = 0;
+    while (x >= q_[k + 1]) {
+      ++k;
+    }
+  }
+  ++count_;
+  for (int i = k + 1; i < 5; ++i) {
+    ++n_[i];
+  }
+  np_[1] += p_ / 2;
+  np_[2] += p_;
+  np_[3] += (1 + p_) / 2;
+  np_[4] += 1;
+
+  // Move the middle markers toward their desired positions.
+  for (int i = 1; i < 4; ++i) {
+    const double d = np_[i] - n_[i];
+    if ((d >= 1 && n_[i + 1] - n_[i] > 1) || (d <= -1 && n_[i - 1] - n_[i] < -1)) {
+      const int ds = d >= 0 ? 1 : -1;
+      const double qp = Parabolic(i, ds);
+      if (q_[i - 1] < qp && qp < q_[i + 1]) {
+        q_[i] = qp;
+      } else {
+        q_[i] = Linear(i, ds);
+      }
+      n_[i] += ds;
+    }
+  }
+}
+
+double P2Quantile::Parabolic(int i, double d) const {
+  const double n_lo = n_[i - 1];
+  const double n_mid = n_[i];
+  const double n_hi = n_[i + 1];
+  return q_[i] + d / (n_hi - n_lo) *
+                     ((n_mid - n_lo + d) * (q_[i + 1] - q_[i]) / (n_hi - n_mid) +
+                      (n_hi - n_mid - d) * (q_[i] - q_[i - 1]) / (n_mid - n_lo));
+}
+
+double P2Quantile::Linear(int i, int d) const {
+  return q_[i] + d * (q_[i + d] - q_[i]) / static_cast<double>(n_[i + d] - n_[i]);
+}
+
+double P2Quantile::Value() const {
+  if (count_ == 0) {
+    return 0;
+  }
+  if (count_ >= 5) {
+    return q_[2];
+  }
+  double sorted[5];
+  std::copy(q_, q_ + count_, sorted);
+  std::sort(sorted, sorted + count_);
+  return sorted[static_cast<int>(std::lround(p_ * (count_ - 1)))];
+}
+
+}  // namespace heyp
@@ -0,0 +1,38 @@
+#ifndef HEYP_ALG_P2_QUANTILE_H_
+#define HEYP_ALG_P2_QUANTILE_H_
+
+#include <cstdint>
+
+namespace heyp {
+
+// P2Quantile estimates a quantile of a stream in constant memory using the P²
+// algorithm (Jain and Chlamtac, 1985). It keeps five markers whose heights track
+// the min, p/2, p, (1+p)/2 quantiles and max, and adjusts them with piecewise
+// parabolic interpolation as samples arrive.
+class P2Quantile {
+ public:
+  explicit P2Quantile(double p);
+
+  void Add(double x);
+
+  // Returns the estimated quantile, or 0 if no samples were added.
+  double Value() const;
+
+  void Clear() { count_ = 0; }
+
+  int64_t count() const { return count_; }
+
+ private:
+  double Parabolic(int i, double d) const;
+  double Linear(int i, int d) const;
+
+  const double p_;
+  int64_t count_ = 0;
+  double q_[5];   // marker heights
+  int64_t n_[5];  // marker positions
+  double np_[5];  // desired marker positions
+};
+
+}  // namespace heyp
+
+#endif  // HEYP_ALG_P2_QUANTILE_H_
@@ -56,6 +56,9 @@ class ThresholdSampler {
   AggUsageEstimator NewAggUsageEstimator() const;
   UsageDistEstimator NewUsageDistEstimator() const;
 
+  // Returns how much a sample adds to an AggUsageEstimator's estimate.
+  double WeightedUsage(double usage) const;
+
  private:
   const double approval_;
   const double thresh_;
@@ -91,6 +94,13 @@ inline ThresholdSampler::AggUsageEstimator ThresholdSampler::NewAggUsageEstimato
   return AggUsageEstimator(approval_, thresh_);
 }
 
+inline double ThresholdSampler::WeightedUsage(double usage) const {
+  if (usage <= 0) {
+    return 0;
+  }
+  return usage / ThresholdSamplingProbOf(approval_, thresh_, usage);
+}
+
 inline void ThresholdSampler::AggUsageEstimator::RecordSample(double usage) {
   double p = ThresholdSamplingProbOf(approval_, thresh_, usage);
   est_ += usage / p;
@@ -0,0 +1,67 @@
+#include "heyp/alg/windowed-max.h"
+
+#include <random>
+#include <vector>
+
+#include "absl/random/random.h"
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "heyp/alg/demand-predictor.h"
+
+namespace heyp {
+namespace {
+
+TEST(WindowedMaxUsageTest, Basic) {
+  const absl::Time now = absl::UnixEpoch();
+  auto t = [now](int64_t secs) { return now + absl::Seconds(secs); };
+
+  WindowedMaxUsage max_usage(absl::Seconds(10));
+  EXPECT_EQ(max_usage.Add(t(0), 5), 5);
+  EXPECT_EQ(max_usage.Add(t(1), 3), 5);
+  EXPECT_EQ(max_usage.Add(t(10), 1), 5);
+  EXPECT_EQ(max_usage.Add(t(11), 2), 3);
+  EXPECT_EQ(max_usage.Add(t(11), 7), 7);
+  EXPECT_EQ(max_usage.Add(t(50), -4), 0);
+  EXPECT_EQ(max_usage.size(), 1);
+
+  max_usage.Clear();
+  EXPECT_EQ(max_usage.Add(t(50), 1), 1);
+}
+
+TEST(WindowedMaxUsageTest, MatchesBweDemandPredictor) {
+  std::mt19937_64 rng(0);
+  for (int iter = 0; iter < 50; ++iter) {
+    SCOPED_TRACE(iter);
+    const absl::Duration window = absl::Milliseconds(absl::Uniform(rng, 1, 5'000));
+    BweDemandPredictor predictor(window, absl::Uniform(rng, 0.5, 2.0),
+                                 absl::Uniform(rng, 0, 1'000));
+    std::unique_ptr<DemandPredictorState> state = predictor.NewState();
+
+    std::vector<UsageHistoryEntry> history;
+    absl::Time now = absl::UnixEpoch();
+    for (int i = 0; i < 500; ++i) {
+      now += absl::Milliseconds(absl::Uniform(rng, 0, 200));
+      history.push_back({now, absl::Uniform<int64_t>(rng, -100, 10'000)});
+      ASSERT_EQ(state->Update(history.back()), predictor.FromUsage(now, history))
+          << "i = " << i;
+    }
+  }
+}
+
+TEST(WindowedMaxUsageTest, MemoryIsBounded) {
+  std::mt19937_64 rng(0);
+  WindowedMaxUsage max_usage(absl::Seconds(30), /*initial_capacity=*/4);
+  absl::Time now = absl::UnixEpoch();
+  int64_t usage = 1'000'000;
+  for (int i = 0; i < 100'000; ++i) {
+    now += absl::Milliseconds(500);
+    // Mostly decreasing usage is the worst case since nothing is dropped early.
+    usage -= absl::Uniform(rng, -10, 100);
+    max_usage.Add(now, usage);
+    ASSERT_LE(max_usage.size(), 61);
+  }
+  EXPECT_LE(max_usage.capacity(), 64);
+}
+
+}  // namespace
+}  // namespace heyp
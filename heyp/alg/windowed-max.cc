@@ -0,0 +1,54 @@
+#include "heyp/alg/windowed-max.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "absl/base/macros.h"
+
+namespace heyp {
+
+namespace {
+
+size_t RoundUpToPow2(size_t n) {
+  size_t p = 1;
+  while (p < n) {
+    p *= 2;
+  }
+  return p;
+}
+
+}  // namespace
+
+WindowedMaxUsage::WindowedMaxUsage(absl::Duration window, size_t initial_capacity)
+    : window_(window), buf_(RoundUpToPow2(std::max<size_t>(initial_capacity, 1))) {}
+
+void WindowedMaxUsage::Grow() {
+  std::vector<Entry> bigger(2 * buf_.size());
+  for (size_t i = 0; i < size_; ++i) {
+    bigger[i] = at(i);
+  }
+  buf_ = std::move(bigger);
+  head_ = 0;
+}
+
+int64_t WindowedMaxUsage::Add(absl::Time time, int64_t bps) {
+  ABSL_ASSERT(size_ == 0 || at(size_ - 1).time <= time);
+
+  while (size_ > 0 && at(size_ - 1).bps <= bps) {
+    --size_;
+  }
+  const absl::Time min_time = time - window_;
+  while (size_ > 0 && at(0).time < min_time) {
+    head_ = (head_ + 1) & (buf_.size() - 1);
+    --size_;
+  }
+  if (size_ == buf_.size()) {
+    Grow();
+  }
+  at(size_++) = {time, bps};
+
+  // Entries are in decreasing order of bps, so the front is the max.
+  return std::max<int64_t>(0, at(0).bps);
+}
+
+}  // namespace heyp
@@ -0,0 +1,50 @@
+#ifndef HEYP_ALG_WINDOWED_MAX_H_
+#define HEYP_ALG_WINDOWED_MAX_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "absl/time/time.h"
+
+namespace heyp {
+
+// WindowedMaxUsage tracks the max usage over a sliding time window.
+//
+// Entries are kept in a ring buffer as a monotonic deque: an entry is dropped as
+// soon as a newer entry with at least as much usage arrives (since it can never be
+// the max again) or when it falls out of the window. So Add takes O(1) amortized
+// time and memory is bounded by the number of entries per window. The buffer only
+// grows if usage keeps decreasing for longer than its capacity.
+class WindowedMaxUsage {
+ public:
+  explicit WindowedMaxUsage(absl::Duration window, size_t initial_capacity = 8);
+
+  // Adds a usage sample, which must be no older than previously added ones, and
+  // returns the max bps of the samples at or after time - window (or 0 if negative).
+  int64_t Add(absl::Time time, int64_t bps);
+
+  void Clear() { size_ = 0; }
+
+  size_t size() const { return size_; }
+  size_t capacity() const { return buf_.size(); }
+  size_t buffer_bytes() const { return buf_.size() * sizeof(Entry); }
+
+ private:
+  struct Entry {
+    absl::Time time;
+    int64_t bps;
+  };
+
+  Entry& at(size_t i) { return buf_[(head_ + i) & (buf_.size() - 1)]; }
+  void Grow();
+
+  const absl::Duration window_;
+  std::vector<Entry> buf_;  // size is a power of 2
+  size_t head_ = 0;
+  size_t size_ = 0;
+};
+
+}  // namespace heyp
+
+#endif  // HEYP_ALG_WINDOWED_MAX_H_
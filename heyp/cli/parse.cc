@@ -25,8 +25,39 @@ absl::Status ParseDemandPredictorConfig(const proto::DemandPredictorConfig& c,
   }
 
   *time_window = *window_or;
-  *predictor = absl::make_unique<BweDemandPredictor>(*time_window, c.usage_multiplier(),
-                                                     c.min_demand_bps());
+  if (c.type() != proto::DP_BWE && *time_window <= absl::ZeroDuration()) {
+    return absl::InvalidArgumentError(
+        absl::StrCat("time_window must be positive, got ", c.time_window_dur()));
+  }
+  switch (c.type()) {
+    case proto::DP_BWE:
+      *predictor = absl::make_unique<BweDemandPredictor>(
+          *time_window, c.usage_multiplier(), c.min_demand_bps());
+      break;
+    case proto::DP_DECAYED_PEAK:
+      *predictor = absl::make_unique<DecayedPeakDemandPredictor>(
+          *time_window, c.usage_multiplier(), c.min_demand_bps());
+      break;
+    case proto::DP_QUANTILE:
+      if (c.quantile() < 0 || c.quantile() > 1) {
+        return absl::InvalidArgumentError(
+            absl::StrCat("quantile must be in [0, 1], got ", c.quantile()));
+      }
+      *predictor = absl::make_unique<QuantileDemandPredictor>(
+          *time_window, c.quantile(), c.usage_multiplier(), c.min_demand_bps());
+      break;
+    case proto::DP_HOLT:
+      if (c.trend_smoothing() <= 0 || c.trend_smoothing() > 1) {
+        return absl::InvalidArgumentError(absl::StrCat(
+            "trend_smoothing must be in (0, 1], got ", c.trend_smoothing()));
+      }
+      *predictor = absl::make_unique<HoltDemandPredictor>(
+          *time_window, c.trend_smoothing(), c.usage_multiplier(), c.min_demand_bps());
+      break;
+    default:
+      return absl::InvalidArgumentError(
+          absl::StrCat("unknown demand predictor type: ", c.type()));
+  }
 
   return absl::OkStatus();
 }
@@ -0,0 +1,73 @@
+#include <cstdio>
+
+#include "absl/strings/str_cat.h"
+#include "benchmark/benchmark.h"
+#include "heyp/cluster-agent/fast-controller.h"
+#include "heyp/proto/config.pb.h"
+#include "heyp/proto/heyp.pb.h"
+
+namespace heyp {
+namespace {
+
+constexpr int kNumFGs = 64;
+
+proto::AllocBundle ClusterWideAllocs() {
+  proto::AllocBundle allocs;
+  for (int i = 0; i < kNumFGs; ++i) {
+    proto::FlowAlloc* a = allocs.add_flow_allocs();
+    a->mutable_flow()->set_src_dc("src");
+    a->mutable_flow()->set_dst_dc(absl::StrCat("dst-", i));
+    a->set_hipri_rate_limit_bps(1'000'000);
+  }
+  return allocs;
+}
+
+std::unique_ptr<FastClusterController> NewController() {
+  return FastClusterController::Create(proto::FastClusterControllerConfig(),
+                                       ClusterWideAllocs());
+}
+
+// Writes the checkpoint of a controller that knows about num_hosts hosts.
+std::string WriteTestCheckpoint(int64_t num_hosts) {
+  const std::string path = absl::StrCat("/tmp/checkpoint-bench-", num_hosts, ".ckpt");
+  auto controller = NewController();
+  {
+    std::vector<std::unique_ptr<ClusterController::Listener>> lis;
+    lis.reserve(num_hosts);
+    for (int64_t host_id = 0; host_id < num_hosts; ++host_id) {
+      lis.push_back(controller->RegisterListener(
+          host_id, [](const proto::AllocBundle&, const SendBundleAux&) {}));
+    }
+    controller->ComputeAndBroadcast();
+  }
+  if (!controller->SaveCheckpoint(path).ok()) {
+    std::abort();
+  }
+  return path;
+}
+
+static void BM_RestoreCheckpoint(benchmark::State& state) {
+  const std::string path = WriteTestCheckpoint(state.range(0));
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto controller = NewController();
+    state.ResumeTiming();
+
+    absl::Status st = controller->RestoreCheckpoint(path);
+    benchmark::DoNotOptimize(st);
+
+    state.PauseTiming();
+    controller = nullptr;
+    state.ResumeTiming();
+  }
+  std::remove(path.c_str());
+}
+
+BENCHMARK(BM_RestoreCheckpoint)
+    ->Arg(1'000)
+    ->Arg(100'000)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+}  // namespace
+}  // namespace heyp
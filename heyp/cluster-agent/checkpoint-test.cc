@@ -0,0 +1,86 @@
+#include "heyp/cluster-agent/checkpoint.h"
+
+#include <cstdio>
+#include <fstream>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+namespace heyp {
+namespace {
+
+CheckpointData TestData() {
+  return CheckpointData{
+      .aggs =
+          {
+              {.flow_hash = 0xabcd,
+               .ring_start = 1,
+               .ring_frac = 0.5,
+               .downgrade_frac = 0.4},
+              {.flow_hash = 0xbcde,
+               .retired = true,
+               .ring_start = 7,
+               .ewma_max_child_usage = 100,
+               .last_usage_bps = 2000},
+          },
+      .words_per_host = 2,
+      .host_ids = {10, 20, 30},
+      .lopri_bits = {1, 0, 2, 3, 0, 1ull << 63},
+  };
+}
+
+TEST(CheckpointTest, RoundTrip) {
+  const std::string path = testing::TempDir() + "/round-trip.ckpt";
+  const CheckpointData data = TestData();
+  ASSERT_TRUE(WriteCheckpoint(path, data).ok());
+
+  absl::StatusOr<std::unique_ptr<MappedCheckpoint>> ckpt_or =
+      MappedCheckpoint::Open(path);
+  ASSERT_TRUE(ckpt_or.ok()) << ckpt_or.status();
+  const MappedCheckpoint& ckpt = **ckpt_or;
+
+  EXPECT_EQ(ckpt.words_per_host(), 2);
+  ASSERT_EQ(ckpt.aggs().size(), 2);
+  EXPECT_EQ(ckpt.aggs()[0].flow_hash, 0xabcd);
+  EXPECT_FALSE(ckpt.aggs()[0].retired);
+  EXPECT_EQ(ckpt.aggs()[0].ring_start, 1);
+  EXPECT_EQ(ckpt.aggs()[0].ring_frac, 0.5);
+  EXPECT_EQ(ckpt.aggs()[0].downgrade_frac, 0.4);
+  EXPECT_EQ(ckpt.aggs()[0].ewma_max_child_usage, -1);
+  EXPECT_EQ(ckpt.aggs()[1].flow_hash, 0xbcde);
+  EXPECT_TRUE(ckpt.aggs()[1].retired);
+  EXPECT_EQ(ckpt.aggs()[1].ring_start, 7);
+  EXPECT_EQ(ckpt.aggs()[1].ewma_max_child_usage, 100);
+  EXPECT_EQ(ckpt.aggs()[1].last_usage_bps, 2000);
+  EXPECT_THAT(ckpt.host_ids(), testing::ElementsAre(10, 20, 30));
+  EXPECT_THAT(ckpt.lopri_bits(), testing::ElementsAre(1, 0, 2, 3, 0, 1ull << 63));
+  std::remove(path.c_str());
+}
+
+TEST(CheckpointTest, RejectsBadFiles) {
+  const std::string path = testing::TempDir() + "/bad.ckpt";
+  std::remove(path.c_str());
+  EXPECT_TRUE(absl::IsNotFound(MappedCheckpoint::Open(path).status()));
+
+  CheckpointData data = TestData();
+  data.lopri_bits.pop_back();
+  EXPECT_TRUE(absl::IsInvalidArgument(WriteCheckpoint(path, data)));
+
+  ASSERT_TRUE(WriteCheckpoint(path, TestData()).ok());
+  {
+    std::fstream f(path, std::ios::in | std::ios::out | std::ios::binary);
+    f.seekp(-3, std::ios::end);
+    f.put('x');
+  }
+  EXPECT_TRUE(absl::IsDataLoss(MappedCheckpoint::Open(path).status()));
+
+  {
+    std::ofstream f(path, std::ios::binary | std::ios::trunc);
+    f << "not a checkpoint, but long enough to have a header";
+  }
+  EXPECT_TRUE(absl::IsDataLoss(MappedCheckpoint::Open(path).status()));
+  std::remove(path.c_str());
+}
+
+}  // namespace
+}  // namespace heyp
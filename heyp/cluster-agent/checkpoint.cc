@@ -0,0 +1,180 @@
+#include "heyp/cluster-agent/checkpoint.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstring>
+
+#include "absl/memory/memory.h"
+#include "absl/numeric/int128.h"
+#include "absl/strings/str_cat.h"
+#include "heyp/posix/strerror.h"
+#include "third_party/xxhash/xxhash.h"
+
+namespace heyp {
+
+struct MappedCheckpoint::Header {
+  uint64_t magic;
+  uint32_t version;
+  uint32_t words_per_host;
+  int64_t num_aggs;
+  int64_t num_hosts;
+  uint64_t body_hash;  // XXH64 of everything after the header
+};
+
+namespace {
+
+constexpr uint64_t kMagic = 0x54504b4350594548;  // "HEYPCKPT"
+constexpr uint32_t kVersion = 2;
+
+absl::Status ErrnoError(absl::string_view what, const std::string& path) {
+  return absl::InternalError(
+      absl::StrCat("failed to ", what, " ", path, ": ", StrError(errno)));
+}
+
+absl::Status WriteAll(int fd, const std::string& buf, const std::string& path) {
+  size_t written = 0;
+  while (written != buf.size()) {
+    ssize_t wrote = write(fd, buf.data() + written, buf.size() - written);
+    if (wrote == -1) {
+      if (errno == EINTR) {
+        continue;
+      }
+      return ErrnoError("write", path);
+    }
+    written += wrote;
+  }
+  return absl::OkStatus();
+}
+
+}  // namespace
+
+absl::Status WriteCheckpoint(const std::string& path, const CheckpointData& data) {
+  if (data.lopri_bits.size() != data.host_ids.size() * data.words_per_host) {
+    return absl::InvalidArgumentError(
+        absl::StrCat("have ", data.lopri_bits.size(), " QoS words for ",
+                     data.host_ids.size(), " hosts with ", data.words_per_host,
+                     " words each"));
+  }
+
+  using Header = MappedCheckpoint::Header;
+  const size_t aggs_size = data.aggs.size() * sizeof(CheckpointAggState);
+  const size_t ids_size = data.host_ids.size() * sizeof(uint64_t);
+  const size_t bits_size = data.lopri_bits.size() * sizeof(uint64_t);
+
+  std::string buf(sizeof(Header) + aggs_size + ids_size + bits_size, '\0');
+  char* body = buf.data() + sizeof(Header);
+  std::memcpy(body, data.aggs.data(), aggs_size);
+  std::memcpy(body + aggs_size, data.host_ids.data(), ids_size);
+  std::memcpy(body + aggs_size + ids_size, data.lopri_bits.data(), bits_size);
+
+  const Header header{
+      .magic = kMagic,
+      .version = kVersion,
+      .words_per_host = static_cast<uint32_t>(data.words_per_host),
+      .num_aggs = static_cast<int64_t>(data.aggs.size()),
+      .num_hosts = static_cast<int64_t>(data.host_ids.size()),
+      .body_hash = XXH64(body, buf.size() - sizeof(Header), 0),
+  };
+  std::memcpy(buf.data(), &header, sizeof(Header));
+
+  const std::string tmp_path = path + ".tmp";
+  int fd = open(tmp_path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+  if (fd == -1) {
+    return ErrnoError("create", tmp_path);
+  }
+  absl::Status st = WriteAll(fd, buf, tmp_path);
+  if (st.ok() && fsync(fd) == -1) {
+    st = ErrnoError("sync", tmp_path);
+  }
+  if (close(fd) == -1 && st.ok()) {
+    st = ErrnoError("close", tmp_path);
+  }
+  if (st.ok() && rename(tmp_path.c_str(), path.c_str()) == -1) {
+    st = ErrnoError("rename to", path);
+  }
+  if (!st.ok()) {
+    unlink(tmp_path.c_str());
+  }
+  return st;
+}
+
+absl::StatusOr<std::unique_ptr<MappedCheckpoint>> MappedCheckpoint::Open(
+    const std::string& path) {
+  int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd == -1) {
+    if (errno == ENOENT) {
+      return absl::NotFoundError(absl::StrCat("no checkpoint at ", path));
+    }
+    return ErrnoError("open", path);
+  }
+  struct stat st;
+  if (fstat(fd, &st) == -1) {
+    absl::Status status = ErrnoError("stat", path);
+    close(fd);
+    return status;
+  }
+  const size_t size = st.st_size;
+  if (size < sizeof(Header)) {
+    close(fd);
+    return absl::DataLossError(absl::StrCat("checkpoint ", path, " is truncated"));
+  }
+  void* data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE | MAP_POPULATE, fd, 0);
+  close(fd);
+  if (data == MAP_FAILED) {
+    return ErrnoError("mmap", path);
+  }
+  auto ckpt =
+      absl::WrapUnique(new MappedCheckpoint(static_cast<const char*>(data), size));
+
+  const Header& h = ckpt->header();
+  if (h.magic != kMagic || h.version != kVersion) {
+    return absl::DataLossError(
+        absl::StrCat(path, " is not a version ", kVersion, " checkpoint"));
+  }
+  const absl::uint128 want_size =
+      absl::uint128(sizeof(Header)) +
+      absl::uint128(std::max<int64_t>(0, h.num_aggs)) * sizeof(CheckpointAggState) +
+      absl::uint128(std::max<int64_t>(0, h.num_hosts)) * sizeof(uint64_t) *
+          (absl::uint128(h.words_per_host) + 1);
+  if (h.num_aggs < 0 || h.num_hosts < 0 || want_size != size) {
+    return absl::DataLossError(absl::StrCat("checkpoint ", path, " has bad sizes"));
+  }
+  if (XXH64(ckpt->data_ + sizeof(Header), size - sizeof(Header), 0) != h.body_hash) {
+    return absl::DataLossError(absl::StrCat("checkpoint ", path, " is corrupt"));
+  }
+  return ckpt;
+}
+
+MappedCheckpoint::~MappedCheckpoint() {
+  munmap(const_cast<char*>(data_), size_);
+}
+
+const MappedCheckpoint::Header& MappedCheckpoint::header() const {
+  return *reinterpret_cast<const Header*>(data_);
+}
+
+int MappedCheckpoint::words_per_host() const { return header().words_per_host; }
+
+absl::Span<const CheckpointAggState> MappedCheckpoint::aggs() const {
+  return absl::MakeConstSpan(
+      reinterpret_cast<const CheckpointAggState*>(data_ + sizeof(Header)),
+      header().num_aggs);
+}
+
+absl::Span<const uint64_t> MappedCheckpoint::host_ids() const {
+  return absl::MakeConstSpan(
+      reinterpret_cast<const uint64_t*>(data_ + sizeof(Header) +
+                                        header().num_aggs * sizeof(CheckpointAggState)),
+      header().num_hosts);
+}
+
+absl::Span<const uint64_t> MappedCheckpoint::lopri_bits() const {
+  return absl::MakeConstSpan(host_ids().data() + header().num_hosts,
+                             header().num_hosts * header().words_per_host);
+}
+
+}  // namespace heyp
@@ -0,0 +1,80 @@
+#ifndef HEYP_CLUSTER_AGENT_CHECKPOINT_H_
+#define HEYP_CLUSTER_AGENT_CHECKPOINT_H_
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "absl/types/span.h"
+
+namespace heyp {
+
+// Per-FG controller state saved in a checkpoint.
+struct CheckpointAggState {
+  // Identifies the FG. Aggs are matched by flow_hash on restore since FG ids depend on
+  // the order in which FGs were added.
+  uint64_t flow_hash = 0;
+  uint64_t retired = 0;  // a full word so that the struct has no padding
+
+  uint64_t ring_start = 0;
+  double ring_frac = 0;
+  double downgrade_frac = 0;
+  double ewma_max_child_usage = -1;
+  int64_t last_usage_bps = 0;
+};
+
+static_assert(std::is_trivially_copyable_v<CheckpointAggState>);
+
+// Controller state to checkpoint.
+struct CheckpointData {
+  std::vector<CheckpointAggState> aggs;  // indexed by FG id
+
+  // QoS bitsets (words_per_host words each; bit i set if FG i is LOPRI) of each host.
+  int words_per_host = 0;
+  std::vector<uint64_t> host_ids;
+  std::vector<uint64_t> lopri_bits;
+};
+
+// Writes data to path. The file is written next to path and renamed over it, so
+// readers never observe a partial checkpoint.
+absl::Status WriteCheckpoint(const std::string& path, const CheckpointData& data);
+
+// MappedCheckpoint is a checkpoint file that is mmap'd and read in place.
+//
+// The file is a fixed header followed by the aggs, host_ids, and lopri_bits arrays.
+class MappedCheckpoint {
+ public:
+  // Maps path and validates its header and checksum.
+  static absl::StatusOr<std::unique_ptr<MappedCheckpoint>> Open(const std::string& path);
+
+  ~MappedCheckpoint();
+
+  MappedCheckpoint(const MappedCheckpoint&) = delete;
+  MappedCheckpoint& operator=(const MappedCheckpoint&) = delete;
+
+  int words_per_host() const;
+  absl::Span<const CheckpointAggState> aggs() const;
+  absl::Span<const uint64_t> host_ids() const;
+  absl::Span<const uint64_t> lopri_bits() const;
+
+ private:
+  struct Header;
+
+  MappedCheckpoint(const char* data, size_t size) : data_(data), size_(size) {}
+
+  friend absl::Status WriteCheckpoint(const std::string& path,
+                                      const CheckpointData& data);
+
+  const Header& header() const;
+
+  const char* data_;
+  size_t size_;
+};
+
+}  // namespace heyp
+
+#endif  // HEYP_CLUSTER_AGENT_CHECKPOINT_H_
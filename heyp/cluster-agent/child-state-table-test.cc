@@ -0,0 +1,134 @@
+#include "heyp/cluster-agent/child-state-table.h"
+
+#include <thread>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+namespace heyp {
+namespace {
+
+TEST(ChildStateTableTest, LOPRIBitsSpanWords) {
+  ChildStateTable table(70);
+  table.Resize(3);
+  EXPECT_EQ(table.size(), 3);
+  EXPECT_EQ(table.words_per_child(), 2);
+
+  table.SetLOPRI(1, 0, true);
+  table.SetLOPRI(1, 63, true);
+  table.SetLOPRI(1, 69, true);
+  table.SetLOPRI(2, 64, true);
+
+  EXPECT_TRUE(table.IsLOPRI(1, 0));
+  EXPECT_TRUE(table.IsLOPRI(1, 63));
+  EXPECT_FALSE(table.IsLOPRI(1, 64));
+  EXPECT_TRUE(table.IsLOPRI(1, 69));
+  EXPECT_FALSE(table.IsLOPRI(0, 0));
+  EXPECT_TRUE(table.IsLOPRI(2, 64));
+
+  std::vector<uint64_t> words;
+  table.CopyLOPRIBits(1, &words);
+  EXPECT_THAT(words, testing::ElementsAre(1 | (uint64_t{1} << 63), uint64_t{1} << 5));
+
+  table.SetLOPRI(1, 63, false);
+  table.CopyLOPRIBits(1, &words);
+  EXPECT_THAT(words, testing::ElementsAre(1, uint64_t{1} << 5));
+}
+
+TEST(ChildStateTableTest, ResizeKeepsState) {
+  ChildStateTable table(4);
+  table.Resize(1);
+  table.SetLOPRI(0, 2, true);
+  table.RecordData(0, 7);
+  table.Resize(100);
+  EXPECT_EQ(table.size(), 100);
+  EXPECT_TRUE(table.IsLOPRI(0, 2));
+  EXPECT_FALSE(table.IsLOPRI(99, 2));
+  EXPECT_EQ(table.GenIfSeenThisEpoch(0), 7);
+
+  table.Resize(10);  // never shrinks
+  EXPECT_EQ(table.size(), 100);
+}
+
+TEST(ChildStateTableTest, GrowAggsKeepsBits) {
+  ChildStateTable table(3);
+  table.Resize(2);
+  table.SetLOPRI(1, 2, true);
+  table.GrowAggs(64);
+  EXPECT_EQ(table.words_per_child(), 1);
+  table.GrowAggs(130);
+  EXPECT_EQ(table.words_per_child(), 3);
+  EXPECT_TRUE(table.IsLOPRI(1, 2));
+  EXPECT_FALSE(table.IsLOPRI(0, 2));
+  EXPECT_FALSE(table.IsLOPRI(1, 129));
+  table.SetLOPRI(1, 129, true);
+  EXPECT_TRUE(table.IsLOPRI(1, 129));
+  EXPECT_FALSE(table.IsLOPRI(0, 129));
+}
+
+TEST(ChildStateTableTest, GenOnlyVisibleInEpochItWasSeen) {
+  ChildStateTable table(1);
+  table.Resize(2);
+  EXPECT_EQ(table.GenIfSeenThisEpoch(0), 0);
+
+  table.RecordData(0, 5);
+  table.RecordData(0, 3);
+  EXPECT_EQ(table.GenIfSeenThisEpoch(0), 5);
+  EXPECT_EQ(table.GenIfSeenThisEpoch(1), 0);
+
+  table.NextEpoch();
+  EXPECT_EQ(table.GenIfSeenThisEpoch(0), 0);
+
+  table.RecordData(0, 4);
+  EXPECT_EQ(table.GenIfSeenThisEpoch(0), 5);
+}
+
+TEST(ChildStateTableTest, MarkForBroadcastOnce) {
+  ChildStateTable table(1);
+  table.Resize(1);
+  EXPECT_TRUE(table.MarkForBroadcast(0));
+  EXPECT_FALSE(table.MarkForBroadcast(0));
+  table.ClearBroadcastMark(0);
+  EXPECT_TRUE(table.MarkForBroadcast(0));
+}
+
+TEST(ChildStateTableTest, ConcurrentUpdates) {
+  constexpr int kNumAggs = 128;
+  constexpr int kNumChildren = 64;
+  ChildStateTable table(kNumAggs);
+  table.Resize(kNumChildren);
+
+  // Each thread owns one agg, like the per-agg tasks in FastClusterController.
+  std::vector<std::thread> threads;
+  std::vector<int> num_marked(kNumAggs, 0);
+  for (int agg_id = 0; agg_id < kNumAggs; ++agg_id) {
+    threads.emplace_back([&table, &num_marked, agg_id] {
+      for (ParID child = 0; child < kNumChildren; ++child) {
+        table.SetLOPRI(child, agg_id, (child + agg_id) % 2 == 0);
+        table.RecordData(child, agg_id);
+        if (table.MarkForBroadcast(child)) {
+          ++num_marked[agg_id];
+        }
+      }
+    });
+  }
+  for (std::thread& t : threads) {
+    t.join();
+  }
+
+  int total_marked = 0;
+  for (int n : num_marked) {
+    total_marked += n;
+  }
+  EXPECT_EQ(total_marked, kNumChildren);
+  for (ParID child = 0; child < kNumChildren; ++child) {
+    EXPECT_EQ(table.GenIfSeenThisEpoch(child), kNumAggs - 1);
+    for (int agg_id = 0; agg_id < kNumAggs; ++agg_id) {
+      EXPECT_EQ(table.IsLOPRI(child, agg_id), (child + agg_id) % 2 == 0);
+    }
+  }
+}
+
+}  // namespace
+}  // namespace heyp
@@ -0,0 +1,52 @@
+#include "heyp/cluster-agent/child-state-table.h"
+
+#include <algorithm>
+
+namespace heyp {
+
+ChildStateTable::ChildStateTable(int num_aggs)
+    : words_per_child_(std::max(1, (num_aggs + 63) / 64)) {}
+
+void ChildStateTable::Resize(int64_t num_children) {
+  if (num_children <= size()) {
+    return;
+  }
+  lopri_bits_.resize(num_children * words_per_child_);
+  gen_seen_.resize(num_children);
+  data_epoch_.resize(num_children);
+  needs_bcast_.resize(num_children);
+}
+
+void ChildStateTable::GrowAggs(int num_aggs) {
+  const int words_per_child = (num_aggs + 63) / 64;
+  if (words_per_child <= words_per_child_) {
+    return;
+  }
+  std::vector<Atomic<uint64_t>> lopri_bits(size() * words_per_child);
+  for (int64_t child = 0; child < size(); ++child) {
+    for (int i = 0; i < words_per_child_; ++i) {
+      lopri_bits[child * words_per_child + i].v.store(
+          lopri_bits_[child * words_per_child_ + i].v.load(std::memory_order_relaxed),
+          std::memory_order_relaxed);
+    }
+  }
+  lopri_bits_ = std::move(lopri_bits);
+  words_per_child_ = words_per_child;
+}
+
+void ChildStateTable::CopyLOPRIBits(ParID child, std::vector<uint64_t>* words) const {
+  words->resize(words_per_child_);
+  for (int i = 0; i < words_per_child_; ++i) {
+    (*words)[i] =
+        lopri_bits_[child * words_per_child_ + i].v.load(std::memory_order_relaxed);
+  }
+}
+
+void ChildStateTable::SetLOPRIBits(ParID child, const uint64_t* words) {
+  for (int i = 0; i < words_per_child_; ++i) {
+    lopri_bits_[child * words_per_child_ + i].v.store(words[i],
+                                                      std::memory_order_relaxed);
+  }
+}
+
+}  // namespace heyp
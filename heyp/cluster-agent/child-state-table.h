@@ -0,0 +1,122 @@
+#ifndef HEYP_CLUSTER_AGENT_CHILD_STATE_TABLE_H_
+#define HEYP_CLUSTER_AGENT_CHILD_STATE_TABLE_H_
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+#include "heyp/threads/par-indexed-map.h"
+
+namespace heyp {
+
+// ChildStateTable holds the per-child state that FastClusterController updates on
+// every control period. It is stored as a struct of arrays indexed by ParID.
+//
+// Resize, GrowAggs, and NextEpoch must not run concurrently with anything else. All other
+// methods may be called concurrently and never block: QoS assignments are packed into
+// bitsets that are updated with atomic ops, and instead of resetting per-run flags,
+// entries are stamped with the epoch (control period) they were last written in.
+class ChildStateTable {
+ public:
+  explicit ChildStateTable(int num_aggs);
+
+  ChildStateTable(const ChildStateTable&) = delete;
+  ChildStateTable& operator=(const ChildStateTable&) = delete;
+
+  // Grows the table to hold children [0, num_children). New children are HIPRI for
+  // all aggs.
+  void Resize(int64_t num_children);
+
+  // Grows the QoS bitsets to hold aggs [0, num_aggs). New aggs are HIPRI for all
+  // children.
+  void GrowAggs(int num_aggs);
+
+  // Starts a new epoch. Children are no longer considered to have sent data.
+  void NextEpoch() { ++epoch_; }
+
+  int64_t size() const { return gen_seen_.size(); }
+  int words_per_child() const { return words_per_child_; }
+
+  void SetLOPRI(ParID child, int agg_id, bool is_lopri);
+  bool IsLOPRI(ParID child, int agg_id) const;
+
+  // Copies the QoS bitset of child into words (words_per_child() words).
+  // Bit i is set if agg i is LOPRI.
+  void CopyLOPRIBits(ParID child, std::vector<uint64_t>* words) const;
+
+  // Overwrites the QoS bitset of child with words (words_per_child() words).
+  void SetLOPRIBits(ParID child, const uint64_t* words);
+
+  // Records that child sent data with the given gen in this epoch.
+  void RecordData(ParID child, int64_t gen);
+
+  // Returns the highest gen seen from child if it sent data in this epoch, 0 otherwise.
+  int64_t GenIfSeenThisEpoch(ParID child) const;
+
+  // Marks child as needing a broadcast. Returns true if it was not already marked.
+  bool MarkForBroadcast(ParID child);
+  void ClearBroadcastMark(ParID child);
+
+ private:
+  // Copyable so that the arrays can be resized (which is never done concurrently).
+  template <typename T>
+  struct Atomic {
+    Atomic() : v(T{}) {}
+    Atomic(const Atomic& other) : v(other.v.load(std::memory_order_relaxed)) {}
+    std::atomic<T> v;
+  };
+
+  int words_per_child_;
+  uint64_t epoch_ = 1;
+
+  std::vector<Atomic<uint64_t>> lopri_bits_;  // words_per_child_ per child
+  std::vector<Atomic<int64_t>> gen_seen_;
+  std::vector<Atomic<uint64_t>> data_epoch_;
+  std::vector<Atomic<bool>> needs_bcast_;
+};
+
+// Implementation //
+
+inline void ChildStateTable::SetLOPRI(ParID child, int agg_id, bool is_lopri) {
+  std::atomic<uint64_t>& word = lopri_bits_[child * words_per_child_ + agg_id / 64].v;
+  const uint64_t bit = uint64_t{1} << (agg_id % 64);
+  if (is_lopri) {
+    word.fetch_or(bit, std::memory_order_relaxed);
+  } else {
+    word.fetch_and(~bit, std::memory_order_relaxed);
+  }
+}
+
+inline bool ChildStateTable::IsLOPRI(ParID child, int agg_id) const {
+  const uint64_t word = lopri_bits_[child * words_per_child_ + agg_id / 64].v.load(
+      std::memory_order_relaxed);
+  return (word >> (agg_id % 64)) & 1;
+}
+
+inline void ChildStateTable::RecordData(ParID child, int64_t gen) {
+  std::atomic<int64_t>& seen = gen_seen_[child].v;
+  int64_t cur = seen.load(std::memory_order_relaxed);
+  while (cur < gen &&
+         !seen.compare_exchange_weak(cur, gen, std::memory_order_relaxed)) {
+  }
+  data_epoch_[child].v.store(epoch_, std::memory_order_relaxed);
+}
+
+inline int64_t ChildStateTable::GenIfSeenThisEpoch(ParID child) const {
+  if (data_epoch_[child].v.load(std::memory_order_relaxed) != epoch_) {
+    return 0;
+  }
+  return gen_seen_[child].v.load(std::memory_order_relaxed);
+}
+
+inline bool ChildStateTable::MarkForBroadcast(ParID child) {
+  return !needs_bcast_[child].v.exchange(true, std::memory_order_relaxed);
+}
+
+inline void ChildStateTable::ClearBroadcastMark(ParID child) {
+  needs_bcast_[child].v.store(false, std::memory_order_relaxed);
+}
+
+}  // namespace heyp
+
+#endif  // HEYP_CLUSTER_AGENT_CHILD_STATE_TABLE_H_
@@ -1,12 +1,14 @@
 #include <csignal>
 #include <iostream>
 #include <string>
+#include <thread>
 
 #include "absl/flags/flag.h"
 #include "absl/status/status.h"
 #include "absl/status/statusor.h"
 #include "absl/strings/str_split.h"
 #include "absl/time/time.h"
+#include "google/protobuf/util/message_differencer.h"
 #include "grpcpp/grpcpp.h"
 #include "heyp/cli/parse.h"
 #include "heyp/cluster-agent/allocator.h"
@@ -31,14 +33,79 @@ static void InterruptHandler(int signal) {
 namespace heyp {
 namespace {
 
+// Polls limits_path and hands the controller any limits that differ from the last
+// ones it was given.
+void WatchLimits(const std::string& limits_path, absl::Duration period,
+                 proto::AllocBundle last, ClusterController* controller,
+                 spdlog::logger* logger) {
+  absl::Time next_check = absl::Now() + period;
+  while (!should_exit_flag.load()) {
+    absl::SleepFor(std::min(absl::Milliseconds(100), next_check - absl::Now()));
+    if (absl::Now() < next_check) {
+      continue;
+    }
+    next_check = absl::Now() + period;
+
+    proto::AllocBundle limits;
+    if (!ReadTextProtoFromFile(limits_path, &limits)) {
+      SPDLOG_LOGGER_WARN(logger, "failed to read limits from {}", limits_path);
+      continue;
+    }
+    if (google::protobuf::util::MessageDifferencer::Equivalent(limits, last)) {
+      continue;
+    }
+    absl::Status st = controller->UpdateClusterWideAllocs(limits);
+    if (!st.ok()) {
+      SPDLOG_LOGGER_WARN(logger, "failed to apply limits from {}: {}", limits_path, st);
+      continue;
+    }
+    SPDLOG_LOGGER_INFO(logger, "applying new limits from {}", limits_path);
+    last = std::move(limits);
+  }
+}
+
 absl::Status Run(const proto::ClusterAgentConfig& c, const proto::AllocBundle& allocs,
-                 const std::string& alloc_records_file) {
+                 const std::string& limits_path, const std::string& alloc_records_file) {
   auto control_period_or =
       ParseAbslDuration(c.server().control_period(), "control period");
   if (!control_period_or.ok()) {
     return control_period_or.status();
   }
 
+  absl::Duration limits_reload_period;
+  if (!c.limits_reload_period().empty()) {
+    if (c.controller_type() != proto::CC_FAST) {
+      return absl::InvalidArgumentError(
+          "limits_reload_period is only supported with controller_type CC_FAST");
+    }
+    auto reload_period_or =
+        ParseAbslDuration(c.limits_reload_period(), "limits reload period");
+    if (!reload_period_or.ok()) {
+      return reload_period_or.status();
+    }
+    limits_reload_period = *reload_period_or;
+  }
+
+  AdaptiveLoopConfig adaptive_config;
+  if (c.server().has_adaptive_control()) {
+    const proto::AdaptiveControlConfig& ac = c.server().adaptive_control();
+    auto min_period_or = ParseAbslDuration(ac.min_period(), "adaptive min period");
+    if (!min_period_or.ok()) {
+      return min_period_or.status();
+    }
+    auto poll_period_or = ParseAbslDuration(ac.poll_period(), "adaptive poll period");
+    if (!poll_period_or.ok()) {
+      return poll_period_or.status();
+    }
+    adaptive_config = {
+        .min_period = *min_period_or,
+        .max_period = *control_period_or,
+        .poll_period = *poll_period_or,
+        .report_frac = ac.report_frac(),
+        .on_approval_crossing = ac.on_approval_crossing(),
+    };
+  }
+
   std::unique_ptr<DemandPredictor> agg_demand_predictor;
   absl::Duration demand_time_window;
   absl::Status predictor_status = ParseDemandPredictorConfig(
@@ -67,15 +134,35 @@ absl::Status Run(const proto::ClusterAgentConfig& c, const proto::AllocBundle& a
       return cluster_alloc_or.status();
     }
     controller = std::make_shared<FullClusterController>(
-        NewHostToClusterAggregator(std::move(agg_demand_predictor), demand_time_window),
-        std::move(*cluster_alloc_or));
+        NewHostToClusterAggregator(std::move(agg_demand_predictor), demand_time_window,
+                                   c.flow_aggregator().incremental()),
+        std::move(*cluster_alloc_or),
+        FullClusterController::Config{
+            .num_threads = c.full_controller_config().num_threads(),
+            .skip_unchanged_bundles = c.full_controller_config().skip_unchanged_bundles(),
+            .rate_limit_tolerance = c.full_controller_config().rate_limit_tolerance(),
+            .refresh_after_skips = c.full_controller_config().refresh_after_skips(),
+        });
   } else if (c.controller_type() == proto::CC_FAST) {
-    controller = FastClusterController::Create(c.fast_controller_config(), allocs);
+    proto::FastClusterControllerConfig fast_config = c.fast_controller_config();
+    if (c.server().has_adaptive_control() &&
+        c.server().adaptive_control().on_approval_crossing()) {
+      fast_config.set_track_pending_usage(true);
+    }
+    controller = FastClusterController::Create(fast_config, allocs);
   } else {
     return absl::InvalidArgumentError("unknown controller type");
   }
 
   auto logger = MakeLogger("main");
+  std::unique_ptr<InfoIngester> ingester;
+  if (c.server().num_ingest_workers() > 0) {
+    ingester = std::make_unique<InfoIngester>(
+        controller, InfoIngester::Config{
+                        .num_workers = c.server().num_ingest_workers(),
+                        .queue_capacity = c.server().ingest_queue_capacity(),
+                    });
+  }
   std::vector<std::unique_ptr<ClusterAgentService>> services;
   std::vector<std::unique_ptr<grpc::Server>> servers;
   services.reserve(c.server().addresses_size());
@@ -88,7 +175,7 @@ absl::Status Run(const proto::ClusterAgentConfig& c, const proto::AllocBundle& a
           &logger, "failed to parse port in {}: service ids may not be useful", address);
     }
 
-    auto service = std::make_unique<ClusterAgentService>(controller, id);
+    auto service = std::make_unique<ClusterAgentService>(controller, id, ingester.get());
     servers.push_back(grpc::ServerBuilder()
                           .AddListeningPort(address, grpc::InsecureServerCredentials())
                           .RegisterService(service.get())
@@ -97,8 +184,23 @@ absl::Status Run(const proto::ClusterAgentConfig& c, const proto::AllocBundle& a
     SPDLOG_LOGGER_INFO(&logger, "Server listening on {}", address);
   }
 
+  std::thread limits_watcher;
+  if (!c.limits_reload_period().empty()) {
+    limits_watcher = std::thread(WatchLimits, limits_path, limits_reload_period, allocs,
+                                 controller.get(), &logger);
+    SetThreadName(limits_watcher.native_handle(), "limits-watch");
+  }
+
   SetCurThreadName("ctl-loop");
-  RunLoop(controller, *control_period_or, &should_exit_flag, &logger);
+  if (c.server().has_adaptive_control()) {
+    RunAdaptiveLoop(controller, adaptive_config, &should_exit_flag, &logger,
+                    ingester.get());
+  } else {
+    RunLoop(controller, *control_period_or, &should_exit_flag, &logger, ingester.get());
+  }
+  if (limits_watcher.joinable()) {
+    limits_watcher.join();
+  }
   if (alloc_recorder != nullptr) {
     alloc_recorder->Close().IgnoreError();
   }
@@ -136,7 +238,8 @@ int main(int argc, char** argv) {
     return 2;
   }
 
-  absl::Status s = heyp::Run(config, limits, absl::GetFlag(FLAGS_alloc_logs));
+  absl::Status s =
+      heyp::Run(config, limits, std::string(argv[2]), absl::GetFlag(FLAGS_alloc_logs));
   if (!s.ok()) {
     std::cerr << "failed to run: " << s << "\n";
     return 3;
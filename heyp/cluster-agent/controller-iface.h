@@ -4,7 +4,10 @@
 #include <chrono>
 #include <cstdint>
 #include <functional>
+#include <memory>
 
+#include "absl/status/status.h"
+#include "heyp/cluster-agent/encoded-bundle.h"
 #include "heyp/proto/heyp.pb.h"
 #include "heyp/threads/par-indexed-map.h"
 
@@ -14,16 +17,46 @@ struct SendBundleAux {
   std::chrono::time_point<std::chrono::steady_clock> compute_start;
 };
 
+// Summarizes the information that arrived since the last ComputeAndBroadcast.
+struct NewInfoSummary {
+  // Fraction of hosts that reported. Controllers that count reports rather than
+  // distinct hosts may exceed 1 if hosts report more often than ComputeAndBroadcast
+  // runs.
+  double frac_hosts_reported = 0;
+
+  // Number of FGs whose estimated usage has crossed their approval (in either
+  // direction) since the last ComputeAndBroadcast.
+  int num_fgs_crossed_approval = 0;
+};
+
 using OnNewBundleFunc =
     std::function<void(const proto::AllocBundle&, const SendBundleAux&)>;
+using OnNewEncodedBundleFunc =
+    std::function<void(const EncodedAllocBundle&, const SendBundleAux&)>;
 
 class ClusterController {
  public:
   virtual ~ClusterController() = default;
 
   virtual void UpdateInfo(ParID bundler_id, const proto::InfoBundle& info) = 0;
+
+  // Ingests usage that an aggregator-agent summarized for the hosts behind it.
+  // Allocations for those hosts are still sent through per-host listeners.
+  virtual absl::Status UpdateAggregatedInfo(const proto::AggregatedInfoBundle& info) {
+    return absl::UnimplementedError("controller does not support aggregator-agents");
+  }
   virtual void ComputeAndBroadcast() = 0;
 
+  // Replaces the cluster-wide approvals without dropping host streams.
+  virtual absl::Status UpdateClusterWideAllocs(
+      const proto::AllocBundle& cluster_wide_allocs) {
+    return absl::UnimplementedError("controller does not support changing approvals");
+  }
+
+  // Used to run ComputeAndBroadcast early when enough has changed. Must be cheap
+  // enough to poll and thread-safe. By default, nothing is reported.
+  virtual NewInfoSummary SummarizeNewInfo() { return {}; }
+
   class Listener {
    public:
     virtual ~Listener() = default;
@@ -33,6 +66,20 @@ class ClusterController {
   virtual std::unique_ptr<Listener> RegisterListener(
       uint64_t host_id, const OnNewBundleFunc& on_new_bundle_func) = 0;
 
+  // Like RegisterListener, but bundles are handed over already serialized.
+  //
+  // Controllers that send identical bundles to many hosts should override this to
+  // serialize each distinct bundle once. By default, every bundle is serialized
+  // separately.
+  virtual std::unique_ptr<Listener> RegisterEncodedListener(
+      uint64_t host_id, const OnNewEncodedBundleFunc& on_new_bundle_func) {
+    return RegisterListener(
+        host_id, [on_new_bundle_func](const proto::AllocBundle& bundle,
+                                      const SendBundleAux& aux) {
+          on_new_bundle_func(EncodedAllocBundle::FromProto(bundle), aux);
+        });
+  }
+
   virtual ParID GetBundlerID(const proto::FlowMarker& bundler) = 0;
 };
 
@@ -0,0 +1,166 @@
+#include "heyp/cluster-agent/encoded-bundle.h"
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "heyp/host-agent/alloc-merger.h"
+#include "heyp/proto/parse-text.h"
+#include "heyp/proto/testing.h"
+
+namespace heyp {
+namespace {
+
+TEST(EncodedAllocBundleTest, FromProto) {
+  auto bundle = ParseTextProto<proto::AllocBundle>(R"(
+    flow_allocs {
+      flow { src_dc: "chicago" dst_dc: "new_york" }
+      hipri_rate_limit_bps: 1000
+    }
+    gen: 5
+  )");
+  EncodedAllocBundle encoded = EncodedAllocBundle::FromProto(bundle);
+  EXPECT_EQ(encoded.ByteSize(), bundle.ByteSizeLong());
+
+  proto::AllocBundle got;
+  ASSERT_TRUE(encoded.ParseTo(&got));
+  EXPECT_THAT(got, EqProto(bundle));
+}
+
+TEST(EncodedAllocBundleTest, ChunksAndGen) {
+  auto allocs = ParseTextProto<proto::AllocBundle>(R"(
+    flow_allocs {
+      flow { src_dc: "chicago" dst_dc: "new_york" }
+      lopri_rate_limit_bps: 1000
+    }
+  )");
+  auto dict = ParseTextProto<proto::AllocBundle>(R"(
+    fg_dictionary {
+      flow { src_dc: "chicago" dst_dc: "new_york" }
+      id: 1
+    }
+  )");
+  EncodedAllocBundle::Chunk allocs_chunk = EncodedAllocBundle::MakeChunk(allocs);
+  EncodedAllocBundle::Chunk dict_chunk = EncodedAllocBundle::MakeChunk(dict);
+
+  for (int64_t gen : {0L, 1L, 300L, -1L}) {
+    EncodedAllocBundle encoded;
+    encoded.AddChunk(allocs_chunk);
+    encoded.AddChunk(dict_chunk);
+    encoded.SetGen(gen);
+    encoded.SetSeq(gen + 2, gen + 1);
+
+    proto::AllocBundle want = allocs;
+    want.MergeFrom(dict);
+    want.set_gen(gen);
+    want.set_seq(gen + 2);
+    want.set_delta_base_seq(gen + 1);
+
+    proto::AllocBundle got;
+    ASSERT_TRUE(encoded.ParseTo(&got));
+    EXPECT_THAT(got, EqProto(want)) << "gen = " << gen;
+    EXPECT_EQ(encoded.ByteSize(), want.ByteSizeLong()) << "gen = " << gen;
+  }
+}
+
+TEST(EncodedAllocBundleTest, FromSerialized) {
+  auto bundle = ParseTextProto<proto::AllocBundle>(R"(
+    flow_allocs {
+      flow { src_dc: "chicago" dst_dc: "new_york" }
+      hipri_rate_limit_bps: 1000
+    }
+    fg_dictionary {
+      flow { src_dc: "chicago" dst_dc: "new_york" }
+      id: 1
+    }
+    gen: -3
+    seq: 7
+    delta_base_seq: 6
+  )");
+  EncodedAllocBundle encoded =
+      EncodedAllocBundle::FromSerialized(bundle.SerializeAsString());
+  EXPECT_EQ(encoded.gen(), -3);
+  EXPECT_EQ(encoded.seq(), 7);
+  EXPECT_EQ(encoded.delta_base_seq(), 6);
+  EXPECT_TRUE(encoded.is_delta());
+
+  proto::AllocBundle got;
+  ASSERT_TRUE(encoded.ParseTo(&got));
+  EXPECT_THAT(got, EqProto(bundle));
+}
+
+EncodedAllocBundle Delta(const char* allocs, int64_t gen, uint64_t seq,
+                         uint64_t delta_base_seq) {
+  EncodedAllocBundle encoded;
+  encoded.AddChunk(EncodedAllocBundle::MakeChunk(ParseTextProto<proto::AllocBundle>(allocs)));
+  encoded.SetGen(gen);
+  encoded.SetSeq(seq, delta_base_seq);
+  return encoded;
+}
+
+TEST(StageAllocBundleTest, MergesDeltasAndReplacesOnFull) {
+  auto full = ParseTextProto<proto::AllocBundle>(R"(
+    flow_allocs {
+      flow { src_dc: "chicago" dst_dc: "new_york" }
+      hipri_rate_limit_bps: 100
+    }
+    flow_allocs {
+      flow { src_dc: "chicago" dst_dc: "detroit" }
+      hipri_rate_limit_bps: 100
+    }
+    gen: 1
+    seq: 1
+  )");
+  std::vector<EncodedAllocBundle> staged;
+  StageAllocBundle(EncodedAllocBundle::FromProto(full), &staged);
+  StageAllocBundle(Delta(R"(flow_allocs {
+                              flow { src_dc: "chicago" dst_dc: "new_york" }
+                              lopri_rate_limit_bps: 100
+                            })",
+                         2, 2, 1),
+                   &staged);
+  StageAllocBundle(Delta(R"(flow_allocs {
+                              flow { src_dc: "chicago" dst_dc: "detroit" }
+                              lopri_rate_limit_bps: 100
+                            })",
+                         3, 3, 2),
+                   &staged);
+  StageAllocBundle(Delta(R"(flow_allocs {
+                              flow { src_dc: "chicago" dst_dc: "new_york" }
+                              hipri_rate_limit_bps: 100
+                            })",
+                         4, 4, 3),
+                   &staged);
+  ASSERT_EQ(staged.size(), 2);
+  EXPECT_FALSE(staged[0].is_delta());
+  EXPECT_EQ(staged[1].seq(), 4);
+  EXPECT_EQ(staged[1].delta_base_seq(), 1);
+  EXPECT_EQ(staged[1].gen(), 4);
+
+  // The host ends up where it would have been had it seen every delta.
+  AllocMerger merger;
+  proto::AllocBundle got;
+  for (const EncodedAllocBundle& e : staged) {
+    ASSERT_TRUE(e.ParseTo(&got));
+    ASSERT_TRUE(merger.Apply(&got));
+  }
+  EXPECT_THAT(got, EqProto(ParseTextProto<proto::AllocBundle>(R"(
+                flow_allocs {
+                  flow { src_dc: "chicago" dst_dc: "new_york" }
+                  hipri_rate_limit_bps: 100
+                }
+                flow_allocs {
+                  flow { src_dc: "chicago" dst_dc: "detroit" }
+                  lopri_rate_limit_bps: 100
+                }
+                gen: 4
+                seq: 4
+              )")));
+
+  // A full bundle makes the staged ones moot.
+  full.set_seq(5);
+  StageAllocBundle(EncodedAllocBundle::FromProto(full), &staged);
+  ASSERT_EQ(staged.size(), 1);
+  EXPECT_EQ(staged[0].seq(), 5);
+}
+
+}  // namespace
+}  // namespace heyp
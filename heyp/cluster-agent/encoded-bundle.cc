@@ -0,0 +1,130 @@
+#include "heyp/cluster-agent/encoded-bundle.h"
+
+#include "google/protobuf/io/coded_stream.h"
+#include "google/protobuf/wire_format_lite.h"
+#include "heyp/log/spdlog.h"
+
+namespace heyp {
+
+EncodedAllocBundle::Chunk EncodedAllocBundle::MakeChunk(
+    const proto::AllocBundle& bundle) {
+  return std::make_shared<const std::string>(bundle.SerializeAsString());
+}
+
+EncodedAllocBundle EncodedAllocBundle::FromProto(const proto::AllocBundle& bundle) {
+  EncodedAllocBundle encoded;
+  encoded.AddChunk(MakeChunk(bundle));
+  encoded.gen_ = bundle.gen();
+  encoded.seq_ = bundle.seq();
+  encoded.delta_base_seq_ = bundle.delta_base_seq();
+  return encoded;
+}
+
+EncodedAllocBundle EncodedAllocBundle::FromSerialized(std::string serialized) {
+  using google::protobuf::internal::WireFormatLite;
+
+  EncodedAllocBundle encoded;
+  google::protobuf::io::CodedInputStream in(
+      reinterpret_cast<const uint8_t*>(serialized.data()), serialized.size());
+  while (uint32_t tag = in.ReadTag()) {
+    uint64_t value = 0;
+    if (WireFormatLite::GetTagWireType(tag) != WireFormatLite::WIRETYPE_VARINT) {
+      if (!WireFormatLite::SkipField(&in, tag)) {
+        break;
+      }
+      continue;
+    }
+    if (!in.ReadVarint64(&value)) {
+      break;
+    }
+    // Like the parser, take the last value of each field.
+    switch (WireFormatLite::GetTagFieldNumber(tag)) {
+      case proto::AllocBundle::kGenFieldNumber:
+        encoded.gen_ = static_cast<int64_t>(value);
+        break;
+      case proto::AllocBundle::kSeqFieldNumber:
+        encoded.seq_ = value;
+        break;
+      case proto::AllocBundle::kDeltaBaseSeqFieldNumber:
+        encoded.delta_base_seq_ = value;
+        break;
+    }
+  }
+  encoded.AddChunk(std::make_shared<const std::string>(std::move(serialized)));
+  return encoded;
+}
+
+void EncodedAllocBundle::AppendTail(int field_number, uint64_t value) {
+  if (value == 0) {
+    return;  // proto3 omits default values
+  }
+  // Each field takes at most 1 byte of tag + a 10-byte varint.
+  H_ASSERT_LE(tail_len_ + 11, sizeof(tail_buf_));
+  uint8_t* start = reinterpret_cast<uint8_t*>(tail_buf_) + tail_len_;
+  uint8_t* end = google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(
+      field_number, value, start);
+  tail_len_ += end - start;
+}
+
+void EncodedAllocBundle::SetGen(int64_t gen) {
+  gen_ = gen;
+  // int64 and uint64 share the same varint encoding.
+  AppendTail(proto::AllocBundle::kGenFieldNumber, static_cast<uint64_t>(gen));
+}
+
+void EncodedAllocBundle::SetSeq(uint64_t seq, uint64_t delta_base_seq) {
+  seq_ = seq;
+  delta_base_seq_ = delta_base_seq;
+  AppendTail(proto::AllocBundle::kSeqFieldNumber, seq);
+  AppendTail(proto::AllocBundle::kDeltaBaseSeqFieldNumber, delta_base_seq);
+}
+
+void EncodedAllocBundle::MergeDelta(const EncodedAllocBundle& next) {
+  H_ASSERT(is_delta());
+  H_ASSERT(next.is_delta());
+  H_ASSERT_EQ(next.delta_base_seq_, seq_);
+
+  // next's allocs come after ours, so the host's AllocMerger lets them win. The new
+  // tail goes after all chunks, so it overrides any scalars inside them.
+  const int64_t gen = next.gen_ != 0 ? next.gen_ : gen_;
+  const uint64_t base = delta_base_seq_;
+  chunks_.insert(chunks_.end(), next.chunks_.begin(), next.chunks_.end());
+  tail_len_ = 0;
+  SetGen(gen);
+  SetSeq(next.seq_, base);
+}
+
+size_t EncodedAllocBundle::ByteSize() const {
+  size_t size = tail_len_;
+  for (const Chunk& c : chunks_) {
+    size += c->size();
+  }
+  return size;
+}
+
+bool EncodedAllocBundle::ParseTo(proto::AllocBundle* bundle) const {
+  std::string buf;
+  buf.reserve(ByteSize());
+  for (const Chunk& c : chunks_) {
+    buf.append(*c);
+  }
+  buf.append(tail_bytes().data(), tail_bytes().size());
+  return bundle->ParseFromString(buf);
+}
+
+void StageAllocBundle(const EncodedAllocBundle& alloc,
+                      std::vector<EncodedAllocBundle>* staged) {
+  if (!alloc.is_delta()) {
+    staged->clear();
+    staged->push_back(alloc);
+    return;
+  }
+  if (!staged->empty() && staged->back().is_delta() &&
+      staged->back().seq() == alloc.delta_base_seq()) {
+    staged->back().MergeDelta(alloc);
+    return;
+  }
+  staged->push_back(alloc);
+}
+
+}  // namespace heyp
@@ -0,0 +1,80 @@
+#ifndef HEYP_CLUSTER_AGENT_ENCODED_BUNDLE_H_
+#define HEYP_CLUSTER_AGENT_ENCODED_BUNDLE_H_
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "absl/container/inlined_vector.h"
+#include "absl/strings/string_view.h"
+#include "heyp/proto/heyp.pb.h"
+
+namespace heyp {
+
+// EncodedAllocBundle is a serialized proto::AllocBundle made of shared, immutable
+// chunks followed by a tail of per-host scalar fields (gen, seq, ...).
+//
+// The protobuf wire format lets fields appear in any order and repeated fields be
+// split, so the concatenation of chunks() and tail_bytes() is a valid AllocBundle.
+// This lets a controller serialize a bundle body once and send it to many hosts.
+class EncodedAllocBundle {
+ public:
+  using Chunk = std::shared_ptr<const std::string>;
+
+  // Serializes a (possibly partial) bundle into a chunk.
+  static Chunk MakeChunk(const proto::AllocBundle& bundle);
+
+  // Returns an EncodedAllocBundle with a single chunk that holds all of bundle.
+  static EncodedAllocBundle FromProto(const proto::AllocBundle& bundle);
+
+  // Like FromProto, but for an already serialized AllocBundle. Only the top-level
+  // scalar fields are decoded.
+  static EncodedAllocBundle FromSerialized(std::string serialized);
+
+  void AddChunk(Chunk chunk) { chunks_.push_back(std::move(chunk)); }
+
+  // Each of these should be called at most once and only if none of the chunks
+  // contain the field(s).
+  void SetGen(int64_t gen);
+  void SetSeq(uint64_t seq, uint64_t delta_base_seq);
+
+  int64_t gen() const { return gen_; }
+  uint64_t seq() const { return seq_; }
+  uint64_t delta_base_seq() const { return delta_base_seq_; }
+  bool is_delta() const { return delta_base_seq_ != 0; }
+
+  // Folds next, a delta on top of this delta, into this bundle. A host that applies
+  // the result ends up with the same allocations, seq and gen as one that applied
+  // this bundle and then next.
+  void MergeDelta(const EncodedAllocBundle& next);
+
+  const absl::InlinedVector<Chunk, 2>& chunks() const { return chunks_; }
+  absl::string_view tail_bytes() const { return absl::string_view(tail_buf_, tail_len_); }
+
+  size_t ByteSize() const;
+
+  bool ParseTo(proto::AllocBundle* bundle) const;
+
+ private:
+  void AppendTail(int field_number, uint64_t value);
+
+  absl::InlinedVector<Chunk, 2> chunks_;
+  int64_t gen_ = 0;
+  uint64_t seq_ = 0;
+  uint64_t delta_base_seq_ = 0;
+  char tail_buf_[48];
+  uint8_t tail_len_ = 0;
+};
+
+// Queues alloc to be sent to a host after the bundles in staged, for senders that
+// cannot keep up. Only the latest allocations need to reach the host, so a full
+// bundle replaces everything staged. But a host can only apply a delta on top of
+// the bundle it was computed against, so a delta is merged into a staged delta
+// instead of replacing it. This leaves at most a full bundle followed by a delta.
+void StageAllocBundle(const EncodedAllocBundle& alloc,
+                      std::vector<EncodedAllocBundle>* staged);
+
+}  // namespace heyp
+
+#endif  // HEYP_CLUSTER_AGENT_ENCODED_BUNDLE_H_
@@ -0,0 +1,141 @@
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <string>
+
+#include "absl/strings/str_cat.h"
+#include "benchmark/benchmark.h"
+#include "heyp/cluster-agent/fast-aggregator.h"
+#include "heyp/proto/heyp.pb.h"
+#include "heyp/proto/pooled-arena.h"
+
+// Count every heap allocation made by this binary.
+
+static std::atomic<int64_t> num_allocs(0);
+
+void* operator new(size_t size) {
+  num_allocs.fetch_add(1, std::memory_order_relaxed);
+  void* p = std::malloc(size == 0 ? 1 : size);
+  if (p == nullptr) {
+    throw std::bad_alloc();
+  }
+  return p;
+}
+
+void* operator new[](size_t size) { return operator new(size); }
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete[](void* p) noexcept { std::free(p); }
+void operator delete(void* p, size_t) noexcept { std::free(p); }
+void operator delete[](void* p, size_t) noexcept { std::free(p); }
+
+namespace heyp {
+namespace {
+
+constexpr int kNumAggFGs = 16;
+constexpr int kDrainEvery = 1000;
+
+proto::FlowMarker AggFlow(int i) {
+  proto::FlowMarker flow;
+  flow.set_src_dc("us-east");
+  flow.set_dst_dc(absl::StrCat("us-west-", i));
+  return flow;
+}
+
+struct Fixture {
+  Fixture() {
+    for (int i = 0; i < kNumAggFGs; ++i) {
+      agg_flow_to_id[AggFlow(i)] = i;
+      samplers.push_back(ThresholdSampler(200, 1'000'000'000));
+      selectors.push_back(HashingDowngradeSelector());
+    }
+    aggregator = std::make_unique<FastAggregator>(
+        &agg_flow_to_id, samplers,
+        FastAggregator::Config{.num_shards = 1, .shard_capacity = 1 << 20});
+
+    proto::InfoBundle bundle;
+    bundle.mutable_bundler()->set_host_id(12345);
+    bundle.set_gen(1);
+    for (int i = 0; i < kNumAggFGs; ++i) {
+      proto::FlowInfo* fi = bundle.add_flow_infos();
+      *fi->mutable_flow() = AggFlow(i);
+      fi->mutable_flow()->set_job("some-job-name");
+      fi->mutable_flow()->set_host_id(12345);
+      fi->set_ewma_usage_bps(1000 * (i + 1));
+    }
+    bundle.SerializeToString(&wire);
+  }
+
+  ClusterFlowMap<int64_t> agg_flow_to_id;
+  std::vector<ThresholdSampler> samplers;
+  std::vector<HashingDowngradeSelector> selectors;
+  std::unique_ptr<FastAggregator> aggregator;
+  WorkStealingExecutor exec{1};
+  std::string wire;
+};
+
+// RunIngest times decode + UpdateInfo and reports the number of heap allocations
+// per bundle. Snapshots are taken periodically (off the clock and not counted) to
+// keep the shard from filling.
+template <typename DecodeFunc>
+void RunIngest(benchmark::State& state, Fixture& f, DecodeFunc decode) {
+  // Warm up thread-local state and reused messages.
+  for (int i = 0; i < 10; ++i) {
+    f.aggregator->UpdateInfo(decode(f.wire));
+  }
+
+  int64_t allocs = 0;
+  int64_t n = 0;
+  for (auto _ : state) {
+    const int64_t before = num_allocs.load(std::memory_order_relaxed);
+    f.aggregator->UpdateInfo(decode(f.wire));
+    allocs += num_allocs.load(std::memory_order_relaxed) - before;
+
+    if (++n % kDrainEvery == 0) {
+      state.PauseTiming();
+      benchmark::DoNotOptimize(f.aggregator->CollectSnapshot(&f.exec, f.selectors));
+      state.ResumeTiming();
+    }
+  }
+  state.counters["allocs_per_bundle"] =
+      benchmark::Counter(allocs, benchmark::Counter::kAvgIterations);
+}
+
+// Decodes every bundle into a new message.
+static void BM_Ingest_FreshBundle(benchmark::State& state) {
+  Fixture f;
+  proto::InfoBundle bundle;
+  RunIngest(state, f, [&bundle](const std::string& wire) -> const proto::InfoBundle& {
+    bundle = proto::InfoBundle();
+    bundle.ParseFromString(wire);
+    return bundle;
+  });
+}
+
+// Decodes every bundle into the same heap message. Clearing keeps the capacity of
+// repeated fields but still frees submessages.
+static void BM_Ingest_ReusedBundle(benchmark::State& state) {
+  Fixture f;
+  proto::InfoBundle bundle;
+  RunIngest(state, f, [&bundle](const std::string& wire) -> const proto::InfoBundle& {
+    bundle.ParseFromString(wire);
+    return bundle;
+  });
+}
+
+// Decodes every bundle into a message on a pooled arena that is reset between
+// bundles, like HostReactor does.
+static void BM_Ingest_ArenaBundle(benchmark::State& state) {
+  Fixture f;
+  ReusableArenaMessage<proto::InfoBundle> bundle;
+  RunIngest(state, f, [&bundle](const std::string& wire) -> const proto::InfoBundle& {
+    bundle.Reset()->ParseFromString(wire);
+    return *bundle;
+  });
+}
+
+BENCHMARK(BM_Ingest_FreshBundle);
+BENCHMARK(BM_Ingest_ReusedBundle);
+BENCHMARK(BM_Ingest_ArenaBundle);
+
+}  // namespace
+}  // namespace heyp
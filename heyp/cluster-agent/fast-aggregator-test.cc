@@ -69,7 +69,7 @@ TEST(FastAggregatorTest, NoSamplingOneFG) {
     }
   )"));
 
-  Executor exec(4);
+  WorkStealingExecutor exec(4);
   std::vector<FastAggInfo> agg_info =
       aggregator.CollectSnapshot(&exec, TestDowngradeSelectors());
 
@@ -129,7 +129,7 @@ TEST(FastAggregatorTest, NoSamplingMultiFG) {
     }
   )"));
 
-  Executor exec(4);
+  WorkStealingExecutor exec(4);
   std::vector<FastAggInfo> agg_info =
       aggregator.CollectSnapshot(&exec, TestDowngradeSelectors());
 
@@ -163,6 +163,142 @@ TEST(FastAggregatorTest, NoSamplingMultiFG) {
                   .child_id = 999, .volume_bps = 202, .currently_lopri = false}));
 }
 
+TEST(FastAggregatorTest, HostGensSharedByAllFGs) {
+  const ClusterFlowMap<int64_t> agg_flow_to_id = TestAggFlowToIdMap();
+
+  FastAggregator aggregator(&agg_flow_to_id, TestSamplers(100, 0, 0, 0),
+                            FastAggregator::Config{.num_shards = 3});
+  aggregator.UpdateInfo(ParseTextProto<proto::InfoBundle>(R"(
+    bundler { host_id: 101 }
+    gen: 5
+    flow_infos {
+      flow { src_dc: "A" dst_dc: "B-1" job: "web" host_id: 101 }
+      ewma_usage_bps: 100
+    }
+  )"));
+  aggregator.UpdateInfo(ParseTextProto<proto::InfoBundle>(R"(
+    bundler { host_id: 999 }
+    gen: 7
+  )"));
+  aggregator.UpdateInfo(ParseTextProto<proto::InfoBundle>(R"(
+    bundler { host_id: 44 }
+    gen: 2
+    flow_infos {
+      flow { src_dc: "A" dst_dc: "B-0" job: "web" host_id: 44 }
+      ewma_usage_bps: 50
+    }
+  )"));
+
+  WorkStealingExecutor exec(2);
+  std::vector<FastAggInfo> agg_info =
+      aggregator.CollectSnapshot(&exec, TestDowngradeSelectors());
+  ASSERT_EQ(agg_info.size(), 3);
+
+  std::vector<std::pair<uint64_t, int64_t>> gens;
+  for (const FastAggInfo::HostInfoGen& hg : agg_info[0].info_gen()) {
+    gens.push_back({hg.host_id, hg.gen});
+  }
+  EXPECT_THAT(gens, testing::UnorderedElementsAre(testing::Pair(101, 5),
+                                                  testing::Pair(999, 7),
+                                                  testing::Pair(44, 2)));
+  EXPECT_EQ(&agg_info[1].info_gen(), &agg_info[0].info_gen());
+  EXPECT_EQ(&agg_info[2].info_gen(), &agg_info[0].info_gen());
+
+  agg_info = aggregator.CollectSnapshot(&exec, TestDowngradeSelectors());
+  EXPECT_THAT(agg_info[0].info_gen(), testing::IsEmpty());
+}
+
+TEST(FastAggregatorTest, AddsAggregatedInfo) {
+  const ClusterFlowMap<int64_t> agg_flow_to_id = TestAggFlowToIdMap();
+
+  // Sampling is on so that counting the presampled children again would show.
+  FastAggregator aggregator(&agg_flow_to_id, TestSamplers(1, 1000, 1000, 1000),
+                            FastAggregator::Config{.num_shards = 2});
+  aggregator.UpdateInfo(ParseTextProto<proto::InfoBundle>(R"(
+    bundler { host_id: 101 }
+    gen: 4
+    flow_infos {
+      flow { src_dc: "A" dst_dc: "B-1" job: "web" host_id: 101 }
+      ewma_usage_bps: 5000
+    }
+  )"));
+  aggregator.UpdateAggregatedInfo(ParseTextProto<proto::AggregatedInfoBundle>(R"(
+    aggregator { host_id: 1 }
+    gen: 1
+    fg_infos {
+      flow { src_dc: "A" dst_dc: "B-1" }
+      hipri_usage_bps: 700
+      lopri_usage_bps: 300
+      sampled_children { host_id: 7 ewma_usage_bps: 600 }
+      sampled_children { host_id: 8 ewma_usage_bps: 300 currently_lopri: true }
+    }
+    fg_infos {
+      flow { src_dc: "A" dst_dc: "unknown" }
+      hipri_usage_bps: 1
+    }
+    host_gens { host_id: 7 gen: 3 }
+    host_gens { host_id: 8 gen: 9 }
+    host_gens { host_id: 9 gen: 1 }
+  )"));
+
+  WorkStealingExecutor exec(2);
+  std::vector<FastAggInfo> agg_info =
+      aggregator.CollectSnapshot(&exec, TestDowngradeSelectors());
+  ASSERT_EQ(agg_info.size(), 3);
+
+  EXPECT_EQ(agg_info[1].parent().ewma_usage_bps(), 6000);
+  EXPECT_EQ(agg_info[1].parent().ewma_hipri_usage_bps(), 5700);
+  EXPECT_EQ(agg_info[1].parent().ewma_lopri_usage_bps(), 300);
+  EXPECT_THAT(
+      agg_info[1].children(),
+      testing::UnorderedElementsAre(
+          ChildFlowInfo{.child_id = 101, .volume_bps = 5000, .currently_lopri = false},
+          ChildFlowInfo{.child_id = 7, .volume_bps = 600, .currently_lopri = false},
+          ChildFlowInfo{.child_id = 8, .volume_bps = 300, .currently_lopri = true}));
+
+  std::vector<std::pair<uint64_t, int64_t>> gens;
+  for (const FastAggInfo::HostInfoGen& hg : agg_info[0].info_gen()) {
+    gens.push_back({hg.host_id, hg.gen});
+  }
+  EXPECT_THAT(gens, testing::UnorderedElementsAre(
+                        testing::Pair(101, 4), testing::Pair(7, 3),
+                        testing::Pair(8, 9), testing::Pair(9, 1)));
+}
+
+TEST(FastAggregatorTest, SpreadsAggregatedInfoOverShards) {
+  const ClusterFlowMap<int64_t> agg_flow_to_id = TestAggFlowToIdMap();
+
+  // No one shard has room for all of the aggregator's hosts.
+  FastAggregator aggregator(&agg_flow_to_id, TestSamplers(100, 0, 0, 0),
+                            FastAggregator::Config{
+                                .num_shards = 4,
+                                .shard_capacity = 4,
+                            });
+  proto::AggregatedInfoBundle info;
+  info.mutable_aggregator()->set_host_id(1);
+  proto::AggregatedFGInfo* fg = info.add_fg_infos();
+  fg->mutable_flow()->set_src_dc("A");
+  fg->mutable_flow()->set_dst_dc("B-1");
+  for (int i = 0; i < 12; ++i) {
+    fg->set_hipri_usage_bps(fg->hipri_usage_bps() + 10);
+    proto::AggregatedFGInfo::Child* c = fg->add_sampled_children();
+    c->set_host_id(i);
+    c->set_ewma_usage_bps(10);
+    proto::HostGen* hg = info.add_host_gens();
+    hg->set_host_id(i);
+    hg->set_gen(1);
+  }
+  aggregator.UpdateAggregatedInfo(info);
+  EXPECT_EQ(aggregator.num_dropped_infos(), 0);
+
+  WorkStealingExecutor exec(2);
+  std::vector<FastAggInfo> agg_info =
+      aggregator.CollectSnapshot(&exec, TestDowngradeSelectors());
+  EXPECT_EQ(agg_info[1].parent().ewma_usage_bps(), 120);
+  EXPECT_EQ(agg_info[1].children().size(), 12);
+  EXPECT_EQ(agg_info[1].info_gen().size(), 12);
+}
+
 TEST(FastAggregatorTest, WithSamplingOneFG) {
   const ClusterFlowMap<int64_t> agg_flow_to_id = TestAggFlowToIdMap();
 
@@ -198,7 +334,7 @@ TEST(FastAggregatorTest, WithSamplingOneFG) {
     }
   )"));
 
-  Executor exec(4);
+  WorkStealingExecutor exec(4);
   std::vector<FastAggInfo> agg_info =
       aggregator.CollectSnapshot(&exec, TestDowngradeSelectors());
 
@@ -273,7 +409,7 @@ TEST(FastAggregatorTest, WithSamplingOneFG_CollectMulti) {
   aggregator.UpdateInfo(info3);
   aggregator.UpdateInfo(info4);
 
-  Executor exec(4);
+  WorkStealingExecutor exec(4);
   std::vector<FastAggInfo> agg_info =
       aggregator.CollectSnapshot(&exec, TestDowngradeSelectors());
 
@@ -367,5 +503,211 @@ TEST(FastAggregatorTest, WithSamplingOneFG_CollectMulti) {
   EXPECT_THAT(agg_info[2].children(), testing::IsEmpty());
 }
 
+TEST(FastAggregatorTest, RoutesByFGId) {
+  const ClusterFlowMap<int64_t> agg_flow_to_id = TestAggFlowToIdMap();
+
+  FastAggregator aggregator(&agg_flow_to_id, TestSamplers(100, 0, 0, 0));
+  // Tagged infos are routed by fg_id (= agg_id + 1) if the id names the same DCs.
+  // Otherwise the id is from an old dictionary and the DCs are used instead.
+  aggregator.UpdateInfo(ParseTextProto<proto::InfoBundle>(R"(
+    bundler { host_id: 101 }
+    flow_infos {
+      flow { src_dc: "A" dst_dc: "B-2" job: "web" host_id: 101 }
+      ewma_usage_bps: 100
+      fg_id: 3
+    }
+    flow_infos {
+      flow { src_dc: "A" dst_dc: "B-1" job: "web" host_id: 101 }
+      ewma_usage_bps: 200
+    }
+    flow_infos {
+      flow { src_dc: "A" dst_dc: "B-1" job: "web" host_id: 101 }
+      ewma_usage_bps: 50
+      fg_id: 1
+    }
+  )"));
+
+  WorkStealingExecutor exec(2);
+  std::vector<FastAggInfo> agg_info =
+      aggregator.CollectSnapshot(&exec, TestDowngradeSelectors());
+  EXPECT_EQ(agg_info[0].parent().ewma_usage_bps(), 0);
+  EXPECT_EQ(agg_info[1].parent().ewma_usage_bps(), 250);
+  EXPECT_EQ(agg_info[2].parent().ewma_usage_bps(), 100);
+}
+
+TEST(FastAggregatorTest, DropsWhenShardFull) {
+  const ClusterFlowMap<int64_t> agg_flow_to_id = TestAggFlowToIdMap();
+
+  FastAggregator aggregator(&agg_flow_to_id, TestSamplers(100, 0, 0, 0),
+                            FastAggregator::Config{
+                                .num_shards = 1,
+                                .shard_capacity = 2,
+                            });
+  EXPECT_EQ(aggregator.num_shards(), 1);
+
+  proto::InfoBundle info = ParseTextProto<proto::InfoBundle>(R"(
+    bundler { host_id: 101 }
+    flow_infos {
+      flow { src_dc: "A" dst_dc: "B-1" job: "web" host_id: 101 }
+      ewma_usage_bps: 100
+    }
+  )");
+  aggregator.UpdateInfo(info);
+  aggregator.UpdateInfo(info);
+  aggregator.UpdateInfo(info);
+  EXPECT_EQ(aggregator.num_dropped_infos(), 2);
+
+  WorkStealingExecutor exec(2);
+  std::vector<FastAggInfo> agg_info =
+      aggregator.CollectSnapshot(&exec, TestDowngradeSelectors());
+  EXPECT_EQ(agg_info[1].parent().ewma_usage_bps(), 200);
+  EXPECT_THAT(
+      agg_info[1].children(),
+      testing::UnorderedElementsAre(
+          ChildFlowInfo{.child_id = 101, .volume_bps = 100, .currently_lopri = false},
+          ChildFlowInfo{.child_id = 101, .volume_bps = 100, .currently_lopri = false}));
+
+  // Draining frees up space again.
+  aggregator.UpdateInfo(info);
+  EXPECT_EQ(aggregator.num_dropped_infos(), 2);
+  agg_info = aggregator.CollectSnapshot(&exec, TestDowngradeSelectors());
+  EXPECT_EQ(agg_info[1].parent().ewma_usage_bps(), 100);
+}
+
+TEST(FastAggregatorTest, DropsGenWithInfos) {
+  const ClusterFlowMap<int64_t> agg_flow_to_id = TestAggFlowToIdMap();
+
+  FastAggregator aggregator(&agg_flow_to_id, TestSamplers(100, 0, 0, 0),
+                            FastAggregator::Config{
+                                .num_shards = 1,
+                                .shard_capacity = 2,
+                            });
+
+  proto::InfoBundle info = ParseTextProto<proto::InfoBundle>(R"(
+    bundler { host_id: 101 }
+    gen: 1
+    flow_infos {
+      flow { src_dc: "A" dst_dc: "B-1" job: "web" host_id: 101 }
+      ewma_usage_bps: 100
+    }
+    flow_infos {
+      flow { src_dc: "A" dst_dc: "B-2" job: "web" host_id: 101 }
+      ewma_usage_bps: 50
+    }
+  )");
+  aggregator.UpdateInfo(info);
+  info.set_gen(2);
+  aggregator.UpdateInfo(info);  // infos don't fit, but the gen would
+  EXPECT_EQ(aggregator.num_dropped_infos(), 3);
+
+  WorkStealingExecutor exec(2);
+  std::vector<FastAggInfo> agg_info =
+      aggregator.CollectSnapshot(&exec, TestDowngradeSelectors());
+  EXPECT_EQ(agg_info[1].parent().ewma_usage_bps(), 100);
+  ASSERT_EQ(agg_info[1].info_gen().size(), 1);
+  EXPECT_EQ(agg_info[1].info_gen()[0].gen, 1);
+}
+
+TEST(FastAggregatorTest, DerivesShardCapacityFromNumHosts) {
+  const ClusterFlowMap<int64_t> agg_flow_to_id = TestAggFlowToIdMap();
+
+  FastAggregator aggregator(&agg_flow_to_id, TestSamplers(100, 0, 0, 0),
+                            FastAggregator::Config{
+                                .num_shards = 1,
+                                .expected_num_hosts = 100,
+                            });
+
+  proto::InfoBundle info = ParseTextProto<proto::InfoBundle>(R"(
+    flow_infos {
+      flow { src_dc: "A" dst_dc: "B-1" job: "web" }
+      ewma_usage_bps: 1
+    }
+  )");
+  for (int i = 0; i < 200; ++i) {
+    info.mutable_bundler()->set_host_id(i);
+    info.mutable_flow_infos(0)->mutable_flow()->set_host_id(i);
+    aggregator.UpdateInfo(info);
+  }
+  EXPECT_EQ(aggregator.num_dropped_infos(), 0);
+
+  WorkStealingExecutor exec(2);
+  std::vector<FastAggInfo> agg_info =
+      aggregator.CollectSnapshot(&exec, TestDowngradeSelectors());
+  EXPECT_EQ(agg_info[1].info_gen().size(), 200);
+}
+
+TEST(FastAggregatorTest, UpdateFGsRetiresAndAddsFGs) {
+  const ClusterFlowMap<int64_t> agg_flow_to_id = TestAggFlowToIdMap();
+  FastAggregator aggregator(&agg_flow_to_id, TestSamplers(100, 0, 0, 0),
+                            FastAggregator::Config{.track_pending_usage = true});
+
+  auto info_for = [](const std::string& dst_dc, int64_t usage_bps) {
+    proto::InfoBundle info = ParseTextProto<proto::InfoBundle>(R"(
+      bundler { host_id: 101 }
+      flow_infos { flow { src_dc: "A" host_id: 101 } }
+    )");
+    info.mutable_flow_infos(0)->mutable_flow()->set_dst_dc(dst_dc);
+    info.mutable_flow_infos(0)->set_ewma_usage_bps(usage_bps);
+    return info;
+  };
+
+  // Queued before the swap, so still counted.
+  aggregator.UpdateInfo(info_for("B-1", 100));
+
+  ClusterFlowMap<int64_t> new_flow_to_id = agg_flow_to_id;
+  new_flow_to_id[TestAggFlow(3)] = 3;
+  std::vector<ThresholdSampler> samplers = TestSamplers(100, 0, 0, 0);
+  samplers.push_back(ThresholdSampler(100, 0));
+  aggregator.UpdateFGs(new_flow_to_id, std::move(samplers), {false, true, false, false});
+
+  aggregator.UpdateInfo(info_for("B-1", 200));
+  aggregator.UpdateInfo(info_for("B-3", 300));
+
+  FastAggregator::PendingUsage pending;
+  aggregator.GetPendingUsage(&pending);
+  EXPECT_THAT(pending.est_bps, testing::ElementsAre(0, 0, 0, 300));
+
+  std::vector<HashingDowngradeSelector> selectors = TestDowngradeSelectors();
+  selectors.push_back(HashingDowngradeSelector());
+  WorkStealingExecutor exec(2);
+  std::vector<FastAggInfo> agg_info = aggregator.CollectSnapshot(&exec, selectors);
+  ASSERT_EQ(agg_info.size(), 4);
+  EXPECT_EQ(agg_info[1].parent().ewma_usage_bps(), 100);
+  EXPECT_EQ(agg_info[3].parent().ewma_usage_bps(), 300);
+  EXPECT_EQ(agg_info[3].parent().flow().dst_dc(), "B-3");
+}
+
+TEST(FastAggregatorTest, PendingUsageOnlyCountsQueuedInfos) {
+  const ClusterFlowMap<int64_t> agg_flow_to_id = TestAggFlowToIdMap();
+  proto::InfoBundle info = ParseTextProto<proto::InfoBundle>(R"(
+    bundler { host_id: 101 }
+    flow_infos {
+      flow { src_dc: "A" dst_dc: "B-1" job: "web" host_id: 101 }
+      ewma_usage_bps: 100
+    }
+  )");
+
+  FastAggregator untracked(&agg_flow_to_id, TestSamplers(100, 0, 0, 0),
+                           FastAggregator::Config{.num_shards = 1});
+  untracked.UpdateInfo(info);
+  FastAggregator::PendingUsage pending;
+  untracked.GetPendingUsage(&pending);
+  EXPECT_EQ(pending.num_updates, 1);
+  EXPECT_THAT(pending.est_bps, testing::ElementsAre(0, 0, 0));
+
+  FastAggregator tracked(&agg_flow_to_id, TestSamplers(100, 0, 0, 0),
+                         FastAggregator::Config{
+                             .num_shards = 1,
+                             .shard_capacity = 2,
+                             .track_pending_usage = true,
+                         });
+  tracked.UpdateInfo(info);
+  tracked.UpdateInfo(info);
+  tracked.UpdateInfo(info);  // dropped
+  tracked.GetPendingUsage(&pending);
+  EXPECT_EQ(pending.num_updates, 3);
+  EXPECT_THAT(pending.est_bps, testing::ElementsAre(0, 200, 0));
+}
+
 }  // namespace
 }  // namespace heyp
@@ -1,16 +1,36 @@
 #include "heyp/cluster-agent/fast-aggregator.h"
 
+#include <algorithm>
+#include <thread>
+
+#include "heyp/flows/fg-dictionary.h"
 #include "heyp/log/spdlog.h"
 
 namespace heyp {
 
+const std::vector<FastAggInfo::HostInfoGen>& FastAggInfo::info_gen() const {
+  static const std::vector<HostInfoGen>* const kEmpty = new std::vector<HostInfoGen>();
+  if (info_gen_ == nullptr) {
+    return *kEmpty;
+  }
+  return *info_gen_;
+}
+
+namespace {
+
+// Versions of FGTables, shared by all FastAggregators so that a thread's cached table
+// can never be mistaken for another aggregator's.
+std::atomic<uint64_t> next_fg_table_version{1};
+
+}  // namespace
+
 std::vector<FastAggInfo> FastAggregator::ComputeTemplateAggInfo(
-    const ClusterFlowMap<int64_t>* agg_flow_to_id) {
-  std::vector<FastAggInfo> infos(agg_flow_to_id->size(), FastAggInfo{});
+    const ClusterFlowMap<int64_t>& agg_flow_to_id) {
+  std::vector<FastAggInfo> infos(agg_flow_to_id.size(), FastAggInfo{});
   for (int i = 0; i < infos.size(); ++i) {
     infos[i].agg_id_ = -1;
   }
-  for (auto& [flow, id] : *agg_flow_to_id) {
+  for (auto& [flow, id] : agg_flow_to_id) {
     H_ASSERT_LT(id, infos.size());
     FastAggInfo& info = infos.at(id);
     info.agg_id_ = id;
@@ -23,169 +43,343 @@ std::vector<FastAggInfo> FastAggregator::ComputeTemplateAggInfo(
   return infos;
 }
 
+std::shared_ptr<const FastAggregator::FGTable> FastAggregator::NewFGTable(
+    const ClusterFlowMap<int64_t>& agg_flow_to_id,
+    std::vector<ThresholdSampler> samplers, std::vector<bool> retired,
+    int num_shards) {
+  auto fgs = std::make_shared<FGTable>();
+  fgs->version = next_fg_table_version.fetch_add(1);
+  fgs->flow_to_id = agg_flow_to_id;
+  fgs->samplers = std::move(samplers);
+  fgs->retired = std::move(retired);
+  fgs->retired.resize(agg_flow_to_id.size(), false);
+  fgs->template_agg_info = ComputeTemplateAggInfo(agg_flow_to_id);
+  H_ASSERT_EQ(fgs->samplers.size(), fgs->template_agg_info.size());
+  fgs->id_to_flow.reserve(fgs->template_agg_info.size());
+  for (const FastAggInfo& info : fgs->template_agg_info) {
+    fgs->id_to_flow.push_back(info.parent().flow());
+  }
+
+  const size_t num_aggs = fgs->template_agg_info.size();
+  fgs->pending_bps.reserve(num_shards);
+  for (int i = 0; i < num_shards; ++i) {
+    fgs->pending_bps.emplace_back(new std::atomic<int64_t>[num_aggs]);
+    for (size_t j = 0; j < num_aggs; ++j) {
+      fgs->pending_bps.back()[j].store(0, std::memory_order_relaxed);
+    }
+  }
+  return fgs;
+}
+
+int FastAggregator::NumShards(const Config& config) {
+  if (config.num_shards > 0) {
+    return config.num_shards;
+  }
+  return std::max<int>(1, std::thread::hardware_concurrency());
+}
+
 FastAggregator::FastAggregator(const ClusterFlowMap<int64_t>* agg_flow_to_id,
                                std::vector<ThresholdSampler> samplers)
-    : agg_flow_to_id_(agg_flow_to_id),
-      samplers_(std::move(samplers)),
-      template_agg_info_(ComputeTemplateAggInfo(agg_flow_to_id_)),
+    : FastAggregator(agg_flow_to_id, std::move(samplers), Config{}) {}
+
+FastAggregator::FastAggregator(const ClusterFlowMap<int64_t>* agg_flow_to_id,
+                               std::vector<ThresholdSampler> samplers, Config config)
+    : track_pending_usage_(config.track_pending_usage),
+      fgs_(NewFGTable(*agg_flow_to_id, std::move(samplers), {}, NumShards(config))),
+      fgs_version_(fgs_->version),
       logger_(MakeLogger("fast-agg")) {
-  for (int i = 0; i < kNumInfoShards; ++i) {
-    for (int j = 0; j < info_shards_[i].size(); ++j) {
-      info_shards_[i][j] = InfoShard();
-    }
-    active_info_shard_ids_[i].store(0);
-    update_counters_[i].store(0);
-    last_update_counters_[i] = 0;
+  const int num_shards = NumShards(config);
+  int64_t info_capacity = config.shard_capacity;
+  int64_t gen_capacity = config.shard_capacity;
+  if (config.shard_capacity <= 0) {
+    // Leave room for every host to report twice per snapshot (or for shards to be
+    // skewed 2:1). Each report has one generation and at most one record per FG.
+    gen_capacity = 2 * ((config.expected_num_hosts + num_shards - 1) / num_shards);
+    info_capacity =
+        gen_capacity * std::max<int64_t>(1, fgs_->template_agg_info.size());
+  }
+  shards_.reserve(num_shards);
+  for (int i = 0; i < num_shards; ++i) {
+    shards_.push_back(std::make_unique<InfoShard>(info_capacity, gen_capacity));
   }
 }
 
+void FastAggregator::UpdateFGs(const ClusterFlowMap<int64_t>& agg_flow_to_id,
+                               std::vector<ThresholdSampler> samplers,
+                               std::vector<bool> retired) {
+  H_ASSERT_GE(agg_flow_to_id.size(), std::atomic_load(&fgs_)->template_agg_info.size());
+  std::shared_ptr<const FGTable> fgs = NewFGTable(agg_flow_to_id, std::move(samplers),
+                                                  std::move(retired), shards_.size());
+  const uint64_t version = fgs->version;
+  std::atomic_store(&fgs_, std::move(fgs));
+  fgs_version_.store(version, std::memory_order_release);
+}
+
+const FastAggregator::FGTable& FastAggregator::IngestFGs() const {
+  struct Cached {
+    uint64_t version = 0;
+    std::shared_ptr<const FGTable> fgs;
+  };
+  thread_local Cached cached;
+  if (cached.version != fgs_version_.load(std::memory_order_acquire)) {
+    cached.fgs = std::atomic_load(&fgs_);
+    cached.version = cached.fgs->version;
+  }
+  return *cached.fgs;
+}
+
 void FastAggregator::UpdateInfo(const proto::InfoBundle& info) {
-  const int shard = static_cast<uint>(info.bundler().host_id()) % kNumInfoShards;
-  update_counters_[shard].fetch_add(1);
+  const int shard_id = static_cast<uint>(info.bundler().host_id()) % shards_.size();
+  InfoShard& shard = *shards_[shard_id];
+  shard.num_updates.fetch_add(1, std::memory_order_relaxed);
+  const FGTable& fgs = IngestFGs();
 
-  std::vector<Info> got;
-  got.reserve(agg_flow_to_id_->size());
+  // Reuse per-thread scratch space so that ingestion doesn't allocate.
+  thread_local std::vector<Info> got;
+  got.clear();
   for (const proto::FlowInfo& fi : info.flow_infos()) {
-    auto id_iter = agg_flow_to_id_->find(fi.flow());
-    if (id_iter == agg_flow_to_id_->end()) {
+    const int64_t agg_id = LookupFGIndex(fgs.flow_to_id, fgs.id_to_flow, fi);
+    if (agg_id < 0 || fgs.retired[agg_id]) {
       continue;
     }
     got.push_back(Info{
-        .agg_id = id_iter->second,
+        .agg_id = agg_id,
         .child_id = info.bundler().host_id(),
         .volume_bps = fi.ewma_usage_bps(),
         .currently_lopri = fi.currently_lopri(),
+        .presampled = false,
+    });
+  }
+
+  // Drop the generation along with the usage, otherwise the controller would take
+  // the host's missing usage as an up-to-date report of no usage.
+  if (!shard.infos.TryPush(got)) {
+    shard.num_dropped.fetch_add(got.size() + 1, std::memory_order_relaxed);
+    return;
+  }
+  if (track_pending_usage_) {
+    // Only counted once queued (see Aggregate).
+    std::atomic<int64_t>* pending_bps = fgs.pending_bps[shard_id].get();
+    for (const Info& i : got) {
+      pending_bps[i.agg_id].fetch_add(
+          static_cast<int64_t>(fgs.samplers[i.agg_id].WeightedUsage(i.volume_bps)),
+          std::memory_order_relaxed);
+    }
+  }
+  if (!shard.gens.TryPush(FastAggInfo::HostInfoGen{
+          .host_id = info.bundler().host_id(),
+          .gen = info.gen(),
+      })) {
+    shard.num_dropped.fetch_add(1, std::memory_order_relaxed);
+  }
+}
+
+void FastAggregator::UpdateAggregatedInfo(const proto::AggregatedInfoBundle& info) {
+  const int num_shards = shards_.size();
+  shards_[static_cast<uint>(info.aggregator().host_id()) % num_shards]
+      ->num_updates.fetch_add(1, std::memory_order_relaxed);
+  const FGTable& fgs = IngestFGs();
+
+  // An aggregator reports for many hosts, so its records are spread over the shards
+  // like those of the hosts themselves: by host for samples and generations, and by
+  // FG for the sums.
+  struct Records {
+    std::vector<Info> got;
+    std::vector<SummedUsage> summed;
+    std::vector<FastAggInfo::HostInfoGen> gens;
+  };
+  thread_local std::vector<Records> by_shard;
+  by_shard.resize(num_shards);
+  for (Records& r : by_shard) {
+    r.got.clear();
+    r.summed.clear();
+    r.gens.clear();
+  }
+  for (const proto::AggregatedFGInfo& fg : info.fg_infos()) {
+    auto iter = fgs.flow_to_id.find(fg.flow());
+    if (iter == fgs.flow_to_id.end() || fgs.retired[iter->second]) {
+      continue;
+    }
+    const int64_t agg_id = iter->second;
+    by_shard[agg_id % num_shards].summed.push_back(SummedUsage{
+        .agg_id = agg_id,
+        .hipri_bps = fg.hipri_usage_bps(),
+        .lopri_bps = fg.lopri_usage_bps(),
     });
+    for (const proto::AggregatedFGInfo::Child& c : fg.sampled_children()) {
+      by_shard[static_cast<uint>(c.host_id()) % num_shards].got.push_back(Info{
+          .agg_id = agg_id,
+          .child_id = c.host_id(),
+          .volume_bps = c.ewma_usage_bps(),
+          .currently_lopri = c.currently_lopri(),
+          .presampled = true,
+      });
+    }
+  }
+  for (const proto::HostGen& hg : info.host_gens()) {
+    by_shard[static_cast<uint>(hg.host_id()) % num_shards].gens.push_back(
+        FastAggInfo::HostInfoGen{
+            .host_id = hg.host_id(),
+            .gen = hg.gen(),
+        });
   }
 
-  int cur_id = 0;
-  while (true) {
-    cur_id = active_info_shard_ids_[shard].load();
-    if (cur_id < 0) {
-      continue;  // try again
+  for (int i = 0; i < num_shards; ++i) {
+    InfoShard& shard = *shards_[i];
+    Records& r = by_shard[i];
+    if (!shard.summed.TryPush(r.summed)) {
+      shard.num_dropped.fetch_add(r.summed.size(), std::memory_order_relaxed);
+    }
+    // As in UpdateInfo, generations are dropped along with the samples.
+    if (!shard.infos.TryPush(r.got)) {
+      shard.num_dropped.fetch_add(r.got.size() + r.gens.size(),
+                                  std::memory_order_relaxed);
+      continue;
     }
-    if (active_info_shard_ids_[shard].compare_exchange_strong(cur_id, -1)) {
-      break;
+    if (!shard.gens.TryPush(r.gens)) {
+      shard.num_dropped.fetch_add(r.gens.size(), std::memory_order_relaxed);
     }
   }
-  // Now active_info_shard_ids_[shard] < 0: no one else can modify
-  InfoShard& cur = info_shards_[shard][cur_id];
+}
 
-  for (Info i : got) {
-    cur.infos.push_back(i);
+void FastAggregator::GetPendingUsage(PendingUsage* usage) const {
+  std::shared_ptr<const FGTable> fgs = std::atomic_load(&fgs_);
+  usage->num_updates = 0;
+  usage->est_bps.assign(fgs->template_agg_info.size(), 0);
+  for (int s = 0; s < shards_.size(); ++s) {
+    usage->num_updates += shards_[s]->num_updates.load(std::memory_order_relaxed) -
+                          shards_[s]->last_num_updates.load(std::memory_order_relaxed);
+    for (size_t i = 0; i < usage->est_bps.size(); ++i) {
+      usage->est_bps[i] += fgs->pending_bps[s][i].load(std::memory_order_relaxed);
+    }
   }
-  cur.gens.push_back({
-      .host_id = info.bundler().host_id(),
-      .gen = info.gen(),
-  });
+}
 
-  // Done with info_shards_[shard]
-  active_info_shard_ids_[shard].store(cur_id, std::memory_order_seq_cst);
+int64_t FastAggregator::num_dropped_infos() const {
+  int64_t num = 0;
+  for (const auto& shard : shards_) {
+    num += shard->num_dropped.load(std::memory_order_relaxed);
+  }
+  return num;
 }
 
-std::pair<std::vector<FastAggInfo>, std::vector<FastAggregator::PrioEstimators>>
-FastAggregator::Aggregate(
-    const FastAggregator::InfoShard& shard,
-    const std::vector<HashingDowngradeSelector>& downgrade_selectors) {
-  std::vector<PrioEstimators> volume_bps;
-  std::vector<FastAggInfo> agg;
-  agg.reserve(template_agg_info_.size());
-  volume_bps.reserve(template_agg_info_.size());
-  for (int i = 0; i < template_agg_info_.size(); ++i) {
-    agg.push_back(FastAggInfo());
-    agg.back().agg_id_ = i;
-    volume_bps.push_back({
-        .hipri = samplers_[i].NewAggUsageEstimator(),
-        .lopri = samplers_[i].NewAggUsageEstimator(),
+FastAggregator::ShardAgg FastAggregator::Aggregate(
+    const FGTable& fgs, int shard_id,
+    const std::vector<HashingDowngradeSelector>& downgrade_selectors,
+    int64_t* num_infos) {
+  InfoShard& shard = *shards_[shard_id];
+  const size_t num_aggs = fgs.template_agg_info.size();
+
+  // Reset before draining. UpdateInfo only counts usage as pending once it is queued,
+  // so usage that this drain misses is counted after the reset and is never lost.
+  // Usage queued just before the drain may still be counted after the reset, and so
+  // remain pending after it is snapshotted.
+  if (track_pending_usage_) {
+    for (int i = 0; i < num_aggs; ++i) {
+      fgs.pending_bps[shard_id][i].store(0, std::memory_order_relaxed);
+    }
+  }
+
+  // Infos queued before an UpdateFGs are still in range since FGs are only appended.
+  ShardAgg out;
+  out.aggs.reserve(num_aggs);
+  out.volume_bps.reserve(num_aggs);
+  out.summed_hipri_bps.resize(num_aggs, 0);
+  out.summed_lopri_bps.resize(num_aggs, 0);
+  for (int i = 0; i < num_aggs; ++i) {
+    out.aggs.push_back(FastAggInfo());
+    out.aggs.back().agg_id_ = i;
+    out.volume_bps.push_back({
+        .hipri = fgs.samplers[i].NewAggUsageEstimator(),
+        .lopri = fgs.samplers[i].NewAggUsageEstimator(),
     });
   }
 
-  for (const Info& info : shard.infos) {
-    agg[info.agg_id].children_.push_back(ChildFlowInfo{
+  *num_infos = shard.infos.Drain([&](const Info& info) {
+    out.aggs[info.agg_id].children_.push_back(ChildFlowInfo{
         .child_id = info.child_id,
         .volume_bps = info.volume_bps,
         .currently_lopri = info.currently_lopri,
     });
+    if (info.presampled) {
+      return;
+    }
     if (downgrade_selectors.at(info.agg_id).IsLOPRI(info.child_id)) {
-      volume_bps[info.agg_id].lopri.RecordSample(info.volume_bps);
+      out.volume_bps[info.agg_id].lopri.RecordSample(info.volume_bps);
     } else {
-      volume_bps[info.agg_id].hipri.RecordSample(info.volume_bps);
-    }
-  }
-  for (const auto gen : shard.gens) {
-    for (FastAggInfo& ai : agg) {
-      ai.info_gen_.push_back(gen);
+      out.volume_bps[info.agg_id].hipri.RecordSample(info.volume_bps);
     }
-  }
+  });
+  shard.summed.Drain([&](const SummedUsage& u) {
+    out.summed_hipri_bps[u.agg_id] += u.hipri_bps;
+    out.summed_lopri_bps[u.agg_id] += u.lopri_bps;
+  });
+  shard.gens.Drain(
+      [&](const FastAggInfo::HostInfoGen& gen) { out.host_gens.push_back(gen); });
 
-  return {agg, volume_bps};
+  return out;
 }
 
 std::vector<FastAggInfo> FastAggregator::CollectSnapshot(
-    Executor* exec, const std::vector<HashingDowngradeSelector>& downgrade_selectors) {
+    WorkStealingExecutor* exec,
+    const std::vector<HashingDowngradeSelector>& downgrade_selectors) {
   std::string buf;
-  for (int i = 0; i < kNumInfoShards; ++i) {
-    int64_t cum = update_counters_[i].load();
+  for (int i = 0; i < shards_.size(); ++i) {
+    int64_t cum = shards_[i]->num_updates.load();
+    int64_t last = shards_[i]->last_num_updates.load();
     if (i == 0) {
-      buf += absl::StrCat(cum - last_update_counters_[i]);
+      buf += absl::StrCat(cum - last);
     } else {
-      buf += absl::StrCat(", ", cum - last_update_counters_[i]);
+      buf += absl::StrCat(", ", cum - last);
     }
-    last_update_counters_[i] = cum;
+    shards_[i]->last_num_updates.store(cum);
   }
   SPDLOG_LOGGER_INFO(&logger_, "early num infos per shard [{}]", buf);
 
   // Compute a std::vector<FastAggInfo> concurrently for each shard.
   // Aggregate into one final std::vector<FastAggInfo>.
-  std::unique_ptr<TaskGroup> tasks = exec->NewTaskGroup();
-  std::array<std::vector<FastAggInfo>, kNumInfoShards> parts;
-  std::array<std::vector<PrioEstimators>, kNumInfoShards> parent_volume_bps;
+  const std::shared_ptr<const FGTable> fgs = std::atomic_load(&fgs_);
+  std::vector<ShardAgg> parts(shards_.size());
   std::atomic<int64_t> num_infos(0);
-  for (int i = 0; i < kNumInfoShards; ++i) {
-    tasks->AddTaskNoStatus(
-        [i, this, &num_infos, &parts, &parent_volume_bps, &downgrade_selectors] {
-          // First swap the existing shard data with the other buffer
-          int cur_id = -2;
-          while (true) {
-            cur_id = active_info_shard_ids_[i].load();
-            if (cur_id < 0) {
-              continue;  // try again
-            }
-            int next_id = (cur_id + 1) % 2;
-            info_shards_[i][next_id].gens.clear();
-            info_shards_[i][next_id].infos.clear();
-            if (active_info_shard_ids_[i].compare_exchange_strong(cur_id, next_id)) {
-              break;
-            }
-          }
-          InfoShard& cur = info_shards_[i][cur_id];
-          num_infos.fetch_add(cur.infos.size());
-
-          // cur contains the shard data
-          std::tie(parts[i], parent_volume_bps[i]) =
-              this->Aggregate(cur, downgrade_selectors);
-        });
-  }
+  exec->ParallelFor(0, shards_.size(), /*grain=*/1,
+                    [this, &fgs, &num_infos, &parts, &downgrade_selectors](int64_t i) {
+                      int64_t shard_num_infos = 0;
+                      parts[i] = this->Aggregate(*fgs, i, downgrade_selectors,
+                                                 &shard_num_infos);
+                      num_infos.fetch_add(shard_num_infos);
+                    });
+  SPDLOG_LOGGER_INFO(&logger_, "processed {} infos from host-agents (dropped {} so far)",
+                     num_infos.load(), num_dropped_infos());
 
-  tasks->WaitAllNoStatus();
-  SPDLOG_LOGGER_INFO(&logger_, "processed {} infos from host-agents", num_infos.load());
+  // Host generations are the same for every agg, so keep one copy.
+  size_t num_host_gens = 0;
+  for (const ShardAgg& part : parts) {
+    num_host_gens += part.host_gens.size();
+  }
+  auto host_gens = std::make_shared<std::vector<FastAggInfo::HostInfoGen>>();
+  host_gens->reserve(num_host_gens);
+  for (const ShardAgg& part : parts) {
+    host_gens->insert(host_gens->end(), part.host_gens.begin(), part.host_gens.end());
+  }
 
-  std::vector<FastAggInfo> combined = parts[0];
-  int64_t num_agg = combined.size();
-  int64_t num_all_agg_children = 0;
-  for (int i = 0; i < combined.size(); ++i) {
-    size_t num_children = 0;
-    for (int part = 0; part < parts.size(); ++part) {
-      num_children += parts[part][i].children_.size();
+  // Merge the other shards into the first one.
+  std::vector<FastAggInfo> combined = std::move(parts[0].aggs);
+  const int64_t num_agg = combined.size();
+  std::atomic<int64_t> num_all_agg_children(0);
+  exec->ParallelFor(0, num_agg, /*grain=*/1, [&](int64_t i) {
+    size_t num_children = combined[i].children_.size();
+    for (int part = 1; part < parts.size(); ++part) {
+      num_children += parts[part].aggs[i].children_.size();
     }
     combined[i].children_.reserve(num_children);
-    num_all_agg_children += num_children;
+    num_all_agg_children.fetch_add(num_children, std::memory_order_relaxed);
 
-    // TODO finish and what about sampling again?
+    // Children are not resampled here. With host-side sampling, hosts already
+    // picked them with the same ThresholdSampler that the estimators use.
     for (int part = 1; part < parts.size(); ++part) {
-      for (const ChildFlowInfo& child : parts[part][i].children_) {
-        combined[i].children_.push_back(child);
-      }
+      const std::vector<ChildFlowInfo>& children = parts[part].aggs[i].children_;
+      combined[i].children_.insert(combined[i].children_.end(), children.begin(),
+                                   children.end());
     }
 
     int64_t sum_bps = 0;
@@ -193,22 +387,25 @@ std::vector<FastAggInfo> FastAggregator::CollectSnapshot(
     int64_t sum_lopri_bps = 0;
     for (int part = 0; part < parts.size(); ++part) {
       const int64_t hipri_part =
-          parent_volume_bps[part][i].hipri.EstUsage(0 /* unused by ThresholdSampler */);
+          parts[part].volume_bps[i].hipri.EstUsage(0 /* unused by ThresholdSampler */) +
+          parts[part].summed_hipri_bps[i];
       const int64_t lopri_part =
-          parent_volume_bps[part][i].lopri.EstUsage(0 /* unused by ThresholdSampler */);
+          parts[part].volume_bps[i].lopri.EstUsage(0 /* unused by ThresholdSampler */) +
+          parts[part].summed_lopri_bps[i];
       sum_hipri_bps += hipri_part;
       sum_lopri_bps += lopri_part;
       sum_bps += hipri_part + lopri_part;
     }
-    combined[i].parent_ = template_agg_info_[i].parent_;
+    combined[i].parent_ = fgs->template_agg_info[i].parent_;
     // Just set both so that the whichever is selected is populated.
     combined[i].parent_.set_ewma_usage_bps(sum_bps);
     combined[i].parent_.set_ewma_hipri_usage_bps(sum_hipri_bps);
     combined[i].parent_.set_ewma_lopri_usage_bps(sum_lopri_bps);
     combined[i].parent_.set_predicted_demand_bps(sum_bps);
-  }
+    combined[i].info_gen_ = host_gens;
+  });
   SPDLOG_LOGGER_INFO(&logger_, "produced {} aggregates with a combined {} children",
-                     num_agg, num_all_agg_children);
+                     num_agg, num_all_agg_children.load());
   return combined;
 }
 
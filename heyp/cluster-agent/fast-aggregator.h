@@ -3,12 +3,14 @@
 
 #include <atomic>
 #include <cstdint>
+#include <memory>
 
 #include "heyp/alg/agg-info-views.h"
 #include "heyp/alg/downgrade/impl-hashing.h"
 #include "heyp/alg/sampler.h"
 #include "heyp/cluster-agent/per-agg-allocators/util.h"
-#include "heyp/threads/executor.h"
+#include "heyp/threads/mpsc-ring.h"
+#include "heyp/threads/work-stealing-executor.h"
 
 namespace heyp {
 
@@ -23,12 +25,15 @@ class FastAggInfo : public AggInfoView {
   };
 
   int64_t agg_id() const { return agg_id_; }
-  const std::vector<HostInfoGen>& info_gen() const { return info_gen_; }
+
+  // Generations of all hosts that reported since the last snapshot (not only those
+  // that reported usage for this agg). The table is shared by all aggs of a snapshot.
+  const std::vector<HostInfoGen>& info_gen() const;
 
  private:
   proto::FlowInfo parent_;
   std::vector<ChildFlowInfo> children_;
-  std::vector<HostInfoGen> info_gen_;
+  std::shared_ptr<const std::vector<HostInfoGen>> info_gen_;
   int64_t agg_id_ = -1;
 
   friend class FastAggregator;
@@ -36,16 +41,68 @@ class FastAggInfo : public AggInfoView {
 
 class FastAggregator {
  public:
+  struct Config {
+    // If <= 0, uses one shard per core.
+    int num_shards = 0;
+
+    // Max number of records each shard buffers between snapshots.
+    // If <= 0, derived from expected_num_hosts.
+    int64_t shard_capacity = 0;
+
+    // Number of hosts expected to report between two snapshots.
+    int64_t expected_num_hosts = 50000;
+
+    // If set, GetPendingUsage reports usage. Costs an atomic add per FG usage.
+    bool track_pending_usage = false;
+  };
+
   FastAggregator(const ClusterFlowMap<int64_t>* agg_flow_to_id,
                  std::vector<ThresholdSampler> samplers);
+  FastAggregator(const ClusterFlowMap<int64_t>* agg_flow_to_id,
+                 std::vector<ThresholdSampler> samplers, Config config);
 
-  // UpdateInfo updates the info. This method is thread safe.
+  // UpdateInfo updates the info. This method is thread safe and never blocks:
+  // if the host's shard is full, the info is dropped.
   void UpdateInfo(const proto::InfoBundle& info);
 
+  // Like UpdateInfo, but for usage that an aggregator-agent already sampled and
+  // summed. Sampled children are not fed to the usage estimators again; the totals
+  // are added as is.
+  void UpdateAggregatedInfo(const proto::AggregatedInfoBundle& info);
+
+  // Replaces the FGs that usage is aggregated for. FGs keep their ids, so
+  // agg_flow_to_id must hold every FG already known (retired ones included) and
+  // number new FGs after them. Usage of retired FGs is ignored.
+  //
+  // UpdateInfo never waits for this to finish: it keeps using the old FGs until it
+  // notices the swap. Must not be called concurrently with CollectSnapshot.
+  void UpdateFGs(const ClusterFlowMap<int64_t>& agg_flow_to_id,
+                 std::vector<ThresholdSampler> samplers, std::vector<bool> retired);
+
+  // Returns the number of records (FG usages and host generations) that were dropped
+  // because a shard was full.
+  int64_t num_dropped_infos() const;
+
+  int num_shards() const { return shards_.size(); }
+
+  struct PendingUsage {
+    int64_t num_updates = 0;
+    std::vector<int64_t> est_bps;  // indexed by agg id
+  };
+
+  // Fills usage with the updates received since the last snapshot and the usage they
+  // report, weighted as in CollectSnapshot. Usage from aggregator-agents is not
+  // included (but each of their bundles counts as one update), nor is usage reported
+  // before the last UpdateFGs. Usage is all zero unless track_pending_usage is set.
+  //
+  // Thread-safe and cheap enough to poll.
+  void GetPendingUsage(PendingUsage* usage) const;
+
   // CollectSnapshot produces a snapshot of usage. It should only be called from
   // one thread at a time but it may be called in parallel to UpdateInfo.
   std::vector<FastAggInfo> CollectSnapshot(
-      Executor* exec, const std::vector<HashingDowngradeSelector>& downgrade_selectors);
+      WorkStealingExecutor* exec,
+      const std::vector<HashingDowngradeSelector>& downgrade_selectors);
 
  private:
   struct PrioEstimators {
@@ -58,33 +115,80 @@ class FastAggregator {
     uint64_t child_id;
     int64_t volume_bps;
     bool currently_lopri;
+    bool presampled;  // from an aggregator-agent
   };
 
+  // Usage totals summed by an aggregator-agent.
+  struct SummedUsage {
+    int64_t agg_id;
+    int64_t hipri_bps;
+    int64_t lopri_bps;
+  };
+
+  // Each shard is written to by many UpdateInfo callers and drained by one
+  // CollectSnapshot task.
   struct InfoShard {
-    std::vector<FastAggInfo::HostInfoGen> gens;
-    std::vector<Info> infos;
+    InfoShard(int64_t info_capacity, int64_t gen_capacity)
+        : infos(info_capacity), gens(gen_capacity), summed(info_capacity) {}
+
+    MPSCRing<Info> infos;
+    MPSCRing<FastAggInfo::HostInfoGen> gens;
+    MPSCRing<SummedUsage> summed;
+    std::atomic<int64_t> num_updates{0};
+    std::atomic<int64_t> num_dropped{0};
+    std::atomic<int64_t> last_num_updates{0};  // only written by CollectSnapshot
+  };
+
+  // The FGs that usage is aggregated for. Immutable once published, except for the
+  // pending usage counters.
+  struct FGTable {
+    uint64_t version = 0;  // unique across all FastAggregators
+    ClusterFlowMap<int64_t> flow_to_id;
+    std::vector<proto::FlowMarker> id_to_flow;
+    std::vector<ThresholdSampler> samplers;
+    std::vector<bool> retired;
+    std::vector<FastAggInfo> template_agg_info;
+
+    // Weighted usage reported since the last snapshot, by shard and agg id.
+    std::vector<std::unique_ptr<std::atomic<int64_t>[]>> pending_bps;
   };
 
+  static std::shared_ptr<const FGTable> NewFGTable(
+      const ClusterFlowMap<int64_t>& agg_flow_to_id,
+      std::vector<ThresholdSampler> samplers, std::vector<bool> retired,
+      int num_shards);
   static std::vector<FastAggInfo> ComputeTemplateAggInfo(
-      const ClusterFlowMap<int64_t>* agg_flow_to_id);
-  // Aggregate aggregates the info but doesn't populate parent_.
-  std::pair<std::vector<FastAggInfo>, std::vector<PrioEstimators>> Aggregate(
-      const InfoShard& shard,
-      const std::vector<HashingDowngradeSelector>& downgrade_selectors);
+      const ClusterFlowMap<int64_t>& agg_flow_to_id);
+  static int NumShards(const Config& config);
+
+  // Returns the FGs for ingestion. The table is cached per thread and only reloaded
+  // when UpdateFGs publishes a new version, so this takes no locks. The reference is
+  // valid until the calling thread's next call.
+  const FGTable& IngestFGs() const;
+
+  struct ShardAgg {
+    std::vector<FastAggInfo> aggs;
+    std::vector<PrioEstimators> volume_bps;
+    std::vector<int64_t> summed_hipri_bps;
+    std::vector<int64_t> summed_lopri_bps;
+    std::vector<FastAggInfo::HostInfoGen> host_gens;
+  };
+
+  // Aggregate drains the shard and aggregates the info but doesn't populate parent_
+  // or info_gen_.
+  ShardAgg Aggregate(const FGTable& fgs, int shard_id,
+                     const std::vector<HashingDowngradeSelector>& downgrade_selectors,
+                     int64_t* num_infos);
+
+  const bool track_pending_usage_;
 
-  const ClusterFlowMap<int64_t>* agg_flow_to_id_;
-  const std::vector<ThresholdSampler> samplers_;
-  const std::vector<FastAggInfo> template_agg_info_;
+  // Swapped RCU-style: published with std::atomic_store and then fgs_version_, so
+  // that readers only need to touch fgs_ when the version changes.
+  std::shared_ptr<const FGTable> fgs_;
+  std::atomic<uint64_t> fgs_version_;
   spdlog::logger logger_;
 
-  constexpr static int kNumInfoShards = 8;
-  // Maintain a sharded queues of Infos.
-  // The current data for shard i can be found in info_shard_[active_info_shard_id_[i]]
-  // *if* active_info_shard_id_[i] > 0. If it is < 0, a write is in progress.
-  std::array<std::array<InfoShard, 2>, kNumInfoShards> info_shards_;
-  std::array<std::atomic<int>, kNumInfoShards> active_info_shard_ids_;
-  std::array<std::atomic<int64_t>, kNumInfoShards> update_counters_;
-  std::array<int64_t, kNumInfoShards> last_update_counters_;
+  std::vector<std::unique_ptr<InfoShard>> shards_;
 };
 
 }  // namespace heyp
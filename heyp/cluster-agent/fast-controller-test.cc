@@ -1,7 +1,13 @@
 #include "heyp/cluster-agent/fast-controller.h"
 
+#include <cstdio>
+#include <fstream>
+
+#include "absl/container/flat_hash_map.h"
+#include "absl/synchronization/mutex.h"
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
+#include "heyp/cluster-agent/checkpoint.h"
 #include "heyp/proto/config.pb.h"
 #include "heyp/proto/heyp.pb.h"
 #include "heyp/proto/parse-text.h"
@@ -10,10 +16,15 @@
 namespace heyp {
 namespace {
 
-std::unique_ptr<FastClusterController> MakeFastClusterController() {
+proto::FastClusterControllerConfig TestConfig() {
   proto::FastClusterControllerConfig config;
   config.set_target_num_samples(10);
   config.set_num_threads(3);
+  return config;
+}
+
+std::unique_ptr<FastClusterController> MakeFastClusterController(
+    const proto::FastClusterControllerConfig& config = TestConfig()) {
 
   return FastClusterController::Create(config, ParseTextProto<proto::AllocBundle>(R"(
                                          flow_allocs {
@@ -239,7 +250,663 @@ TEST(FastClusterControllerTest, PlumbsDataCompletely) {
              )"));
   controller->ComputeAndBroadcast();
 
-  EXPECT_EQ(call_count, 3);
+  // The fourth host stays HIPRI but is still sent its first bundle.
+  EXPECT_EQ(call_count, 4);
+}
+
+TEST(FastClusterControllerTest, EncodedListenersShareBundles) {
+  // Use one thread so that all hosts are in the same broadcast shard.
+  proto::FastClusterControllerConfig config = TestConfig();
+  config.set_num_threads(1);
+  auto controller = MakeFastClusterController(config);
+
+  absl::Mutex mu;
+  absl::flat_hash_map<uint64_t, proto::AllocBundle> decoded;
+  absl::flat_hash_map<uint64_t, proto::AllocBundle> encoded;
+  absl::flat_hash_map<uint64_t, const std::string*> bodies;
+  std::vector<std::unique_ptr<ClusterController::Listener>> listeners;
+  for (uint64_t host_id : {1, 2}) {
+    listeners.push_back(controller->RegisterListener(
+        host_id, [&, host_id](const proto::AllocBundle& b, const SendBundleAux&) {
+          absl::MutexLock l(&mu);
+          decoded[host_id] = b;
+        }));
+    listeners.push_back(controller->RegisterEncodedListener(
+        host_id, [&, host_id](const EncodedAllocBundle& b, const SendBundleAux&) {
+          absl::MutexLock l(&mu);
+          ASSERT_TRUE(b.ParseTo(&encoded[host_id]));
+          bodies[host_id] = b.chunks()[0].get();
+        }));
+  }
+
+  // Both hosts should be downgraded on Chicago->Detroit.
+  UpdateInfo(controller.get(), ParseTextProto<proto::InfoBundle>(R"(
+               bundler { host_id: 1 }
+               timestamp { seconds: 1 }
+               gen: 7
+               flow_infos {
+                 flow { src_dc: "chicago" dst_dc: "detroit" job: "UNSET" host_id: 1 }
+                 ewma_usage_bps: 100000
+                 currently_lopri: true
+               }
+             )"));
+  UpdateInfo(controller.get(), ParseTextProto<proto::InfoBundle>(R"(
+               bundler { host_id: 2 }
+               timestamp { seconds: 1 }
+               gen: 9
+               flow_infos {
+                 flow { src_dc: "chicago" dst_dc: "detroit" job: "UNSET" host_id: 2 }
+                 ewma_usage_bps: 100000
+                 currently_lopri: true
+               }
+             )"));
+  controller->ComputeAndBroadcast();
+
+  absl::MutexLock l(&mu);
+  ASSERT_EQ(decoded.size(), 2);
+  ASSERT_EQ(encoded.size(), 2);
+  for (uint64_t host_id : {1, 2}) {
+    EXPECT_THAT(encoded[host_id], EqProto(decoded[host_id])) << "host " << host_id;
+  }
+  EXPECT_EQ(encoded[1].gen(), 7);
+  EXPECT_EQ(encoded[2].gen(), 9);
+  EXPECT_EQ(encoded[1].fg_dictionary_size(), 2);
+  EXPECT_EQ(bodies[1], bodies[2]);
+}
+
+TEST(FastClusterControllerTest, SendsSamplingParamsToHosts) {
+  proto::FastClusterControllerConfig config = TestConfig();
+  config.set_host_side_sampling(true);
+  auto controller = MakeFastClusterController(config);
+
+  absl::Mutex mu;
+  proto::AllocBundle decoded;
+  proto::AllocBundle encoded;
+  auto lis1 = controller->RegisterListener(
+      1, [&](const proto::AllocBundle& b, const SendBundleAux&) {
+        absl::MutexLock l(&mu);
+        decoded = b;
+      });
+  auto lis2 = controller->RegisterEncodedListener(
+      1, [&](const EncodedAllocBundle& b, const SendBundleAux&) {
+        absl::MutexLock l(&mu);
+        ASSERT_TRUE(b.ParseTo(&encoded));
+      });
+
+  UpdateInfo(controller.get(), ParseTextProto<proto::InfoBundle>(R"(
+               bundler { host_id: 1 }
+               timestamp { seconds: 1 }
+               needs_full_alloc: true
+             )"));
+  controller->ComputeAndBroadcast();
+
+  absl::MutexLock l(&mu);
+  const char* kWantDictionary = R"(
+    fg_dictionary {
+      flow { src_dc: "chicago" dst_dc: "new_york" }
+      id: 1
+      sampling { num_samples_at_approval: 10 approval_bps: 1000 }
+    }
+    fg_dictionary {
+      flow { src_dc: "chicago" dst_dc: "detroit" }
+      id: 2
+      sampling { num_samples_at_approval: 10 approval_bps: 500 }
+    }
+  )";
+  EXPECT_THAT(decoded.fg_dictionary(),
+              EqRepeatedProto(
+                  ParseTextProto<proto::AllocBundle>(kWantDictionary).fg_dictionary()));
+  EXPECT_THAT(encoded.fg_dictionary(),
+              EqRepeatedProto(
+                  ParseTextProto<proto::AllocBundle>(kWantDictionary).fg_dictionary()));
+}
+
+TEST(FastClusterControllerTest, SendsSamplingParamsToHostsThatStayHIPRI) {
+  proto::FastClusterControllerConfig config = TestConfig();
+  config.set_host_side_sampling(true);
+  auto controller = MakeFastClusterController(config);
+
+  absl::Mutex mu;
+  int num_bundles = 0;
+  proto::AllocBundle last;
+  auto lis = controller->RegisterEncodedListener(
+      7, [&](const EncodedAllocBundle& b, const SendBundleAux&) {
+        absl::MutexLock l(&mu);
+        ++num_bundles;
+        ASSERT_TRUE(b.ParseTo(&last));
+      });
+
+  // The host never asks for a full bundle and its usage never gets it downgraded.
+  for (int run = 0; run < 2; ++run) {
+    UpdateInfo(controller.get(), ParseTextProto<proto::InfoBundle>(R"(
+                 bundler { host_id: 7 }
+                 timestamp { seconds: 1 }
+                 flow_infos {
+                   flow { src_dc: "chicago" dst_dc: "detroit" job: "UNSET" host_id: 7 }
+                   ewma_usage_bps: 10
+                 }
+               )"));
+    controller->ComputeAndBroadcast();
+  }
+
+  absl::MutexLock l(&mu);
+  EXPECT_EQ(num_bundles, 1);
+  ASSERT_EQ(last.fg_dictionary_size(), 2);
+  for (const proto::FGDictionaryEntry& e : last.fg_dictionary()) {
+    EXPECT_TRUE(e.has_sampling()) << e.ShortDebugString();
+  }
+  for (const proto::FlowAlloc& a : last.flow_allocs()) {
+    EXPECT_EQ(a.lopri_rate_limit_bps(), 0) << a.ShortDebugString();
+  }
+}
+
+TEST(FastClusterControllerTest, SendsDeltas) {
+  proto::FastClusterControllerConfig config = TestConfig();
+  config.set_send_delta_allocs(true);
+  auto controller = MakeFastClusterController(config);
+
+  absl::Mutex mu;
+  std::vector<proto::AllocBundle> got;
+  auto lis = controller->RegisterEncodedListener(
+      1, [&](const EncodedAllocBundle& b, const SendBundleAux&) {
+        absl::MutexLock l(&mu);
+        got.emplace_back();
+        ASSERT_TRUE(b.ParseTo(&got.back()));
+      });
+
+  auto info_with_usage = [](int64_t usage_bps) {
+    auto info = ParseTextProto<proto::InfoBundle>(R"(
+      bundler { host_id: 1 }
+      timestamp { seconds: 1 }
+      flow_infos {
+        flow { src_dc: "chicago" dst_dc: "detroit" job: "UNSET" host_id: 1 }
+      }
+    )");
+    info.mutable_flow_infos(0)->set_ewma_usage_bps(usage_bps);
+    return info;
+  };
+
+  // Downgrade, then upgrade.
+  UpdateInfo(controller.get(), info_with_usage(100000));
+  controller->ComputeAndBroadcast();
+  UpdateInfo(controller.get(), info_with_usage(10));
+  controller->ComputeAndBroadcast();
+
+  // Nothing changed, but the host asked for a full bundle.
+  proto::InfoBundle resync = info_with_usage(10);
+  resync.set_needs_full_alloc(true);
+  UpdateInfo(controller.get(), resync);
+  controller->ComputeAndBroadcast();
+
+  absl::MutexLock l(&mu);
+  ASSERT_EQ(got.size(), 3);
+
+  EXPECT_EQ(got[0].seq(), 1);
+  EXPECT_EQ(got[0].delta_base_seq(), 0);
+  EXPECT_EQ(got[0].flow_allocs_size(), 2);
+  EXPECT_EQ(got[0].fg_dictionary_size(), 2);
+
+  EXPECT_THAT(got[1], EqProto(ParseTextProto<proto::AllocBundle>(R"(
+                flow_allocs {
+                  flow { src_dc: "chicago" dst_dc: "detroit" }
+                  hipri_rate_limit_bps: 107374182400
+                }
+                seq: 2
+                delta_base_seq: 1
+              )")));
+
+  EXPECT_THAT(got[2], AllocBundleEq(ParseTextProto<proto::AllocBundle>(R"(
+                flow_allocs {
+                  flow { src_dc: "chicago" dst_dc: "new_york" }
+                  hipri_rate_limit_bps: 107374182400
+                }
+                flow_allocs {
+                  flow { src_dc: "chicago" dst_dc: "detroit" }
+                  hipri_rate_limit_bps: 107374182400
+                }
+              )")));
+  EXPECT_EQ(got[2].seq(), 3);
+  EXPECT_EQ(got[2].delta_base_seq(), 0);
+}
+
+TEST(FastClusterControllerTest, SummarizesNewInfo) {
+  proto::FastClusterControllerConfig config = TestConfig();
+  config.set_track_pending_usage(true);
+  auto controller = MakeFastClusterController(config);
+  std::vector<std::unique_ptr<ClusterController::Listener>> lis;
+  for (uint64_t host_id = 1; host_id <= 4; ++host_id) {
+    lis.push_back(controller->RegisterListener(
+        host_id, [](const proto::AllocBundle&, const SendBundleAux&) {}));
+  }
+
+  auto info_with_usage = [](uint64_t host_id, int64_t usage_bps) {
+    auto info = ParseTextProto<proto::InfoBundle>(R"(
+      timestamp { seconds: 1 }
+      flow_infos {
+        flow { src_dc: "chicago" dst_dc: "detroit" job: "UNSET" }
+      }
+    )");
+    info.mutable_bundler()->set_host_id(host_id);
+    info.mutable_flow_infos(0)->mutable_flow()->set_host_id(host_id);
+    info.mutable_flow_infos(0)->set_ewma_usage_bps(usage_bps);
+    return info;
+  };
+
+  NewInfoSummary s = controller->SummarizeNewInfo();
+  EXPECT_EQ(s.frac_hosts_reported, 0);
+  EXPECT_EQ(s.num_fgs_crossed_approval, 0);
+
+  // One of four hosts uses 1000 bps, so the FG is estimated to use 4000 bps (> 500).
+  UpdateInfo(controller.get(), info_with_usage(1, 1000));
+  s = controller->SummarizeNewInfo();
+  EXPECT_EQ(s.frac_hosts_reported, 0.25);
+  EXPECT_EQ(s.num_fgs_crossed_approval, 1);
+
+  controller->ComputeAndBroadcast();
+  s = controller->SummarizeNewInfo();
+  EXPECT_EQ(s.frac_hosts_reported, 0);
+  EXPECT_EQ(s.num_fgs_crossed_approval, 0);
+
+  // Still above approval (4 * 200 bps).
+  UpdateInfo(controller.get(), info_with_usage(2, 200));
+  s = controller->SummarizeNewInfo();
+  EXPECT_EQ(s.num_fgs_crossed_approval, 0);
+
+  // Small usages stand for 50 bps after weighting by their sampling probability, so
+  // the FG is now estimated to use 2 * (200 + 50) bps, which is not above approval.
+  UpdateInfo(controller.get(), info_with_usage(3, 20));
+  s = controller->SummarizeNewInfo();
+  EXPECT_EQ(s.frac_hosts_reported, 0.5);
+  EXPECT_EQ(s.num_fgs_crossed_approval, 1);
+}
+
+TEST(FastClusterControllerTest, CountsDistinctReportingHosts) {
+  auto controller = MakeFastClusterController();
+  std::vector<std::unique_ptr<ClusterController::Listener>> lis;
+  for (uint64_t host_id = 1; host_id <= 4; ++host_id) {
+    lis.push_back(controller->RegisterListener(
+        host_id, [](const proto::AllocBundle&, const SendBundleAux&) {}));
+  }
+  // A second listener for a host does not make it count twice.
+  lis.push_back(controller->RegisterListener(
+      4, [](const proto::AllocBundle&, const SendBundleAux&) {}));
+
+  auto info_from = [](uint64_t host_id) {
+    proto::InfoBundle info;
+    info.mutable_bundler()->set_host_id(host_id);
+    return info;
+  };
+
+  UpdateInfo(controller.get(), info_from(1));
+  UpdateInfo(controller.get(), info_from(1));
+  EXPECT_EQ(controller->SummarizeNewInfo().frac_hosts_reported, 0.25);
+
+  // Callers need not pass the ParID from GetBundlerID.
+  controller->UpdateInfo(0, info_from(2));
+  controller->UpdateInfo(0, info_from(2));
+  EXPECT_EQ(controller->SummarizeNewInfo().frac_hosts_reported, 0.5);
+
+  // Hosts without listeners no longer count as known.
+  lis.erase(lis.begin() + 2, lis.end());
+  EXPECT_EQ(controller->SummarizeNewInfo().frac_hosts_reported, 1);
+
+  // Aggregator-agents report for many hosts at once.
+  controller->ComputeAndBroadcast();
+  EXPECT_EQ(controller->SummarizeNewInfo().frac_hosts_reported, 0);
+  for (uint64_t host_id = 3; host_id <= 4; ++host_id) {
+    lis.push_back(controller->RegisterListener(
+        host_id, [](const proto::AllocBundle&, const SendBundleAux&) {}));
+  }
+  ASSERT_TRUE(controller
+                  ->UpdateAggregatedInfo(ParseTextProto<proto::AggregatedInfoBundle>(R"(
+                    aggregator { host_id: 100 }
+                    host_gens { host_id: 2 gen: 1 }
+                    host_gens { host_id: 3 gen: 1 }
+                    host_gens { host_id: 4 gen: 1 }
+                  )"))
+                  .ok());
+  EXPECT_EQ(controller->SummarizeNewInfo().frac_hosts_reported, 0.75);
+  UpdateInfo(controller.get(), info_from(1));
+  EXPECT_EQ(controller->SummarizeNewInfo().frac_hosts_reported, 1);
+}
+
+TEST(FastClusterControllerTest, UpdatesClusterWideAllocs) {
+  proto::FastClusterControllerConfig config = TestConfig();
+  config.set_host_side_sampling(true);
+  config.set_track_pending_usage(true);
+  auto controller = MakeFastClusterController(config);
+
+  absl::Mutex mu;
+  int num_bundles = 0;
+  proto::AllocBundle last;
+  auto lis = controller->RegisterEncodedListener(
+      1, [&](const EncodedAllocBundle& b, const SendBundleAux&) {
+        absl::MutexLock l(&mu);
+        ++num_bundles;
+        ASSERT_TRUE(b.ParseTo(&last));
+      });
+  UpdateInfo(controller.get(), ParseTextProto<proto::InfoBundle>(R"(
+               bundler { host_id: 1 }
+               timestamp { seconds: 1 }
+               needs_full_alloc: true
+             )"));
+  controller->ComputeAndBroadcast();
+
+  EXPECT_TRUE(absl::IsInvalidArgument(
+      controller->UpdateClusterWideAllocs(ParseTextProto<proto::AllocBundle>(R"(
+        flow_allocs { flow { src_dc: "chicago" dst_dc: "boston" } }
+        flow_allocs { flow { src_dc: "chicago" dst_dc: "boston" } }
+      )"))));
+
+  // Retire detroit, raise new_york, and add boston.
+  ASSERT_TRUE(controller
+                  ->UpdateClusterWideAllocs(ParseTextProto<proto::AllocBundle>(R"(
+                    flow_allocs {
+                      flow { src_dc: "chicago" dst_dc: "boston" }
+                      hipri_rate_limit_bps: 300
+                    }
+                    flow_allocs {
+                      flow { src_dc: "chicago" dst_dc: "new_york" }
+                      hipri_rate_limit_bps: 2000
+                    }
+                  )"))
+                  .ok());
+  {
+    absl::MutexLock l(&mu);
+    EXPECT_EQ(num_bundles, 1);  // not applied until the next control period
+  }
+  controller->ComputeAndBroadcast();
+  {
+    absl::MutexLock l(&mu);
+    EXPECT_EQ(num_bundles, 2);
+    EXPECT_THAT(last, AllocBundleEq(ParseTextProto<proto::AllocBundle>(R"(
+                  flow_allocs {
+                    flow { src_dc: "chicago" dst_dc: "new_york" }
+                    hipri_rate_limit_bps: 107374182400
+                  }
+                  flow_allocs {
+                    flow { src_dc: "chicago" dst_dc: "detroit" }
+                    hipri_rate_limit_bps: 107374182400
+                  }
+                  flow_allocs {
+                    flow { src_dc: "chicago" dst_dc: "boston" }
+                    hipri_rate_limit_bps: 107374182400
+                  }
+                  fg_dictionary {
+                    flow { src_dc: "chicago" dst_dc: "new_york" }
+                    id: 1
+                    sampling { num_samples_at_approval: 10 approval_bps: 2000 }
+                  }
+                  fg_dictionary {
+                    flow { src_dc: "chicago" dst_dc: "detroit" }
+                    id: 2
+                    sampling { num_samples_at_approval: 10 approval_bps: 500 }
+                  }
+                  fg_dictionary {
+                    flow { src_dc: "chicago" dst_dc: "boston" }
+                    id: 3
+                    sampling { num_samples_at_approval: 10 approval_bps: 300 }
+                  }
+                )")));
+  }
+
+  // Only boston crosses its approval: detroit is retired and new_york's was raised.
+  UpdateInfo(controller.get(), ParseTextProto<proto::InfoBundle>(R"(
+               bundler { host_id: 1 }
+               timestamp { seconds: 1 }
+               flow_infos {
+                 flow { src_dc: "chicago" dst_dc: "new_york" job: "UNSET" host_id: 1 }
+                 ewma_usage_bps: 1500
+               }
+               flow_infos {
+                 flow { src_dc: "chicago" dst_dc: "detroit" job: "UNSET" host_id: 1 }
+                 ewma_usage_bps: 5000
+               }
+               flow_infos {
+                 flow { src_dc: "chicago" dst_dc: "boston" job: "UNSET" host_id: 1 }
+                 ewma_usage_bps: 1000
+               }
+             )"));
+  EXPECT_EQ(controller->SummarizeNewInfo().num_fgs_crossed_approval, 1);
+}
+
+TEST(FastClusterControllerTest, ApprovalsAndAggregatorsAreExclusive) {
+  const auto limits = ParseTextProto<proto::AllocBundle>(R"(
+    flow_allocs {
+      flow { src_dc: "chicago" dst_dc: "new_york" }
+      hipri_rate_limit_bps: 2000
+    }
+  )");
+  const auto agg_info = ParseTextProto<proto::AggregatedInfoBundle>(R"(
+    aggregator { host_id: 100 }
+    host_gens { host_id: 1 gen: 1 }
+  )");
+
+  auto with_aggregator = MakeFastClusterController();
+  ASSERT_TRUE(with_aggregator->UpdateAggregatedInfo(agg_info).ok());
+  EXPECT_TRUE(
+      absl::IsFailedPrecondition(with_aggregator->UpdateClusterWideAllocs(limits)));
+
+  auto with_new_approvals = MakeFastClusterController();
+  ASSERT_TRUE(with_new_approvals->UpdateClusterWideAllocs(limits).ok());
+  EXPECT_TRUE(
+      absl::IsFailedPrecondition(with_new_approvals->UpdateAggregatedInfo(agg_info)));
+}
+
+std::string ReadFile(const std::string& path) {
+  std::ifstream f(path, std::ios::binary);
+  return std::string(std::istreambuf_iterator<char>(f), {});
+}
+
+TEST(FastClusterControllerTest, SavesAndRestoresCheckpoint) {
+  proto::FastClusterControllerConfig config = TestConfig();
+  config.mutable_downgrade_frac_controller()->set_prop_gain(0.5);
+  auto controller = MakeFastClusterController(config);
+  std::vector<std::unique_ptr<ClusterController::Listener>> lis;
+  for (uint64_t host_id = 1; host_id <= 20; ++host_id) {
+    lis.push_back(controller->RegisterListener(
+        host_id, [](const proto::AllocBundle&, const SendBundleAux&) {}));
+  }
+  for (int run = 0; run < 3; ++run) {
+    for (uint64_t host_id = 1; host_id <= 20; ++host_id) {
+      auto info = ParseTextProto<proto::InfoBundle>(R"(
+        timestamp { seconds: 1 }
+        flow_infos {
+          flow { src_dc: "chicago" dst_dc: "detroit" job: "UNSET" }
+          ewma_usage_bps: 100
+        }
+      )");
+      info.mutable_bundler()->set_host_id(host_id);
+      info.mutable_flow_infos(0)->mutable_flow()->set_host_id(host_id);
+      UpdateInfo(controller.get(), info);
+    }
+    controller->ComputeAndBroadcast();
+  }
+  lis.clear();
+
+  const std::string path1 = testing::TempDir() + "/fast-controller-1.ckpt";
+  const std::string path2 = testing::TempDir() + "/fast-controller-2.ckpt";
+  ASSERT_TRUE(controller->SaveCheckpoint(path1).ok());
+
+  auto restored = MakeFastClusterController(config);
+  absl::Status st = restored->RestoreCheckpoint(path1);
+  ASSERT_TRUE(st.ok()) << st;
+  ASSERT_TRUE(restored->SaveCheckpoint(path2).ok());
+  EXPECT_EQ(ReadFile(path1), ReadFile(path2));
+
+  // No FGs in common.
+  auto other = FastClusterController::Create(
+      TestConfig(), ParseTextProto<proto::AllocBundle>(R"(
+        flow_allocs {
+          flow { src_dc: "chicago" dst_dc: "seattle" }
+          hipri_rate_limit_bps: 1000
+        }
+      )"));
+  EXPECT_TRUE(absl::IsFailedPrecondition(other->RestoreCheckpoint(path1)));
+  std::remove(path1.c_str());
+  std::remove(path2.c_str());
+}
+
+TEST(FastClusterControllerTest, RestoresCheckpointAfterApprovalsChange) {
+  proto::FastClusterControllerConfig config = TestConfig();
+  config.mutable_downgrade_frac_controller()->set_prop_gain(0.5);
+  auto controller = MakeFastClusterController(config);
+  // Spread hosts over the ring so that some are downgraded.
+  std::vector<uint64_t> host_ids;
+  for (uint64_t i = 1; i < 16; ++i) {
+    host_ids.push_back(i << 60);
+  }
+  std::vector<std::unique_ptr<ClusterController::Listener>> lis;
+  for (uint64_t host_id : host_ids) {
+    lis.push_back(controller->RegisterListener(
+        host_id, [](const proto::AllocBundle&, const SendBundleAux&) {}));
+  }
+
+  // Retire new_york and add boston, so that detroit is the second of three FGs here
+  // but the first of two for a controller started with the new approvals.
+  const auto new_limits = ParseTextProto<proto::AllocBundle>(R"(
+    flow_allocs {
+      flow { src_dc: "chicago" dst_dc: "detroit" }
+      hipri_rate_limit_bps: 500
+    }
+    flow_allocs {
+      flow { src_dc: "chicago" dst_dc: "boston" }
+      hipri_rate_limit_bps: 300
+    }
+  )");
+  ASSERT_TRUE(controller->UpdateClusterWideAllocs(new_limits).ok());
+  for (int run = 0; run < 3; ++run) {
+    for (uint64_t host_id : host_ids) {
+      auto info = ParseTextProto<proto::InfoBundle>(R"(
+        timestamp { seconds: 1 }
+        flow_infos {
+          flow { src_dc: "chicago" dst_dc: "detroit" job: "UNSET" }
+          ewma_usage_bps: 100
+        }
+      )");
+      info.mutable_bundler()->set_host_id(host_id);
+      info.mutable_flow_infos(0)->mutable_flow()->set_host_id(host_id);
+      UpdateInfo(controller.get(), info);
+    }
+    controller->ComputeAndBroadcast();
+  }
+  lis.clear();
+
+  const std::string path1 = testing::TempDir() + "/fast-controller-reload-1.ckpt";
+  const std::string path2 = testing::TempDir() + "/fast-controller-reload-2.ckpt";
+  ASSERT_TRUE(controller->SaveCheckpoint(path1).ok());
+
+  auto restored = FastClusterController::Create(config, new_limits);
+  absl::Status st = restored->RestoreCheckpoint(path1);
+  ASSERT_TRUE(st.ok()) << st;
+  ASSERT_TRUE(restored->SaveCheckpoint(path2).ok());
+
+  auto saved_or = MappedCheckpoint::Open(path1);
+  auto restored_or = MappedCheckpoint::Open(path2);
+  ASSERT_TRUE(saved_or.ok() && restored_or.ok());
+  const MappedCheckpoint& saved = **saved_or;
+  const MappedCheckpoint& got = **restored_or;
+  ASSERT_EQ(saved.aggs().size(), 3);
+  ASSERT_EQ(got.aggs().size(), 2);
+  EXPECT_TRUE(saved.aggs()[0].retired);
+  EXPECT_EQ(got.aggs()[0].flow_hash, saved.aggs()[1].flow_hash);
+  EXPECT_EQ(got.aggs()[0].downgrade_frac, saved.aggs()[1].downgrade_frac);
+  EXPECT_EQ(got.aggs()[0].ring_frac, saved.aggs()[1].ring_frac);
+  EXPECT_GT(got.aggs()[0].ring_frac, 0);
+
+  // detroit's QoS bit moves from bit 1 to bit 0.
+  ASSERT_THAT(got.host_ids(), testing::ElementsAreArray(saved.host_ids()));
+  int num_lopri = 0;
+  for (size_t i = 0; i < got.host_ids().size(); ++i) {
+    const uint64_t saved_word = saved.lopri_bits()[i * saved.words_per_host()];
+    const uint64_t got_word = got.lopri_bits()[i * got.words_per_host()];
+    EXPECT_EQ(got_word, (saved_word >> 1) & 1) << "host " << got.host_ids()[i];
+    num_lopri += got_word;
+  }
+  EXPECT_GT(num_lopri, 0);
+  std::remove(path1.c_str());
+  std::remove(path2.c_str());
+}
+
+TEST(FastClusterControllerTest, SendsRestoredQoSToReconnectingHosts) {
+  proto::FastClusterControllerConfig config = TestConfig();
+  config.mutable_downgrade_frac_controller()->set_prop_gain(0.5);
+  // Spread hosts over the ring so that some are downgraded.
+  std::vector<uint64_t> host_ids;
+  for (uint64_t i = 1; i < 16; ++i) {
+    host_ids.push_back(i << 60);
+  }
+  auto report_usage = [&host_ids](FastClusterController* controller) {
+    for (uint64_t host_id : host_ids) {
+      auto info = ParseTextProto<proto::InfoBundle>(R"(
+        timestamp { seconds: 1 }
+        flow_infos {
+          flow { src_dc: "chicago" dst_dc: "detroit" job: "UNSET" }
+          ewma_usage_bps: 100
+        }
+      )");
+      info.mutable_bundler()->set_host_id(host_id);
+      info.mutable_flow_infos(0)->mutable_flow()->set_host_id(host_id);
+      UpdateInfo(controller, info);
+    }
+  };
+
+  auto controller = MakeFastClusterController(config);
+  {
+    std::vector<std::unique_ptr<ClusterController::Listener>> lis;
+    for (uint64_t host_id : host_ids) {
+      lis.push_back(controller->RegisterListener(
+          host_id, [](const proto::AllocBundle&, const SendBundleAux&) {}));
+    }
+    for (int run = 0; run < 3; ++run) {
+      report_usage(controller.get());
+      controller->ComputeAndBroadcast();
+    }
+  }
+  const std::string path1 = testing::TempDir() + "/fast-controller-reconnect-1.ckpt";
+  const std::string path2 = testing::TempDir() + "/fast-controller-reconnect-2.ckpt";
+  ASSERT_TRUE(controller->SaveCheckpoint(path1).ok());
+
+  // Hosts reconnect to a restarted controller. Each must be sent the QoS that the
+  // controller restored, whether or not this run changes it.
+  auto restored = MakeFastClusterController(config);
+  ASSERT_TRUE(restored->RestoreCheckpoint(path1).ok());
+  absl::Mutex mu;
+  absl::flat_hash_map<uint64_t, std::vector<proto::AllocBundle>> got;
+  std::vector<std::unique_ptr<ClusterController::Listener>> lis;
+  for (uint64_t host_id : host_ids) {
+    lis.push_back(restored->RegisterListener(
+        host_id, [&mu, &got, host_id](const proto::AllocBundle& b, const SendBundleAux&) {
+          absl::MutexLock l(&mu);
+          got[host_id].push_back(b);
+        }));
+  }
+  report_usage(restored.get());
+  restored->ComputeAndBroadcast();
+  ASSERT_TRUE(restored->SaveCheckpoint(path2).ok());
+
+  auto ckpt_or = MappedCheckpoint::Open(path2);
+  ASSERT_TRUE(ckpt_or.ok());
+  const MappedCheckpoint& ckpt = **ckpt_or;
+  absl::MutexLock l(&mu);
+  int num_lopri = 0;
+  for (size_t i = 0; i < ckpt.host_ids().size(); ++i) {
+    const uint64_t host_id = ckpt.host_ids()[i];
+    ASSERT_EQ(got[host_id].size(), 1) << "host " << host_id;
+    // detroit is FG 1.
+    const bool want_lopri = (ckpt.lopri_bits()[i * ckpt.words_per_host()] >> 1) & 1;
+    bool is_lopri = false;
+    for (const proto::FlowAlloc& a : got[host_id][0].flow_allocs()) {
+      if (a.flow().dst_dc() == "detroit") {
+        is_lopri = a.lopri_rate_limit_bps() > 0;
+      }
+    }
+    EXPECT_EQ(is_lopri, want_lopri) << "host " << host_id;
+    num_lopri += want_lopri;
+  }
+  EXPECT_GT(num_lopri, 0);
+  std::remove(path1.c_str());
+  std::remove(path2.c_str());
 }
 
 }  // namespace
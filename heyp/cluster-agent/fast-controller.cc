@@ -1,7 +1,10 @@
 #include "heyp/cluster-agent/fast-controller.h"
 
 #include "absl/functional/bind_front.h"
+#include "heyp/cluster-agent/checkpoint.h"
 #include "heyp/flows/agg-marker.h"
+#include "heyp/flows/fg-dictionary.h"
+#include "third_party/xxhash/xxhash.h"
 
 namespace heyp {
 namespace {
@@ -22,55 +25,107 @@ AggConfig MakeAggConfig(const proto::AllocBundle& cluster_wide_allocs) {
   return config;
 }
 
+proto::AllocBundle MakeFGDictionary(
+    const proto::FastClusterControllerConfig& config,
+    const std::vector<proto::FlowMarker>& agg_id2flow,
+    const std::vector<int64_t>& approval_bps) {
+  proto::AllocBundle bundle;
+  AddFGDictionary(agg_id2flow, 0, &bundle);
+  if (config.host_side_sampling()) {
+    // Hosts sample with the same parameters that the usage estimators assume.
+    for (int i = 0; i < bundle.fg_dictionary_size(); ++i) {
+      proto::ThresholdSamplingParams* p =
+          bundle.mutable_fg_dictionary(i)->mutable_sampling();
+      p->set_num_samples_at_approval(config.target_num_samples());
+      p->set_approval_bps(approval_bps[i]);
+    }
+  }
+  return bundle;
+}
+
+std::vector<ThresholdSampler> MakeSamplers(
+    const proto::FastClusterControllerConfig& config,
+    const std::vector<int64_t>& approval_bps) {
+  std::vector<ThresholdSampler> samplers;
+  samplers.reserve(approval_bps.size());
+  for (int64_t approval : approval_bps) {
+    samplers.emplace_back(config.target_num_samples(), approval);
+  }
+  return samplers;
+}
+
+uint64_t HashAggFlow(const proto::FlowMarker& flow) {
+  const std::string buf = flow.SerializeAsString();
+  return XXH64(buf.data(), buf.size(), 0);
+}
+
 }  // namespace
 
 std::unique_ptr<FastClusterController> FastClusterController::Create(
     const proto::FastClusterControllerConfig& config,
     const proto::AllocBundle& cluster_wide_allocs) {
   AggConfig agg_config = MakeAggConfig(cluster_wide_allocs);
-  std::vector<ThresholdSampler> samplers;
-  samplers.reserve(agg_config.approval_bps.size());
-  for (int i = 0; i < agg_config.approval_bps.size(); ++i) {
-    samplers.emplace_back(config.target_num_samples(), agg_config.approval_bps[i]);
-  }
-  return absl::WrapUnique(new FastClusterController(
+  auto controller = absl::WrapUnique(new FastClusterController(
       config, std::move(agg_config.flow2id), std::move(agg_config.id2flow),
-      std::move(agg_config.approval_bps), std::move(samplers), config.num_threads()));
+      std::move(agg_config.approval_bps)));
+  if (!config.checkpoint_file().empty()) {
+    absl::Status st = controller->RestoreCheckpoint(config.checkpoint_file());
+    if (st.ok()) {
+      SPDLOG_LOGGER_INFO(&controller->logger_, "restored state from {}",
+                         config.checkpoint_file());
+    } else if (absl::IsNotFound(st)) {
+      SPDLOG_LOGGER_INFO(&controller->logger_, "starting without a checkpoint: {}", st);
+    } else {
+      SPDLOG_LOGGER_WARN(&controller->logger_, "failed to restore checkpoint: {}", st);
+    }
+  }
+  return controller;
 }
 
 FastClusterController::FastClusterController(
     const proto::FastClusterControllerConfig& config, ClusterFlowMap<int64_t> agg_flow2id,
-    std::vector<proto::FlowMarker> agg_id2flow, std::vector<int64_t> approval_bps,
-    std::vector<ThresholdSampler> samplers, int num_threads)
-    : agg_flow2id_(std::move(agg_flow2id)),
+    std::vector<proto::FlowMarker> agg_id2flow, std::vector<int64_t> approval_bps)
+    : config_(config),
+      send_delta_allocs_(config.send_delta_allocs()),
+      min_report_frac_for_crossing_(config.min_report_frac_for_crossing()),
+      checkpoint_file_(config.checkpoint_file()),
+      checkpoint_every_n_runs_(std::max(1, config.checkpoint_every_n_runs())),
+      agg_flow2id_(std::move(agg_flow2id)),
       agg_id2flow_(std::move(agg_id2flow)),
-      approval_bps_(std::move(approval_bps)),
+      agg_retired_(agg_id2flow_.size(), false),
       logger_(MakeLogger("fast-cluster-ctlr")),
-      exec_(num_threads, "ctl-work"),
-      aggregator_(&agg_flow2id_, std::move(samplers)),
+      exec_(config.num_threads(), "ctl-work"),
+      aggregator_(&agg_flow2id_, MakeSamplers(config, approval_bps),
+                  FastAggregator::Config{
+                      .num_shards = config.num_info_shards(),
+                      .shard_capacity = config.info_shard_capacity(),
+                      .expected_num_hosts = config.expected_num_hosts(),
+                      .track_pending_usage = config.track_pending_usage(),
+                  }),
+      approval_bps_(std::move(approval_bps)),
+      last_usage_bps_(approval_bps_.size()),
       agg_selectors_(approval_bps_.size(), HashingDowngradeSelector{}),
+      fg_dictionary_(MakeFGDictionary(config, agg_id2flow_, approval_bps_)),
+      fg_dictionary_chunk_(EncodedAllocBundle::MakeChunk(fg_dictionary_)),
+      child_states_(agg_id2flow_.size()),
       next_lis_id_(1) {
-  agg_states_.reserve(approval_bps_.size());
   if (config.has_downgrade_frac_controller()) {
     SPDLOG_LOGGER_INFO(&logger_, "using feedback control");
-    for (size_t i = 0; i < approval_bps_.size(); ++i) {
-      agg_states_.push_back(PerAggState{PerAggState{
-          .frac_controller = DowngradeFracController(config.downgrade_frac_controller()),
-      }});
-    }
   } else {
     SPDLOG_LOGGER_INFO(&logger_, "not using feedback control");
-    for (size_t i = 0; i < approval_bps_.size(); ++i) {
-      agg_states_.push_back(PerAggState{PerAggState{}});
-    }
+  }
+  agg_states_.reserve(approval_bps_.size());
+  for (size_t i = 0; i < approval_bps_.size(); ++i) {
+    agg_states_.push_back(NewAggState());
   }
 }
 
-void SetAggIsLOPRI(int agg_id, bool is_lopri, std::vector<bool>* agg_is_lopri) {
-  if (agg_id >= agg_is_lopri->size()) {
-    agg_is_lopri->resize(agg_id + 1, false);
+FastClusterController::PerAggState FastClusterController::NewAggState() const {
+  PerAggState state;
+  if (config_.has_downgrade_frac_controller()) {
+    state.frac_controller = DowngradeFracController(config_.downgrade_frac_controller());
   }
-  (*agg_is_lopri)[agg_id] = is_lopri;
+  return state;
 }
 
 static proto::AllocBundle CreateBroadcastBundle(
@@ -88,61 +143,249 @@ constexpr int64_t kMaxChildBandwidthBps =
     100 * (static_cast<int64_t>(1) << 30);  // 100 Gbps
 }
 
-void FastClusterController::BroadcastStateUnconditional(
-    const SendBundleAux& aux, proto::AllocBundle* base_bundle,
-    FastClusterController::ChildState& state) {
-  H_SPDLOG_CHECK_LE(&logger_, state.agg_is_lopri.size(), base_bundle->flow_allocs_size());
-  for (int i = 0; i < base_bundle->flow_allocs_size(); ++i) {
-    bool is_lopri = false;
-    if (i < state.agg_is_lopri.size()) {
-      is_lopri = state.agg_is_lopri[i];
-    }
-    proto::FlowAlloc* alloc = base_bundle->mutable_flow_allocs(i);
-    if (is_lopri) {
-      alloc->set_hipri_rate_limit_bps(0);
-      alloc->set_lopri_rate_limit_bps(kMaxChildBandwidthBps);
-    } else {
-      alloc->set_hipri_rate_limit_bps(kMaxChildBandwidthBps);
-      alloc->set_lopri_rate_limit_bps(0);
+static void SetAllocRates(bool is_lopri, proto::FlowAlloc* alloc) {
+  if (is_lopri) {
+    alloc->set_hipri_rate_limit_bps(0);
+    alloc->set_lopri_rate_limit_bps(kMaxChildBandwidthBps);
+  } else {
+    alloc->set_hipri_rate_limit_bps(kMaxChildBandwidthBps);
+    alloc->set_lopri_rate_limit_bps(0);
+  }
+}
+
+static void SetFlowAllocs(const std::vector<uint64_t>& lopri_bits,
+                          proto::AllocBundle* bundle) {
+  for (int i = 0; i < bundle->flow_allocs_size(); ++i) {
+    const bool is_lopri = (lopri_bits[i / 64] >> (i % 64)) & 1;
+    SetAllocRates(is_lopri, bundle->mutable_flow_allocs(i));
+  }
+}
+
+EncodedAllocBundle::Chunk FastClusterController::FullAllocsChunk(
+    const std::vector<uint64_t>& lopri_bits, proto::AllocBundle* base_bundle,
+    BundleCache* cache) {
+  EncodedAllocBundle::Chunk& cached = cache->full[lopri_bits];
+  if (cached == nullptr) {
+    SetFlowAllocs(lopri_bits, base_bundle);
+    base_bundle->set_gen(0);
+    cached = EncodedAllocBundle::MakeChunk(*base_bundle);
+  }
+  return cached;
+}
+
+EncodedAllocBundle::Chunk FastClusterController::DeltaAllocsChunk(
+    const std::vector<uint64_t>& last_sent_lopri_bits,
+    const std::vector<uint64_t>& lopri_bits, BundleCache* cache) {
+  H_SPDLOG_CHECK_EQ(&logger_, last_sent_lopri_bits.size(), lopri_bits.size());
+  cache->delta_key.clear();
+  for (int32_t w = 0; w < lopri_bits.size(); ++w) {
+    uint64_t changed = lopri_bits[w] ^ last_sent_lopri_bits[w];
+    while (changed != 0) {
+      const int32_t b = __builtin_ctzll(changed);
+      changed &= changed - 1;
+      const int32_t agg_id = 64 * w + b;
+      cache->delta_key.push_back(2 * agg_id + ((lopri_bits[w] >> b) & 1));
     }
   }
-  base_bundle->set_gen(0);
-  if (state.saw_data_this_run) {
-    base_bundle->set_gen(state.gen_seen);
+  if (auto iter = cache->delta.find(cache->delta_key); iter != cache->delta.end()) {
+    return iter->second;
   }
-  for (auto& [lis_id, on_new_bundle_func] : state.lis_new_bundle_funcs) {
-    on_new_bundle_func(*base_bundle, aux);
+
+  cache->delta_bundle.clear_flow_allocs();
+  for (int32_t k : cache->delta_key) {
+    proto::FlowAlloc* alloc = cache->delta_bundle.add_flow_allocs();
+    *alloc->mutable_flow() = agg_id2flow_[k / 2];
+    SetAllocRates(k % 2 == 1, alloc);
   }
+  EncodedAllocBundle::Chunk chunk = EncodedAllocBundle::MakeChunk(cache->delta_bundle);
+  cache->delta.emplace(cache->delta_key, chunk);
+  return chunk;
+}
+
+void FastClusterController::Broadcast(const SendBundleAux& aux,
+                                      proto::AllocBundle* base_bundle,
+                                      BundleCache* cache, ParID par_id) {
+  child_states_.ClearBroadcastMark(par_id);
+  child_states_.CopyLOPRIBits(par_id, &cache->lopri_bits);
+  const std::vector<uint64_t>& lopri_bits = cache->lopri_bits;
+  const int64_t gen = child_states_.GenIfSeenThisEpoch(par_id);
+
+  host_listeners_.OnID(par_id, [&](HostListeners& host) {
+    EncodedAllocBundle::Chunk full_allocs;
+    bool filled_base_bundle = false;
+    for (auto& [lis_id, lis] : host.listeners) {
+      // The listener's first bundle, or the FGs changed.
+      const bool needs_fg_dictionary =
+          lis.sent_fg_dictionary_version != fg_dictionary_version_;
+      if (lis.on_new_encoded_bundle_func) {
+        EncodedAllocBundle encoded;
+        if (send_delta_allocs_ && !lis.needs_full && !needs_fg_dictionary) {
+          encoded.AddChunk(DeltaAllocsChunk(lis.last_sent_lopri_bits, lopri_bits, cache));
+          encoded.SetSeq(lis.num_sent + 1, lis.num_sent);
+        } else {
+          if (full_allocs == nullptr) {
+            full_allocs = FullAllocsChunk(lopri_bits, base_bundle, cache);
+            filled_base_bundle = false;  // gen may have been cleared
+          }
+          encoded.AddChunk(full_allocs);
+          if (send_delta_allocs_) {
+            encoded.SetSeq(lis.num_sent + 1, 0);
+          }
+        }
+        if (needs_fg_dictionary) {
+          encoded.AddChunk(fg_dictionary_chunk_);
+        }
+        encoded.SetGen(gen);
+        lis.on_new_encoded_bundle_func(encoded, aux);
+        lis.sent_fg_dictionary_version = fg_dictionary_version_;
+        if (send_delta_allocs_) {
+          ++lis.num_sent;
+          lis.needs_full = false;
+          lis.last_sent_lopri_bits = lopri_bits;
+        }
+        continue;
+      }
+
+      if (!filled_base_bundle) {
+        SetFlowAllocs(lopri_bits, base_bundle);
+        base_bundle->set_gen(gen);
+        filled_base_bundle = true;
+      }
+      if (!needs_fg_dictionary) {
+        lis.on_new_bundle_func(*base_bundle, aux);
+      } else {
+        *base_bundle->mutable_fg_dictionary() = fg_dictionary_.fg_dictionary();
+        lis.on_new_bundle_func(*base_bundle, aux);
+        base_bundle->clear_fg_dictionary();
+        lis.sent_fg_dictionary_version = fg_dictionary_version_;
+      }
+    }
+  });
 }
 
-void FastClusterController::BroadcastStateIfUpdated(
-    const SendBundleAux& aux, proto::AllocBundle* base_bundle,
-    FastClusterController::ChildState& state) {
-  if (state.broadcasted_latest_state) {
-    return;
+void FastClusterController::UpdateInfo(ParID bundler_id, const proto::InfoBundle& info) {
+  if (info.needs_full_alloc()) {
+    ResendFullAllocs(info.bundler().host_id());
   }
-  BroadcastStateUnconditional(aux, base_bundle, state);
-  state.broadcasted_latest_state = true;
+  CountHostReport(bundler_id, info.bundler().host_id());
+  aggregator_.UpdateInfo(info);
 }
 
-std::unique_ptr<ClusterController::Listener> FastClusterController::RegisterListener(
-    uint64_t host_id, const OnNewBundleFunc& on_new_bundle_func) {
-  GetResult res = child_states_.GetID(host_id);
+ParID FastClusterController::GetBundlerID(const proto::FlowMarker& bundler) {
+  return GetHostParID(bundler.host_id()).id;
+}
+
+GetResult FastClusterController::GetHostParID(uint64_t host_id) {
+  GetResult res = host_listeners_.GetID(host_id);
   if (res.just_created) {
+    host_listeners_.OnID(res.id, [host_id](HostListeners& host) { host.host_id = host_id; });
     absl::MutexLock l(&mu_);
     new_host_id_pairs_.push_back({host_id, res.id});
   }
+  return res;
+}
+
+void FastClusterController::CountHostReport(ParID bundler_id, uint64_t host_id) {
+  const int64_t epoch = report_epoch_.load(std::memory_order_relaxed);
+  bool matched = false;
+  bool first_report = false;
+  auto count = [&](HostListeners& host) {
+    matched = true;
+    first_report = host.reported_epoch != epoch;
+    host.reported_epoch = epoch;
+  };
+  // Callers that did not get bundler_id from GetBundlerID pay for a lookup.
+  if (bundler_id >= 0 && bundler_id < host_listeners_.NumIDs()) {
+    host_listeners_.OnID(bundler_id, [&](HostListeners& host) {
+      if (host.host_id == host_id) {
+        count(host);
+      }
+    });
+  }
+  if (!matched) {
+    GetResult res = GetHostParID(host_id);
+    if (res.id < 0) {
+      return;
+    }
+    host_listeners_.OnID(res.id, [&](HostListeners& host) {
+      host.host_id = host_id;  // in case GetHostParID raced with another caller
+      count(host);
+    });
+  }
+  if (first_report) {
+    num_hosts_reported_.fetch_add(1, std::memory_order_relaxed);
+  }
+}
+
+absl::Status FastClusterController::UpdateAggregatedInfo(
+    const proto::AggregatedInfoBundle& info) {
+  {
+    absl::MutexLock l(&mu_);
+    if (changed_approvals_) {
+      return absl::FailedPreconditionError(
+          "approvals have changed since startup and aggregator-agents only support "
+          "the FGs they started with");
+    }
+    has_aggregators_ = true;
+  }
+  for (const proto::HostGen& hg : info.host_gens()) {
+    if (hg.needs_full_alloc()) {
+      ResendFullAllocs(hg.host_id());
+    }
+  }
+  num_hosts_reported_.fetch_add(info.host_gens_size(), std::memory_order_relaxed);
+  aggregator_.UpdateAggregatedInfo(info);
+  return absl::OkStatus();
+}
+
+void FastClusterController::ResendFullAllocs(uint64_t host_id) {
+  GetResult res = GetHostParID(host_id);
+  host_listeners_.OnID(res.id, [](HostListeners& host) {
+    for (auto& [lis_id, lis] : host.listeners) {
+      lis.needs_full = true;
+    }
+  });
+  absl::MutexLock l(&mu_);
+  resync_par_ids_.push_back(res.id);
+}
+
+std::unique_ptr<ClusterController::Listener> FastClusterController::RegisterListener(
+    uint64_t host_id, const OnNewBundleFunc& on_new_bundle_func) {
+  return AddListener(host_id, ListenerState{
+                                  .on_new_bundle_func = on_new_bundle_func,
+                              });
+}
+
+std::unique_ptr<ClusterController::Listener>
+FastClusterController::RegisterEncodedListener(
+    uint64_t host_id, const OnNewEncodedBundleFunc& on_new_bundle_func) {
+  return AddListener(host_id, ListenerState{
+                                  .on_new_encoded_bundle_func = on_new_bundle_func,
+                              });
+}
+
+std::unique_ptr<ClusterController::Listener> FastClusterController::AddListener(
+    uint64_t host_id, ListenerState lis_state) {
+  GetResult res = GetHostParID(host_id);
 
   auto lis = absl::WrapUnique(new Listener());
   lis->host_par_id_ = res.id;
   lis->lis_id_ = next_lis_id_.fetch_add(1, std::memory_order_seq_cst);
   lis->controller_ = this;
 
-  child_states_.OnID(res.id, [&](ChildState& state) {
-    state.lis_new_bundle_funcs[lis->lis_id_] = on_new_bundle_func;
+  host_listeners_.OnID(res.id, [&](HostListeners& host) {
+    if (host.listeners.empty()) {
+      num_hosts_with_listeners_.fetch_add(1, std::memory_order_relaxed);
+    }
+    host.listeners[lis->lis_id_] = std::move(lis_state);
     // SPDLOG_LOGGER_INFO(&logger_, "add lis {} for host id = {} (par id = {})",
     //                    lis->lis_id_, host_id, lis->host_par_id_);
   });
+
+  // Send the new listener a full bundle (with the FG dictionary) in the next run.
+  // Otherwise hosts that stay HIPRI would never hear from us.
+  absl::MutexLock l(&mu_);
+  resync_par_ids_.push_back(res.id);
   return lis;
 }
 
@@ -151,13 +394,17 @@ FastClusterController::Listener::Listener()
 
 FastClusterController::Listener::~Listener() {
   if (controller_ != nullptr) {
-    controller_->child_states_.OnID(
-        host_par_id_, [&](FastClusterController::ChildState& state) {
-          ABSL_ASSERT(state.lis_new_bundle_funcs.contains(lis_id_));
+    controller_->host_listeners_.OnID(
+        host_par_id_, [&](FastClusterController::HostListeners& host) {
+          ABSL_ASSERT(host.listeners.contains(lis_id_));
           // SPDLOG_LOGGER_INFO(&controller_->logger_, "remove lis {} for host par id =
           // {}",
           //                    lis_id_, host_par_id_);
-          state.lis_new_bundle_funcs.erase(lis_id_);
+          host.listeners.erase(lis_id_);
+          if (host.listeners.empty()) {
+            controller_->num_hosts_with_listeners_.fetch_sub(1,
+                                                             std::memory_order_relaxed);
+          }
         });
   }
   host_par_id_ = 0;
@@ -165,177 +412,400 @@ FastClusterController::Listener::~Listener() {
   controller_ = nullptr;
 }
 
-void ForEachSelected(const absl::btree_map<uint64_t, ParID>& id2par, UnorderedIds ids,
-                     absl::FunctionRef<void(uint64_t, ParID)> func) {
-  for (IdRange r : ids.ranges) {
-    for (auto iter = id2par.lower_bound(r.lo);
-         iter != id2par.end() && iter->first <= r.hi /* inclusive */; ++iter) {
-      func(iter->first, iter->second);
-    }
+NewInfoSummary FastClusterController::SummarizeNewInfo() {
+  absl::ReaderMutexLock l(&fgs_mu_);
+  FastAggregator::PendingUsage pending;
+  aggregator_.GetPendingUsage(&pending);
+
+  NewInfoSummary summary;
+  summary.frac_hosts_reported =
+      static_cast<double>(num_hosts_reported_.load(std::memory_order_relaxed)) /
+      static_cast<double>(std::max<int64_t>(
+          1, num_hosts_with_listeners_.load(std::memory_order_relaxed)));
+  if (!config_.track_pending_usage() ||
+      summary.frac_hosts_reported < min_report_frac_for_crossing_ ||
+      summary.frac_hosts_reported <= 0) {
+    return summary;
   }
-
-  for (uint64_t p : ids.points) {
-    if (auto iter = id2par.find(p); iter != id2par.end()) {
-      func(iter->first, iter->second);
-    }
+  const double scale = 1 / std::min(1.0, summary.frac_hosts_reported);
+  for (size_t i = 0; i < pending.est_bps.size(); ++i) {
+    const bool was_above =
+        last_usage_bps_[i].load(std::memory_order_relaxed) > approval_bps_[i];
+    const bool is_above = pending.est_bps[i] * scale > approval_bps_[i];
+    summary.num_fgs_crossed_approval += was_above != is_above;
   }
+  return summary;
 }
 
 void FastClusterController::ComputeAndBroadcast() {
   auto start_time = std::chrono::steady_clock::now();
 
+  // Step 0: Switch to new approvals, if there are any.
+  std::optional<proto::AllocBundle> new_cluster_wide_allocs;
+  {
+    absl::MutexLock l(&mu_);
+    new_cluster_wide_allocs.swap(new_cluster_wide_allocs_);
+  }
+  if (new_cluster_wide_allocs.has_value()) {
+    ApplyClusterWideAllocs(*new_cluster_wide_allocs);
+  }
+
   // Step 1: Get a snapshot and catch up on Host, Par IDs
+  report_epoch_.fetch_add(1, std::memory_order_relaxed);
+  num_hosts_reported_.store(0, std::memory_order_relaxed);
   const std::vector<FastAggInfo> snap_infos =
       aggregator_.CollectSnapshot(&exec_, agg_selectors_);
+  std::vector<ParID> resync_par_ids;
   {
     absl::MutexLock l(&mu_);
-    for (auto p : new_host_id_pairs_) {
-      host2par_[p.first] = p.second;
-    }
+    host2par_.Add(new_host_id_pairs_);
     new_host_id_pairs_.clear();
+    resync_par_ids.swap(resync_par_ids_);
+  }
+  child_states_.Resize(host_listeners_.NumIDs());
+  child_states_.NextEpoch();
+  if (new_cluster_wide_allocs.has_value()) {
+    // Every host needs the new FG dictionary.
+    for (ParID par_id = 0; par_id < child_states_.size(); ++par_id) {
+      resync_par_ids.push_back(par_id);
+    }
+  }
+
+  // Hosts that asked for a full bundle are contacted even if nothing changed.
+  std::vector<ParID> par_ids_to_resync;
+  for (ParID par_id : resync_par_ids) {
+    if (child_states_.MarkForBroadcast(par_id)) {
+      par_ids_to_resync.push_back(par_id);
+    }
   }
 
-  std::unique_ptr<TaskGroup> tasks = exec_.NewTaskGroup();
 
   // Step 2: Perform downgrade and update state in parallel for each FG.
   std::vector<std::vector<ParID>> par_ids_to_bcast(snap_infos.size(),
                                                    std::vector<ParID>{});
-  for (int agg_id = 0; agg_id < snap_infos.size(); ++agg_id) {
-    tasks->AddTaskNoStatus([&snap_infos, &par_ids_to_bcast, this, agg_id] {
-      // Step 2.1: Compute LOPRI frac
-      const FastAggInfo& info = snap_infos[agg_id];
-      int64_t hipri_admission = approval_bps_[agg_id];
-
-      PerAggState& agg_state = agg_states_[agg_id];
-      double frac_lopri = 0;
-      if (agg_state.frac_controller) {
-        constexpr double kEwmaWeight = 0.3;
-        double max_child_usage = 0;
-        for (auto& child : info.children()) {
-          if (child.volume_bps > max_child_usage) {
-            max_child_usage = child.volume_bps;
-          }
-        }
-        if (agg_state.ewma_max_child_usage < 0) {
-          agg_state.ewma_max_child_usage = max_child_usage;
-        } else {
-          agg_state.ewma_max_child_usage =
-              kEwmaWeight * max_child_usage +
-              (1 - kEwmaWeight) * agg_state.ewma_max_child_usage;
-        }
-
-        double downgrade_frac_inc = 0;
-        if (info.parent().ewma_usage_bps() < hipri_admission) {
-          downgrade_frac_inc = -0.2;
-        } else {
-          downgrade_frac_inc = agg_state.frac_controller->TrafficFracToDowngrade(
-              info.parent().ewma_hipri_usage_bps(), info.parent().ewma_lopri_usage_bps(),
-              hipri_admission, agg_state.ewma_max_child_usage);
+  auto update_agg = [&snap_infos, &par_ids_to_bcast, this](int64_t agg_id) {
+    // Step 2.1: Compute LOPRI frac
+    if (agg_retired_[agg_id]) {
+      return;
+    }
+    const FastAggInfo& info = snap_infos[agg_id];
+    int64_t hipri_admission = approval_bps_[agg_id];
+    last_usage_bps_[agg_id].store(info.parent().ewma_usage_bps(),
+                                  std::memory_order_relaxed);
+
+    PerAggState& agg_state = agg_states_[agg_id];
+    double frac_lopri = 0;
+    if (agg_state.frac_controller) {
+      constexpr double kEwmaWeight = 0.3;
+      double max_child_usage = 0;
+      for (auto& child : info.children()) {
+        if (child.volume_bps > max_child_usage) {
+          max_child_usage = child.volume_bps;
         }
-        agg_state.downgrade_frac += downgrade_frac_inc;
-        agg_state.downgrade_frac = ClampFracLOPRISilent(agg_state.downgrade_frac);
-        frac_lopri = agg_state.downgrade_frac;
+      }
+      if (agg_state.ewma_max_child_usage < 0) {
+        agg_state.ewma_max_child_usage = max_child_usage;
       } else {
-        const int64_t lopri_bps =
-            std::max<int64_t>(0, info.parent().ewma_usage_bps() - hipri_admission);
-        frac_lopri = static_cast<double>(lopri_bps) /
-                     static_cast<double>(info.parent().ewma_usage_bps());
-        frac_lopri = ClampFracLOPRI(&logger_, frac_lopri);
+        agg_state.ewma_max_child_usage =
+            kEwmaWeight * max_child_usage +
+            (1 - kEwmaWeight) * agg_state.ewma_max_child_usage;
       }
 
-      SPDLOG_LOGGER_INFO(&logger_,
-                         "allocating agg = ({}, {}) approval = {} est-usage = {} "
-                         "#samples = {} lopri-frac = {}",
-                         info.parent().flow().src_dc(), info.parent().flow().dst_dc(),
-                         hipri_admission, info.parent().ewma_usage_bps(),
-                         info.children().size(), frac_lopri);
-
-      // Step 2.2: Select LOPRI children
-      DowngradeDiff downgrade_diff =
-          agg_selectors_[agg_id].PickChildren(info, frac_lopri, &logger_);
-
-      // Step 2.3: Record which children we just heard from (for monitoring response time)
-      for (const auto& hg : info.info_gen()) {
-        auto iter = host2par_.find(hg.host_id);
-        if (iter != host2par_.end()) {
-          child_states_.OnID(iter->second, [hg](ChildState& state) {
-            state.gen_seen = std::max(hg.gen, state.gen_seen);
-            state.saw_data_this_run = true;
-          });
-        }
+      double downgrade_frac_inc = 0;
+      if (info.parent().ewma_usage_bps() < hipri_admission) {
+        downgrade_frac_inc = -0.2;
+      } else {
+        downgrade_frac_inc = agg_state.frac_controller->TrafficFracToDowngrade(
+            info.parent().ewma_hipri_usage_bps(), info.parent().ewma_lopri_usage_bps(),
+            hipri_admission, agg_state.ewma_max_child_usage);
       }
+      agg_state.downgrade_frac += downgrade_frac_inc;
+      agg_state.downgrade_frac = ClampFracLOPRISilent(agg_state.downgrade_frac);
+      frac_lopri = agg_state.downgrade_frac;
+    } else {
+      const int64_t lopri_bps =
+          std::max<int64_t>(0, info.parent().ewma_usage_bps() - hipri_admission);
+      frac_lopri = static_cast<double>(lopri_bps) /
+                   static_cast<double>(info.parent().ewma_usage_bps());
+      frac_lopri = ClampFracLOPRI(&logger_, frac_lopri);
+    }
 
-      // Step 2.4: Update child states and record which children we need to contact.
-      ForEachSelected(host2par_, downgrade_diff.to_downgrade,
-                      [agg_id, &par_ids_to_bcast, this](uint64_t host_id, ParID par_id) {
+    SPDLOG_LOGGER_INFO(&logger_,
+                       "allocating agg = ({}, {}) approval = {} est-usage = {} "
+                       "#samples = {} lopri-frac = {}",
+                       info.parent().flow().src_dc(), info.parent().flow().dst_dc(),
+                       hipri_admission, info.parent().ewma_usage_bps(),
+                       info.children().size(), frac_lopri);
+
+    // Step 2.2: Select LOPRI children
+    DowngradeDiff downgrade_diff =
+        agg_selectors_[agg_id].PickChildren(info, frac_lopri, &logger_);
+
+    // Step 2.3: Update child states and record which children we need to contact.
+    ForEachSelected(host2par_, downgrade_diff.to_downgrade,
+                    [agg_id, &par_ids_to_bcast, this](uint64_t host_id, ParID par_id) {
+                      child_states_.SetLOPRI(par_id, agg_id, true);
+                      if (child_states_.MarkForBroadcast(par_id)) {
                         par_ids_to_bcast[agg_id].push_back(par_id);
-                        child_states_.OnID(par_id, [agg_id](ChildState& state) {
-                          SetAggIsLOPRI(agg_id, true, &state.agg_is_lopri);
-                          state.broadcasted_latest_state = false;
-                        });
-                      });
-
-      ForEachSelected(host2par_, downgrade_diff.to_upgrade,
-                      [agg_id, &par_ids_to_bcast, this](uint64_t host_id, ParID par_id) {
+                      }
+                    });
+
+    ForEachSelected(host2par_, downgrade_diff.to_upgrade,
+                    [agg_id, &par_ids_to_bcast, this](uint64_t host_id, ParID par_id) {
+                      child_states_.SetLOPRI(par_id, agg_id, false);
+                      if (child_states_.MarkForBroadcast(par_id)) {
                         par_ids_to_bcast[agg_id].push_back(par_id);
-                        child_states_.OnID(par_id, [agg_id](ChildState& state) {
-                          SetAggIsLOPRI(agg_id, false, &state.agg_is_lopri);
-                          state.broadcasted_latest_state = false;
-                        });
-                      });
+                      }
+                    });
+  };
+  exec_.ParallelFor(0, snap_infos.size(), /*grain=*/1, update_agg);
+
+  // Step 2.4: Record which children we just heard from (for monitoring response time).
+  // The host generations are shared by all FGs, so this is a single pass over hosts.
+  if (!snap_infos.empty()) {
+    const std::vector<FastAggInfo::HostInfoGen>& info_gen = snap_infos[0].info_gen();
+    exec_.ParallelFor(0, info_gen.size(), /*grain=*/4096, [&info_gen, this](int64_t i) {
+      if (ParID par_id = host2par_.Find(info_gen[i].host_id); par_id != -1) {
+        child_states_.RecordData(par_id, info_gen[i].gen);
+      }
     });
   }
-  tasks->WaitAllNoStatus();
+
+  par_ids_to_bcast.push_back(std::move(par_ids_to_resync));
 
   SendBundleAux aux{
       .compute_start = start_time,
   };
 
   // Step 3: Notify (affected) children about any changes.
-  tasks = exec_.NewTaskGroup();
-  const int num_bcast_shard = exec_.num_workers();
-  for (int bcast_shard = 0; bcast_shard < num_bcast_shard; ++bcast_shard) {
-    tasks->AddTaskNoStatus([&aux, num_bcast_shard, bcast_shard, &par_ids_to_bcast, this] {
-      for (int vec_i = 0; vec_i < par_ids_to_bcast.size(); ++vec_i) {
-        proto::AllocBundle base_bundle = CreateBroadcastBundle(agg_id2flow_);
-        auto bcast_func = [&aux, &base_bundle, this](ChildState& state) {
-          this->BroadcastStateIfUpdated(aux, &base_bundle, state);
-        };
-        for (int i = 0;
-             i < (par_ids_to_bcast[vec_i].size() + num_bcast_shard - 1) / num_bcast_shard;
-             ++i) {
-          int j = bcast_shard + i * num_bcast_shard;
-          if (j >= par_ids_to_bcast[vec_i].size()) {
-            break;
-          }
-          child_states_.OnID(par_ids_to_bcast[vec_i][j], bcast_func);
+  const int num_bcast_shard = std::max<int>(1, exec_.num_workers());
+  auto bcast_shard_func = [&aux, num_bcast_shard, &par_ids_to_bcast,
+                           this](int64_t bcast_shard) {
+    BundleCache cache;
+    for (int vec_i = 0; vec_i < par_ids_to_bcast.size(); ++vec_i) {
+      proto::AllocBundle base_bundle = CreateBroadcastBundle(agg_id2flow_);
+      for (int i = 0;
+           i < (par_ids_to_bcast[vec_i].size() + num_bcast_shard - 1) / num_bcast_shard;
+           ++i) {
+        int j = bcast_shard + i * num_bcast_shard;
+        if (j >= par_ids_to_bcast[vec_i].size()) {
+          break;
         }
+        Broadcast(aux, &base_bundle, &cache, par_ids_to_bcast[vec_i][j]);
       }
-    });
+    }
+  };
+  exec_.ParallelFor(0, num_bcast_shard, /*grain=*/1, bcast_shard_func);
+
+  absl::Duration elapsed =
+      absl::FromChrono(std::chrono::steady_clock::now() - start_time);
+  SPDLOG_LOGGER_INFO(&logger_, "compute+bcast time = {}", elapsed);
+
+  if (!checkpoint_file_.empty() && ++num_runs_ % checkpoint_every_n_runs_ == 0) {
+    absl::Status st = SaveCheckpoint(checkpoint_file_);
+    if (!st.ok()) {
+      SPDLOG_LOGGER_WARN(&logger_, "failed to save checkpoint: {}", st);
+    }
+  }
+}
+
+absl::Status FastClusterController::UpdateClusterWideAllocs(
+    const proto::AllocBundle& cluster_wide_allocs) {
+  ClusterFlowMap<bool> seen;
+  for (const proto::FlowAlloc& a : cluster_wide_allocs.flow_allocs()) {
+    if (!seen.insert({a.flow(), true}).second) {
+      return absl::InvalidArgumentError(
+          absl::StrCat("duplicate approval for FG ", a.flow().ShortDebugString()));
+    }
+  }
+  absl::MutexLock l(&mu_);
+  if (has_aggregators_) {
+    return absl::FailedPreconditionError(
+        "approvals cannot be changed once aggregator-agents have reported");
   }
-  tasks->WaitAllNoStatus();
+  changed_approvals_ = true;
+  new_cluster_wide_allocs_ = cluster_wide_allocs;
+  return absl::OkStatus();
+}
 
-  // Step 4: Reset saw_data_this_run to false
-  tasks = exec_.NewTaskGroup();
-  for (int agg_id = 0; agg_id < snap_infos.size(); ++agg_id) {
-    tasks->AddTaskNoStatus([&snap_infos , this, agg_id] {
+void FastClusterController::ApplyClusterWideAllocs(
+    const proto::AllocBundle& cluster_wide_allocs) {
+  const size_t old_num_aggs = agg_id2flow_.size();
+  std::vector<bool> was_retired = agg_retired_;
+  std::vector<int64_t> approval_bps = approval_bps_;
+  agg_retired_.assign(old_num_aggs, true);
+  for (const proto::FlowAlloc& a : cluster_wide_allocs.flow_allocs()) {
+    auto [iter, added] = agg_flow2id_.insert({a.flow(), agg_id2flow_.size()});
+    if (added) {
+      agg_id2flow_.push_back(ToClusterFlow(a.flow()));
+      agg_retired_.push_back(false);
+      approval_bps.push_back(a.hipri_rate_limit_bps());
+    } else {
+      agg_retired_[iter->second] = false;
+      approval_bps[iter->second] = a.hipri_rate_limit_bps();
+    }
+  }
+  const size_t num_aggs = agg_id2flow_.size();
+
+  // Retired FGs start over if they come back. Until then, all hosts are HIPRI (with
+  // no limit) for them.
+  int num_retired = 0;
+  int num_restored = 0;
+  child_states_.GrowAggs(num_aggs);
+  for (size_t i = 0; i < old_num_aggs; ++i) {
+    if (agg_retired_[i] && !was_retired[i]) {
+      ++num_retired;
+      agg_states_[i] = NewAggState();
+      agg_selectors_[i] = HashingDowngradeSelector{};
+      for (ParID par_id = 0; par_id < child_states_.size(); ++par_id) {
+        child_states_.SetLOPRI(par_id, i, false);
+      }
+    } else if (!agg_retired_[i] && was_retired[i]) {
+      ++num_restored;
+    }
+  }
+  for (size_t i = old_num_aggs; i < num_aggs; ++i) {
+    agg_states_.push_back(NewAggState());
+  }
+  agg_selectors_.resize(num_aggs, HashingDowngradeSelector{});
 
-      const FastAggInfo& info = snap_infos[agg_id];
-      for (const auto& hg : info.info_gen()) {
-        auto iter = host2par_.find(hg.host_id);
-        if (iter != host2par_.end()) {
-          child_states_.OnID(iter->second, [&](ChildState& state) {
-            state.saw_data_this_run = false;
-          });
-        }
+  {
+    absl::MutexLock l(&fgs_mu_);
+    aggregator_.UpdateFGs(agg_flow2id_, MakeSamplers(config_, approval_bps),
+                          agg_retired_);
+    std::vector<std::atomic<int64_t>> last_usage_bps(num_aggs);
+    for (size_t i = 0; i < old_num_aggs; ++i) {
+      if (!agg_retired_[i]) {
+        last_usage_bps[i].store(last_usage_bps_[i].load(std::memory_order_relaxed),
+                                std::memory_order_relaxed);
       }
+    }
+    last_usage_bps_.swap(last_usage_bps);
+    approval_bps_ = std::move(approval_bps);
+  }
+
+  fg_dictionary_ = MakeFGDictionary(config_, agg_id2flow_, approval_bps_);
+  fg_dictionary_chunk_ = EncodedAllocBundle::MakeChunk(fg_dictionary_);
+  ++fg_dictionary_version_;
+
+  SPDLOG_LOGGER_INFO(&logger_,
+                     "switched to new approvals: {} FGs added, {} retired, {} restored",
+                     num_aggs - old_num_aggs, num_retired, num_restored);
+}
+
+absl::Status FastClusterController::SaveCheckpoint(const std::string& path) {
+  CheckpointData data;
+  data.aggs.reserve(agg_states_.size());
+  for (size_t i = 0; i < agg_states_.size(); ++i) {
+    const HashRing& ring = agg_selectors_[i].lopri_ring();
+    data.aggs.push_back(CheckpointAggState{
+        .flow_hash = HashAggFlow(agg_id2flow_[i]),
+        .retired = agg_retired_[i],
+        .ring_start = ring.start(),
+        .ring_frac = ring.frac(),
+        .downgrade_frac = agg_states_[i].downgrade_frac,
+        .ewma_max_child_usage = agg_states_[i].ewma_max_child_usage,
+        .last_usage_bps = last_usage_bps_[i].load(std::memory_order_relaxed),
     });
   }
-  tasks->WaitAllNoStatus();
 
-  absl::Duration elapsed =
-      absl::FromChrono(std::chrono::steady_clock::now() - start_time);
-  SPDLOG_LOGGER_INFO(&logger_, "compute+bcast time = {}", elapsed);
+  data.words_per_host = child_states_.words_per_child();
+  data.host_ids.reserve(host2par_.size());
+  data.lopri_bits.reserve(host2par_.size() * data.words_per_host);
+  std::vector<uint64_t> words;
+  for (size_t i = 0; i < host2par_.size(); ++i) {
+    const ParID par_id = host2par_.par_id(i);
+    if (par_id >= child_states_.size()) {
+      continue;
+    }
+    data.host_ids.push_back(host2par_.host_id(i));
+    child_states_.CopyLOPRIBits(par_id, &words);
+    data.lopri_bits.insert(data.lopri_bits.end(), words.begin(), words.end());
+  }
+  return WriteCheckpoint(path, data);
+}
+
+absl::Status FastClusterController::RestoreCheckpoint(const std::string& path) {
+  absl::StatusOr<std::unique_ptr<MappedCheckpoint>> ckpt_or =
+      MappedCheckpoint::Open(path);
+  if (!ckpt_or.ok()) {
+    return ckpt_or.status();
+  }
+  const MappedCheckpoint& ckpt = **ckpt_or;
+  absl::Span<const CheckpointAggState> ckpt_aggs = ckpt.aggs();
+  const int ckpt_words_per_host = ckpt.words_per_host();
+  if (static_cast<int64_t>(ckpt_words_per_host) * 64 < ckpt_aggs.size()) {
+    return absl::DataLossError(
+        absl::StrCat("checkpoint ", path, " has too few QoS words per host"));
+  }
+
+  // Match FGs by flow since ids follow the order in which FGs were added, which a
+  // restart with changed approvals does not reproduce.
+  absl::flat_hash_map<uint64_t, int64_t> ckpt_agg_by_flow;
+  for (size_t i = 0; i < ckpt_aggs.size(); ++i) {
+    if (!ckpt_aggs[i].retired) {
+      ckpt_agg_by_flow[ckpt_aggs[i].flow_hash] = i;
+    }
+  }
+  std::vector<int64_t> ckpt_agg_ids(agg_states_.size(), -1);
+  bool same_ids = ckpt_aggs.size() == agg_states_.size() &&
+                  ckpt_words_per_host == child_states_.words_per_child();
+  int num_matched = 0;
+  for (size_t i = 0; i < agg_states_.size(); ++i) {
+    auto iter = ckpt_agg_by_flow.find(HashAggFlow(agg_id2flow_[i]));
+    if (iter != ckpt_agg_by_flow.end()) {
+      ckpt_agg_ids[i] = iter->second;
+      ++num_matched;
+    }
+    same_ids = same_ids && ckpt_agg_ids[i] == i;
+  }
+  if (num_matched == 0) {
+    return absl::FailedPreconditionError(
+        absl::StrCat("checkpoint ", path, " shares no FGs with the current approvals"));
+  }
+
+  for (size_t i = 0; i < agg_states_.size(); ++i) {
+    if (ckpt_agg_ids[i] < 0) {
+      continue;
+    }
+    const CheckpointAggState& s = ckpt_aggs[ckpt_agg_ids[i]];
+    agg_selectors_[i].set_lopri_ring(HashRing(s.ring_start, s.ring_frac));
+    agg_states_[i].downgrade_frac = s.downgrade_frac;
+    agg_states_[i].ewma_max_child_usage = s.ewma_max_child_usage;
+    last_usage_bps_[i].store(s.last_usage_bps, std::memory_order_relaxed);
+  }
+
+  // Hosts get their ParIDs now so that their QoS bits are in place when they
+  // reconnect.
+  absl::Span<const uint64_t> host_ids = ckpt.host_ids();
+  std::vector<std::pair<uint64_t, ParID>> pairs;
+  pairs.reserve(host_ids.size());
+  for (uint64_t host_id : host_ids) {
+    const ParID par_id = host_listeners_.GetID(host_id).id;
+    host_listeners_.OnID(par_id, [host_id](HostListeners& host) { host.host_id = host_id; });
+    pairs.push_back({host_id, par_id});
+  }
+  host2par_.Add(pairs);
+  child_states_.Resize(host_listeners_.NumIDs());
+
+  const uint64_t* bits = ckpt.lopri_bits().data();
+  std::vector<uint64_t> words(child_states_.words_per_child());
+  for (size_t i = 0; i < pairs.size(); ++i) {
+    const uint64_t* host_bits = bits + i * ckpt_words_per_host;
+    if (same_ids) {
+      child_states_.SetLOPRIBits(pairs[i].second, host_bits);
+      continue;
+    }
+    std::fill(words.begin(), words.end(), 0);
+    for (size_t agg_id = 0; agg_id < ckpt_agg_ids.size(); ++agg_id) {
+      const int64_t ckpt_id = ckpt_agg_ids[agg_id];
+      if (ckpt_id >= 0 && (host_bits[ckpt_id / 64] >> (ckpt_id % 64)) & 1) {
+        words[agg_id / 64] |= uint64_t{1} << (agg_id % 64);
+      }
+    }
+    child_states_.SetLOPRIBits(pairs[i].second, words.data());
+  }
+  return absl::OkStatus();
 }
 
 }  // namespace heyp
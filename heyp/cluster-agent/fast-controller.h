@@ -2,20 +2,25 @@
 #define HEYP_CLUSTER_AGENT_FAST_CONTROLLER_H_
 
 #include <atomic>
+#include <optional>
 
-#include "absl/container/btree_map.h"
+#include "absl/container/flat_hash_map.h"
 #include "absl/functional/function_ref.h"
+#include "absl/status/status.h"
 #include "heyp/alg/downgrade/impl-hashing.h"
 #include "heyp/alg/sampler.h"
 #include "heyp/alg/unordered-ids.h"
+#include "heyp/cluster-agent/child-state-table.h"
 #include "heyp/cluster-agent/controller-iface.h"
+#include "heyp/cluster-agent/encoded-bundle.h"
 #include "heyp/cluster-agent/fast-aggregator.h"
+#include "heyp/cluster-agent/host-index.h"
 #include "heyp/cluster-agent/per-agg-allocators/util.h"
 #include "heyp/flows/map.h"
 #include "heyp/proto/config.pb.h"
 #include "heyp/proto/heyp.pb.h"
-#include "heyp/threads/executor.h"
 #include "heyp/threads/par-indexed-map.h"
+#include "heyp/threads/work-stealing-executor.h"
 
 namespace heyp {
 
@@ -29,21 +34,57 @@ class FastClusterController : public ClusterController {
       const proto::FastClusterControllerConfig& config,
       const proto::AllocBundle& cluster_wide_allocs);
 
-  void UpdateInfo(ParID bundler_id, const proto::InfoBundle& info) override {
-    aggregator_.UpdateInfo(info);
-  }
+  void UpdateInfo(ParID bundler_id, const proto::InfoBundle& info) override;
+
+  // Fails if the approvals were changed since startup: aggregator-agents sum usage for
+  // the FGs they started with.
+  absl::Status UpdateAggregatedInfo(const proto::AggregatedInfoBundle& info) override;
 
   void ComputeAndBroadcast() override;
 
+  // Scales the usage reported since the last snapshot by the fraction of hosts that
+  // reported it to detect approval crossings. Hosts are only counted once per snapshot,
+  // out of those with a listener.
+  NewInfoSummary SummarizeNewInfo() override;
+
+  // Saves the state needed to resume downgrade after a restart.
+  // Must not be called concurrently with ComputeAndBroadcast.
+  absl::Status SaveCheckpoint(const std::string& path);
+
+  // Replaces the cluster-wide approvals. FGs missing from cluster_wide_allocs are
+  // retired (their hosts are made HIPRI and their usage is ignored) and new ones are
+  // added. Host streams stay up: each host is sent the new FG dictionary with its next
+  // bundle.
+  //
+  // Fails once an aggregator-agent has reported since, unlike hosts, aggregator-agents
+  // are never sent the new FGs.
+  //
+  // Thread-safe. The change is applied at the start of the next ComputeAndBroadcast.
+  absl::Status UpdateClusterWideAllocs(
+      const proto::AllocBundle& cluster_wide_allocs) override;
+
+  // Restores state saved by SaveCheckpoint. Must be called before any listeners are
+  // registered. FGs are matched by flow, so a checkpoint taken after the approvals
+  // were changed still applies to a controller started with the new approvals. FGs
+  // that are not in the checkpoint start over. Fails if no FG is in the checkpoint.
+  //
+  // Restored hosts are sent their QoS once they reconnect (as every new listener is
+  // sent a full bundle), since the checkpoint may predate what they last enforced.
+  absl::Status RestoreCheckpoint(const std::string& path);
+
   class Listener;
 
   // on_new_bundle_func should not block.
   std::unique_ptr<ClusterController::Listener> RegisterListener(
       uint64_t host_id, const OnNewBundleFunc& on_new_bundle_func) override;
 
-  ParID GetBundlerID(const proto::FlowMarker& bundler) override {
-    return 0; /* currently unused by FastClusterController */
-  }
+  // Hosts with the same QoS assignment share one serialized bundle body.
+  std::unique_ptr<ClusterController::Listener> RegisterEncodedListener(
+      uint64_t host_id, const OnNewEncodedBundleFunc& on_new_bundle_func) override;
+
+  // Returns the host's ParID. UpdateInfo uses it to count the host's reports without
+  // looking it up again.
+  ParID GetBundlerID(const proto::FlowMarker& bundler) override;
 
   class Listener : public ClusterController::Listener {
    public:
@@ -66,15 +107,24 @@ class FastClusterController : public ClusterController {
   FastClusterController(const proto::FastClusterControllerConfig& config,
                         ClusterFlowMap<int64_t> agg_flow2id,
                         std::vector<proto::FlowMarker> agg_id2flow,
-                        std::vector<int64_t> approval_bps,
-                        std::vector<ThresholdSampler> samplers, int num_threads);
+                        std::vector<int64_t> approval_bps);
 
-  const ClusterFlowMap<int64_t> agg_flow2id_;
-  const std::vector<proto::FlowMarker> agg_id2flow_;
-  const std::vector<int64_t> approval_bps_;
+  const proto::FastClusterControllerConfig config_;
+  const bool send_delta_allocs_;
+  const double min_report_frac_for_crossing_;
+  const std::string checkpoint_file_;
+  const int checkpoint_every_n_runs_;
+  int64_t num_runs_ = 0;
+
+  // The FGs. These are only changed by ApplyClusterWideAllocs, which runs at the
+  // start of ComputeAndBroadcast. Ids are never reused: retired FGs keep theirs in
+  // case they come back.
+  ClusterFlowMap<int64_t> agg_flow2id_;
+  std::vector<proto::FlowMarker> agg_id2flow_;
+  std::vector<bool> agg_retired_;
 
   spdlog::logger logger_;
-  Executor exec_;
+  WorkStealingExecutor exec_;
   FastAggregator aggregator_;
 
   struct PerAggState {
@@ -83,31 +133,111 @@ class FastClusterController : public ClusterController {
     std::optional<DowngradeFracController> frac_controller;
   };
 
+  PerAggState NewAggState() const;
+
   std::vector<PerAggState> agg_states_;
+
+  // Approvals and the usage of each agg in the last snapshot, read by
+  // SummarizeNewInfo. ComputeAndBroadcast only needs fgs_mu_ to resize them.
+  absl::Mutex fgs_mu_;
+  std::vector<int64_t> approval_bps_;
+  std::vector<std::atomic<int64_t>> last_usage_bps_;
+
   std::vector<HashingDowngradeSelector> agg_selectors_;
 
+  // The fg_dictionary for all aggregate flows (and serialized once). Listeners are
+  // resent it whenever its version changes.
+  proto::AllocBundle fg_dictionary_;
+  EncodedAllocBundle::Chunk fg_dictionary_chunk_;
+  uint64_t fg_dictionary_version_ = 1;
+
+  // Per-host state that is updated on every run. Only used by ComputeAndBroadcast.
+  ChildStateTable child_states_;
+
   std::atomic<uint64_t> next_lis_id_;
-  struct ChildState {
-    std::vector<bool> agg_is_lopri;
-    absl::flat_hash_map<uint64_t, OnNewBundleFunc> lis_new_bundle_funcs;
-    int64_t gen_seen = 0;
-    bool broadcasted_latest_state = false;
-    bool saw_data_this_run = false;
+  struct ListenerState {
+    // Exactly one of these is set.
+    OnNewBundleFunc on_new_bundle_func;
+    OnNewEncodedBundleFunc on_new_encoded_bundle_func;
+    uint64_t sent_fg_dictionary_version = 0;
+
+    // Only used for encoded listeners when send_delta_allocs_ is set.
+    uint64_t num_sent = 0;
+    bool needs_full = true;
+    std::vector<uint64_t> last_sent_lopri_bits;
+  };
+  struct HostListeners {
+    absl::flat_hash_map<uint64_t, ListenerState> listeners;
+    uint64_t host_id = 0;  // set once the ParID is handed out by GetHostParID
+
+    // The last report epoch that the host reported in (see num_hosts_reported_).
+    int64_t reported_epoch = -1;
+  };
+
+  // Listeners of each host. Assigns the ParIDs used to index child_states_.
+  //
+  // Only touched to add/remove listeners, to count reports and when broadcasting to a
+  // host.
+  ParIndexedMap<uint64_t, HostListeners, absl::flat_hash_map<uint64_t, ParID>>
+      host_listeners_;
+
+  std::unique_ptr<ClusterController::Listener> AddListener(uint64_t host_id,
+                                                          ListenerState lis_state);
+
+  // Looks up (or assigns) the ParID of host_id in host_listeners_. New hosts are
+  // queued to be added to host2par_.
+  GetResult GetHostParID(uint64_t host_id);
+
+  // Counts a report from host_id, whose ParID is likely bundler_id, towards
+  // num_hosts_reported_ if it is the host's first in this epoch.
+  void CountHostReport(ParID bundler_id, uint64_t host_id);
+
+  // Number of distinct hosts that reported since ComputeAndBroadcast last took a
+  // snapshot (each host of an aggregator-agent's bundle counts once per bundle), and
+  // the number of hosts with at least one listener. Read by SummarizeNewInfo.
+  //
+  // Each snapshot starts a new report epoch. Reports that race with it may be counted
+  // in either epoch.
+  std::atomic<int64_t> report_epoch_{0};
+  std::atomic<int64_t> num_hosts_reported_{0};
+  std::atomic<int64_t> num_hosts_with_listeners_{0};
+
+  // Serialized flow_allocs shared by hosts that are sent the same allocations.
+  // Each broadcast shard keeps its own cache so that they need not synchronize.
+  struct BundleCache {
+    // Keyed by the QoS bitset.
+    absl::flat_hash_map<std::vector<uint64_t>, EncodedAllocBundle::Chunk> full;
+    // Keyed by the changed aggs (2 * agg_id + is_lopri).
+    absl::flat_hash_map<std::vector<int32_t>, EncodedAllocBundle::Chunk> delta;
+
+    std::vector<uint64_t> lopri_bits;  // scratch
+    std::vector<int32_t> delta_key;    // scratch
+    proto::AllocBundle delta_bundle;   // scratch
   };
-  ParIndexedMap<uint64_t, ChildState, absl::flat_hash_map<uint64_t, ParID>> child_states_;
 
   // base_bundle should have flows_allocs[i].flow populated for all aggregate flows.
-  void BroadcastStateUnconditional(const SendBundleAux& aux,
-                                   proto::AllocBundle* base_bundle, ChildState& state);
-  void BroadcastStateIfUpdated(const SendBundleAux& aux, proto::AllocBundle* base_bundle,
-                               ChildState& state);
+  void Broadcast(const SendBundleAux& aux, proto::AllocBundle* base_bundle,
+                 BundleCache* cache, ParID par_id);
+
+  EncodedAllocBundle::Chunk FullAllocsChunk(const std::vector<uint64_t>& lopri_bits,
+                                            proto::AllocBundle* base_bundle,
+                                            BundleCache* cache);
+  EncodedAllocBundle::Chunk DeltaAllocsChunk(
+      const std::vector<uint64_t>& last_sent_lopri_bits,
+      const std::vector<uint64_t>& lopri_bits, BundleCache* cache);
+
+  // Makes the next bundles sent to host_id full ones.
+  void ResendFullAllocs(uint64_t host_id);
+
+  // Switches to the approvals in cluster_wide_allocs (see UpdateClusterWideAllocs).
+  void ApplyClusterWideAllocs(const proto::AllocBundle& cluster_wide_allocs);
 
-  // A copy of the id map in child_states_ that is maintained so that we don't need to
+  // A copy of the id map in host_listeners_ that is maintained so that we don't need to
   // synchronize between UpdateInfo and ComputeAndBroadcast.
   // Additionally, we can specialize the respresentations to serve each use the best.
   //
   // Only used by ComputeAndBroadcast.
-  absl::btree_map<uint64_t, ParID> host2par_;
+  HostIndex host2par_;
 
   // A list of new host ID information that will be drained and added to host2par_ when
   // ComputeAndBroadcast runs.
@@ -115,11 +245,18 @@ class FastClusterController : public ClusterController {
   // Pushed to in RegisterListener and drained in ComputeAndBroadcast.
   absl::Mutex mu_;
   std::vector<std::pair<uint64_t, ParID>> new_host_id_pairs_ ABSL_GUARDED_BY(mu_);
-};
 
-// Time complexity: O(log(id2par) * (ids.ranges + ids.points))
-void ForEachSelected(const absl::btree_map<uint64_t, ParID>& id2par, UnorderedIds ids,
-                     absl::FunctionRef<void(uint64_t, ParID)> func);
+  // Hosts that asked for a full bundle or have a new listener. They will be sent one
+  // in the next ComputeAndBroadcast, even if their allocations did not change.
+  std::vector<ParID> resync_par_ids_ ABSL_GUARDED_BY(mu_);
+
+  // Approvals to switch to in the next ComputeAndBroadcast.
+  std::optional<proto::AllocBundle> new_cluster_wide_allocs_ ABSL_GUARDED_BY(mu_);
+
+  // Approvals can only be changed if no aggregator-agent has reported and vice versa.
+  bool changed_approvals_ ABSL_GUARDED_BY(mu_) = false;
+  bool has_aggregators_ ABSL_GUARDED_BY(mu_) = false;
+};
 
 }  // namespace heyp
 
@@ -28,7 +28,8 @@ extern bool DebugShouldProbeLOPRI;
 
 namespace {
 
-FullClusterController MakeFullClusterController() {
+FullClusterController MakeFullClusterController(
+    FullClusterController::Config config = {}) {
   return FullClusterController(
       NewHostToClusterAggregator(
           absl::make_unique<BweDemandPredictor>(absl::Seconds(5), 1.0, 500),
@@ -52,7 +53,8 @@ FullClusterController MakeFullClusterController() {
                                  }
                                )"),
                                1)
-          .value());
+          .value(),
+      config);
 }
 
 void UpdateInfo(FullClusterController* c, const proto::InfoBundle& b) {
@@ -151,6 +153,124 @@ TEST(FullClusterControllerTest, RemoveListener) {
   EXPECT_EQ(num_broadcast_3, 0);
 }
 
+TEST(FullClusterControllerTest, SendsFGDictionaryOnce) {
+  auto controller = MakeFullClusterController();
+
+  std::vector<proto::AllocBundle> got;
+  auto lis = controller.RegisterListener(
+      1, [&got](const proto::AllocBundle& b, const SendBundleAux&) { got.push_back(b); });
+
+  auto info = ParseTextProto<proto::InfoBundle>(R"(
+    bundler { host_id: 1 }
+    timestamp { seconds: 1 }
+    flow_infos {
+      flow { src_dc: "chicago" dst_dc: "detroit" job: "UNSET" host_id: 1 }
+      predicted_demand_bps: 1000
+      ewma_usage_bps: 1000
+    }
+    flow_infos {
+      flow { src_dc: "chicago" dst_dc: "new_york" job: "UNSET" host_id: 1 }
+      predicted_demand_bps: 1000
+      ewma_usage_bps: 1000
+    }
+  )");
+  UpdateInfo(&controller, info);
+  controller.ComputeAndBroadcast();
+  info.mutable_timestamp()->set_seconds(2);
+  UpdateInfo(&controller, info);
+  controller.ComputeAndBroadcast();
+
+  ASSERT_EQ(got.size(), 2);
+  ASSERT_EQ(got[0].fg_dictionary_size(), 2);
+  EXPECT_EQ(got[0].fg_dictionary(0).id(), 1);
+  EXPECT_EQ(got[0].fg_dictionary(1).id(), 2);
+  EXPECT_THAT(got[1].fg_dictionary(), testing::IsEmpty());
+
+  // Each dictionary entry names an FG that was allocated.
+  for (const proto::FGDictionaryEntry& e : got[0].fg_dictionary()) {
+    EXPECT_EQ(e.flow().src_dc(), "chicago");
+    EXPECT_THAT(e.flow().dst_dc(), testing::AnyOf("detroit", "new_york"));
+    EXPECT_EQ(e.flow().job(), "");
+  }
+}
+
+TEST(FullClusterControllerTest, BroadcastsToManyHostsInParallel) {
+  constexpr int kNumHosts = 300;
+  auto controller = MakeFullClusterController({.num_threads = 4});
+
+  std::vector<std::vector<proto::AllocBundle>> got(kNumHosts + 1);
+  std::vector<std::unique_ptr<ClusterController::Listener>> listeners;
+  for (uint64_t host = 1; host <= kNumHosts; ++host) {
+    listeners.push_back(controller.RegisterListener(
+        host, [&got, host](const proto::AllocBundle& b, const SendBundleAux&) {
+          got[host].push_back(b);
+        }));
+  }
+
+  for (uint64_t host = 1; host <= kNumHosts; ++host) {
+    proto::InfoBundle info;
+    info.mutable_bundler()->set_host_id(host);
+    info.mutable_timestamp()->set_seconds(1);
+    proto::FlowInfo* fi = info.add_flow_infos();
+    fi->mutable_flow()->set_src_dc("chicago");
+    fi->mutable_flow()->set_dst_dc(host % 2 == 0 ? "new_york" : "detroit");
+    fi->mutable_flow()->set_job("UNSET");
+    fi->mutable_flow()->set_host_id(host);
+    fi->set_predicted_demand_bps(1);
+    fi->set_ewma_usage_bps(1);
+    UpdateInfo(&controller, info);
+  }
+  controller.ComputeAndBroadcast();
+
+  for (uint64_t host = 1; host <= kNumHosts; ++host) {
+    ASSERT_EQ(got[host].size(), 1) << "host " << host;
+    const proto::AllocBundle& b = got[host][0];
+    ASSERT_EQ(b.flow_allocs_size(), 1);
+    EXPECT_EQ(b.flow_allocs(0).flow().host_id(), host);
+    EXPECT_EQ(b.flow_allocs(0).flow().dst_dc(), host % 2 == 0 ? "new_york" : "detroit");
+    EXPECT_EQ(b.fg_dictionary_size(), 2);
+  }
+}
+
+TEST(FullClusterControllerTest, SkipsUnchangedBundles) {
+  auto controller = MakeFullClusterController({
+      .skip_unchanged_bundles = true,
+      .refresh_after_skips = 2,
+  });
+
+  std::vector<proto::AllocBundle> got1;
+  std::vector<proto::AllocBundle> got2;
+  auto lis1 = controller.RegisterListener(
+      1, [&got1](const proto::AllocBundle& b, const SendBundleAux&) { got1.push_back(b); });
+
+  auto info = ParseTextProto<proto::InfoBundle>(R"(
+    bundler { host_id: 1 }
+    flow_infos {
+      flow { src_dc: "chicago" dst_dc: "new_york" job: "UNSET" host_id: 1 }
+      predicted_demand_bps: 1000
+      ewma_usage_bps: 1000
+    }
+  )");
+  std::unique_ptr<ClusterController::Listener> lis2;
+  for (int sec = 1; sec <= 5; ++sec) {
+    if (sec == 3) {
+      // New listeners get a bundle even if the host's allocs are unchanged.
+      lis2 = controller.RegisterListener(
+          1, [&got2](const proto::AllocBundle& b, const SendBundleAux&) {
+            got2.push_back(b);
+          });
+    }
+    info.mutable_timestamp()->set_seconds(sec);
+    UpdateInfo(&controller, info);
+    controller.ComputeAndBroadcast();
+  }
+
+  // lis1 is sent a bundle in the 1st period, skipped twice, then refreshed in the 4th.
+  ASSERT_EQ(got1.size(), 2);
+  EXPECT_THAT(got1[0], AllocBundleEq(got1[1]));
+  EXPECT_EQ(got2.size(), 1);
+}
+
 TEST(FullClusterControllerTest, PlumbsDataCompletely) {
   auto controller = MakeFullClusterController();
 
@@ -1,10 +1,15 @@
 #include "heyp/cluster-agent/full-controller.h"
 
+#include <cmath>
+
 #include "absl/base/macros.h"
 #include "heyp/alg/debug.h"
 #include "heyp/cluster-agent/allocator.h"
 #include "heyp/cluster-agent/allocs.h"
+#include "heyp/flows/agg-marker.h"
+#include "heyp/flows/fg-dictionary.h"
 #include "heyp/log/spdlog.h"
+#include "heyp/proto/alg.h"
 #include "heyp/proto/heyp.pb.h"
 
 namespace heyp {
@@ -14,22 +19,42 @@ static constexpr absl::Duration kLongStateLockDur = absl::Milliseconds(100);
 
 FullClusterController::FullClusterController(std::unique_ptr<FlowAggregator> aggregator,
                                              std::unique_ptr<ClusterAllocator> allocator)
-    : aggregator_(std::move(aggregator)),
+    : FullClusterController(std::move(aggregator), std::move(allocator), Config{}) {}
+
+FullClusterController::FullClusterController(std::unique_ptr<FlowAggregator> aggregator,
+                                             std::unique_ptr<ClusterAllocator> allocator,
+                                             Config config)
+    : config_(config),
+      aggregator_(std::move(aggregator)),
       allocator_(std::move(allocator)),
       logger_(MakeLogger("cluster-ctlr")),
-      last_alloc_bundle_(std::make_shared<const LastBundleMap>()),
-      next_lis_id_(1) {}
+      last_alloc_bundle_(std::make_shared<const AllocSnapshot>(AllocSnapshot{
+          .by_shard = std::vector<LastBundleMap>(kNumShards),
+          .fg_index = std::make_shared<const ClusterFlowMap<int64_t>>(),
+          .fg_flows = std::make_shared<const std::vector<proto::FlowMarker>>(),
+      })),
+      shared_fg_index_(last_alloc_bundle_->fg_index),
+      shared_fg_flows_(last_alloc_bundle_->fg_flows),
+      next_lis_id_(1),
+      listener_shards_(new ListenerShard[kNumShards]),
+      exec_(config_.num_threads, "ctl-bcast") {}
+
+int FullClusterController::ShardOf(uint64_t host_id) {
+  // Host ids may be small integers, so mix the bits first.
+  return static_cast<int>(((host_id * 0x9e3779b97f4a7c15) >> 32) % kNumShards);
+}
 
 FullClusterController::Listener::Listener()
     : host_id_(0), lis_id_(0), controller_(nullptr) {}
 
 FullClusterController::Listener::~Listener() {
   if (controller_ != nullptr && host_id_ != 0) {
-    MutexLockWarnLong l(&controller_->broadcasting_mu_, kLongBcastLockDur,
-                        &controller_->logger_, "broadcasting_mu_ in ~Listenener");
-    ABSL_ASSERT(controller_->new_bundle_funcs_.contains(host_id_));
-    ABSL_ASSERT(controller_->new_bundle_funcs_.at(host_id_).contains(lis_id_));
-    controller_->new_bundle_funcs_.at(host_id_).erase(lis_id_);
+    ListenerShard& shard = controller_->listener_shards_[ShardOf(host_id_)];
+    MutexLockWarnLong l(&shard.mu, kLongBcastLockDur, &controller_->logger_,
+                        "listener shard mu in ~Listenener");
+    ABSL_ASSERT(shard.listeners.contains(host_id_));
+    ABSL_ASSERT(shard.listeners.at(host_id_).contains(lis_id_));
+    shard.listeners.at(host_id_).erase(lis_id_);
   }
   host_id_ = 0;
   lis_id_ = 0;
@@ -41,11 +66,13 @@ std::unique_ptr<ClusterController::Listener> FullClusterController::RegisterList
   auto lis = absl::WrapUnique(new Listener());
   lis->host_id_ = host_id;
   lis->controller_ = this;
-  MutexLockWarnLong l(&broadcasting_mu_, kLongBcastLockDur, &logger_,
-                      "broadcasting_mu_ in RegisterListener");
-  lis->lis_id_ = next_lis_id_;
-  new_bundle_funcs_[host_id][next_lis_id_] = on_new_bundle_func;
-  next_lis_id_++;
+  lis->lis_id_ = next_lis_id_.fetch_add(1, std::memory_order_relaxed);
+  ListenerShard& shard = listener_shards_[ShardOf(host_id)];
+  MutexLockWarnLong l(&shard.mu, kLongBcastLockDur, &logger_,
+                      "listener shard mu in RegisterListener");
+  shard.listeners[host_id][lis->lis_id_] = ListenerState{
+      .on_new_bundle_func = on_new_bundle_func,
+  };
   return lis;
 }
 
@@ -53,38 +80,47 @@ std::unique_ptr<ClusterController::Listener> FullClusterController::RegisterList
 // - 0 if the flow is marked to use HIPRI
 // - 1 if the flow is marked to use LOPRI
 // - 2 otherwise
-static int LookupAlloc(const absl::flat_hash_map<uint64_t, proto::AllocBundle>& bundles,
-                       uint64_t host_id, const proto::FlowMarker& flow) {
-  auto biter = bundles.find(host_id);
-  if (biter == bundles.end()) {
+//
+// Uses the FG id that the host tagged fi with, if any, to avoid hashing DCs.
+static int LookupAlloc(const ClusterFlowMap<int64_t>& fg_index,
+                       const std::vector<proto::FlowMarker>& fg_flows,
+                       const std::vector<int8_t>& qos_by_fg, const proto::FlowInfo& fi) {
+  const int64_t fg = LookupFGIndex(fg_index, fg_flows, fi);
+  if (fg < 0 || fg >= qos_by_fg.size()) {
     return 2;
   }
-  CompareFlowOptions cmp_opt{
-      .cmp_fg = true,
-      .cmp_job = false,
-      .cmp_src_host = false,
-      .cmp_host_flow = false,
-      .cmp_seqnum = false,
-  };
-  for (const proto::FlowAlloc& alloc : biter->second.flow_allocs()) {
-    if (IsSameFlow(alloc.flow(), flow, cmp_opt)) {
-      if (alloc.lopri_rate_limit_bps() > 0) {
-        return 1;
-      }
-      return 0;
-    }
+  return qos_by_fg[fg];
+}
+
+// Records the QoS of alloc unless an earlier alloc for the same FG did.
+static void SetQoSIfUnset(int64_t fg, const proto::FlowAlloc& alloc,
+                          std::vector<int8_t>* qos_by_fg) {
+  if (fg >= qos_by_fg->size()) {
+    qos_by_fg->resize(fg + 1, 2);
+  }
+  if ((*qos_by_fg)[fg] == 2) {
+    (*qos_by_fg)[fg] = alloc.lopri_rate_limit_bps() > 0 ? 1 : 0;
   }
-  return 2;
 }
 
 void FullClusterController::UpdateInfo(ParID bundler_id, const proto::InfoBundle& info) {
-  proto::InfoBundle info_with_intended_qos = info;
-  std::shared_ptr<const LastBundleMap> last_alloc_bundle =
+  std::shared_ptr<const AllocSnapshot> last_alloc_bundle =
       std::atomic_load(&last_alloc_bundle_);
-  for (int i = 0; i < info_with_intended_qos.flow_infos_size(); ++i) {
-    proto::FlowInfo* fi = info_with_intended_qos.mutable_flow_infos(i);
-    int alloc = LookupAlloc(*last_alloc_bundle,
-                            info_with_intended_qos.bundler().host_id(), fi->flow());
+  const uint64_t host_id = info.bundler().host_id();
+  num_infos_since_compute_.fetch_add(1, std::memory_order_relaxed);
+  const LastBundleMap& by_host = last_alloc_bundle->by_shard[ShardOf(host_id)];
+  auto host_iter = by_host.find(host_id);
+  const HostAllocs* host_allocs =
+      host_iter == by_host.end() ? nullptr : &host_iter->second;
+
+  // Override the QoS reported by the host with the one we asked for, as the
+  // aggregator stores each FlowInfo.
+  aggregator_->Update(bundler_id, info, [&](proto::FlowInfo* fi) {
+    int alloc = 2;
+    if (host_allocs != nullptr) {
+      alloc = LookupAlloc(*last_alloc_bundle->fg_index, *last_alloc_bundle->fg_flows,
+                          host_allocs->qos_by_fg, *fi);
+    }
     // Per-QoS usage should be unset. It's only used at the Cluster FG level.
     // Still, reset as a defensive measure.
     fi->set_ewma_hipri_usage_bps(0);
@@ -100,17 +136,63 @@ void FullClusterController::UpdateInfo(ParID bundler_id, const proto::InfoBundle
         // leave QoS alone
         break;
     }
+  });
+}
+
+// Returns true if cur allocates the same flows as prev (in the same order) with
+// rate limits that are within tolerance of prev's and zero in the same places.
+static bool SameAllocs(const proto::AllocBundle& prev, const proto::AllocBundle& cur,
+                       double tolerance) {
+  if (prev.flow_allocs_size() != cur.flow_allocs_size()) {
+    return false;
+  }
+  auto close = [tolerance](int64_t prev_bps, int64_t cur_bps) {
+    if ((prev_bps == 0) != (cur_bps == 0)) {
+      return false;
+    }
+    return std::abs(cur_bps - prev_bps) <= tolerance * prev_bps;
+  };
+  for (int i = 0; i < cur.flow_allocs_size(); ++i) {
+    const proto::FlowAlloc& p = prev.flow_allocs(i);
+    const proto::FlowAlloc& c = cur.flow_allocs(i);
+    if (!close(p.hipri_rate_limit_bps(), c.hipri_rate_limit_bps()) ||
+        !close(p.lopri_rate_limit_bps(), c.lopri_rate_limit_bps()) ||
+        !IsSameFlow(p.flow(), c.flow())) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool FullClusterController::ShouldSkip(const ListenerState& lis,
+                                       const proto::AllocBundle& bundle) const {
+  if (!lis.sent_any || lis.num_fgs_sent < fg_flows_.size()) {
+    return false;  // the listener needs a bundle (or FG dictionary entries)
   }
-  aggregator_->Update(bundler_id, info_with_intended_qos);
+  if (config_.refresh_after_skips > 0 && lis.num_skipped >= config_.refresh_after_skips) {
+    return false;
+  }
+  return SameAllocs(lis.last_sent, bundle, config_.rate_limit_tolerance);
 }
 
 ParID FullClusterController::GetBundlerID(const proto::FlowMarker& bundler) {
   return aggregator_->GetBundlerID(bundler);
 }
 
+NewInfoSummary FullClusterController::SummarizeNewInfo() {
+  std::shared_ptr<const AllocSnapshot> last_alloc_bundle =
+      std::atomic_load(&last_alloc_bundle_);
+  return {
+      .frac_hosts_reported =
+          static_cast<double>(num_infos_since_compute_.load(std::memory_order_relaxed)) /
+          static_cast<double>(std::max<int64_t>(1, last_alloc_bundle->num_hosts)),
+  };
+}
+
 void FullClusterController::ComputeAndBroadcast() {
   auto start_time = std::chrono::steady_clock::now();
   SPDLOG_LOGGER_INFO(&logger_, "starting compute+bcast");
+  num_infos_since_compute_.store(0, std::memory_order_relaxed);
 
   const bool should_debug = DebugQosAndRateLimitSelection();
   state_mu_.Lock(kLongStateLockDur, &logger_, "state_mu_ in ComputeAndBroadcast");
@@ -131,23 +213,105 @@ void FullClusterController::ComputeAndBroadcast() {
     SPDLOG_LOGGER_INFO(&logger_, "got allocs: {}", allocs);
   }
 
-  std::shared_ptr<const LastBundleMap> alloc_bundles =
-      std::make_shared<const LastBundleMap>(BundleByHost(std::move(allocs)));
-
-  broadcasting_mu_.Lock(kLongBcastLockDur, &logger_,
-                        "broadcasting_mu_ in ComputeAndBroadcast");
-  int num = 0;
-  for (auto& [host, bundle] : *alloc_bundles) {
-    auto iter = new_bundle_funcs_.find(host);
-    if (iter != new_bundle_funcs_.end()) {
-      for (auto& [id, func] : iter->second) {
-        func(bundle, SendBundleAux{});
-        ++num;
+  // Group allocs by shard, then build each shard's per-host bundles in parallel.
+  std::vector<std::vector<proto::FlowAlloc>>& sets = allocs.partial_sets;
+  std::vector<std::vector<std::vector<int32_t>>> shard_members(sets.size());
+  exec_.ParallelFor(0, sets.size(), 1, [&](int64_t i) {
+    shard_members[i].resize(kNumShards);
+    for (int32_t j = 0; j < sets[i].size(); ++j) {
+      shard_members[i][ShardOf(sets[i][j].flow().host_id())].push_back(j);
+    }
+  });
+
+  auto alloc_bundles = std::make_shared<AllocSnapshot>();
+  alloc_bundles->by_shard.resize(kNumShards);
+
+  // FGs that are missing from fg_index_ are assigned ids after the parallel phase so
+  // that fg_index_ is read-only while shards are built.
+  struct UnindexedAlloc {
+    HostAllocs* h;
+    int index;
+  };
+  std::vector<std::vector<UnindexedAlloc>> unindexed(kNumShards);
+  exec_.ParallelFor(0, kNumShards, 1, [&](int64_t shard) {
+    LastBundleMap& by_host = alloc_bundles->by_shard[shard];
+    for (size_t i = 0; i < sets.size(); ++i) {
+      for (int32_t j : shard_members[i][shard]) {
+        HostAllocs& h = by_host[sets[i][j].flow().host_id()];
+        h.bundle.mutable_flow_allocs()->Add(std::move(sets[i][j]));
       }
     }
+    for (auto& [host, h] : by_host) {
+      for (int k = 0; k < h.bundle.flow_allocs_size(); ++k) {
+        const proto::FlowAlloc& alloc = h.bundle.flow_allocs(k);
+        auto iter = fg_index_.find(alloc.flow());
+        if (iter == fg_index_.end()) {
+          unindexed[shard].push_back({&h, k});
+        } else {
+          SetQoSIfUnset(iter->second, alloc, &h.qos_by_fg);
+        }
+      }
+    }
+  });
+
+  const size_t num_fgs_before = fg_flows_.size();
+  for (const std::vector<UnindexedAlloc>& allocs_in_shard : unindexed) {
+    for (const UnindexedAlloc& u : allocs_in_shard) {
+      const proto::FlowAlloc& alloc = u.h->bundle.flow_allocs(u.index);
+      auto [iter, inserted] = fg_index_.try_emplace(alloc.flow(), fg_flows_.size());
+      if (inserted) {
+        fg_flows_.push_back(ToClusterFlow(alloc.flow()));
+      }
+      SetQoSIfUnset(iter->second, alloc, &u.h->qos_by_fg);
+    }
+  }
+
+  for (const LastBundleMap& by_host : alloc_bundles->by_shard) {
+    alloc_bundles->num_hosts += by_host.size();
+  }
+
+  if (fg_flows_.size() != num_fgs_before) {
+    shared_fg_index_ = std::make_shared<const ClusterFlowMap<int64_t>>(fg_index_);
+    shared_fg_flows_ = std::make_shared<const std::vector<proto::FlowMarker>>(fg_flows_);
   }
-  std::atomic_store(&last_alloc_bundle_, alloc_bundles);
-  broadcasting_mu_.Unlock();
+  alloc_bundles->fg_index = shared_fg_index_;
+  alloc_bundles->fg_flows = shared_fg_flows_;
+
+  // Broadcast each shard under its own lock so that listeners of other shards can
+  // (un)register meanwhile.
+  exec_.ParallelFor(0, kNumShards, 1, [&](int64_t shard_index) {
+    ListenerShard& shard = listener_shards_[shard_index];
+    MutexLockWarnLong l(&shard.mu, kLongBcastLockDur, &logger_,
+                        "listener shard mu in ComputeAndBroadcast");
+    for (auto& [host, h] : alloc_bundles->by_shard[shard_index]) {
+      auto iter = shard.listeners.find(host);
+      if (iter == shard.listeners.end()) {
+        continue;
+      }
+      for (auto& [id, lis] : iter->second) {
+        if (config_.skip_unchanged_bundles) {
+          if (ShouldSkip(lis, h.bundle)) {
+            ++lis.num_skipped;
+            continue;
+          }
+          lis.sent_any = true;
+          lis.last_sent = h.bundle;
+          lis.num_skipped = 0;
+        }
+        if (lis.num_fgs_sent < fg_flows_.size()) {
+          // Catch the host up on FG ids.
+          proto::AllocBundle with_dict = h.bundle;
+          AddFGDictionary(fg_flows_, lis.num_fgs_sent, &with_dict);
+          lis.on_new_bundle_func(with_dict, SendBundleAux{});
+          lis.num_fgs_sent = fg_flows_.size();
+        } else {
+          lis.on_new_bundle_func(h.bundle, SendBundleAux{});
+        }
+      }
+    }
+  });
+  std::atomic_store(&last_alloc_bundle_,
+                    std::shared_ptr<const AllocSnapshot>(std::move(alloc_bundles)));
 
   absl::Duration elapsed =
       absl::FromChrono(std::chrono::steady_clock::now() - start_time);
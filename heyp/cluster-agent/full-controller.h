@@ -1,25 +1,51 @@
 #ifndef HEYP_CLUSTER_AGENT_FULL_CONTROLLER_H_
 #define HEYP_CLUSTER_AGENT_FULL_CONTROLLER_H_
 
+#include <atomic>
 #include <cstdint>
+#include <memory>
+#include <vector>
 
 #include "absl/container/flat_hash_map.h"
 #include "heyp/cluster-agent/allocator.h"
 #include "heyp/cluster-agent/controller-iface.h"
 #include "heyp/flows/aggregator.h"
+#include "heyp/flows/map.h"
 #include "heyp/threads/mutex-helpers.h"
+#include "heyp/threads/work-stealing-executor.h"
 #include "spdlog/spdlog.h"
 
 namespace heyp {
 
 class FullClusterController : public ClusterController {
  public:
+  struct Config {
+    // Workers that build and broadcast alloc bundles. If 0, the thread calling
+    // ComputeAndBroadcast does all the work.
+    int num_threads = 0;
+
+    // If set, a host is not sent its bundle when it allocates the same flows as the
+    // last bundle sent to it, with rate limits within rate_limit_tolerance (a
+    // fraction of the last sent limit).
+    bool skip_unchanged_bundles = false;
+    double rate_limit_tolerance = 0;
+
+    // If positive, unchanged bundles are resent after this many skipped periods.
+    int refresh_after_skips = 0;
+  };
+
   FullClusterController(std::unique_ptr<FlowAggregator> aggregator,
                         std::unique_ptr<ClusterAllocator> allocator);
+  FullClusterController(std::unique_ptr<FlowAggregator> aggregator,
+                        std::unique_ptr<ClusterAllocator> allocator, Config config);
 
   void UpdateInfo(ParID bundler_id, const proto::InfoBundle& info) override;
   void ComputeAndBroadcast() override;
 
+  // Only reports the fraction of hosts that reported (relative to the hosts that were
+  // allocated in the last period).
+  NewInfoSummary SummarizeNewInfo() override;
+
   class Listener;
 
   // on_new_bundle_func should not block.
@@ -49,21 +75,73 @@ class FullClusterController : public ClusterController {
   FlowAggregator& AggregatorForTesting() { return *aggregator_; }
 
  private:
+  const Config config_;
   std::unique_ptr<FlowAggregator> aggregator_;
   TimedMutex state_mu_;
   std::unique_ptr<ClusterAllocator> allocator_ ABSL_GUARDED_BY(state_mu_);
   spdlog::logger logger_;
 
-  using LastBundleMap = absl::flat_hash_map<uint64_t, proto::AllocBundle>;
+  struct HostAllocs {
+    proto::AllocBundle bundle;
+
+    // QoS of the first alloc in bundle for each FG, indexed by the FG's index in
+    // fg_flows_. 0 = HIPRI, 1 = LOPRI, 2 = no alloc.
+    std::vector<int8_t> qos_by_fg;
+  };
+
+  using LastBundleMap = absl::flat_hash_map<uint64_t, HostAllocs>;
+
+  // Hosts (and their listeners) are sharded by host id so that bundles can be built
+  // and broadcast one shard per task.
+  static constexpr int kNumShards = 64;
+  static int ShardOf(uint64_t host_id);
+
+  struct AllocSnapshot {
+    std::vector<LastBundleMap> by_shard;  // size kNumShards
+    int64_t num_hosts = 0;
+
+    // Copies of fg_index_ and fg_flows_ for UpdateInfo. Shared by snapshots until
+    // they grow.
+    std::shared_ptr<const ClusterFlowMap<int64_t>> fg_index;
+    std::shared_ptr<const std::vector<proto::FlowMarker>> fg_flows;
+  };
 
   // Access atomically.
-  // Written to while holding broadcasting_mu_.
-  std::shared_ptr<const LastBundleMap> last_alloc_bundle_;
+  // Only written to by ComputeAndBroadcast.
+  std::shared_ptr<const AllocSnapshot> last_alloc_bundle_;
+
+  // Number of UpdateInfo calls since ComputeAndBroadcast last started.
+  std::atomic<int64_t> num_infos_since_compute_{0};
+
+  // FG dictionary sent to hosts so that they can tag FlowInfos with FG ids.
+  // Only grows. Only accessed by ComputeAndBroadcast.
+  ClusterFlowMap<int64_t> fg_index_;
+  std::vector<proto::FlowMarker> fg_flows_;
+  std::shared_ptr<const ClusterFlowMap<int64_t>> shared_fg_index_;
+  std::shared_ptr<const std::vector<proto::FlowMarker>> shared_fg_flows_;
+
+  struct ListenerState {
+    OnNewBundleFunc on_new_bundle_func;
+    int64_t num_fgs_sent = 0;  // prefix of fg_flows_ sent to the listener
+
+    // Only maintained if config_.skip_unchanged_bundles.
+    bool sent_any = false;
+    proto::AllocBundle last_sent;  // without the FG dictionary
+    int num_skipped = 0;           // since last_sent
+  };
+
+  bool ShouldSkip(const ListenerState& lis, const proto::AllocBundle& bundle) const;
+
+  struct ListenerShard {
+    TimedMutex mu;
+    absl::flat_hash_map<uint64_t, absl::flat_hash_map<uint64_t, ListenerState>>
+        listeners ABSL_GUARDED_BY(mu);
+  };
+
+  std::atomic<uint64_t> next_lis_id_;
+  std::unique_ptr<ListenerShard[]> listener_shards_;  // size kNumShards
 
-  TimedMutex broadcasting_mu_;
-  uint64_t next_lis_id_ ABSL_GUARDED_BY(broadcasting_mu_);
-  absl::flat_hash_map<uint64_t, absl::flat_hash_map<uint64_t, OnNewBundleFunc>>
-      new_bundle_funcs_ ABSL_GUARDED_BY(broadcasting_mu_);
+  WorkStealingExecutor exec_;
 };
 
 }  // namespace heyp
@@ -0,0 +1,113 @@
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "absl/container/btree_map.h"
+#include "benchmark/benchmark.h"
+#include "heyp/cluster-agent/host-index.h"
+
+namespace heyp {
+namespace {
+
+constexpr int kNumLookups = 1 << 14;
+constexpr int kNumRanges = 64;
+
+// Compares HostIndex with the absl::btree_map that FastClusterController used
+// previously. Host IDs are random 64-bit values, like the hashed IDs assigned to hosts.
+struct Fixture {
+  explicit Fixture(int num_hosts) {
+    std::mt19937_64 rng(num_hosts);
+    std::vector<std::pair<uint64_t, ParID>> pairs;
+    for (int i = 0; i < num_hosts; ++i) {
+      pairs.push_back({rng(), i});
+      btree[pairs.back().first] = i;
+    }
+    index.Add(pairs);
+
+    for (int i = 0; i < kNumLookups; ++i) {
+      lookups.push_back(pairs[rng() % pairs.size()].first);
+    }
+
+    // Each range covers about 1/(4*kNumRanges) of the ID space.
+    const uint64_t width = std::numeric_limits<uint64_t>::max() / (4 * kNumRanges);
+    for (int i = 0; i < kNumRanges; ++i) {
+      uint64_t lo = rng() - width;
+      selected.ranges.push_back(IdRange(lo, lo + width));
+    }
+  }
+
+  absl::btree_map<uint64_t, ParID> btree;
+  HostIndex index;
+  std::vector<uint64_t> lookups;
+  UnorderedIds selected;
+};
+
+void BtreeForEachSelected(const absl::btree_map<uint64_t, ParID>& id2par,
+                          const UnorderedIds& ids,
+                          absl::FunctionRef<void(uint64_t, ParID)> func) {
+  for (IdRange r : ids.ranges) {
+    for (auto iter = id2par.lower_bound(r.lo);
+         iter != id2par.end() && iter->first <= r.hi /* inclusive */; ++iter) {
+      func(iter->first, iter->second);
+    }
+  }
+
+  for (uint64_t p : ids.points) {
+    if (auto iter = id2par.find(p); iter != id2par.end()) {
+      func(iter->first, iter->second);
+    }
+  }
+}
+
+static void BM_Find_Btree(benchmark::State& state) {
+  Fixture f(state.range(0));
+  for (auto _ : state) {
+    for (uint64_t id : f.lookups) {
+      auto iter = f.btree.find(id);
+      benchmark::DoNotOptimize(iter);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * f.lookups.size());
+}
+
+static void BM_Find_HostIndex(benchmark::State& state) {
+  Fixture f(state.range(0));
+  for (auto _ : state) {
+    for (uint64_t id : f.lookups) {
+      benchmark::DoNotOptimize(f.index.Find(id));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * f.lookups.size());
+}
+
+static void BM_ForEachSelected_Btree(benchmark::State& state) {
+  Fixture f(state.range(0));
+  int64_t num_selected = 0;
+  for (auto _ : state) {
+    BtreeForEachSelected(f.btree, f.selected, [&](uint64_t host_id, ParID par_id) {
+      benchmark::DoNotOptimize(par_id);
+      ++num_selected;
+    });
+  }
+  state.SetItemsProcessed(num_selected);
+}
+
+static void BM_ForEachSelected_HostIndex(benchmark::State& state) {
+  Fixture f(state.range(0));
+  int64_t num_selected = 0;
+  for (auto _ : state) {
+    ForEachSelected(f.index, f.selected, [&](uint64_t host_id, ParID par_id) {
+      benchmark::DoNotOptimize(par_id);
+      ++num_selected;
+    });
+  }
+  state.SetItemsProcessed(num_selected);
+}
+
+BENCHMARK(BM_Find_Btree)->Arg(10'000)->Arg(100'000)->Arg(1'000'000);
+BENCHMARK(BM_Find_HostIndex)->Arg(10'000)->Arg(100'000)->Arg(1'000'000);
+BENCHMARK(BM_ForEachSelected_Btree)->Arg(10'000)->Arg(100'000)->Arg(1'000'000);
+BENCHMARK(BM_ForEachSelected_HostIndex)->Arg(10'000)->Arg(100'000)->Arg(1'000'000);
+
+}  // namespace
+}  // namespace heyp
@@ -0,0 +1,102 @@
+#include "heyp/cluster-agent/host-index.h"
+
+#include <limits>
+#include <map>
+#include <random>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+namespace heyp {
+namespace {
+
+std::vector<std::pair<uint64_t, ParID>> Selected(const HostIndex& index,
+                                                 const UnorderedIds& ids) {
+  std::vector<std::pair<uint64_t, ParID>> got;
+  ForEachSelected(index, ids,
+                  [&](uint64_t host_id, ParID par_id) { got.push_back({host_id, par_id}); });
+  return got;
+}
+
+TEST(HostIndexTest, Empty) {
+  HostIndex index;
+  EXPECT_EQ(index.size(), 0);
+  EXPECT_EQ(index.LowerBound(0), 0);
+  EXPECT_EQ(index.Find(0), -1);
+  EXPECT_THAT(Selected(index, {.ranges = {{0, 100}}, .points = {5}}),
+              testing::IsEmpty());
+}
+
+TEST(HostIndexTest, AddOverwritesAndMerges) {
+  HostIndex index;
+  index.Add({{30, 3}, {10, 1}, {20, 2}, {10, 11}});
+  EXPECT_EQ(index.size(), 3);
+  EXPECT_EQ(index.Find(10), 11);
+  EXPECT_EQ(index.Find(20), 2);
+  EXPECT_EQ(index.Find(30), 3);
+  EXPECT_EQ(index.Find(15), -1);
+
+  index.Add({{15, 4}, {30, 33}, {std::numeric_limits<uint64_t>::max(), 5}});
+  EXPECT_EQ(index.size(), 5);
+  EXPECT_EQ(index.Find(15), 4);
+  EXPECT_EQ(index.Find(30), 33);
+  EXPECT_EQ(index.Find(std::numeric_limits<uint64_t>::max()), 5);
+  EXPECT_EQ(index.LowerBound(31), 4);
+}
+
+TEST(HostIndexTest, ForEachSelected) {
+  HostIndex index;
+  index.Add({{1, 0}, {2, 1}, {4, 2}, {8, 3}, {16, 4}});
+
+  EXPECT_THAT(Selected(index, {.ranges = {{2, 8}, {17, 20}}, .points = {16, 3}}),
+              testing::ElementsAre(testing::Pair(2, 1), testing::Pair(4, 2),
+                                   testing::Pair(8, 3), testing::Pair(16, 4)));
+}
+
+void ExpectMatchesStdMap(HostIndexKernel kernel) {
+  std::mt19937_64 rng(0);
+  for (int n : {1, 7, 8, 9, 63, 64, 65, 1000, 4099}) {
+    std::map<uint64_t, ParID> want;
+    std::vector<std::pair<uint64_t, ParID>> pairs;
+    for (int i = 0; i < n; ++i) {
+      uint64_t id = rng() % (8 * n);
+      pairs.push_back({id, i});
+      want[id] = i;
+    }
+    HostIndex index(kernel);
+    // Add in two batches to exercise merging.
+    index.Add(absl::MakeConstSpan(pairs).subspan(0, n / 2));
+    index.Add(absl::MakeConstSpan(pairs).subspan(n / 2));
+    ASSERT_EQ(index.size(), want.size());
+
+    for (uint64_t id = 0; id < 8 * n + 2; ++id) {
+      auto iter = want.lower_bound(id);
+      size_t pos = index.LowerBound(id);
+      SCOPED_TRACE(testing::Message() << "n = " << n << " id = " << id);
+      if (iter == want.end()) {
+        EXPECT_EQ(pos, index.size());
+        EXPECT_EQ(index.Find(id), -1);
+      } else {
+        ASSERT_LT(pos, index.size());
+        EXPECT_EQ(index.host_id(pos), iter->first);
+        EXPECT_EQ(index.par_id(pos), iter->second);
+        EXPECT_EQ(index.Find(id), iter->first == id ? iter->second : -1);
+      }
+    }
+  }
+}
+
+TEST(HostIndexTest, MatchesStdMapScalar) {
+  ExpectMatchesStdMap(HostIndexKernel::kScalar);
+}
+
+TEST(HostIndexTest, MatchesStdMapAVX2) {
+  if (!CPUSupports(HostIndexKernel::kAVX2)) {
+    GTEST_SKIP() << "CPU does not support AVX2";
+  }
+  ExpectMatchesStdMap(HostIndexKernel::kAVX2);
+}
+
+}  // namespace
+}  // namespace heyp
@@ -0,0 +1,185 @@
+#include "heyp/cluster-agent/host-index.h"
+
+#include <algorithm>
+#include <limits>
+
+#if defined(__x86_64__)
+#include <immintrin.h>
+#endif
+
+namespace heyp {
+
+namespace {
+
+constexpr uint64_t kPadID = std::numeric_limits<uint64_t>::max();
+
+// Returns the number of ids[0:HostIndex::kBlockSize] that are < host_id.
+inline int CountLessScalar(const uint64_t* ids, uint64_t host_id) {
+  // Branch-free so that compilers can vectorize it.
+  int n = 0;
+  for (int i = 0; i < HostIndex::kBlockSize; ++i) {
+    n += ids[i] < host_id;
+  }
+  return n;
+}
+
+#if defined(__x86_64__)
+
+__attribute__((target("avx2,popcnt"))) int CountLessAVX2(const uint64_t* ids,
+                                                          uint64_t host_id) {
+  static_assert(HostIndex::kBlockSize == 8);
+  // AVX2 only has a signed 64-bit compare, so flip the sign bits first.
+  const __m256i sign = _mm256_set1_epi64x(std::numeric_limits<int64_t>::min());
+  const __m256i x = _mm256_xor_si256(_mm256_set1_epi64x(host_id), sign);
+  const __m256i a = _mm256_xor_si256(
+      _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ids)), sign);
+  const __m256i b = _mm256_xor_si256(
+      _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ids + 4)), sign);
+  const int mask_a = _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpgt_epi64(x, a)));
+  const int mask_b = _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpgt_epi64(x, b)));
+  return __builtin_popcount(mask_a | (mask_b << 4));
+}
+
+#endif  // defined(__x86_64__)
+
+}  // namespace
+
+bool CPUSupports(HostIndexKernel kernel) {
+  switch (kernel) {
+    case HostIndexKernel::kScalar:
+      return true;
+#if defined(__x86_64__)
+    case HostIndexKernel::kAVX2:
+      return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("popcnt");
+#endif
+    default:
+      return false;
+  }
+}
+
+HostIndexKernel BestHostIndexKernel() {
+  static const HostIndexKernel kBest = CPUSupports(HostIndexKernel::kAVX2)
+                                           ? HostIndexKernel::kAVX2
+                                           : HostIndexKernel::kScalar;
+  return kBest;
+}
+
+void HostIndex::Add(absl::Span<const std::pair<uint64_t, ParID>> host_id_pairs) {
+  if (host_id_pairs.empty()) {
+    return;
+  }
+
+  // Later pairs win over earlier ones with the same host ID.
+  std::vector<std::pair<uint64_t, ParID>> added(host_id_pairs.begin(),
+                                                host_id_pairs.end());
+  std::stable_sort(added.begin(), added.end(),
+                   [](const auto& a, const auto& b) { return a.first < b.first; });
+
+  std::vector<uint64_t> ids;
+  std::vector<ParID> pars;
+  ids.reserve(num_hosts_ + added.size() + kBlockSize);
+  pars.reserve(num_hosts_ + added.size() + kBlockSize);
+
+  size_t i = 0;
+  size_t j = 0;
+  while (i < num_hosts_ || j < added.size()) {
+    if (j < added.size() && (i == num_hosts_ || added[j].first <= ids_[i])) {
+      const uint64_t id = added[j].first;
+      while (j + 1 < added.size() && added[j + 1].first == id) {
+        ++j;
+      }
+      if (i < num_hosts_ && ids_[i] == id) {
+        ++i;  // overwritten
+      }
+      ids.push_back(id);
+      pars.push_back(added[j].second);
+      ++j;
+    } else {
+      ids.push_back(ids_[i]);
+      pars.push_back(pars_[i]);
+      ++i;
+    }
+  }
+
+  num_hosts_ = ids.size();
+  ids_ = std::move(ids);
+  pars_ = std::move(pars);
+  Rebuild();
+}
+
+void HostIndex::Rebuild() {
+  const size_t num_blocks = (num_hosts_ + kBlockSize - 1) / kBlockSize;
+  ids_.resize(num_blocks * kBlockSize, kPadID);
+  pars_.resize(num_blocks * kBlockSize, -1);
+
+  eyt_keys_.assign(num_blocks + 1, 0);
+  eyt_blocks_.assign(num_blocks + 1, 0);
+  size_t next_block = 0;
+  FillEytzinger(&next_block, 1);
+}
+
+void HostIndex::FillEytzinger(size_t* next_block, size_t k) {
+  if (k >= eyt_keys_.size()) {
+    return;
+  }
+  FillEytzinger(next_block, 2 * k);
+  eyt_keys_[k] = ids_[*next_block * kBlockSize + kBlockSize - 1];
+  eyt_blocks_[k] = *next_block;
+  ++*next_block;
+  FillEytzinger(next_block, 2 * k + 1);
+}
+
+size_t HostIndex::LowerBound(uint64_t host_id) const {
+  const size_t num_blocks = eyt_keys_.size() - (eyt_keys_.empty() ? 0 : 1);
+  const uint64_t* keys = eyt_keys_.data();
+
+  // Find the first block whose last ID is >= host_id.
+  size_t k = 1;
+  while (k <= num_blocks) {
+    // The 8 descendants three levels down are contiguous; fetch them early.
+    __builtin_prefetch(reinterpret_cast<const void*>(
+        reinterpret_cast<uintptr_t>(keys) + 8 * k * sizeof(uint64_t)));
+    k = 2 * k + (keys[k] < host_id);
+  }
+  k >>= __builtin_ffsll(~k);
+  if (k == 0) {
+    return num_hosts_;
+  }
+
+  const size_t block = eyt_blocks_[k];
+  const uint64_t* block_ids = &ids_[block * kBlockSize];
+  int num_less;
+#if defined(__x86_64__)
+  num_less = kernel_ == HostIndexKernel::kAVX2 ? CountLessAVX2(block_ids, host_id)
+                                               : CountLessScalar(block_ids, host_id);
+#else
+  num_less = CountLessScalar(block_ids, host_id);
+#endif
+  return std::min(block * kBlockSize + num_less, num_hosts_);
+}
+
+ParID HostIndex::Find(uint64_t host_id) const {
+  const size_t i = LowerBound(host_id);
+  if (i < num_hosts_ && ids_[i] == host_id) {
+    return pars_[i];
+  }
+  return -1;
+}
+
+void ForEachSelected(const HostIndex& index, const UnorderedIds& ids,
+                     absl::FunctionRef<void(uint64_t, ParID)> func) {
+  for (IdRange r : ids.ranges) {
+    for (size_t i = index.LowerBound(r.lo);
+         i < index.size() && index.host_id(i) <= r.hi /* inclusive */; ++i) {
+      func(index.host_id(i), index.par_id(i));
+    }
+  }
+
+  for (uint64_t p : ids.points) {
+    if (ParID par_id = index.Find(p); par_id != -1) {
+      func(p, par_id);
+    }
+  }
+}
+
+}  // namespace heyp
@@ -0,0 +1,80 @@
+#ifndef HEYP_CLUSTER_AGENT_HOST_INDEX_H_
+#define HEYP_CLUSTER_AGENT_HOST_INDEX_H_
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "absl/functional/function_ref.h"
+#include "absl/types/span.h"
+#include "heyp/alg/unordered-ids.h"
+#include "heyp/threads/par-indexed-map.h"
+
+namespace heyp {
+
+// Instruction sets that HostIndex can compare a block of IDs with.
+enum class HostIndexKernel {
+  kScalar,
+  kAVX2,
+};
+
+// Returns the fastest kernel that this CPU supports.
+HostIndexKernel BestHostIndexKernel();
+
+bool CPUSupports(HostIndexKernel kernel);
+
+// HostIndex is a read-optimized map from host ID to ParID.
+//
+// Hosts are kept in sorted, flat arrays so that range scans are sequential.
+// Lookups search a B+-style summary: the sorted IDs are split into blocks of
+// kBlockSize (one cache line) and the last ID of each block is laid out in
+// Eytzinger (BFS) order. A search walks the summary to find the block and then
+// compares against all IDs in the block at once (with AVX2 if the CPU supports it).
+//
+// The index is rebuilt whenever hosts are added, so Add should be called in batches.
+// It is not thread-safe for writes, but concurrent reads are fine.
+class HostIndex {
+ public:
+  static constexpr int kBlockSize = 8;
+
+  HostIndex() : HostIndex(BestHostIndexKernel()) {}
+
+  // kernel must be supported by the CPU.
+  explicit HostIndex(HostIndexKernel kernel) : kernel_(kernel) {}
+
+  // Adds (or overwrites) the host IDs and rebuilds the index.
+  void Add(absl::Span<const std::pair<uint64_t, ParID>> host_id_pairs);
+
+  // Returns the position of the first host ID >= host_id, or size() if there is none.
+  size_t LowerBound(uint64_t host_id) const;
+
+  // Returns the ParID of host_id or -1 if it is not present.
+  ParID Find(uint64_t host_id) const;
+
+  size_t size() const { return num_hosts_; }
+  uint64_t host_id(size_t i) const { return ids_[i]; }
+  ParID par_id(size_t i) const { return pars_[i]; }
+
+ private:
+  void Rebuild();
+  void FillEytzinger(size_t* next_block, size_t k);
+
+  HostIndexKernel kernel_;
+  size_t num_hosts_ = 0;
+
+  // Sorted host IDs, padded with UINT64_MAX to a multiple of kBlockSize.
+  std::vector<uint64_t> ids_;
+  std::vector<ParID> pars_;
+
+  // Last ID of each block in Eytzinger order (1-indexed), and the block it came from.
+  std::vector<uint64_t> eyt_keys_;
+  std::vector<uint32_t> eyt_blocks_;
+};
+
+// Time complexity: O(log(index) * (ids.ranges + ids.points)) plus the number of matches
+void ForEachSelected(const HostIndex& index, const UnorderedIds& ids,
+                     absl::FunctionRef<void(uint64_t, ParID)> func);
+
+}  // namespace heyp
+
+#endif  // HEYP_CLUSTER_AGENT_HOST_INDEX_H_
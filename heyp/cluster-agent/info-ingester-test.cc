@@ -0,0 +1,121 @@
+#include "heyp/cluster-agent/info-ingester.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "absl/container/flat_hash_map.h"
+#include "absl/synchronization/mutex.h"
+#include "absl/synchronization/notification.h"
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+namespace heyp {
+namespace {
+
+// Records the timestamps of the bundles it is given, per bundler.
+class RecordingController : public ClusterController {
+ public:
+  void UpdateInfo(ParID bundler_id, const proto::InfoBundle& info) override {
+    if (num_started_.fetch_add(1) == 0) {
+      started_.Notify();
+    }
+    if (block_ != nullptr) {
+      block_->WaitForNotification();
+    }
+    absl::MutexLock l(&mu_);
+    seconds_by_bundler_[bundler_id].push_back(info.timestamp().seconds());
+  }
+
+  void ComputeAndBroadcast() override {}
+
+  std::unique_ptr<Listener> RegisterListener(uint64_t host_id,
+                                             const OnNewBundleFunc& func) override {
+    return nullptr;
+  }
+
+  ParID GetBundlerID(const proto::FlowMarker& bundler) override {
+    return bundler.host_id();
+  }
+
+  std::vector<int64_t> Seconds(ParID bundler_id) {
+    absl::MutexLock l(&mu_);
+    return seconds_by_bundler_[bundler_id];
+  }
+
+  absl::Notification* block_ = nullptr;
+  absl::Notification started_;  // notified on the first call to UpdateInfo
+  std::atomic<int> num_started_{0};
+
+ private:
+  absl::Mutex mu_;
+  absl::flat_hash_map<ParID, std::vector<int64_t>> seconds_by_bundler_;
+};
+
+std::unique_ptr<proto::InfoBundle> Bundle(InfoIngester& ingester, int64_t seconds) {
+  std::unique_ptr<proto::InfoBundle> b = ingester.NewBundle();
+  b->mutable_timestamp()->set_seconds(seconds);
+  return b;
+}
+
+TEST(InfoIngesterTest, AppliesEachBundlersBundlesInOrder) {
+  constexpr int kNumBundlers = 16;
+  constexpr int kNumPerBundler = 500;
+  auto controller = std::make_shared<RecordingController>();
+  {
+    InfoIngester ingester(controller, {.num_workers = 3, .queue_capacity = 1 << 14});
+
+    std::vector<std::thread> producers;
+    for (int t = 0; t < 4; ++t) {
+      producers.emplace_back([&ingester, t] {
+        for (int64_t sec = 0; sec < kNumPerBundler; ++sec) {
+          for (ParID id = t; id < kNumBundlers; id += 4) {
+            EXPECT_TRUE(ingester.Enqueue(id, Bundle(ingester, sec)));
+          }
+        }
+      });
+    }
+    for (std::thread& t : producers) {
+      t.join();
+    }
+  }  // waits for the queues to drain
+
+  std::vector<int64_t> want;
+  for (int64_t sec = 0; sec < kNumPerBundler; ++sec) {
+    want.push_back(sec);
+  }
+  for (ParID id = 0; id < kNumBundlers; ++id) {
+    EXPECT_EQ(controller->Seconds(id), want) << "bundler " << id;
+  }
+}
+
+TEST(InfoIngesterTest, DropsWhenFullAndReportsStats) {
+  auto controller = std::make_shared<RecordingController>();
+  absl::Notification unblock;
+  controller->block_ = &unblock;
+
+  InfoIngester ingester(controller, {.num_workers = 1, .queue_capacity = 4});
+
+  // The worker takes the first bundle and blocks on it, so 4 more fit.
+  ASSERT_TRUE(ingester.Enqueue(0, Bundle(ingester, 0)));
+  ASSERT_TRUE(controller->started_.WaitForNotificationWithTimeout(absl::Seconds(10)));
+  int num_ok = 0;
+  for (int64_t sec = 1; sec <= 6; ++sec) {
+    num_ok += ingester.Enqueue(0, Bundle(ingester, sec));
+  }
+  EXPECT_EQ(num_ok, 4);
+
+  InfoIngester::Stats s = ingester.TakeStats();
+  EXPECT_EQ(s.queue_depth, 5);
+  EXPECT_EQ(s.num_dropped, 2);
+
+  unblock.Notify();
+  ASSERT_TRUE(ingester.WaitForDrain(absl::Seconds(10)));
+  s = ingester.TakeStats();
+  EXPECT_EQ(s.queue_depth, 0);
+  EXPECT_EQ(s.num_applied, 5);
+  EXPECT_THAT(controller->Seconds(0), testing::ElementsAre(0, 1, 2, 3, 4));
+}
+
+}  // namespace
+}  // namespace heyp
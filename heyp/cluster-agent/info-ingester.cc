@@ -0,0 +1,155 @@
+#include "heyp/cluster-agent/info-ingester.h"
+
+#include <algorithm>
+
+#include "absl/time/clock.h"
+#include "heyp/log/spdlog.h"
+#include "heyp/threads/set-name.h"
+
+namespace heyp {
+
+InfoIngester::InfoIngester(std::shared_ptr<ClusterController> controller, Config config)
+    : controller_(std::move(controller)),
+      max_pooled_(config.num_workers * config.queue_capacity) {
+  H_ASSERT_GT(config.num_workers, 0);
+  workers_.reserve(config.num_workers);
+  for (int i = 0; i < config.num_workers; ++i) {
+    workers_.push_back(std::make_unique<Worker>(config.queue_capacity));
+  }
+  threads_.reserve(config.num_workers);
+  for (int i = 0; i < config.num_workers; ++i) {
+    threads_.push_back(std::thread([this, i] { WorkerMain(workers_[i].get()); }));
+    SetThreadName(threads_.back().native_handle(), "ingest");
+  }
+}
+
+InfoIngester::~InfoIngester() {
+  for (auto& w : workers_) {
+    absl::MutexLock l(&w->mu);
+    w->has_work = true;
+    w->exit = true;
+  }
+  for (std::thread& t : threads_) {
+    t.join();
+  }
+}
+
+std::unique_ptr<proto::InfoBundle> InfoIngester::NewBundle() {
+  {
+    absl::MutexLock l(&pool_mu_);
+    if (!pool_.empty()) {
+      std::unique_ptr<proto::InfoBundle> b = std::move(pool_.back());
+      pool_.pop_back();
+      return b;
+    }
+  }
+  return std::make_unique<proto::InfoBundle>();
+}
+
+void InfoIngester::Recycle(proto::InfoBundle* bundle) {
+  bundle->Clear();  // keeps the memory of repeated fields
+  absl::MutexLock l(&pool_mu_);
+  if (pool_.size() < max_pooled_) {
+    pool_.emplace_back(bundle);
+  } else {
+    delete bundle;
+  }
+}
+
+bool InfoIngester::Enqueue(ParID bundler_id, std::unique_ptr<proto::InfoBundle> bundle) {
+  Worker* w = workers_[bundler_id % workers_.size()].get();
+  const Staged s{
+      .bundler_id = bundler_id,
+      .bundle = bundle.get(),
+      .enqueue_nanos = absl::GetCurrentTimeNanos(),
+  };
+  if (!w->ring.TryPush(s)) {
+    num_dropped_.fetch_add(1, std::memory_order_relaxed);
+    Recycle(bundle.release());
+    return false;
+  }
+  bundle.release();  // now owned by the ring
+  num_enqueued_.fetch_add(1, std::memory_order_relaxed);
+
+  // Only wake the worker if nobody has since it last started draining.
+  if (!w->signaled.exchange(true)) {
+    absl::MutexLock l(&w->mu);
+    w->has_work = true;
+  }
+  return true;
+}
+
+void InfoIngester::WorkerMain(Worker* w) {
+  std::vector<Staged> batch;
+  while (true) {
+    bool exit = false;
+    {
+      absl::MutexLock l(&w->mu);
+      w->mu.Await(absl::Condition(&w->has_work));
+      w->has_work = false;
+      exit = w->exit;
+    }
+    w->signaled.store(false);
+
+    batch.clear();
+    w->ring.Drain([&batch](const Staged& s) { batch.push_back(s); });
+    if (!batch.empty()) {
+      int64_t sum_lag_nanos = 0;
+      int64_t max_lag_nanos = 0;
+      for (const Staged& s : batch) {
+        controller_->UpdateInfo(s.bundler_id, *s.bundle);
+        const int64_t lag = absl::GetCurrentTimeNanos() - s.enqueue_nanos;
+        sum_lag_nanos += lag;
+        max_lag_nanos = std::max(max_lag_nanos, lag);
+        Recycle(s.bundle);
+      }
+      // Updated with stats_mu_ held so that WaitForDrain notices.
+      absl::MutexLock l(&stats_mu_);
+      num_applied_.fetch_add(batch.size(), std::memory_order_relaxed);
+      ++win_num_batches_;
+      win_num_bundles_ += batch.size();
+      win_max_batch_size_ = std::max<int64_t>(win_max_batch_size_, batch.size());
+      win_sum_lag_nanos_ += sum_lag_nanos;
+      win_max_lag_nanos_ = std::max(win_max_lag_nanos_, max_lag_nanos);
+    }
+    if (exit) {
+      return;
+    }
+  }
+}
+
+InfoIngester::Stats InfoIngester::TakeStats() {
+  Stats stats;
+  stats.num_applied = num_applied_.load(std::memory_order_relaxed);
+  stats.num_dropped = num_dropped_.load(std::memory_order_relaxed);
+  stats.queue_depth = num_enqueued_.load(std::memory_order_relaxed) - stats.num_applied;
+
+  absl::MutexLock l(&stats_mu_);
+  stats.num_batches = win_num_batches_;
+  stats.max_batch_size = win_max_batch_size_;
+  if (win_num_batches_ > 0) {
+    stats.mean_batch_size = static_cast<double>(win_num_bundles_) / win_num_batches_;
+    stats.mean_lag = absl::Nanoseconds(win_sum_lag_nanos_ / win_num_bundles_);
+  }
+  stats.max_lag = absl::Nanoseconds(win_max_lag_nanos_);
+  win_num_batches_ = 0;
+  win_num_bundles_ = 0;
+  win_max_batch_size_ = 0;
+  win_sum_lag_nanos_ = 0;
+  win_max_lag_nanos_ = 0;
+  return stats;
+}
+
+bool InfoIngester::WaitForDrain(absl::Duration timeout) {
+  absl::MutexLock l(&stats_mu_);
+  return stats_mu_.AwaitWithTimeout(
+      absl::Condition(
+          +[](InfoIngester* self) {
+            return self->num_applied_.load(std::memory_order_relaxed) >=
+                   self->num_enqueued_.load(std::memory_order_relaxed);
+          },
+          this),
+      timeout);
+}
+
+}  // namespace heyp
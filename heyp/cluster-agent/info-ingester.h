@@ -0,0 +1,112 @@
+#ifndef HEYP_CLUSTER_AGENT_INFO_INGESTER_H_
+#define HEYP_CLUSTER_AGENT_INFO_INGESTER_H_
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "absl/synchronization/mutex.h"
+#include "absl/time/time.h"
+#include "heyp/cluster-agent/controller-iface.h"
+#include "heyp/proto/heyp.pb.h"
+#include "heyp/threads/mpsc-ring.h"
+
+namespace heyp {
+
+// InfoIngester applies InfoBundles to a ClusterController on its own workers so that
+// the (gRPC) threads that receive bundles only need to decode and enqueue them.
+//
+// Bundles are sharded across workers by bundler so that each bundler's bundles are
+// applied in order. Each worker has an MPSCRing that it drains in batches.
+class InfoIngester {
+ public:
+  struct Config {
+    int num_workers = 2;
+
+    // Max number of bundles each worker buffers. Bundles that arrive when a worker's
+    // queue is full are dropped.
+    int64_t queue_capacity = 4096;
+  };
+
+  InfoIngester(std::shared_ptr<ClusterController> controller, Config config);
+  ~InfoIngester();
+
+  InfoIngester(const InfoIngester&) = delete;
+  InfoIngester& operator=(const InfoIngester&) = delete;
+
+  // NewBundle returns an empty bundle to decode into and pass to Enqueue.
+  // Bundles are recycled once they have been applied.
+  std::unique_ptr<proto::InfoBundle> NewBundle();
+
+  // Enqueue stages bundle to be applied with controller->UpdateInfo(bundler_id, ...).
+  // Returns false if the bundle was dropped because the queue was full.
+  //
+  // Thread-safe.
+  bool Enqueue(ParID bundler_id, std::unique_ptr<proto::InfoBundle> bundle);
+
+  struct Stats {
+    int64_t queue_depth = 0;  // bundles enqueued but not yet applied
+    int64_t num_applied = 0;
+    int64_t num_dropped = 0;
+
+    // Since the last call to TakeStats.
+    int64_t num_batches = 0;
+    int64_t max_batch_size = 0;
+    double mean_batch_size = 0;
+    absl::Duration mean_lag;  // from Enqueue to the end of UpdateInfo
+    absl::Duration max_lag;
+  };
+
+  // TakeStats returns cumulative counters and resets the windowed ones.
+  Stats TakeStats();
+
+  // Blocks until every bundle enqueued so far has been applied. Returns false if that
+  // takes longer than timeout.
+  bool WaitForDrain(absl::Duration timeout);
+
+ private:
+  struct Staged {
+    ParID bundler_id;
+    proto::InfoBundle* bundle;  // owned
+    int64_t enqueue_nanos;
+  };
+
+  struct Worker {
+    explicit Worker(int64_t capacity) : ring(capacity) {}
+
+    MPSCRing<Staged> ring;
+    std::atomic<bool> signaled{false};
+
+    absl::Mutex mu;
+    bool has_work ABSL_GUARDED_BY(mu) = false;  // also set to exit
+    bool exit ABSL_GUARDED_BY(mu) = false;
+  };
+
+  void WorkerMain(Worker* w);
+  void Recycle(proto::InfoBundle* bundle);
+
+  const std::shared_ptr<ClusterController> controller_;
+  const int64_t max_pooled_;
+  std::vector<std::unique_ptr<Worker>> workers_;
+  std::vector<std::thread> threads_;
+
+  absl::Mutex pool_mu_;
+  std::vector<std::unique_ptr<proto::InfoBundle>> pool_ ABSL_GUARDED_BY(pool_mu_);
+
+  std::atomic<int64_t> num_enqueued_{0};
+  std::atomic<int64_t> num_applied_{0};
+  std::atomic<int64_t> num_dropped_{0};
+
+  absl::Mutex stats_mu_;
+  int64_t win_num_batches_ ABSL_GUARDED_BY(stats_mu_) = 0;
+  int64_t win_num_bundles_ ABSL_GUARDED_BY(stats_mu_) = 0;
+  int64_t win_max_batch_size_ ABSL_GUARDED_BY(stats_mu_) = 0;
+  int64_t win_sum_lag_nanos_ ABSL_GUARDED_BY(stats_mu_) = 0;
+  int64_t win_max_lag_nanos_ ABSL_GUARDED_BY(stats_mu_) = 0;
+};
+
+}  // namespace heyp
+
+#endif  // HEYP_CLUSTER_AGENT_INFO_INGESTER_H_
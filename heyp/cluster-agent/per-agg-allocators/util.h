@@ -3,6 +3,7 @@
 
 #include "absl/container/flat_hash_map.h"
 #include "heyp/alg/qos-downgrade.h"
+#include "heyp/flows/map.h"
 #include "heyp/log/spdlog.h"
 #include "heyp/proto/alg.h"
 #include "heyp/proto/heyp.pb.h"
@@ -12,10 +13,6 @@ namespace heyp {
 double ClampFracLOPRI(spdlog::logger* logger, double frac_lopri);
 double ClampFracLOPRISilent(double frac_lopri);
 
-template <typename ValueType>
-using ClusterFlowMap =
-    absl::flat_hash_map<proto::FlowMarker, ValueType, HashClusterFlow, EqClusterFlow>;
-
 ClusterFlowMap<proto::FlowAlloc> ToAdmissionsMap(
     const proto::AllocBundle& cluster_wide_allocs);
 
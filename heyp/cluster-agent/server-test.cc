@@ -225,5 +225,66 @@ TEST(ClusterAgentTest, NoCrashManyResp) {
   server->Wait();
 }
 
+// Counts runs and reports whatever frac_hosts_reported it is told to.
+class CountingController : public ClusterController {
+ public:
+  void UpdateInfo(ParID bundler_id, const proto::InfoBundle& info) override {}
+
+  void ComputeAndBroadcast() override {
+    frac_hosts_reported.store(0);
+    ++num_runs;
+  }
+
+  NewInfoSummary SummarizeNewInfo() override {
+    return {.frac_hosts_reported = frac_hosts_reported.load()};
+  }
+
+  std::unique_ptr<Listener> RegisterListener(uint64_t host_id,
+                                             const OnNewBundleFunc& func) override {
+    return nullptr;
+  }
+
+  ParID GetBundlerID(const proto::FlowMarker& bundler) override { return 0; }
+
+  std::atomic<double> frac_hosts_reported{0};
+  std::atomic<int> num_runs{0};
+};
+
+TEST(RunAdaptiveLoopTest, RunsEarlyWhenHostsReport) {
+  auto controller = std::make_shared<CountingController>();
+  auto logger = MakeLogger("cluster-agent-test");
+  std::atomic<bool> should_exit{false};
+  std::thread loop([&] {
+    RunAdaptiveLoop(controller,
+                    {
+                        .min_period = absl::Milliseconds(1),
+                        .max_period = absl::Hours(1),
+                        .poll_period = absl::Milliseconds(1),
+                        .report_frac = 0.5,
+                    },
+                    &should_exit, &logger);
+  });
+
+  auto wait_for_runs = [&controller](int n) {
+    while (controller->num_runs.load() < n) {
+      absl::SleepFor(absl::Milliseconds(1));
+    }
+  };
+
+  wait_for_runs(1);
+  absl::SleepFor(absl::Milliseconds(20));
+  EXPECT_EQ(controller->num_runs.load(), 1);
+
+  controller->frac_hosts_reported.store(0.25);
+  absl::SleepFor(absl::Milliseconds(20));
+  EXPECT_EQ(controller->num_runs.load(), 1);
+
+  controller->frac_hosts_reported.store(0.5);
+  wait_for_runs(2);
+
+  should_exit.store(true);
+  loop.join();
+}
+
 }  // namespace
 }  // namespace heyp
@@ -2,33 +2,101 @@
 
 #include <grpcpp/support/server_callback.h>
 
+#include "absl/container/flat_hash_map.h"
+#include "absl/container/inlined_vector.h"
 #include "absl/strings/str_format.h"
+#include "absl/synchronization/mutex.h"
+#include "google/protobuf/io/coded_stream.h"
 #include "grpcpp/grpcpp.h"
 #include "heyp/log/spdlog.h"
 #include "heyp/proto/heyp.pb.h"
+#include "heyp/proto/pooled-arena.h"
 #include "heyp/threads/mutex-helpers.h"
 
 namespace heyp {
 
-class HostReactor
-    : public grpc::ServerBidiReactor<proto::InfoBundle, proto::AllocBundle> {
+namespace {
+
+void UnrefChunk(void* chunk) { delete static_cast<EncodedAllocBundle::Chunk*>(chunk); }
+
+// Appends alloc to slices without copying the (shared) chunks.
+template <typename SliceVec>
+void AppendSlices(const EncodedAllocBundle& alloc, SliceVec* slices) {
+  for (const EncodedAllocBundle::Chunk& c : alloc.chunks()) {
+    // The slice holds a reference to the chunk until gRPC is done with it.
+    slices->emplace_back(const_cast<char*>(c->data()), c->size(), &UnrefChunk,
+                         new EncodedAllocBundle::Chunk(c));
+  }
+  if (!alloc.tail_bytes().empty()) {
+    slices->emplace_back(alloc.tail_bytes().data(), alloc.tail_bytes().size());
+  }
+}
+
+grpc::ByteBuffer ToByteBuffer(const EncodedAllocBundle& alloc) {
+  absl::InlinedVector<grpc::Slice, 3> slices;
+  AppendSlices(alloc, &slices);
+  return grpc::ByteBuffer(slices.data(), slices.size());
+}
+
+// Appends a RelayedAllocBatch.allocs entry that embeds alloc as
+// RelayedAllocBundle.bundle. Only the few bytes of framing are copied.
+void AppendRelayedAlloc(uint64_t host_id, const EncodedAllocBundle& alloc,
+                        std::vector<grpc::Slice>* slices) {
+  using google::protobuf::io::CodedOutputStream;
+  constexpr uint8_t kAllocsTag = (proto::RelayedAllocBatch::kAllocsFieldNumber << 3) | 2;
+  constexpr uint8_t kHostIdTag = (proto::RelayedAllocBundle::kHostIdFieldNumber << 3) | 0;
+  constexpr uint8_t kBundleTag = (proto::RelayedAllocBundle::kBundleFieldNumber << 3) | 2;
+
+  const uint64_t bundle_size = alloc.ByteSize();
+  const uint64_t entry_size = 1 + CodedOutputStream::VarintSize64(host_id) + 1 +
+                              CodedOutputStream::VarintSize64(bundle_size) + bundle_size;
+
+  uint8_t header[3 + 3 * 10];
+  uint8_t* p = header;
+  *p++ = kAllocsTag;
+  p = CodedOutputStream::WriteVarint64ToArray(entry_size, p);
+  *p++ = kHostIdTag;
+  p = CodedOutputStream::WriteVarint64ToArray(host_id, p);
+  *p++ = kBundleTag;
+  p = CodedOutputStream::WriteVarint64ToArray(bundle_size, p);
+  slices->emplace_back(header, p - header);
+  AppendSlices(alloc, slices);
+}
+
+}  // namespace
+
+class HostReactor : public grpc::ServerBidiReactor<grpc::ByteBuffer, grpc::ByteBuffer> {
  public:
   HostReactor(ClusterAgentService* service, grpc::CallbackServerContext* context)
       : peer_(context->peer()),
         service_(service),
-        staged_alloc_(&b1_),
-        wip_write_alloc_(&b2_),
         wip_write_(false),
-        has_staged_(false),
         finished_(false) {
     // SPDLOG_LOGGER_INFO(&service->logger_, "{}: new connection from {}", __func__,
     // peer_);
     DoReadLoop();
   }
 
-  void DoReadLoop() { StartRead(&info_); }
+  void DoReadLoop() { StartRead(&read_buf_); }
 
   void OnReadDone(bool ok) override {
+    grpc::Status parse_status;
+    proto::InfoBundle* info = nullptr;
+    std::unique_ptr<proto::InfoBundle> staged;
+    if (ok) {
+      if (service_->ingester_ != nullptr) {
+        // The bundle is handed off to the ingester, which recycles it once applied.
+        staged = service_->ingester_->NewBundle();
+        info = staged.get();
+      } else {
+        // Each read decodes into a fresh InfoBundle on a pooled arena that is reset
+        // (not freed) between reads, so steady-state reads don't allocate.
+        info = info_.Reset();
+      }
+      parse_status =
+          grpc::SerializationTraits<proto::InfoBundle>::Deserialize(&read_buf_, info);
+    }
+
     MutexLockWarnLong l(&mu_, kLongLockDur, &service_->logger_, "HostReactor.mu_");
     if (finished_) {
       return;
@@ -38,6 +106,13 @@ class HostReactor
       finished_ = true;
       return;
     }
+    if (!parse_status.ok()) {
+      SPDLOG_LOGGER_ERROR(&service_->logger_, "bad info from {}: {}", peer_,
+                          parse_status.error_message());
+      Finish(parse_status);
+      finished_ = true;
+      return;
+    }
     // SPDLOG_LOGGER_INFO(&service_->logger_, "got info from {} with {} FGs", peer_,
     //                    info_.flow_infos_size());
 
@@ -55,33 +130,36 @@ class HostReactor
       // If lis_ is null, then we know that only one read was issued (the first) and no
       // writes, so it's impossible for concurrent operations to take place.
       mu_.Unlock();
-      lis_ = service_->controller_->RegisterListener(
-          info_.bundler().host_id(),
-          [this](const proto::AllocBundle& alloc, const SendBundleAux& aux) {
-            // SPDLOG_LOGGER_INFO(&service_->logger_, "sending allocs for {} FGs to {}",
-            //                    alloc.flow_allocs_size(), peer_);
+      lis_ = service_->controller_->RegisterEncodedListener(
+          info->bundler().host_id(),
+          [this](const EncodedAllocBundle& alloc, const SendBundleAux& aux) {
+            // SPDLOG_LOGGER_INFO(&service_->logger_, "sending {} byte allocs to {}",
+            //                    alloc.ByteSize(), peer_);
             UpdateAlloc(alloc, aux);
           });
-      bundler_id_ = service_->controller_->GetBundlerID(info_.bundler());
+      bundler_id_ = service_->controller_->GetBundlerID(info->bundler());
       mu_.Lock(kLongLockDur, &service_->logger_, "HostReactor.mu_");
     }
 
-    service_->controller_->UpdateInfo(bundler_id_, info_);
+    if (staged != nullptr) {
+      service_->ingester_->Enqueue(bundler_id_, std::move(staged));
+    } else {
+      service_->controller_->UpdateInfo(bundler_id_, *info);
+    }
     DoReadLoop();
   }
 
-  void UpdateAlloc(const proto::AllocBundle& alloc, const SendBundleAux& aux) {
+  void UpdateAlloc(const EncodedAllocBundle& alloc, const SendBundleAux& aux) {
     MutexLockWarnLong l(&mu_, kLongLockDur, &service_->logger_, "HostReactor.mu_");
-    *staged_alloc_ = BundleAndAux{alloc, aux};
+    StageAllocBundle(alloc, &staged_);
+    staged_aux_ = aux;
     if (!wip_write_ && !finished_) {
       SendAlloc();
-    } else {
-      has_staged_ = true;
     }
   }
 
   void OnWriteDone(bool ok) override {
-    // TO DEBUG: Do something with wip_write_alloc_->aux
+    // TO DEBUG: Do something with wip_write_alloc_.aux
 
     if (!ok) {
       SPDLOG_LOGGER_ERROR(&service_->logger_, "write failed to {}", peer_);
@@ -95,8 +173,7 @@ class HostReactor
     }
     MutexLockWarnLong l(&mu_, kLongLockDur, &service_->logger_, "HostReactor.mu_");
     wip_write_ = false;
-    if (has_staged_ && !finished_) {
-      has_staged_ = false;
+    if (!staged_.empty() && !finished_) {
       SendAlloc();
     }
   }
@@ -107,31 +184,30 @@ class HostReactor
   static constexpr absl::Duration kLongLockDur = absl::Milliseconds(5);
 
   void SendAlloc() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_) {
-    BundleAndAux* t = staged_alloc_;
-    staged_alloc_ = wip_write_alloc_;
-    wip_write_alloc_ = t;
+    wip_write_alloc_.bundle = ToByteBuffer(staged_.front());
+    wip_write_alloc_.aux = staged_aux_;
+    staged_.erase(staged_.begin());
     wip_write_ = true;
-    StartWrite(&wip_write_alloc_->bundle);
+    StartWrite(&wip_write_alloc_.bundle);
   }
 
   struct BundleAndAux {
-    proto::AllocBundle bundle;
+    grpc::ByteBuffer bundle;  // serialized proto::AllocBundle
     SendBundleAux aux;
   };
 
   const std::string peer_;
   ClusterAgentService* service_;
-  proto::InfoBundle info_;
+  grpc::ByteBuffer read_buf_;
+  ReusableArenaMessage<proto::InfoBundle> info_;
 
   TimedMutex mu_;
-  BundleAndAux b1_ ABSL_GUARDED_BY(mu_);
-  BundleAndAux b2_ ABSL_GUARDED_BY(mu_);
 
   // Write state
-  BundleAndAux* staged_alloc_ ABSL_GUARDED_BY(mu_);
-  BundleAndAux* wip_write_alloc_ ABSL_GUARDED_BY(mu_);
+  std::vector<EncodedAllocBundle> staged_ ABSL_GUARDED_BY(mu_);  // see StageAllocBundle
+  SendBundleAux staged_aux_ ABSL_GUARDED_BY(mu_);
+  BundleAndAux wip_write_alloc_ ABSL_GUARDED_BY(mu_);
   bool wip_write_ ABSL_GUARDED_BY(mu_);
-  bool has_staged_ ABSL_GUARDED_BY(mu_);
 
   bool finished_;  // only read/written in event loop
 
@@ -139,24 +215,229 @@ class HostReactor
   ParID bundler_id_ = -1;
 };
 
+// AggregatorReactor serves an aggregator-agent: it feeds the summaries it receives to
+// the controller and relays allocations for the hosts behind the aggregator back on
+// the same stream.
+class AggregatorReactor
+    : public grpc::ServerBidiReactor<grpc::ByteBuffer, grpc::ByteBuffer> {
+ public:
+  AggregatorReactor(ClusterAgentService* service, grpc::CallbackServerContext* context)
+      : peer_(context->peer()), service_(service), wip_write_(false), finished_(false) {
+    StartRead(&read_buf_);
+  }
+
+  void OnReadDone(bool ok) override {
+    grpc::Status parse_status;
+    if (ok) {
+      parse_status = grpc::SerializationTraits<proto::AggregatedInfoBundle>::Deserialize(
+          &read_buf_, info_.Reset());
+    }
+
+    {
+      MutexLockWarnLong l(&mu_, kLongLockDur, &service_->logger_,
+                          "AggregatorReactor.mu_");
+      if (finished_) {
+        return;
+      }
+      if (!ok) {
+        FinishLocked(grpc::Status::OK);
+      } else if (!parse_status.ok()) {
+        SPDLOG_LOGGER_ERROR(&service_->logger_, "bad aggregated info from {}: {}", peer_,
+                            parse_status.error_message());
+        FinishLocked(parse_status);
+      }
+    }
+    if (!ok || !parse_status.ok()) {
+      CloseListeners();
+      return;
+    }
+
+    {
+      // mu_ is not held to avoid a lock cycle with the controller (see HostReactor).
+      absl::MutexLock l(&lis_mu_);
+      if (lis_closed_) {
+        return;  // a write failed
+      }
+      for (const proto::HostGen& hg : info_->host_gens()) {
+        std::unique_ptr<ClusterController::Listener>& lis = listeners_[hg.host_id()];
+        if (lis == nullptr) {
+          const uint64_t host_id = hg.host_id();
+          lis = service_->controller_->RegisterEncodedListener(
+              host_id,
+              [this, host_id](const EncodedAllocBundle& alloc, const SendBundleAux& aux) {
+                Relay(host_id, alloc);
+              });
+        }
+      }
+    }
+
+    absl::Status st = service_->controller_->UpdateAggregatedInfo(*info_);
+    if (!st.ok()) {
+      {
+        MutexLockWarnLong l(&mu_, kLongLockDur, &service_->logger_,
+                            "AggregatorReactor.mu_");
+        SPDLOG_LOGGER_ERROR(&service_->logger_, "rejecting aggregator {}: {}", peer_,
+                            st.ToString());
+        if (!finished_) {
+          // absl and gRPC status codes share values.
+          FinishLocked(grpc::Status(static_cast<grpc::StatusCode>(st.code()),
+                                    std::string(st.message())));
+        }
+      }
+      CloseListeners();
+      return;
+    }
+    StartRead(&read_buf_);
+  }
+
+  void Relay(uint64_t host_id, const EncodedAllocBundle& alloc) {
+    MutexLockWarnLong l(&mu_, kLongLockDur, &service_->logger_, "AggregatorReactor.mu_");
+    // Like HostReactor, only the latest allocations of each host are kept.
+    StageAllocBundle(alloc, &pending_[host_id]);
+    if (!wip_write_ && !finished_) {
+      SendPending();
+    }
+  }
+
+  void OnWriteDone(bool ok) override {
+    {
+      MutexLockWarnLong l(&mu_, kLongLockDur, &service_->logger_,
+                          "AggregatorReactor.mu_");
+      wip_write_ = false;
+      if (ok) {
+        if (!pending_.empty() && !finished_) {
+          SendPending();
+        }
+        return;
+      }
+      SPDLOG_LOGGER_ERROR(&service_->logger_, "write failed to {}", peer_);
+      if (!finished_) {
+        FinishLocked(grpc::Status(grpc::StatusCode::UNKNOWN, "failed write"));
+      }
+    }
+    CloseListeners();
+  }
+
+  void OnDone() override { delete this; }
+
+ private:
+  static constexpr absl::Duration kLongLockDur = absl::Milliseconds(5);
+
+  void FinishLocked(grpc::Status status) ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_) {
+    Finish(std::move(status));
+    finished_ = true;
+  }
+
+  // Unregisters all relayed hosts so that the controller stops calling Relay, which
+  // would otherwise race with OnDone. Must be called without mu_ held, since the
+  // controller holds its own lock while calling Relay.
+  void CloseListeners() {
+    absl::MutexLock l(&lis_mu_);
+    lis_closed_ = true;
+    listeners_.clear();
+  }
+
+  // Sends all pending bundles in one RelayedAllocBatch.
+  void SendPending() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_) {
+    slices_.clear();
+    for (const auto& [host_id, allocs] : pending_) {
+      for (const EncodedAllocBundle& alloc : allocs) {
+        AppendRelayedAlloc(host_id, alloc, &slices_);
+      }
+    }
+    pending_.clear();
+    write_buf_ = grpc::ByteBuffer(slices_.data(), slices_.size());
+    wip_write_ = true;
+    StartWrite(&write_buf_);
+  }
+
+  const std::string peer_;
+  ClusterAgentService* service_;
+  grpc::ByteBuffer read_buf_;
+  ReusableArenaMessage<proto::AggregatedInfoBundle> info_;
+
+  TimedMutex mu_;
+  absl::flat_hash_map<uint64_t, std::vector<EncodedAllocBundle>> pending_
+      ABSL_GUARDED_BY(mu_);
+  std::vector<grpc::Slice> slices_ ABSL_GUARDED_BY(mu_);
+  grpc::ByteBuffer write_buf_ ABSL_GUARDED_BY(mu_);
+  bool wip_write_ ABSL_GUARDED_BY(mu_);
+  bool finished_ ABSL_GUARDED_BY(mu_);
+
+  // Declared last so that, like HostReactor's lis_, the listeners are destroyed (and
+  // stop calling Relay) before the state that Relay touches.
+  absl::Mutex lis_mu_;
+  bool lis_closed_ ABSL_GUARDED_BY(lis_mu_) = false;
+  absl::flat_hash_map<uint64_t, std::unique_ptr<ClusterController::Listener>> listeners_
+      ABSL_GUARDED_BY(lis_mu_);
+};
+
 ClusterAgentService::ClusterAgentService(
-    const std::shared_ptr<ClusterController>& controller, int id)
+    const std::shared_ptr<ClusterController>& controller, int id, InfoIngester* ingester)
     : controller_(std::move(controller)),
+      ingester_(ingester),
       logger_(MakeLogger(absl::StrCat("cluster-agent-svc-", id))) {}
 
-grpc::ServerBidiReactor<proto::InfoBundle, proto::AllocBundle>*
+grpc::ServerBidiReactor<grpc::ByteBuffer, grpc::ByteBuffer>*
 ClusterAgentService::RegisterHost(grpc::CallbackServerContext* context) {
   return new HostReactor(this, context);
 }
 
+grpc::ServerBidiReactor<grpc::ByteBuffer, grpc::ByteBuffer>*
+ClusterAgentService::RegisterAggregator(grpc::CallbackServerContext* context) {
+  return new AggregatorReactor(this, context);
+}
+
+static void LogIngestStats(InfoIngester* ingester, spdlog::logger* logger) {
+  if (ingester == nullptr) {
+    return;
+  }
+  InfoIngester::Stats s = ingester->TakeStats();
+  SPDLOG_LOGGER_INFO(logger,
+                     "ingest: queue depth = {} applied = {} dropped = {} batches = {} "
+                     "mean batch = {} max batch = {} mean lag = {} max lag = {}",
+                     s.queue_depth, s.num_applied, s.num_dropped, s.num_batches,
+                     s.mean_batch_size, s.max_batch_size, s.mean_lag, s.max_lag);
+}
+
 void RunLoop(const std::shared_ptr<ClusterController>& controller,
              absl::Duration control_period, std::atomic<bool>* should_exit,
-             spdlog::logger* logger) {
+             spdlog::logger* logger, InfoIngester* ingester) {
   while (!should_exit->load()) {
+    LogIngestStats(ingester, logger);
     SPDLOG_LOGGER_INFO(logger, "{}: compute new allocations", __func__);
     controller->ComputeAndBroadcast();
     absl::SleepFor(control_period);
   }
 }
 
+void RunAdaptiveLoop(const std::shared_ptr<ClusterController>& controller,
+                     const AdaptiveLoopConfig& config, std::atomic<bool>* should_exit,
+                     spdlog::logger* logger, InfoIngester* ingester) {
+  const char* reason = "start";
+  while (!should_exit->load()) {
+    LogIngestStats(ingester, logger);
+    SPDLOG_LOGGER_INFO(logger, "{}: compute new allocations ({})", __func__, reason);
+    const absl::Time start = absl::Now();
+    controller->ComputeAndBroadcast();
+
+    absl::SleepFor(config.min_period - (absl::Now() - start));
+    reason = nullptr;
+    while (reason == nullptr && !should_exit->load()) {
+      if (absl::Now() - start >= config.max_period) {
+        reason = "max period";
+        break;
+      }
+      const NewInfoSummary summary = controller->SummarizeNewInfo();
+      if (summary.frac_hosts_reported >= config.report_frac) {
+        reason = "hosts reported";
+      } else if (config.on_approval_crossing && summary.num_fgs_crossed_approval > 0) {
+        reason = "approval crossed";
+      } else {
+        absl::SleepFor(config.poll_period);
+      }
+    }
+  }
+}
+
 }  // namespace heyp
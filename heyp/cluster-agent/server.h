@@ -5,28 +5,64 @@
 #include <memory>
 
 #include "heyp/cluster-agent/controller-iface.h"
+#include "heyp/cluster-agent/info-ingester.h"
 #include "heyp/proto/heyp.grpc.pb.h"
 #include "spdlog/spdlog.h"
 
 namespace heyp {
 
-class ClusterAgentService final : public proto::ClusterAgent::CallbackService {
+// ClusterAgentService handles RegisterHost and RegisterAggregator streams.
+//
+// Messages are (de)serialized by the reactors instead of by gRPC so that allocations
+// can be sent as pre-serialized buffers that are shared among hosts.
+class ClusterAgentService final
+    : public proto::ClusterAgent::WithRawCallbackMethod_RegisterHost<
+          proto::ClusterAgent::WithRawCallbackMethod_RegisterAggregator<
+              proto::ClusterAgent::Service>> {
  public:
-  ClusterAgentService(const std::shared_ptr<ClusterController>& controller, int id);
+  // If ingester is non-null, host InfoBundles are applied through it instead of on
+  // the gRPC callback threads.
+  ClusterAgentService(const std::shared_ptr<ClusterController>& controller, int id,
+                      InfoIngester* ingester = nullptr);
 
-  grpc::ServerBidiReactor<proto::InfoBundle, proto::AllocBundle>* RegisterHost(
+  grpc::ServerBidiReactor<grpc::ByteBuffer, grpc::ByteBuffer>* RegisterHost(
+      grpc::CallbackServerContext* context) override;
+
+  grpc::ServerBidiReactor<grpc::ByteBuffer, grpc::ByteBuffer>* RegisterAggregator(
       grpc::CallbackServerContext* context) override;
 
  private:
   std::shared_ptr<ClusterController> controller_;
+  InfoIngester* ingester_;
   spdlog::logger logger_;
 
   friend class HostReactor;
+  friend class AggregatorReactor;
 };
 
+// Also logs the ingester's stats every period if one is given.
 void RunLoop(const std::shared_ptr<ClusterController>& controller,
              absl::Duration control_period, std::atomic<bool>* should_exit,
-             spdlog::logger* logger);
+             spdlog::logger* logger, InfoIngester* ingester = nullptr);
+
+struct AdaptiveLoopConfig {
+  absl::Duration min_period = absl::Milliseconds(100);
+  absl::Duration max_period = absl::Seconds(5);
+  absl::Duration poll_period = absl::Milliseconds(10);
+
+  // Run once controller->SummarizeNewInfo() reports this many reports per host.
+  double report_frac = 0.5;
+
+  // Run once controller->SummarizeNewInfo() reports that an FG crossed its approval.
+  bool on_approval_crossing = true;
+};
+
+// Like RunLoop, but runs ComputeAndBroadcast as soon as enough new information has
+// arrived, as long as min_period has passed since the last run. Runs at least every
+// max_period.
+void RunAdaptiveLoop(const std::shared_ptr<ClusterController>& controller,
+                     const AdaptiveLoopConfig& config, std::atomic<bool>* should_exit,
+                     spdlog::logger* logger, InfoIngester* ingester = nullptr);
 
 }  // namespace heyp
 
@@ -1,5 +1,6 @@
 #include "heyp/flows/aggregator.h"
 
+#include "absl/random/random.h"
 #include "gmock/gmock.h"
 #include "google/protobuf/util/message_differencer.h"
 #include "gtest/gtest.h"
@@ -73,10 +74,12 @@ void UpdateFlowAgg(FlowAggregator* flow_agg, const proto::InfoBundle& b) {
   flow_agg->Update(id, b);
 }
 
-TEST(ConnToHostAggregatorTest, OneBundleOneTime) {
+class ConnToHostAggregatorTest : public testing::TestWithParam<bool> {};
+
+TEST_P(ConnToHostAggregatorTest, OneBundleOneTime) {
   const absl::Duration window = absl::Seconds(30);
   auto flow_agg = NewConnToHostAggregator(
-      absl::make_unique<BweDemandPredictor>(window, 1.2, 100), window);
+      absl::make_unique<BweDemandPredictor>(window, 1.2, 100), window, GetParam());
 
   UpdateFlowAgg(flow_agg.get(), ParseTextProto<proto::InfoBundle>(R"(
                   bundler { host_id: 1 }
@@ -235,10 +238,10 @@ TEST(ConnToHostAggregatorTest, OneBundleOneTime) {
       }));
 }
 
-TEST(ConnToHostAggregatorTest, AliveThenDead) {
+TEST_P(ConnToHostAggregatorTest, AliveThenDead) {
   const absl::Duration window = absl::Seconds(30);
   auto flow_agg = NewConnToHostAggregator(
-      absl::make_unique<BweDemandPredictor>(window, 1.2, 100), window);
+      absl::make_unique<BweDemandPredictor>(window, 1.2, 100), window, GetParam());
 
   UpdateFlowAgg(flow_agg.get(), ParseTextProto<proto::InfoBundle>(R"(
                   bundler { host_id: 1 }
@@ -323,10 +326,14 @@ TEST(ConnToHostAggregatorTest, AliveThenDead) {
             }));
 }
 
-TEST(HostToClusterAggregatorTest, Unaligned) {
+INSTANTIATE_TEST_SUITE_P(Incremental, ConnToHostAggregatorTest, testing::Bool());
+
+class HostToClusterAggregatorTest : public testing::TestWithParam<bool> {};
+
+TEST_P(HostToClusterAggregatorTest, Unaligned) {
   const absl::Duration window = absl::Seconds(60);
   auto flow_agg = NewHostToClusterAggregator(
-      absl::make_unique<BweDemandPredictor>(window, 1.1, 50), window);
+      absl::make_unique<BweDemandPredictor>(window, 1.1, 50), window, GetParam());
 
   UpdateFlowAgg(flow_agg.get(), ParseTextProto<proto::InfoBundle>(R"(
                   bundler { host_id: 2 }
@@ -425,5 +432,45 @@ TEST(HostToClusterAggregatorTest, Unaligned) {
       }));
 }
 
+INSTANTIATE_TEST_SUITE_P(Incremental, HostToClusterAggregatorTest, testing::Bool());
+
+TEST(FlowAggregatorTest, IncrementalMatchesRebuild) {
+  const absl::Duration window = absl::Seconds(5);
+  auto rebuild = NewHostToClusterAggregator(
+      absl::make_unique<BweDemandPredictor>(window, 1.1, 50), window, false);
+  auto incremental = NewHostToClusterAggregator(
+      absl::make_unique<BweDemandPredictor>(window, 1.1, 50), window, true);
+
+  const std::vector<std::string> dsts = {"west-us", "central-us", "east-eu"};
+  absl::BitGen gen;
+  for (int sec = 1; sec <= 40; ++sec) {
+    for (int host = 1; host <= 8; ++host) {
+      if (absl::Bernoulli(gen, 0.3)) {
+        continue;  // skip to let some children expire and revive
+      }
+      proto::InfoBundle b;
+      b.mutable_bundler()->set_host_id(host);
+      b.mutable_timestamp()->set_seconds(sec);
+      for (const std::string& dst : dsts) {
+        if (absl::Bernoulli(gen, 0.4)) {
+          continue;
+        }
+        proto::FlowInfo* fi = b.add_flow_infos();
+        fi->mutable_flow()->set_src_dc("east-us");
+        fi->mutable_flow()->set_dst_dc(dst);
+        fi->mutable_flow()->set_job("UNSET");
+        fi->mutable_flow()->set_host_id(host);
+        fi->set_ewma_usage_bps(absl::Uniform(gen, 0, 1000));
+        fi->set_cum_hipri_usage_bytes(100 * sec + host);
+        fi->set_cum_lopri_usage_bytes(10 * sec);
+        fi->set_currently_lopri(absl::Bernoulli(gen, 0.5));
+      }
+      UpdateFlowAgg(rebuild.get(), b);
+      UpdateFlowAgg(incremental.get(), b);
+    }
+    ASSERT_EQ(GetResult(*rebuild), GetResult(*incremental)) << "at " << sec << "s";
+  }
+}
+
 }  // namespace
 }  // namespace heyp
@@ -36,7 +36,7 @@ CompareFlowOptions ClusterFlowOptions() {
 
 std::unique_ptr<FlowAggregator> NewConnToHostAggregator(
     std::unique_ptr<DemandPredictor> host_demand_predictor,
-    absl::Duration usage_history_window) {
+    absl::Duration usage_history_window, bool incremental) {
   return absl::make_unique<FlowAggregator>(
       std::move(host_demand_predictor),
       FlowAggregator::Config{
@@ -49,12 +49,13 @@ std::unique_ptr<FlowAggregator> NewConnToHostAggregator(
           .is_valid_child = [](const proto::FlowMarker& c) -> bool {
             return ExpectedFieldsAreSet(c, {});
           },
+          .incremental = incremental,
       });
 }
 
 std::unique_ptr<FlowAggregator> NewHostToClusterAggregator(
     std::unique_ptr<DemandPredictor> cluster_demand_predictor,
-    absl::Duration usage_history_window) {
+    absl::Duration usage_history_window, bool incremental) {
   return absl::make_unique<FlowAggregator>(
       std::move(cluster_demand_predictor),
       FlowAggregator::Config{
@@ -67,6 +68,7 @@ std::unique_ptr<FlowAggregator> NewHostToClusterAggregator(
           .is_valid_child = [](const proto::FlowMarker& h) -> bool {
             return ExpectedFieldsAreSet(h, HostFlowOptions());
           },
+          .incremental = incremental,
       });
 }
 
@@ -81,8 +83,20 @@ ParID FlowAggregator::GetBundlerID(const proto::FlowMarker& bundler) {
 }
 
 void FlowAggregator::Update(ParID bundler_id, const proto::InfoBundle& bundle) {
+  Update(bundler_id, bundle, [](proto::FlowInfo*) {});
+}
+
+void FlowAggregator::Update(ParID bundler_id, const proto::InfoBundle& bundle,
+                            absl::FunctionRef<void(proto::FlowInfo*)> annotate) {
   const absl::Time timestamp = FromProtoTimestamp(bundle.timestamp());
 
+  if (config_.incremental) {
+    bundle_states_.OnID(bundler_id, [&](BundleState& bs) {
+      UpdateIncremental(bs, timestamp, bundle, annotate);
+    });
+    return;
+  }
+
   bundle_states_.OnID(bundler_id, [&](BundleState& bs) {
     for (const proto::FlowInfo& fi : bundle.flow_infos()) {
       if (config_.is_valid_child != nullptr) {
@@ -94,30 +108,173 @@ void FlowAggregator::Update(ParID bundler_id, const proto::InfoBundle& bundle) {
       if (iter == bs.active.end()) {
         // Remove from the dead map (in case it exists)
         bs.dead.erase(fi.flow());
-        bs.active[fi.flow()] = {timestamp, fi};
+        iter = bs.active.insert({fi.flow(), {timestamp, fi}}).first;
       } else {
         iter->second = {timestamp, fi};
       }
+      annotate(&iter->second.info);
     }
     std::vector<proto::FlowMarker> to_erase;
     for (const auto& iter : bs.active) {
-      if (iter.second.first + config_.usage_history_window < timestamp) {
+      if (iter.second.time + config_.usage_history_window < timestamp) {
         to_erase.push_back(iter.first);
       }
     }
     for (const proto::FlowMarker& m : to_erase) {
-      bs.dead[m] = {timestamp, bs.active[m].second};
+      bs.dead[m] = {timestamp, bs.active[m].info};
       bs.active.erase(m);
     }
   });
 }
 
+void FlowAggregator::UpdateIncremental(
+    BundleState& bs, absl::Time timestamp, const proto::InfoBundle& bundle,
+    absl::FunctionRef<void(proto::FlowInfo*)> annotate) {
+  for (const proto::FlowInfo& fi : bundle.flow_infos()) {
+    if (config_.is_valid_child != nullptr) {
+      H_SPDLOG_CHECK_MESG(&logger_, config_.is_valid_child(fi.flow()),
+                          fi.flow().ShortDebugString());
+    }
+
+    auto iter = bs.active.find(fi.flow());
+    if (iter != bs.active.end()) {
+      ChildState& c = iter->second;
+      IncrementalAgg* agg = c.agg;
+      absl::MutexLock l(&agg->mu);
+      RemoveActive(agg, c.time, c.info, &c.handle);
+      c.time = timestamp;
+      c.info = fi;
+      annotate(&c.info);
+      AddActive(agg, c.time, c.info, &c.handle);
+      continue;
+    }
+
+    IncrementalAgg* agg = nullptr;
+    if (auto dead_iter = bs.dead.find(fi.flow()); dead_iter != bs.dead.end()) {
+      agg = dead_iter->second.agg;
+      absl::MutexLock l(&agg->mu);
+      RemoveDead(agg, dead_iter->second.time, dead_iter->second.info);
+      bs.dead.erase(dead_iter);
+    } else {
+      agg = InternAgg(fi.flow());
+    }
+    iter = bs.active.insert({fi.flow(), {timestamp, fi, agg}}).first;
+    ChildState& c = iter->second;
+    annotate(&c.info);
+    absl::MutexLock l(&agg->mu);
+    AddActive(agg, c.time, c.info, &c.handle);
+  }
+
+  std::vector<proto::FlowMarker> to_erase;
+  for (const auto& iter : bs.active) {
+    if (iter.second.time + config_.usage_history_window < timestamp) {
+      to_erase.push_back(iter.first);
+    }
+  }
+  for (const proto::FlowMarker& m : to_erase) {
+    auto iter = bs.active.find(m);
+    ChildState& c = iter->second;
+    IncrementalAgg* agg = c.agg;
+    {
+      absl::MutexLock l(&agg->mu);
+      RemoveActive(agg, c.time, c.info, &c.handle);
+      AddDead(agg, timestamp, c.info);
+    }
+    bs.dead[m] = {timestamp, std::move(c.info), agg};
+    bs.active.erase(iter);
+  }
+}
+
+void FlowAggregator::AddActive(IncrementalAgg* agg, absl::Time time,
+                               const proto::FlowInfo& info, int32_t* handle) {
+  agg->active_times.insert(time);
+  agg->cum_hipri_usage_bytes += info.cum_hipri_usage_bytes();
+  agg->cum_lopri_usage_bytes += info.cum_lopri_usage_bytes();
+  agg->sum_ewma_usage_bps += info.ewma_usage_bps();
+  if (info.currently_lopri()) {
+    agg->sum_ewma_lopri_usage_bps += info.ewma_usage_bps();
+  } else {
+    agg->sum_ewma_hipri_usage_bps += info.ewma_usage_bps();
+  }
+
+  if (agg->free_handles.empty()) {
+    *handle = agg->slot_of_handle.size();
+    agg->slot_of_handle.push_back(-1);
+  } else {
+    *handle = agg->free_handles.back();
+    agg->free_handles.pop_back();
+  }
+  agg->slot_of_handle[*handle] = agg->info.children_size();
+  agg->handle_of_slot.push_back(*handle);
+  *agg->info.add_children() = info;
+}
+
+void FlowAggregator::RemoveActive(IncrementalAgg* agg, absl::Time time,
+                                  const proto::FlowInfo& info, int32_t* handle) {
+  agg->active_times.erase(agg->active_times.find(time));
+  agg->cum_hipri_usage_bytes -= info.cum_hipri_usage_bytes();
+  agg->cum_lopri_usage_bytes -= info.cum_lopri_usage_bytes();
+  agg->sum_ewma_usage_bps -= info.ewma_usage_bps();
+  if (info.currently_lopri()) {
+    agg->sum_ewma_lopri_usage_bps -= info.ewma_usage_bps();
+  } else {
+    agg->sum_ewma_hipri_usage_bps -= info.ewma_usage_bps();
+  }
+
+  // Swap-remove the child and fix up the handle of the one that moved.
+  const int32_t slot = agg->slot_of_handle[*handle];
+  const int32_t last = agg->info.children_size() - 1;
+  if (slot != last) {
+    agg->info.mutable_children()->SwapElements(slot, last);
+    const int32_t moved = agg->handle_of_slot[last];
+    agg->handle_of_slot[slot] = moved;
+    agg->slot_of_handle[moved] = slot;
+  }
+  agg->info.mutable_children()->RemoveLast();
+  agg->handle_of_slot.pop_back();
+  agg->slot_of_handle[*handle] = -1;
+  agg->free_handles.push_back(*handle);
+  *handle = -1;
+}
+
+void FlowAggregator::AddDead(IncrementalAgg* agg, absl::Time time,
+                             const proto::FlowInfo& info) {
+  agg->dead_times.insert(time);
+  agg->cum_hipri_usage_bytes += info.cum_hipri_usage_bytes();
+  agg->cum_lopri_usage_bytes += info.cum_lopri_usage_bytes();
+}
+
+void FlowAggregator::RemoveDead(IncrementalAgg* agg, absl::Time time,
+                                const proto::FlowInfo& info) {
+  agg->dead_times.erase(agg->dead_times.find(time));
+  agg->cum_hipri_usage_bytes -= info.cum_hipri_usage_bytes();
+  agg->cum_lopri_usage_bytes -= info.cum_lopri_usage_bytes();
+}
+
+FlowAggregator::IncrementalAgg* FlowAggregator::InternAgg(
+    const proto::FlowMarker& child) {
+  proto::FlowMarker agg_flow = config_.get_agg_flow_fn(child);
+  absl::MutexLock l(&incremental_aggs_mu_);
+  auto iter = incremental_agg_index_.find(agg_flow);
+  if (iter != incremental_agg_index_.end()) {
+    return iter->second;
+  }
+  incremental_aggs_.push_back(std::make_unique<IncrementalAgg>(agg_flow));
+  incremental_agg_index_[agg_flow] = incremental_aggs_.back().get();
+  return incremental_aggs_.back().get();
+}
+
 constexpr bool kDebugSpikes = false;
 
 void FlowAggregator::ForEachAgg(
     absl::FunctionRef<void(absl::Time, const proto::AggInfo&)> func) {
   MutexLockWarnLong l(&mu_, absl::Seconds(1), &logger_, "mu_");
 
+  if (config_.incremental) {
+    ForEachAggIncremental(func);
+    return;
+  }
+
   FlowMap<AggWIP> agg_wips;
 
   // Get a pointer to agg_wips_ here, while we have the lock since clang's thread-safety
@@ -128,30 +285,30 @@ void FlowAggregator::ForEachAgg(
         for (const auto& flow_time_info : bs.active) {
           AggWIP* wip = GetAggWIP(config_, flow_time_info.first, &agg_wips);
           wip->oldest_active_time =
-              std::min(wip->oldest_active_time, flow_time_info.second.first);
+              std::min(wip->oldest_active_time, flow_time_info.second.time);
           wip->cum_hipri_usage_bytes +=
-              flow_time_info.second.second.cum_hipri_usage_bytes();
+              flow_time_info.second.info.cum_hipri_usage_bytes();
           wip->cum_lopri_usage_bytes +=
-              flow_time_info.second.second.cum_lopri_usage_bytes();
-          wip->sum_ewma_usage_bps += flow_time_info.second.second.ewma_usage_bps();
-          if (flow_time_info.second.second.currently_lopri()) {
+              flow_time_info.second.info.cum_lopri_usage_bytes();
+          wip->sum_ewma_usage_bps += flow_time_info.second.info.ewma_usage_bps();
+          if (flow_time_info.second.info.currently_lopri()) {
             wip->sum_ewma_lopri_usage_bps +=
-                flow_time_info.second.second.ewma_usage_bps();
+                flow_time_info.second.info.ewma_usage_bps();
           } else {
             wip->sum_ewma_hipri_usage_bps +=
-                flow_time_info.second.second.ewma_usage_bps();
+                flow_time_info.second.info.ewma_usage_bps();
           }
-          wip->children.push_back(flow_time_info.second.second);
+          wip->children.push_back(flow_time_info.second.info);
         }
 
         for (const auto& flow_time_info : bs.dead) {
           AggWIP* wip = GetAggWIP(config_, flow_time_info.first, &agg_wips);
           wip->newest_dead_time =
-              std::max(wip->newest_dead_time, flow_time_info.second.first);
+              std::max(wip->newest_dead_time, flow_time_info.second.time);
           wip->cum_hipri_usage_bytes +=
-              flow_time_info.second.second.cum_hipri_usage_bytes();
+              flow_time_info.second.info.cum_hipri_usage_bytes();
           wip->cum_lopri_usage_bytes +=
-              flow_time_info.second.second.cum_lopri_usage_bytes();
+              flow_time_info.second.info.cum_lopri_usage_bytes();
         }
       });
 
@@ -163,9 +320,9 @@ void FlowAggregator::ForEachAgg(
     ParID num_ids = states.NumIDs();
     states.ForEach(0, num_ids, [&](ParID bundler_id, BundleState& bs) {
       for (auto& flow_time_info : bs.active) {
-        if (IsSameFlow(config_.get_agg_flow_fn(flow_time_info.second.second.flow()),
+        if (IsSameFlow(config_.get_agg_flow_fn(flow_time_info.second.info.flow()),
                        wanted_agg)) {
-          lines.push_back("\t" + flow_time_info.second.second.ShortDebugString());
+          lines.push_back("\t" + flow_time_info.second.info.ShortDebugString());
         }
       }
     });
@@ -173,9 +330,9 @@ void FlowAggregator::ForEachAgg(
     lines.push_back("dead: [");
     states.ForEach(0, num_ids, [&](ParID bundler_id, BundleState& bs) {
       for (auto& flow_time_info : bs.dead) {
-        if (IsSameFlow(config_.get_agg_flow_fn(flow_time_info.second.second.flow()),
+        if (IsSameFlow(config_.get_agg_flow_fn(flow_time_info.second.info.flow()),
                        wanted_agg)) {
-          lines.push_back("\t" + flow_time_info.second.second.ShortDebugString());
+          lines.push_back("\t" + flow_time_info.second.info.ShortDebugString());
         }
       }
     });
@@ -253,6 +410,42 @@ FlowAggregator::AggWIP* FlowAggregator::GetAggWIP(const Config& config,
   return &iter->second;
 }
 
+void FlowAggregator::ForEachAggIncremental(
+    absl::FunctionRef<void(absl::Time, const proto::AggInfo&)> func) {
+  std::vector<IncrementalAgg*> aggs;
+  {
+    absl::MutexLock l(&incremental_aggs_mu_);
+    aggs.reserve(incremental_aggs_.size());
+    for (const auto& agg : incremental_aggs_) {
+      aggs.push_back(agg.get());
+    }
+  }
+
+  for (IncrementalAgg* agg : aggs) {
+    absl::MutexLock l(&agg->mu);
+    absl::Time time;
+    if (!agg->active_times.empty()) {
+      time = *agg->active_times.begin();
+    } else if (!agg->dead_times.empty()) {
+      time = *agg->dead_times.rbegin();
+    } else {
+      continue;
+    }
+    agg->state.UpdateUsage(
+        {
+            .time = time,
+            .sum_child_usage_bps = agg->sum_ewma_usage_bps,
+            .sum_child_hipri_usage_bps = agg->sum_ewma_hipri_usage_bps,
+            .sum_child_lopri_usage_bps = agg->sum_ewma_lopri_usage_bps,
+            .cum_hipri_usage_bytes = agg->cum_hipri_usage_bytes,
+            .cum_lopri_usage_bytes = agg->cum_lopri_usage_bytes,
+        },
+        config_.usage_history_window, *agg_demand_predictor_);
+    *agg->info.mutable_parent() = agg->state.cur();
+    func(time, agg->info);
+  }
+}
+
 AggState* FlowAggregator::GetAggState(const proto::FlowMarker& agg_flow,
                                       FlowMap<AggState>* states) {
   auto iter = states->find(agg_flow);
@@ -1,7 +1,9 @@
 #ifndef HEYP_FLOWS_AGGREGATOR_H_
 #define HEYP_FLOWS_AGGREGATOR_H_
 
+#include <memory>
 #include <mutex>
+#include <set>
 #include <string>
 #include <vector>
 
@@ -23,11 +25,11 @@ class FlowAggregator;
 
 std::unique_ptr<FlowAggregator> NewConnToHostAggregator(
     std::unique_ptr<DemandPredictor> host_demand_predictor,
-    absl::Duration usage_history_window);
+    absl::Duration usage_history_window, bool incremental = false);
 
 std::unique_ptr<FlowAggregator> NewHostToClusterAggregator(
     std::unique_ptr<DemandPredictor> cluster_demand_predictor,
-    absl::Duration usage_history_window);
+    absl::Duration usage_history_window, bool incremental = false);
 
 class FlowAggregator {
  public:
@@ -37,6 +39,10 @@ class FlowAggregator {
 
     std::function<bool(proto::FlowMarker)> is_valid_parent;  // optional
     std::function<bool(proto::FlowMarker)> is_valid_child;   // optional
+
+    // If set, Update applies each child's change to running per-FG sums (and
+    // children lists), so ForEachAgg need not visit every child.
+    bool incremental = false;
   };
 
   FlowAggregator(std::unique_ptr<DemandPredictor> agg_demand_predictor, Config config);
@@ -47,6 +53,11 @@ class FlowAggregator {
   // flows (i.e. the same flow should only ever be reported by one bundler).
   void Update(ParID bundler_id, const proto::InfoBundle& bundle);
 
+  // Like Update, but calls annotate on the stored copy of each FlowInfo (e.g. to
+  // override its QoS) so that callers need not copy bundle to modify it.
+  void Update(ParID bundler_id, const proto::InfoBundle& bundle,
+              absl::FunctionRef<void(proto::FlowInfo*)> annotate);
+
   ParID GetBundlerID(const proto::FlowMarker& bundler);
 
   void ForEachAgg(absl::FunctionRef<void(absl::Time, const proto::AggInfo&)> func);
@@ -66,10 +77,42 @@ class FlowAggregator {
   template <typename ValueType>
   using FlowMap = absl::flat_hash_map<proto::FlowMarker, ValueType, HashFlow, EqFlow>;
 
+  // Running sums of an FG in incremental mode.
+  struct IncrementalAgg {
+    explicit IncrementalAgg(const proto::FlowMarker& flow) : state(flow, false) {}
+
+    absl::Mutex mu;
+    int64_t cum_hipri_usage_bytes ABSL_GUARDED_BY(mu) = 0;
+    int64_t cum_lopri_usage_bytes ABSL_GUARDED_BY(mu) = 0;
+    int64_t sum_ewma_usage_bps ABSL_GUARDED_BY(mu) = 0;
+    int64_t sum_ewma_hipri_usage_bps ABSL_GUARDED_BY(mu) = 0;
+    int64_t sum_ewma_lopri_usage_bps ABSL_GUARDED_BY(mu) = 0;
+    std::multiset<absl::Time> active_times ABSL_GUARDED_BY(mu);
+    std::multiset<absl::Time> dead_times ABSL_GUARDED_BY(mu);
+
+    // children holds the active children. Children refer to their entries by a
+    // handle that stays valid when other children are removed.
+    proto::AggInfo info ABSL_GUARDED_BY(mu);
+    std::vector<int32_t> slot_of_handle ABSL_GUARDED_BY(mu);
+    std::vector<int32_t> handle_of_slot ABSL_GUARDED_BY(mu);
+    std::vector<int32_t> free_handles ABSL_GUARDED_BY(mu);
+
+    AggState state;  // only accessed by ForEachAgg
+  };
+
+  struct ChildState {
+    absl::Time time;
+    proto::FlowInfo info;
+
+    // Only used in incremental mode.
+    IncrementalAgg* agg = nullptr;
+    int32_t handle = -1;  // set while active
+  };
+
   struct BundleState {
     absl::Time last_updated = absl::InfinitePast();
-    FlowMap<std::pair<absl::Time, proto::FlowInfo>> active;
-    FlowMap<std::pair<absl::Time, proto::FlowInfo>> dead;
+    FlowMap<ChildState> active;
+    FlowMap<ChildState> dead;
   };
   using BundleStatesMap = ParIndexedMap<proto::FlowMarker, BundleState, FlowMap<ParID>>;
 
@@ -78,12 +121,37 @@ class FlowAggregator {
   static AggState* GetAggState(const proto::FlowMarker& agg_flow,
                                FlowMap<AggState>* states);
 
+  void UpdateIncremental(BundleState& bs, absl::Time timestamp,
+                         const proto::InfoBundle& bundle,
+                         absl::FunctionRef<void(proto::FlowInfo*)> annotate);
+  void ForEachAggIncremental(
+      absl::FunctionRef<void(absl::Time, const proto::AggInfo&)> func)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  IncrementalAgg* InternAgg(const proto::FlowMarker& child);
+  static void AddActive(IncrementalAgg* agg, absl::Time time,
+                        const proto::FlowInfo& info, int32_t* handle)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(agg->mu);
+  static void RemoveActive(IncrementalAgg* agg, absl::Time time,
+                           const proto::FlowInfo& info, int32_t* handle)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(agg->mu);
+  static void AddDead(IncrementalAgg* agg, absl::Time time, const proto::FlowInfo& info)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(agg->mu);
+  static void RemoveDead(IncrementalAgg* agg, absl::Time time,
+                         const proto::FlowInfo& info)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(agg->mu);
+
   const Config config_;
   const std::unique_ptr<DemandPredictor> agg_demand_predictor_;
   spdlog::logger logger_;
 
   BundleStatesMap bundle_states_;
 
+  // FGs in incremental mode. Entries are never removed.
+  absl::Mutex incremental_aggs_mu_;
+  FlowMap<IncrementalAgg*> incremental_agg_index_ ABSL_GUARDED_BY(incremental_aggs_mu_);
+  std::vector<std::unique_ptr<IncrementalAgg>> incremental_aggs_
+      ABSL_GUARDED_BY(incremental_aggs_mu_);
+
   TimedMutex mu_;
   FlowMap<AggState> agg_states_ ABSL_GUARDED_BY(mu_);
   // For debugging
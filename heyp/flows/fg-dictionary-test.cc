@@ -0,0 +1,179 @@
+#include "heyp/flows/fg-dictionary.h"
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "heyp/proto/parse-text.h"
+#include "heyp/proto/testing.h"
+
+namespace heyp {
+namespace {
+
+ClusterFlowMap<int64_t> TestFlow2Index() {
+  return ClusterFlowMap<int64_t>{
+      {ParseTextProto<proto::FlowMarker>(R"(src_dc: "A" dst_dc: "B")"), 0},
+      {ParseTextProto<proto::FlowMarker>(R"(src_dc: "A" dst_dc: "C")"), 1},
+  };
+}
+
+std::vector<proto::FlowMarker> TestIndex2Flow() {
+  return {
+      ParseTextProto<proto::FlowMarker>(R"(src_dc: "A" dst_dc: "B")"),
+      ParseTextProto<proto::FlowMarker>(R"(src_dc: "A" dst_dc: "C")"),
+  };
+}
+
+TEST(LookupFGIndexTest, UsesMatchingId) {
+  // The id is used even if flow2index doesn't know the FG.
+  EXPECT_EQ(LookupFGIndex({}, TestIndex2Flow(), ParseTextProto<proto::FlowInfo>(R"(
+              flow { src_dc: "A" dst_dc: "C" job: "j" host_id: 1 }
+              fg_id: 2
+            )")),
+            1);
+}
+
+TEST(LookupFGIndexTest, IgnoresStaleId) {
+  // Ids from an older dictionary that name a different FG are not trusted.
+  EXPECT_EQ(
+      LookupFGIndex(TestFlow2Index(), TestIndex2Flow(), ParseTextProto<proto::FlowInfo>(R"(
+        flow { src_dc: "A" dst_dc: "B" job: "j" host_id: 1 }
+        fg_id: 2
+      )")),
+      0);
+}
+
+TEST(LookupFGIndexTest, FallsBackToDCs) {
+  EXPECT_EQ(
+      LookupFGIndex(TestFlow2Index(), TestIndex2Flow(), ParseTextProto<proto::FlowInfo>(R"(
+        flow { src_dc: "A" dst_dc: "C" job: "j" host_id: 1 }
+      )")),
+      1);
+  // Out of range ids are ignored.
+  EXPECT_EQ(
+      LookupFGIndex(TestFlow2Index(), TestIndex2Flow(), ParseTextProto<proto::FlowInfo>(R"(
+        flow { src_dc: "A" dst_dc: "B" job: "j" host_id: 1 }
+        fg_id: 3
+      )")),
+      0);
+  EXPECT_EQ(
+      LookupFGIndex(TestFlow2Index(), TestIndex2Flow(), ParseTextProto<proto::FlowInfo>(R"(
+        flow { src_dc: "A" dst_dc: "Z" job: "j" host_id: 1 }
+      )")),
+      -1);
+}
+
+TEST(AddFGDictionaryTest, Basic) {
+  const std::vector<proto::FlowMarker> index2flow{
+      ParseTextProto<proto::FlowMarker>(R"(src_dc: "A" dst_dc: "B")"),
+      ParseTextProto<proto::FlowMarker>(R"(src_dc: "A" dst_dc: "C" job: "j")"),
+  };
+  proto::AllocBundle bundle;
+  AddFGDictionary(index2flow, 0, &bundle);
+  EXPECT_THAT(bundle, EqProto(ParseTextProto<proto::AllocBundle>(R"(
+                fg_dictionary { flow { src_dc: "A" dst_dc: "B" } id: 1 }
+                fg_dictionary { flow { src_dc: "A" dst_dc: "C" } id: 2 }
+              )")));
+
+  bundle.Clear();
+  AddFGDictionary(index2flow, 1, &bundle);
+  EXPECT_THAT(bundle, EqProto(ParseTextProto<proto::AllocBundle>(R"(
+                fg_dictionary { flow { src_dc: "A" dst_dc: "C" } id: 2 }
+              )")));
+}
+
+TEST(HostFGIdsTest, AppendAndReplace) {
+  HostFGIds ids;
+  auto bundle = ParseTextProto<proto::InfoBundle>(R"(
+    flow_infos { flow { src_dc: "A" dst_dc: "B" job: "j" host_id: 1 } }
+    flow_infos { flow { src_dc: "A" dst_dc: "C" job: "j" host_id: 1 } }
+  )");
+
+  ids.Tag(&bundle);
+  EXPECT_EQ(bundle.flow_infos(0).fg_id(), 0);
+  EXPECT_EQ(bundle.flow_infos(1).fg_id(), 0);
+
+  ids.Update(ParseTextProto<proto::AllocBundle>(R"(
+    fg_dictionary { flow { src_dc: "A" dst_dc: "B" } id: 1 }
+  )"));
+  ids.Update(ParseTextProto<proto::AllocBundle>(R"(
+    fg_dictionary { flow { src_dc: "A" dst_dc: "C" } id: 2 }
+  )"));
+  ids.Tag(&bundle);
+  EXPECT_EQ(bundle.flow_infos(0).fg_id(), 1);
+  EXPECT_EQ(bundle.flow_infos(1).fg_id(), 2);
+
+  // A dictionary starting at id 1 (e.g. from a restarted cluster agent) replaces
+  // the old one.
+  ids.Update(ParseTextProto<proto::AllocBundle>(R"(
+    fg_dictionary { flow { src_dc: "A" dst_dc: "C" } id: 1 }
+  )"));
+  bundle.mutable_flow_infos(0)->clear_fg_id();
+  ids.Tag(&bundle);
+  EXPECT_EQ(bundle.flow_infos(0).fg_id(), 0);
+  EXPECT_EQ(bundle.flow_infos(1).fg_id(), 1);
+
+  ids.Clear();
+  bundle.mutable_flow_infos(1)->clear_fg_id();
+  ids.Tag(&bundle);
+  EXPECT_EQ(bundle.flow_infos(0).fg_id(), 0);
+  EXPECT_EQ(bundle.flow_infos(1).fg_id(), 0);
+}
+
+TEST(HostFGIdsTest, SampleOnlyFGsWithParams) {
+  HostFGIds ids;
+  ids.Update(ParseTextProto<proto::AllocBundle>(R"(
+    fg_dictionary {
+      flow { src_dc: "A" dst_dc: "B" }
+      id: 1
+      sampling { num_samples_at_approval: 1 approval_bps: 1000000 }
+    }
+    fg_dictionary { flow { src_dc: "A" dst_dc: "C" } id: 2 }
+    fg_dictionary {
+      flow { src_dc: "A" dst_dc: "D" }
+      id: 3
+      sampling { num_samples_at_approval: 10 approval_bps: 1000 }
+    }
+  )"));
+
+  absl::BitGen gen;
+  int num_ab = 0;
+  for (int i = 0; i < 1000; ++i) {
+    auto bundle = ParseTextProto<proto::InfoBundle>(R"(
+      bundler { host_id: 1 }
+      flow_infos {
+        flow { src_dc: "A" dst_dc: "B" job: "j" host_id: 1 }
+        ewma_usage_bps: 1
+      }
+      flow_infos {
+        flow { src_dc: "A" dst_dc: "C" job: "j" host_id: 1 }
+        ewma_usage_bps: 1
+      }
+      flow_infos {
+        flow { src_dc: "A" dst_dc: "D" job: "j" host_id: 1 }
+        ewma_usage_bps: 100
+      }
+      flow_infos {
+        flow { src_dc: "A" dst_dc: "Z" job: "j" host_id: 1 }
+        ewma_usage_bps: 1
+      }
+    )");
+    const int num_removed = ids.Sample(gen, &bundle);
+    EXPECT_EQ(num_removed + bundle.flow_infos_size(), 4);
+
+    // A->C and A->Z are not sampled and A->D is picked with probability 1.
+    std::vector<std::string> dsts;
+    for (const proto::FlowInfo& fi : bundle.flow_infos()) {
+      dsts.push_back(fi.flow().dst_dc());
+    }
+    if (num_removed == 0) {
+      ++num_ab;
+      EXPECT_THAT(dsts, testing::UnorderedElementsAre("B", "C", "D", "Z"));
+    } else {
+      EXPECT_THAT(dsts, testing::UnorderedElementsAre("C", "D", "Z"));
+    }
+  }
+  // A->B is picked with probability 1e-6.
+  EXPECT_LT(num_ab, 5);
+}
+
+}  // namespace
+}  // namespace heyp
@@ -0,0 +1,92 @@
+#include "heyp/flows/fg-dictionary.h"
+
+#include "heyp/alg/sampler.h"
+
+namespace heyp {
+
+int64_t LookupFGIndex(const ClusterFlowMap<int64_t>& flow2index,
+                      absl::Span<const proto::FlowMarker> index2flow,
+                      const proto::FlowInfo& fi) {
+  if (fi.fg_id() > 0 && fi.fg_id() <= index2flow.size()) {
+    const proto::FlowMarker& fg = index2flow[fi.fg_id() - 1];
+    if (fg.src_dc() == fi.flow().src_dc() && fg.dst_dc() == fi.flow().dst_dc()) {
+      return static_cast<int64_t>(fi.fg_id()) - 1;
+    }
+  }
+  auto iter = flow2index.find(fi.flow());
+  if (iter == flow2index.end()) {
+    return -1;
+  }
+  return iter->second;
+}
+
+void AddFGDictionary(absl::Span<const proto::FlowMarker> index2flow,
+                     int64_t first_index, proto::AllocBundle* bundle) {
+  for (int64_t i = first_index; i < index2flow.size(); ++i) {
+    proto::FGDictionaryEntry* e = bundle->add_fg_dictionary();
+    e->mutable_flow()->set_src_dc(index2flow[i].src_dc());
+    e->mutable_flow()->set_dst_dc(index2flow[i].dst_dc());
+    e->set_id(i + 1);
+  }
+}
+
+void HostFGIds::Update(const proto::AllocBundle& bundle) {
+  if (bundle.fg_dictionary().empty()) {
+    return;
+  }
+  absl::MutexLock l(&mu_);
+  if (bundle.fg_dictionary(0).id() == 1) {
+    // Full dictionary (e.g. from a new stream).
+    ids_.clear();
+  }
+  for (const proto::FGDictionaryEntry& e : bundle.fg_dictionary()) {
+    ids_[e.flow()] = Entry{
+        .id = e.id(),
+        .sample = e.has_sampling(),
+        .sampling = e.sampling(),
+    };
+  }
+}
+
+void HostFGIds::Clear() {
+  absl::MutexLock l(&mu_);
+  ids_.clear();
+}
+
+void HostFGIds::Tag(proto::InfoBundle* bundle) const {
+  absl::MutexLock l(&mu_);
+  for (proto::FlowInfo& fi : *bundle->mutable_flow_infos()) {
+    auto iter = ids_.find(fi.flow());
+    if (iter != ids_.end()) {
+      fi.set_fg_id(iter->second.id);
+    }
+  }
+}
+
+int HostFGIds::Sample(absl::BitGen& gen, proto::InfoBundle* bundle) const {
+  auto* infos = bundle->mutable_flow_infos();
+  int num_kept = 0;
+  {
+    absl::MutexLock l(&mu_);
+    for (int i = 0; i < infos->size(); ++i) {
+      const proto::FlowInfo& fi = infos->Get(i);
+      auto iter = ids_.find(fi.flow());
+      if (iter != ids_.end() && iter->second.sample) {
+        const ThresholdSampler sampler(iter->second.sampling.num_samples_at_approval(),
+                                       iter->second.sampling.approval_bps());
+        if (!sampler.ShouldInclude(gen, fi.ewma_usage_bps())) {
+          continue;
+        }
+      }
+      if (num_kept != i) {
+        infos->SwapElements(num_kept, i);
+      }
+      ++num_kept;
+    }
+  }
+  const int num_removed = infos->size() - num_kept;
+  infos->DeleteSubrange(num_kept, num_removed);
+  return num_removed;
+}
+
+}  // namespace heyp
@@ -0,0 +1,64 @@
+#ifndef HEYP_FLOWS_FG_DICTIONARY_H_
+#define HEYP_FLOWS_FG_DICTIONARY_H_
+
+#include <cstdint>
+#include <vector>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/random/random.h"
+#include "absl/synchronization/mutex.h"
+#include "absl/types/span.h"
+#include "heyp/flows/map.h"
+#include "heyp/proto/heyp.pb.h"
+
+namespace heyp {
+
+// The cluster agent gives each cluster-level FG a compact id and sends hosts the
+// id <-> FG mapping in AllocBundle.fg_dictionary. Hosts then tag FlowInfos with
+// FlowInfo.fg_id so that the cluster agent can route usage by index.
+//
+// On the wire, id = index + 1 so that 0 (the default) means no id.
+
+// Returns the index of fi's cluster-level FG using fi.fg_id() if it is set and
+// index2flow has the same DCs as fi.flow() at that index, and otherwise by matching
+// the DCs of fi.flow() against flow2index. Ids are checked since hosts may still use
+// a dictionary from before the cluster agent restarted or renumbered its FGs.
+// Returns -1 if the FG is unknown.
+int64_t LookupFGIndex(const ClusterFlowMap<int64_t>& flow2index,
+                      absl::Span<const proto::FlowMarker> index2flow,
+                      const proto::FlowInfo& fi);
+
+// Appends entries for index2flow[first_index:] to bundle->fg_dictionary.
+void AddFGDictionary(absl::Span<const proto::FlowMarker> index2flow,
+                     int64_t first_index, proto::AllocBundle* bundle);
+
+// HostFGIds holds the FG dictionary learned by a host. Thread-safe.
+class HostFGIds {
+ public:
+  // Update applies any dictionary entries in bundle.
+  void Update(const proto::AllocBundle& bundle);
+
+  // Clear forgets the dictionary, e.g. when connecting to a new cluster agent.
+  void Clear();
+
+  // Tag sets fg_id on each FlowInfo whose FG is in the dictionary.
+  void Tag(proto::InfoBundle* bundle) const;
+
+  // Sample removes the FlowInfos of FGs that the cluster agent asked hosts to sample
+  // and that are not picked this time. Returns the number of FlowInfos removed.
+  int Sample(absl::BitGen& gen, proto::InfoBundle* bundle) const;
+
+ private:
+  struct Entry {
+    uint32_t id = 0;
+    bool sample = false;
+    proto::ThresholdSamplingParams sampling;
+  };
+
+  mutable absl::Mutex mu_;
+  ClusterFlowMap<Entry> ids_ ABSL_GUARDED_BY(mu_);
+};
+
+}  // namespace heyp
+
+#endif  // HEYP_FLOWS_FG_DICTIONARY_H_
@@ -9,6 +9,11 @@ namespace heyp {
 template <typename ValueType>
 using FlowMap = absl::flat_hash_map<proto::FlowMarker, ValueType, HashFlow, EqFlow>;
 
-}
+// ClusterFlowMap only considers the src and dst DCs of each key.
+template <typename ValueType>
+using ClusterFlowMap =
+    absl::flat_hash_map<proto::FlowMarker, ValueType, HashClusterFlow, EqClusterFlow>;
+
+}  // namespace heyp
 
 #endif  // HEYP_FLOWS_MAP_H_
@@ -0,0 +1,243 @@
+// replay-demand-predictors compares the memory use and accuracy of demand
+// predictors by replaying recorded flow logs.
+//
+// Inputs are NDJSON files of InfoBundles, such as those written by the host agent
+// with the fine-grained flow state log enabled. Each flow's ewma_usage_bps is fed
+// to every predictor, and each prediction is compared against the max usage of the
+// flow over the following time window.
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "absl/container/flat_hash_map.h"
+#include "absl/flags/flag.h"
+#include "absl/status/status.h"
+#include "absl/strings/ascii.h"
+#include "absl/strings/str_format.h"
+#include "absl/time/time.h"
+#include "google/protobuf/util/json_util.h"
+#include "heyp/alg/demand-predictor.h"
+#include "heyp/alg/windowed-max.h"
+#include "heyp/cli/parse.h"
+#include "heyp/init/init.h"
+#include "heyp/posix/strerror.h"
+#include "heyp/proto/config.pb.h"
+#include "heyp/proto/constructors.h"
+#include "heyp/proto/heyp.pb.h"
+
+ABSL_FLAG(std::string, time_window, "10s", "time window used by all predictors");
+ABSL_FLAG(double, usage_multiplier, 1.0, "multiplier applied to predicted usage");
+ABSL_FLAG(int64_t, min_demand_bps, 0, "minimum predicted demand");
+ABSL_FLAG(double, quantile, 0.95, "quantile predicted by DP_QUANTILE");
+ABSL_FLAG(double, trend_smoothing, 0.1, "trend smoothing used by DP_HOLT");
+ABSL_FLAG(std::string, usage_history_window, "120s",
+          "usage history kept per flow when predicting from the history");
+
+namespace heyp {
+namespace {
+
+bool ReadLine(FILE* f, std::string* out) {
+  out->clear();
+
+  int c;
+  while ((c = fgetc(f)) != EOF && c != '\n') {
+    out->push_back(c);
+  }
+
+  return !(ferror(f) || (feof(f) && out->empty()));
+}
+
+using FlowUsage = absl::flat_hash_map<std::string, std::vector<UsageHistoryEntry>>;
+
+absl::Status ReadUsage(const std::string& path, FlowUsage* usage) {
+  FILE* f = fopen(path.c_str(), "r");
+  if (f == nullptr) {
+    return absl::NotFoundError(
+        absl::StrFormat("failed to open %s: %s", path, StrError(errno)));
+  }
+
+  google::protobuf::util::JsonParseOptions opt;
+  opt.ignore_unknown_fields = true;
+
+  std::string line;
+  proto::InfoBundle bundle;
+  while (ReadLine(f, &line)) {
+    absl::StripAsciiWhitespace(&line);
+    if (line.empty()) {
+      continue;
+    }
+    bundle.Clear();
+    auto st = google::protobuf::util::JsonStringToMessage(line, &bundle, opt);
+    if (!st.ok()) {
+      fclose(f);
+      return absl::DataLossError(
+          absl::StrFormat("failed to parse %s: %s", path, std::string(st.message())));
+    }
+    const absl::Time time = FromProtoTimestamp(bundle.timestamp());
+    for (const proto::FlowInfo& info : bundle.flow_infos()) {
+      (*usage)[info.flow().ShortDebugString()].push_back({time, info.ewma_usage_bps()});
+    }
+  }
+  fclose(f);
+  return absl::OkStatus();
+}
+
+// Returns the max usage over [t, t + window] for every sample.
+std::vector<int64_t> FutureMaxUsage(const std::vector<UsageHistoryEntry>& samples,
+                                    absl::Duration window) {
+  // Negate time so that the trailing max over reversed samples looks ahead.
+  WindowedMaxUsage max_usage(window);
+  std::vector<int64_t> future(samples.size());
+  for (size_t i = samples.size(); i-- > 0;) {
+    future[i] = max_usage.Add(absl::UnixEpoch() - (samples[i].time - absl::UnixEpoch()),
+                              samples[i].bps);
+  }
+  return future;
+}
+
+struct Result {
+  std::string name;
+  int64_t num_flows = 0;
+  int64_t num_samples = 0;
+  int64_t num_under = 0;
+  double sum_bytes = 0;
+  double sum_abs_err = 0;
+  double sum_pred = 0;
+  double sum_actual = 0;
+
+  void Record(int64_t pred, int64_t actual) {
+    ++num_samples;
+    num_under += pred < actual;
+    sum_abs_err += std::abs(static_cast<double>(pred - actual));
+    sum_pred += pred;
+    sum_actual += actual;
+  }
+};
+
+// Replays usage through per-flow predictor state.
+Result ReplayWithState(const std::string& name, const DemandPredictor& predictor,
+                       const FlowUsage& usage, absl::Duration window) {
+  Result r{.name = name};
+  for (const auto& [flow, samples] : usage) {
+    const std::vector<int64_t> future = FutureMaxUsage(samples, window);
+    std::unique_ptr<DemandPredictorState> state = predictor.NewState();
+    size_t max_bytes = 0;
+    for (size_t i = 0; i < samples.size(); ++i) {
+      r.Record(state->Update(samples[i]), future[i]);
+      max_bytes = std::max(max_bytes, state->BytesUsed());
+    }
+    ++r.num_flows;
+    r.sum_bytes += max_bytes;
+  }
+  return r;
+}
+
+// Replays usage through FromUsage while keeping the usage history the same way
+// AggState does when the predictor has no per-flow state.
+Result ReplayWithHistory(const std::string& name, const DemandPredictor& predictor,
+                         const FlowUsage& usage, absl::Duration window,
+                         absl::Duration usage_history_window) {
+  Result r{.name = name};
+  for (const auto& [flow, samples] : usage) {
+    const std::vector<int64_t> future = FutureMaxUsage(samples, window);
+    std::vector<UsageHistoryEntry> history;
+    for (size_t i = 0; i < samples.size(); ++i) {
+      history.push_back(samples[i]);
+      if (samples[i].time - history.front().time > 2 * usage_history_window) {
+        const absl::Time min_time = samples[i].time - usage_history_window;
+        size_t keep_from = 0;
+        while (history[keep_from].time < min_time) {
+          ++keep_from;
+        }
+        history.erase(history.begin(), history.begin() + keep_from);
+      }
+      r.Record(predictor.FromUsage(samples[i].time, history), future[i]);
+    }
+    ++r.num_flows;
+    r.sum_bytes += sizeof(history) + history.capacity() * sizeof(UsageHistoryEntry);
+  }
+  return r;
+}
+
+int Run(const std::vector<std::string>& inputs) {
+  FlowUsage usage;
+  for (const std::string& path : inputs) {
+    absl::Status st = ReadUsage(path, &usage);
+    if (!st.ok()) {
+      absl::FPrintF(stderr, "%s\n", st.ToString());
+      return 1;
+    }
+  }
+  for (auto& [flow, samples] : usage) {
+    std::stable_sort(samples.begin(), samples.end(),
+                     [](const UsageHistoryEntry& lhs, const UsageHistoryEntry& rhs) {
+                       return lhs.time < rhs.time;
+                     });
+  }
+
+  absl::Duration usage_history_window;
+  if (!absl::ParseDuration(absl::GetFlag(FLAGS_usage_history_window),
+                           &usage_history_window)) {
+    absl::FPrintF(stderr, "invalid usage_history_window: %s\n",
+                  absl::GetFlag(FLAGS_usage_history_window));
+    return 1;
+  }
+
+  std::vector<Result> results;
+  for (proto::DemandPredictorType type : {proto::DP_BWE, proto::DP_DECAYED_PEAK,
+                                          proto::DP_QUANTILE, proto::DP_HOLT}) {
+    proto::DemandPredictorConfig config;
+    config.set_type(type);
+    config.set_time_window_dur(absl::GetFlag(FLAGS_time_window));
+    config.set_usage_multiplier(absl::GetFlag(FLAGS_usage_multiplier));
+    config.set_min_demand_bps(absl::GetFlag(FLAGS_min_demand_bps));
+    config.set_quantile(absl::GetFlag(FLAGS_quantile));
+    config.set_trend_smoothing(absl::GetFlag(FLAGS_trend_smoothing));
+
+    std::unique_ptr<DemandPredictor> predictor;
+    absl::Duration window;
+    absl::Status st = ParseDemandPredictorConfig(config, &predictor, &window);
+    if (!st.ok()) {
+      absl::FPrintF(stderr, "%s\n", st.ToString());
+      return 1;
+    }
+    const std::string name = proto::DemandPredictorType_Name(type);
+    if (type == proto::DP_BWE) {
+      results.push_back(ReplayWithHistory(name + "_HISTORY", *predictor, usage, window,
+                                          usage_history_window));
+    }
+    results.push_back(ReplayWithState(name, *predictor, usage, window));
+  }
+
+  absl::FPrintF(stdout,
+                "Predictor,NumFlows,NumSamples,BytesPerFlow,NormAbsErr,UnderFrac,"
+                "OverProvision\n");
+  for (const Result& r : results) {
+    absl::FPrintF(stdout, "%s,%d,%d,%f,%f,%f,%f\n", r.name, r.num_flows, r.num_samples,
+                  r.sum_bytes / std::max<int64_t>(1, r.num_flows),
+                  r.sum_abs_err / std::max(1.0, r.sum_actual),
+                  static_cast<double>(r.num_under) / std::max<int64_t>(1, r.num_samples),
+                  r.sum_pred / std::max(1.0, r.sum_actual));
+  }
+  return 0;
+}
+
+}  // namespace
+}  // namespace heyp
+
+int main(int argc, char** argv) {
+  heyp::MainInit(&argc, &argv);
+
+  std::vector<std::string> inputs;
+  if (argc == 1) {
+    inputs.push_back("/dev/stdin");
+  }
+  for (int i = 1; i < argc; ++i) {
+    inputs.push_back(argv[i]);
+  }
+  return heyp::Run(inputs);
+}
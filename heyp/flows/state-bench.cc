@@ -0,0 +1,83 @@
+#include <stdint.h>
+
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "absl/random/random.h"
+#include "benchmark/benchmark.h"
+#include "heyp/flows/state.h"
+
+namespace heyp {
+namespace {
+
+// Hides NewState so that AggState falls back to keeping the usage history.
+class HistoryOnlyDemandPredictor : public DemandPredictor {
+ public:
+  explicit HistoryOnlyDemandPredictor(const DemandPredictor* p) : p_(p) {}
+
+  int64_t FromUsage(absl::Time now,
+                    absl::Span<const UsageHistoryEntry> usage_history) const override {
+    return p_->FromUsage(now, usage_history);
+  }
+
+ private:
+  const DemandPredictor* p_;
+};
+
+// Updates the usage of state.range(0) flows once per 500ms collection period and
+// predicts demand over a state.range(1) second window. Each iteration is one period.
+template <bool kStreaming>
+static void BM_AggStateUpdateUsage(benchmark::State& state) {
+  const int64_t num_flows = state.range(0);
+  const absl::Duration window = absl::Seconds(state.range(1));
+  constexpr absl::Duration kPeriod = absl::Milliseconds(500);
+
+  BweDemandPredictor bwe(window, 1.1, 0);
+  HistoryOnlyDemandPredictor history_only(&bwe);
+  const DemandPredictor& predictor =
+      kStreaming ? static_cast<const DemandPredictor&>(bwe) : history_only;
+
+  std::mt19937_64 rng(0);
+  std::vector<AggState> flows;
+  std::vector<int64_t> cum_usage_bytes(num_flows, 0);
+  flows.reserve(num_flows);
+  for (int64_t i = 0; i < num_flows; ++i) {
+    flows.emplace_back(proto::FlowMarker());
+  }
+
+  // Warm up so that the history covers the whole window.
+  absl::Time now = absl::UnixEpoch();
+  auto run_period = [&] {
+    now += kPeriod;
+    for (int64_t i = 0; i < num_flows; ++i) {
+      cum_usage_bytes[i] += absl::Uniform<int64_t>(rng, 0, 1'000'000);
+      flows[i].UpdateUsage(
+          {
+              .time = now,
+              .cum_hipri_usage_bytes = cum_usage_bytes[i],
+          },
+          window, predictor);
+    }
+  };
+  for (int i = 0; i < 2 * (window / kPeriod); ++i) {
+    run_period();
+  }
+
+  for (auto _ : state) {
+    run_period();
+  }
+  state.SetItemsProcessed(state.iterations() * num_flows);
+}
+
+BENCHMARK_TEMPLATE(BM_AggStateUpdateUsage, false)
+    ->Args({100'000, 5})
+    ->Args({100'000, 30})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_AggStateUpdateUsage, true)
+    ->Args({100'000, 5})
+    ->Args({100'000, 30})
+    ->Unit(benchmark::kMillisecond);
+
+}  // namespace
+}  // namespace heyp
@@ -106,6 +106,16 @@ void AggState::UpdateUsage(const Update u, absl::Duration usage_history_window,
   cur_.set_cum_hipri_usage_bytes(u.cum_hipri_usage_bytes);
   cur_.set_cum_lopri_usage_bytes(u.cum_lopri_usage_bytes);
 
+  if (!checked_predictor_state_) {
+    predictor_state_ = demand_predictor.NewState();
+    checked_predictor_state_ = true;
+  }
+  if (predictor_state_ != nullptr) {
+    cur_.set_predicted_demand_bps(
+        predictor_state_->Update({u.time, cur_.ewma_usage_bps()}));
+    return;
+  }
+
   usage_history_.push_back({u.time, cur_.ewma_usage_bps()});
 
   // Garbage collect old entries, but allow some delay.
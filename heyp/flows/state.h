@@ -2,6 +2,7 @@
 #define HEYP_FLOWS_STATE_H_
 
 #include <cstdint>
+#include <memory>
 #include <vector>
 
 #include "absl/time/time.h"
@@ -31,10 +32,16 @@ class AggState {
 
   // UpdatesUpdate updates the demand and automatically sets currently_lopri
   // when there is an increase in LOPRI usage but no increase for HIPRI.
+  //
+  // demand_predictor must be the same (and outlive this) across calls. If it
+  // provides per-flow state, usage history is not kept and usage_history_window is
+  // unused.
   void UpdateUsage(const Update u, absl::Duration usage_history_window,
                    const DemandPredictor& demand_predictor);
 
  protected:
+  std::unique_ptr<DemandPredictorState> predictor_state_;
+  bool checked_predictor_state_ = false;
   std::vector<UsageHistoryEntry> usage_history_;
   absl::Time updated_time_ = absl::InfinitePast();
   proto::FlowInfo cur_;
@@ -0,0 +1,123 @@
+#include "heyp/host-agent/alloc-merger.h"
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "heyp/proto/parse-text.h"
+#include "heyp/proto/testing.h"
+
+namespace heyp {
+namespace {
+
+TEST(AllocMergerTest, PassesThroughFullBundles) {
+  AllocMerger merger;
+  auto bundle = ParseTextProto<proto::AllocBundle>(R"(
+    flow_allocs {
+      flow { src_dc: "A" dst_dc: "B" }
+      hipri_rate_limit_bps: 100
+    }
+    gen: 3
+  )");
+  proto::AllocBundle got = bundle;
+  EXPECT_TRUE(merger.Apply(&got));
+  EXPECT_THAT(got, EqProto(bundle));
+}
+
+TEST(AllocMergerTest, AppliesDeltas) {
+  AllocMerger merger;
+  auto b1 = ParseTextProto<proto::AllocBundle>(R"(
+    flow_allocs {
+      flow { src_dc: "A" dst_dc: "B" }
+      hipri_rate_limit_bps: 100
+    }
+    flow_allocs {
+      flow { src_dc: "A" dst_dc: "C" }
+      hipri_rate_limit_bps: 200
+    }
+    seq: 1
+  )");
+  ASSERT_TRUE(merger.Apply(&b1));
+
+  auto b2 = ParseTextProto<proto::AllocBundle>(R"(
+    flow_allocs {
+      flow { src_dc: "A" dst_dc: "C" }
+      lopri_rate_limit_bps: 200
+    }
+    flow_allocs {
+      flow { src_dc: "A" dst_dc: "D" }
+      hipri_rate_limit_bps: 300
+    }
+    gen: 7
+    seq: 2
+    delta_base_seq: 1
+  )");
+  ASSERT_TRUE(merger.Apply(&b2));
+  EXPECT_THAT(b2, EqProto(ParseTextProto<proto::AllocBundle>(R"(
+                flow_allocs {
+                  flow { src_dc: "A" dst_dc: "B" }
+                  hipri_rate_limit_bps: 100
+                }
+                flow_allocs {
+                  flow { src_dc: "A" dst_dc: "C" }
+                  lopri_rate_limit_bps: 200
+                }
+                flow_allocs {
+                  flow { src_dc: "A" dst_dc: "D" }
+                  hipri_rate_limit_bps: 300
+                }
+                gen: 7
+                seq: 2
+              )")));
+
+  // An empty delta still carries the gen.
+  auto b3 = ParseTextProto<proto::AllocBundle>(R"(
+    gen: 8
+    seq: 3
+    delta_base_seq: 2
+  )");
+  ASSERT_TRUE(merger.Apply(&b3));
+  EXPECT_EQ(b3.flow_allocs_size(), 3);
+  EXPECT_EQ(b3.gen(), 8);
+}
+
+TEST(AllocMergerTest, RejectsDeltasAfterGap) {
+  AllocMerger merger;
+
+  // No base yet.
+  auto delta = ParseTextProto<proto::AllocBundle>(R"(
+    flow_allocs {
+      flow { src_dc: "A" dst_dc: "B" }
+      lopri_rate_limit_bps: 100
+    }
+    seq: 2
+    delta_base_seq: 1
+  )");
+  proto::AllocBundle got = delta;
+  EXPECT_FALSE(merger.Apply(&got));
+  EXPECT_THAT(got, EqProto(delta));
+
+  auto full = ParseTextProto<proto::AllocBundle>(R"(
+    flow_allocs {
+      flow { src_dc: "A" dst_dc: "B" }
+      hipri_rate_limit_bps: 100
+    }
+    seq: 3
+  )");
+  ASSERT_TRUE(merger.Apply(&full));
+
+  // Missed seq 4.
+  got = ParseTextProto<proto::AllocBundle>(R"(
+    seq: 5
+    delta_base_seq: 4
+  )");
+  EXPECT_FALSE(merger.Apply(&got));
+
+  got = ParseTextProto<proto::AllocBundle>(R"(
+    seq: 4
+    delta_base_seq: 3
+  )");
+  EXPECT_TRUE(merger.Apply(&got));
+  EXPECT_EQ(got.flow_allocs_size(), 1);
+}
+
+}  // namespace
+}  // namespace heyp
@@ -0,0 +1,34 @@
+#include "heyp/host-agent/alloc-merger.h"
+
+namespace heyp {
+
+bool AllocMerger::Apply(proto::AllocBundle* bundle) {
+  if (bundle->delta_base_seq() == 0) {
+    allocs_ = bundle->flow_allocs();
+    alloc_index_.clear();
+    for (int i = 0; i < allocs_.size(); ++i) {
+      alloc_index_[allocs_[i].flow()] = i;
+    }
+    last_seq_ = bundle->seq();
+    return true;
+  }
+
+  if (last_seq_ == 0 || bundle->delta_base_seq() != last_seq_) {
+    return false;  // missed a bundle
+  }
+
+  for (const proto::FlowAlloc& a : bundle->flow_allocs()) {
+    auto [iter, inserted] = alloc_index_.insert({a.flow(), allocs_.size()});
+    if (inserted) {
+      *allocs_.Add() = a;
+    } else {
+      allocs_[iter->second] = a;
+    }
+  }
+  *bundle->mutable_flow_allocs() = allocs_;
+  bundle->set_delta_base_seq(0);
+  last_seq_ = bundle->seq();
+  return true;
+}
+
+}  // namespace heyp
@@ -0,0 +1,31 @@
+#ifndef HEYP_HOST_AGENT_ALLOC_MERGER_H_
+#define HEYP_HOST_AGENT_ALLOC_MERGER_H_
+
+#include <cstdint>
+
+#include "heyp/flows/map.h"
+#include "heyp/proto/heyp.pb.h"
+
+namespace heyp {
+
+// AllocMerger turns the AllocBundles received on one RegisterHost stream into full
+// bundles by applying deltas (see AllocBundle.delta_base_seq) onto the last full
+// set of allocations.
+class AllocMerger {
+ public:
+  // Apply merges bundle in place so that it holds every FlowAlloc.
+  //
+  // Returns false if bundle is a delta on top of a bundle other than the last one
+  // that was applied. Then, bundle is left unchanged and the host should request a
+  // full bundle.
+  bool Apply(proto::AllocBundle* bundle);
+
+ private:
+  uint64_t last_seq_ = 0;
+  google::protobuf::RepeatedPtrField<proto::FlowAlloc> allocs_;
+  ClusterFlowMap<int> alloc_index_;
+};
+
+}  // namespace heyp
+
+#endif  // HEYP_HOST_AGENT_ALLOC_MERGER_H_
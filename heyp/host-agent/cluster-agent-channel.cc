@@ -6,8 +6,10 @@ namespace heyp {
 
 // TODO: consider removing all failed and just making a new stream when something fails.
 
-ClusterAgentChannel::ClusterAgentChannel(std::unique_ptr<proto::ClusterAgent::Stub> stub)
+ClusterAgentChannel::ClusterAgentChannel(std::unique_ptr<proto::ClusterAgent::Stub> stub,
+                                         HostFGIds* fg_ids)
     : stub_(std::move(stub)),
+      fg_ids_(fg_ids),
       read_failed_(false),
       write_failed_(false),
       writes_done_(false) {}
@@ -16,6 +18,9 @@ void ClusterAgentChannel::CreateStreamIfNeeded() {
   if (stream_) {
     return;
   }
+  if (fg_ids_ != nullptr) {
+    fg_ids_->Clear();
+  }
   stream_ = std::make_shared<StreamInfo>();
   stream_->stream = stub_->RegisterHost(&stream_->ctx);
   all_streams_.push_back(std::weak_ptr<StreamInfo>(stream_));
@@ -69,7 +74,13 @@ grpc::Status ClusterAgentChannel::Write(const proto::InfoBundle& bundle) {
 
   bool failed = false;
   if (do_write) {
-    failed = !s->stream->Write(bundle);
+    if (s->needs_full_alloc.exchange(false)) {
+      proto::InfoBundle resync_bundle = bundle;
+      resync_bundle.set_needs_full_alloc(true);
+      failed = !s->stream->Write(resync_bundle);
+    } else {
+      failed = !s->stream->Write(bundle);
+    }
   }
 
   absl::MutexLock l(&mu_);
@@ -93,7 +104,14 @@ grpc::Status ClusterAgentChannel::Read(proto::AllocBundle* bundle) {
 
   bool failed = false;
   if (do_read) {
-    failed = !s->stream->Read(bundle);
+    while (true) {
+      failed = !s->stream->Read(bundle);
+      if (failed || s->merger.Apply(bundle)) {
+        break;
+      }
+      // Missed the delta's base; wait for a full bundle.
+      s->needs_full_alloc.store(true);
+    }
   }
 
   absl::MutexLock l(&mu_);
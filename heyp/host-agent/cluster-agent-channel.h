@@ -1,11 +1,14 @@
 #ifndef HEYP_HOST_AGENT_CLUSTER_AGENT_CHANNEL_H_
 #define HEYP_HOST_AGENT_CLUSTER_AGENT_CHANNEL_H_
 
+#include <atomic>
 #include <memory>
 
 #include "absl/base/thread_annotations.h"
 #include "absl/synchronization/mutex.h"
 #include "grpcpp/grpcpp.h"
+#include "heyp/flows/fg-dictionary.h"
+#include "heyp/host-agent/alloc-merger.h"
 #include "heyp/proto/heyp.grpc.pb.h"
 #include "heyp/proto/heyp.pb.h"
 
@@ -13,12 +16,18 @@ namespace heyp {
 
 class ClusterAgentChannel {
  public:
-  explicit ClusterAgentChannel(std::unique_ptr<proto::ClusterAgent::Stub> stub);
+  // If fg_ids is non-null, it is cleared whenever a new stream is opened since the
+  // cluster agent on the other end may number FGs differently.
+  explicit ClusterAgentChannel(std::unique_ptr<proto::ClusterAgent::Stub> stub,
+                               HostFGIds* fg_ids = nullptr);
 
   grpc::Status WritesDone();
 
   grpc::Status Write(const proto::InfoBundle& bundle);
 
+  // Read returns the next AllocBundle with all FlowAllocs, merging deltas as needed.
+  // If a delta cannot be applied, it is dropped and the next Write asks the cluster
+  // agent for a full bundle.
   grpc::Status Read(proto::AllocBundle* bundle);
 
   void TryCancel();
@@ -28,9 +37,12 @@ class ClusterAgentChannel {
     grpc::ClientContext ctx;
     std::unique_ptr<grpc::ClientReaderWriter<proto::InfoBundle, proto::AllocBundle>>
         stream;
+    AllocMerger merger;  // only used by the reader
+    std::atomic<bool> needs_full_alloc{false};
   };
 
   std::unique_ptr<proto::ClusterAgent::Stub> stub_;
+  HostFGIds* fg_ids_;
 
   absl::Mutex mu_;
   std::shared_ptr<StreamInfo> stream_;
@@ -2,6 +2,7 @@
 
 #include "absl/cleanup/cleanup.h"
 #include "absl/functional/bind_front.h"
+#include "absl/random/random.h"
 #include "absl/time/clock.h"
 #include "enforcer.h"
 #include "heyp/log/spdlog.h"
@@ -22,7 +23,7 @@ HostDaemon::HostDaemon(const std::shared_ptr<grpc::Channel>& channel, Config con
       flow_state_logger_(-1),
       fine_grained_flow_state_logger_(-1),
       enforcer_(enforcer),
-      channel_(proto::ClusterAgent::NewStub(channel)) {
+      channel_(proto::ClusterAgent::NewStub(channel), &fg_ids_) {
   if (!config.stats_log_file.empty()) {
     absl::Status st = flow_state_logger_.Init(config.stats_log_file);
     if (!st.ok()) {
@@ -191,6 +192,7 @@ void HostDaemon::SendInfos(std::atomic<bool>* should_exit) {
   SPDLOG_LOGGER_INFO(&logger, "begin loop");
   absl::Cleanup loop_done = [&logger] { SPDLOG_LOGGER_INFO(&logger, "end loop"); };
 
+  absl::BitGen rng;
   do {
     // Step 1: collect a bundle of all src/dst DC-level flows on the host.
     proto::InfoBundle bundle;
@@ -201,10 +203,16 @@ void HostDaemon::SendInfos(std::atomic<bool>* should_exit) {
         [&bundle](absl::Time time, const proto::AggInfo& info) {
           *bundle.add_flow_infos() = info.parent();
         });
+    fg_ids_.Tag(&bundle);
+
+    // Step 1.5: drop usage of FGs that were not sampled (if the cluster agent asked
+    // us to sample). Bundles with no usage left still serve as heartbeats.
+    const int num_unsampled = fg_ids_.Sample(rng, &bundle);
 
     // Step 2: send to cluster agent.
-    SPDLOG_LOGGER_INFO(&logger, "sending info bundle to cluster agent with {} FGs",
-                       bundle.flow_infos_size());
+    SPDLOG_LOGGER_INFO(&logger,
+                       "sending info bundle to cluster agent with {} FGs ({} unsampled)",
+                       bundle.flow_infos_size(), num_unsampled);
     if (auto st = channel_.Write(bundle); !st.ok()) {
       SPDLOG_LOGGER_WARN(&logger,
                          "failed to send info bundle to cluster agent with {} FGs: {}",
@@ -236,6 +244,7 @@ void HostDaemon::EnforceAllocs(std::atomic<bool>* should_exit,
 
     SPDLOG_LOGGER_INFO(&logger, "got alloc bundle from cluster agent for {} FGs",
                        bundle.flow_allocs_size());
+    fg_ids_.Update(bundle);
     // Step 2: enforce the new allocation.
     enforcer_->EnforceAllocs(*flow_state_provider_, bundle);
 
@@ -9,6 +9,7 @@
 #include "grpcpp/grpcpp.h"
 #include "heyp/flows/aggregator.h"
 #include "heyp/flows/dc-mapper.h"
+#include "heyp/flows/fg-dictionary.h"
 #include "heyp/host-agent/cluster-agent-channel.h"
 #include "heyp/host-agent/enforcer.h"
 #include "heyp/host-agent/flow-tracker.h"
@@ -59,6 +60,7 @@ class HostDaemon {
   NdjsonLogger flow_state_logger_;
   NdjsonLogger fine_grained_flow_state_logger_;
   HostEnforcer* enforcer_;
+  HostFGIds fg_ids_;  // before channel_, which clears it
   ClusterAgentChannel channel_;
 
   std::thread collect_stats_thread_;
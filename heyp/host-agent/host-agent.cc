@@ -114,7 +114,8 @@ absl::Status Run(const proto::HostAgentConfig& c) {
       });
   SPDLOG_LOGGER_INFO(&logger, "creating flow aggregator");
   std::unique_ptr<FlowAggregator> flow_aggregator =
-      NewConnToHostAggregator(std::move(host_demand_predictor), 2 * host_demand_window);
+      NewConnToHostAggregator(std::move(host_demand_predictor), 2 * host_demand_window,
+                              c.socket_to_host_aggregator().incremental());
   SPDLOG_LOGGER_INFO(&logger, "creating flow state reporter");
   auto flow_state_reporter_or = SSFlowStateReporter::Create(
       {
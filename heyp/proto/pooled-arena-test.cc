@@ -0,0 +1,58 @@
+#include "heyp/proto/pooled-arena.h"
+
+#include <string>
+#include <thread>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "heyp/proto/heyp.pb.h"
+#include "heyp/proto/parse-text.h"
+#include "heyp/proto/testing.h"
+
+namespace heyp {
+namespace {
+
+TEST(ReusableArenaMessageTest, ResetClears) {
+  ReusableArenaMessage<proto::InfoBundle> m;
+  m->mutable_bundler()->set_host_id(5);
+  m->add_flow_infos()->set_ewma_usage_bps(100);
+  EXPECT_THAT(*m.Reset(), EqProto(proto::InfoBundle()));
+  EXPECT_EQ(m.get()->flow_infos_size(), 0);
+}
+
+TEST(ReusableArenaMessageTest, BlocksAreRecycledAcrossThreads) {
+  const auto want = ParseTextProto<proto::InfoBundle>(R"(
+    bundler { host_id: 101 }
+    gen: 3
+    flow_infos {
+      flow { src_dc: "A" dst_dc: "B" job: "web" host_id: 101 }
+      ewma_usage_bps: 100
+    }
+    flow_infos {
+      flow { src_dc: "A" dst_dc: "C" job: "web" host_id: 101 }
+      ewma_usage_bps: 200
+    }
+  )");
+  std::string wire;
+  ASSERT_TRUE(want.SerializeToString(&wire));
+
+  ReusableArenaMessage<proto::InfoBundle> m;
+  auto decode_on_other_thread = [&] {
+    proto::InfoBundle* b = m.Reset();
+    std::thread t([b, &wire] { ASSERT_TRUE(b->ParseFromString(wire)); });
+    t.join();
+    EXPECT_THAT(*b, EqProto(want));
+  };
+
+  for (int i = 0; i < 10; ++i) {
+    decode_on_other_thread();
+  }
+  const int64_t num_allocated = NumPooledArenaBlocksAllocated();
+  for (int i = 0; i < 100; ++i) {
+    decode_on_other_thread();
+  }
+  EXPECT_EQ(NumPooledArenaBlocksAllocated(), num_allocated);
+}
+
+}  // namespace
+}  // namespace heyp
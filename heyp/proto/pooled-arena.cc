@@ -0,0 +1,76 @@
+#include "heyp/proto/pooled-arena.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <vector>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/synchronization/mutex.h"
+
+namespace heyp {
+namespace {
+
+// Caps the memory held by idle blocks at 64 MiB.
+constexpr size_t kMaxIdleBlocks = 8192;
+
+class BlockPool {
+ public:
+  BlockPool() { free_.reserve(kMaxIdleBlocks); }
+
+  void* Alloc(size_t size) {
+    if (size == kPooledArenaBlockSize) {
+      absl::MutexLock l(&mu_);
+      if (!free_.empty()) {
+        void* b = free_.back();
+        free_.pop_back();
+        return b;
+      }
+    }
+    num_allocated_.fetch_add(1, std::memory_order_relaxed);
+    return ::operator new(size);
+  }
+
+  void Dealloc(void* b, size_t size) {
+    if (size == kPooledArenaBlockSize) {
+      absl::MutexLock l(&mu_);
+      if (free_.size() < kMaxIdleBlocks) {
+        free_.push_back(b);
+        return;
+      }
+    }
+    ::operator delete(b);
+  }
+
+  int64_t num_allocated() const {
+    return num_allocated_.load(std::memory_order_relaxed);
+  }
+
+ private:
+  absl::Mutex mu_;
+  std::vector<void*> free_ ABSL_GUARDED_BY(mu_);
+  std::atomic<int64_t> num_allocated_{0};
+};
+
+BlockPool* GetPool() {
+  static BlockPool* pool = new BlockPool();
+  return pool;
+}
+
+void* PoolAlloc(size_t size) { return GetPool()->Alloc(size); }
+void PoolDealloc(void* b, size_t size) { GetPool()->Dealloc(b, size); }
+
+}  // namespace
+
+google::protobuf::ArenaOptions PooledArenaOptions() {
+  google::protobuf::ArenaOptions opts;
+  opts.start_block_size = kPooledArenaBlockSize;
+  opts.max_block_size = kPooledArenaBlockSize;
+  opts.block_alloc = PoolAlloc;
+  opts.block_dealloc = PoolDealloc;
+  return opts;
+}
+
+int64_t NumPooledArenaBlocksAllocated() { return GetPool()->num_allocated(); }
+
+}  // namespace heyp
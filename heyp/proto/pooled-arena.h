@@ -0,0 +1,57 @@
+#ifndef HEYP_PROTO_POOLED_ARENA_H_
+#define HEYP_PROTO_POOLED_ARENA_H_
+
+#include <cstddef>
+#include <cstdint>
+
+#include "google/protobuf/arena.h"
+
+namespace heyp {
+
+constexpr size_t kPooledArenaBlockSize = 8 << 10;
+
+// PooledArenaOptions returns options for an arena whose blocks are
+// kPooledArenaBlockSize bytes (unless a single allocation needs more) and are
+// recycled through a process-wide free list rather than returned to malloc.
+//
+// Arenas keep separate blocks for every thread that allocates from them. Pooling
+// the blocks keeps arenas that are reset often and written to from many threads
+// (e.g. by gRPC while deserializing) off the heap once the pool is warm.
+google::protobuf::ArenaOptions PooledArenaOptions();
+
+// Returns the number of blocks that the pool has had to malloc so far.
+int64_t NumPooledArenaBlocksAllocated();
+
+// ReusableArenaMessage holds a single Message on a pooled arena. Reset frees the
+// previous message (returning its blocks to the pool) and creates a new, empty one.
+//
+// Not thread-safe, but the message may be populated by any thread.
+template <typename Message>
+class ReusableArenaMessage {
+ public:
+  ReusableArenaMessage()
+      : arena_(PooledArenaOptions()),
+        mesg_(google::protobuf::Arena::CreateMessage<Message>(&arena_)) {}
+
+  ReusableArenaMessage(const ReusableArenaMessage&) = delete;
+  ReusableArenaMessage& operator=(const ReusableArenaMessage&) = delete;
+
+  // Invalidates pointers returned by earlier calls to get() or Reset().
+  Message* Reset() {
+    arena_.Reset();
+    mesg_ = google::protobuf::Arena::CreateMessage<Message>(&arena_);
+    return mesg_;
+  }
+
+  Message* get() const { return mesg_; }
+  Message& operator*() const { return *mesg_; }
+  Message* operator->() const { return mesg_; }
+
+ private:
+  google::protobuf::Arena arena_;
+  Message* mesg_;
+};
+
+}  // namespace heyp
+
+#endif  // HEYP_PROTO_POOLED_ARENA_H_
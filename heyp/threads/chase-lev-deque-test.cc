@@ -0,0 +1,78 @@
+#include "heyp/threads/chase-lev-deque.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+namespace heyp {
+namespace {
+
+TEST(ChaseLevDequeTest, OwnerIsLIFOThiefIsFIFO) {
+  std::vector<int> items{0, 1, 2, 3};
+  ChaseLevDeque<int> deque(2);
+  EXPECT_TRUE(deque.Empty());
+  EXPECT_EQ(deque.Pop(), nullptr);
+  EXPECT_EQ(deque.Steal(), nullptr);
+
+  for (int& i : items) {
+    deque.Push(&i);  // grows past the initial capacity
+  }
+  EXPECT_FALSE(deque.Empty());
+  EXPECT_EQ(deque.Steal(), &items[0]);
+  EXPECT_EQ(deque.Pop(), &items[3]);
+  EXPECT_EQ(deque.Steal(), &items[1]);
+  EXPECT_EQ(deque.Pop(), &items[2]);
+  EXPECT_EQ(deque.Pop(), nullptr);
+  EXPECT_TRUE(deque.Empty());
+}
+
+TEST(ChaseLevDequeTest, EveryItemTakenOnce) {
+  constexpr int kNumItems = 100'000;
+  constexpr int kNumThieves = 3;
+
+  std::vector<int> items(kNumItems);
+  std::vector<std::atomic<int>> taken(kNumItems);
+  ChaseLevDeque<int> deque(16);
+  std::atomic<bool> owner_done(false);
+
+  auto take = [&](int* item) {
+    taken[item - items.data()].fetch_add(1);
+  };
+
+  std::vector<std::thread> thieves;
+  for (int t = 0; t < kNumThieves; ++t) {
+    thieves.emplace_back([&] {
+      while (!owner_done.load() || !deque.Empty()) {
+        if (int* item = deque.Steal(); item != nullptr) {
+          take(item);
+        }
+      }
+    });
+  }
+
+  for (int i = 0; i < kNumItems; ++i) {
+    deque.Push(&items[i]);
+    if (i % 3 == 0) {
+      if (int* item = deque.Pop(); item != nullptr) {
+        take(item);
+      }
+    }
+  }
+  while (int* item = deque.Pop()) {
+    take(item);
+  }
+  owner_done.store(true);
+  for (std::thread& t : thieves) {
+    t.join();
+  }
+
+  for (int i = 0; i < kNumItems; ++i) {
+    EXPECT_EQ(taken[i].load(), 1) << "item " << i;
+  }
+}
+
+}  // namespace
+}  // namespace heyp
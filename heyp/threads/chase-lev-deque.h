@@ -0,0 +1,143 @@
+#ifndef HEYP_THREADS_CHASE_LEV_DEQUE_H_
+#define HEYP_THREADS_CHASE_LEV_DEQUE_H_
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace heyp {
+
+// ChaseLevDeque is an unbounded work-stealing deque of T*.
+//
+// The owner thread pushes and pops at the bottom (LIFO) while any number of thieves
+// steal from the top (FIFO). Only steals that race for the last element synchronize
+// with the owner.
+//
+// The implementation follows "Correct and Efficient Work-Stealing for Weak Memory
+// Models" (Lê et al., PPoPP'13). Arrays replaced by Push are kept alive until the
+// deque is destroyed since thieves may still be reading them.
+template <typename T>
+class ChaseLevDeque {
+ public:
+  // capacity is rounded up to the next power of two.
+  explicit ChaseLevDeque(int64_t capacity = 256);
+
+  ChaseLevDeque(const ChaseLevDeque&) = delete;
+  ChaseLevDeque& operator=(const ChaseLevDeque&) = delete;
+
+  // Owner only.
+  void Push(T* item);
+  T* Pop();  // returns nullptr if empty
+
+  // Any thread. Returns nullptr if empty or if the steal lost a race.
+  T* Steal();
+
+  // Approximate unless called by the owner with no concurrent thieves.
+  bool Empty() const {
+    return bottom_.load(std::memory_order_relaxed) <=
+           top_.load(std::memory_order_relaxed);
+  }
+
+ private:
+  struct Array {
+    explicit Array(int64_t cap) : mask(cap - 1), items(new std::atomic<T*>[cap]) {}
+
+    int64_t capacity() const { return mask + 1; }
+    T* Get(int64_t i) const { return items[i & mask].load(std::memory_order_relaxed); }
+    void Put(int64_t i, T* item) { items[i & mask].store(item, std::memory_order_relaxed); }
+
+    const int64_t mask;
+    std::unique_ptr<std::atomic<T*>[]> items;
+  };
+
+  Array* Grow(Array* a, int64_t bottom, int64_t top);
+
+  alignas(64) std::atomic<int64_t> top_;
+  alignas(64) std::atomic<int64_t> bottom_;
+  std::atomic<Array*> array_;
+  std::vector<std::unique_ptr<Array>> arrays_;  // owner only
+};
+
+// Implementation //
+
+template <typename T>
+ChaseLevDeque<T>::ChaseLevDeque(int64_t capacity) : top_(0), bottom_(0) {
+  int64_t cap = 1;
+  while (cap < capacity) {
+    cap <<= 1;
+  }
+  arrays_.push_back(std::make_unique<Array>(cap));
+  array_.store(arrays_.back().get(), std::memory_order_relaxed);
+}
+
+template <typename T>
+typename ChaseLevDeque<T>::Array* ChaseLevDeque<T>::Grow(Array* a, int64_t bottom,
+                                                          int64_t top) {
+  arrays_.push_back(std::make_unique<Array>(2 * a->capacity()));
+  Array* bigger = arrays_.back().get();
+  for (int64_t i = top; i < bottom; ++i) {
+    bigger->Put(i, a->Get(i));
+  }
+  array_.store(bigger, std::memory_order_release);
+  return bigger;
+}
+
+template <typename T>
+void ChaseLevDeque<T>::Push(T* item) {
+  const int64_t b = bottom_.load(std::memory_order_relaxed);
+  const int64_t t = top_.load(std::memory_order_acquire);
+  Array* a = array_.load(std::memory_order_relaxed);
+  if (b - t > a->capacity() - 1) {
+    a = Grow(a, b, t);
+  }
+  a->Put(b, item);
+  std::atomic_thread_fence(std::memory_order_release);
+  bottom_.store(b + 1, std::memory_order_relaxed);
+}
+
+template <typename T>
+T* ChaseLevDeque<T>::Pop() {
+  const int64_t b = bottom_.load(std::memory_order_relaxed) - 1;
+  Array* a = array_.load(std::memory_order_relaxed);
+  bottom_.store(b, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  int64_t t = top_.load(std::memory_order_relaxed);
+
+  if (t > b) {
+    // Empty
+    bottom_.store(b + 1, std::memory_order_relaxed);
+    return nullptr;
+  }
+  T* item = a->Get(b);
+  if (t == b) {
+    // Last element: race against thieves.
+    if (!top_.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                      std::memory_order_relaxed)) {
+      item = nullptr;
+    }
+    bottom_.store(b + 1, std::memory_order_relaxed);
+  }
+  return item;
+}
+
+template <typename T>
+T* ChaseLevDeque<T>::Steal() {
+  int64_t t = top_.load(std::memory_order_acquire);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  const int64_t b = bottom_.load(std::memory_order_acquire);
+  if (t >= b) {
+    return nullptr;
+  }
+  Array* a = array_.load(std::memory_order_acquire);
+  T* item = a->Get(t);
+  if (!top_.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                    std::memory_order_relaxed)) {
+    return nullptr;
+  }
+  return item;
+}
+
+}  // namespace heyp
+
+#endif  // HEYP_THREADS_CHASE_LEV_DEQUE_H_
@@ -0,0 +1,57 @@
+#include <atomic>
+#include <cstdint>
+
+#include "benchmark/benchmark.h"
+#include "heyp/threads/executor.h"
+#include "heyp/threads/work-stealing-executor.h"
+
+namespace heyp {
+namespace {
+
+constexpr int kNumWorkers = 4;
+
+// Stands in for the work done per aggregate FG: a few hundred ns of arithmetic.
+void SpinWork(int64_t i, int64_t iters, std::atomic<int64_t>* sink) {
+  int64_t x = i;
+  for (int64_t k = 0; k < iters; ++k) {
+    x = x * 6364136223846793005 + 1442695040888963407;
+  }
+  sink->fetch_add(x & 1, std::memory_order_relaxed);
+}
+
+// One TaskGroup task per index, like the per-FG loops in FastClusterController did.
+static void BM_Executor_TaskGroup(benchmark::State& state) {
+  Executor exec(kNumWorkers);
+  const int64_t n = state.range(0);
+  const int64_t work = state.range(1);
+  std::atomic<int64_t> sink(0);
+  for (auto _ : state) {
+    std::unique_ptr<TaskGroup> tasks = exec.NewTaskGroup();
+    for (int64_t i = 0; i < n; ++i) {
+      tasks->AddTaskNoStatus([i, work, &sink] { SpinWork(i, work, &sink); });
+    }
+    tasks->WaitAllNoStatus();
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+static void BM_WorkStealing_ParallelFor(benchmark::State& state) {
+  WorkStealingExecutor exec(kNumWorkers);
+  const int64_t n = state.range(0);
+  const int64_t work = state.range(1);
+  std::atomic<int64_t> sink(0);
+  for (auto _ : state) {
+    exec.ParallelFor(0, n, 1, [work, &sink](int64_t i) { SpinWork(i, work, &sink); });
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+BENCHMARK(BM_Executor_TaskGroup)
+    ->ArgsProduct({{16, 256, 4096}, {0, 100, 1000}})
+    ->UseRealTime();
+BENCHMARK(BM_WorkStealing_ParallelFor)
+    ->ArgsProduct({{16, 256, 4096}, {0, 100, 1000}})
+    ->UseRealTime();
+
+}  // namespace
+}  // namespace heyp
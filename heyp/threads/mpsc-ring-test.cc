@@ -0,0 +1,111 @@
+#include "heyp/threads/mpsc-ring.h"
+
+#include <thread>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+namespace heyp {
+namespace {
+
+TEST(MPSCRingTest, RoundsUpCapacity) {
+  EXPECT_EQ(MPSCRing<int64_t>(0).capacity(), 2);
+  EXPECT_EQ(MPSCRing<int64_t>(1).capacity(), 2);
+  EXPECT_EQ(MPSCRing<int64_t>(5).capacity(), 8);
+  EXPECT_EQ(MPSCRing<int64_t>(16).capacity(), 16);
+}
+
+TEST(MPSCRingTest, PushDrainInOrder) {
+  MPSCRing<int64_t> ring(4);
+  EXPECT_TRUE(ring.TryPush(1));
+  EXPECT_TRUE(ring.TryPush(2));
+  const int64_t batch[] = {3, 4};
+  EXPECT_TRUE(ring.TryPush(absl::MakeConstSpan(batch)));
+
+  std::vector<int64_t> got;
+  EXPECT_EQ(ring.Drain([&](int64_t v) { got.push_back(v); }), 4);
+  EXPECT_THAT(got, testing::ElementsAre(1, 2, 3, 4));
+
+  got.clear();
+  EXPECT_EQ(ring.Drain([&](int64_t v) { got.push_back(v); }), 0);
+  EXPECT_THAT(got, testing::IsEmpty());
+}
+
+TEST(MPSCRingTest, DropsWhenFull) {
+  MPSCRing<int64_t> ring(4);
+  const int64_t batch[] = {1, 2, 3};
+  EXPECT_TRUE(ring.TryPush(absl::MakeConstSpan(batch)));
+  // Batches are all or nothing.
+  EXPECT_FALSE(ring.TryPush(absl::MakeConstSpan(batch)));
+  EXPECT_TRUE(ring.TryPush(4));
+  EXPECT_FALSE(ring.TryPush(5));
+
+  std::vector<int64_t> got;
+  ring.Drain([&](int64_t v) { got.push_back(v); });
+  EXPECT_THAT(got, testing::ElementsAre(1, 2, 3, 4));
+
+  // Space is reclaimed after draining, including across the wrap-around.
+  EXPECT_TRUE(ring.TryPush(absl::MakeConstSpan(batch)));
+  got.clear();
+  ring.Drain([&](int64_t v) { got.push_back(v); });
+  EXPECT_THAT(got, testing::ElementsAre(1, 2, 3));
+}
+
+TEST(MPSCRingTest, DropsWhenSmallestFull) {
+  MPSCRing<int64_t> ring(1);
+  EXPECT_TRUE(ring.TryPush(1));
+  EXPECT_TRUE(ring.TryPush(2));
+  EXPECT_FALSE(ring.TryPush(3));
+  EXPECT_EQ(ring.Drain([](int64_t) {}), 2);
+}
+
+TEST(MPSCRingTest, ConcurrentProducers) {
+  constexpr int kNumProducers = 8;
+  constexpr int kPerProducer = 20000;
+
+  struct Rec {
+    int32_t producer;
+    int32_t seq;
+  };
+
+  MPSCRing<Rec> ring(1024);
+  std::atomic<int> num_done(0);
+  std::vector<std::thread> producers;
+  std::vector<int64_t> num_dropped(kNumProducers, 0);
+  for (int p = 0; p < kNumProducers; ++p) {
+    producers.push_back(std::thread([p, &ring, &num_done, &num_dropped] {
+      for (int i = 0; i < kPerProducer; ++i) {
+        if (!ring.TryPush(Rec{p, i})) {
+          ++num_dropped[p];
+        }
+      }
+      num_done.fetch_add(1);
+    }));
+  }
+
+  // Records from any one producer must come out in order.
+  std::vector<int32_t> last_seq(kNumProducers, -1);
+  int64_t num_got = 0;
+  auto consume = [&](Rec r) {
+    EXPECT_GT(r.seq, last_seq[r.producer]);
+    last_seq[r.producer] = r.seq;
+    ++num_got;
+  };
+  while (num_done.load() < kNumProducers) {
+    ring.Drain(consume);
+  }
+  for (std::thread& t : producers) {
+    t.join();
+  }
+  ring.Drain(consume);
+
+  int64_t total_dropped = 0;
+  for (int64_t d : num_dropped) {
+    total_dropped += d;
+  }
+  EXPECT_EQ(num_got + total_dropped, kNumProducers * kPerProducer);
+}
+
+}  // namespace
+}  // namespace heyp
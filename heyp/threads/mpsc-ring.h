@@ -0,0 +1,146 @@
+#ifndef HEYP_THREADS_MPSC_RING_H_
+#define HEYP_THREADS_MPSC_RING_H_
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+
+#include "absl/base/optimization.h"
+#include "absl/types/span.h"
+
+namespace heyp {
+
+// MPSCRing is a bounded, lock-free multi-producer/single-consumer queue of
+// fixed-size records.
+//
+// Producers never wait on each other or on the consumer: if the ring is full, the push
+// fails and the caller is expected to drop (and count) the records.
+//
+// The design follows Dmitry Vyukov's bounded queue: each cell carries a sequence
+// number that tells producers and the consumer whether the cell is free, being
+// written, or ready to be read.
+template <typename T>
+class MPSCRing {
+ public:
+  static_assert(std::is_trivially_copyable<T>::value,
+                "MPSCRing only holds trivially copyable records");
+
+  // capacity is rounded up to the next power of two, and to at least 2 since with a
+  // single cell, a written cell would look free to the next producer.
+  explicit MPSCRing(size_t capacity);
+
+  MPSCRing(const MPSCRing&) = delete;
+  MPSCRing& operator=(const MPSCRing&) = delete;
+
+  // TryPush enqueues all of records or none of them.
+  // Returns false if there is not enough free space.
+  //
+  // Thread-safe with respect to other producers and the consumer.
+  bool TryPush(absl::Span<const T> records);
+  bool TryPush(const T& record) { return TryPush(absl::MakeConstSpan(&record, 1)); }
+
+  // Drain calls func on every record that has been fully published and frees the
+  // cells. Records whose writes are still in flight are left for the next call.
+  //
+  // Only one thread may call Drain at a time.
+  template <typename Func>
+  size_t Drain(Func func);
+
+  size_t capacity() const { return mask_ + 1; }
+
+ private:
+  struct Cell {
+    std::atomic<uint64_t> seq;
+    T val;
+  };
+
+  static size_t RoundUpPow2(size_t n);
+
+  const uint64_t mask_;
+  std::unique_ptr<Cell[]> cells_;
+
+  alignas(64) std::atomic<uint64_t> tail_;
+  alignas(64) uint64_t head_;  // only accessed by the consumer
+};
+
+// Implementation //
+
+template <typename T>
+size_t MPSCRing<T>::RoundUpPow2(size_t n) {
+  size_t p = 1;
+  while (p < n) {
+    p <<= 1;
+  }
+  return p;
+}
+
+template <typename T>
+MPSCRing<T>::MPSCRing(size_t capacity)
+    : mask_(RoundUpPow2(std::max<size_t>(capacity, 2)) - 1),
+      cells_(new Cell[mask_ + 1]),
+      tail_(0),
+      head_(0) {
+  for (uint64_t i = 0; i <= mask_; ++i) {
+    cells_[i].seq.store(i, std::memory_order_relaxed);
+  }
+}
+
+template <typename T>
+bool MPSCRing<T>::TryPush(absl::Span<const T> records) {
+  const uint64_t n = records.size();
+  if (n == 0) {
+    return true;
+  }
+  if (ABSL_PREDICT_FALSE(n > capacity())) {
+    return false;
+  }
+
+  // Claim [pos, pos+n). Cells are freed in order by the consumer, so if the last cell
+  // is free for this lap, then all preceding cells are too.
+  uint64_t pos = tail_.load(std::memory_order_relaxed);
+  while (true) {
+    const uint64_t last = pos + n - 1;
+    const uint64_t seq = cells_[last & mask_].seq.load(std::memory_order_acquire);
+    const int64_t dif = static_cast<int64_t>(seq) - static_cast<int64_t>(last);
+    if (dif == 0) {
+      if (tail_.compare_exchange_weak(pos, pos + n, std::memory_order_relaxed)) {
+        break;
+      }
+      // pos was reloaded by compare_exchange_weak
+    } else if (dif < 0) {
+      return false;  // full
+    } else {
+      pos = tail_.load(std::memory_order_relaxed);
+    }
+  }
+
+  for (uint64_t i = 0; i < n; ++i) {
+    Cell& c = cells_[(pos + i) & mask_];
+    c.val = records[i];
+    c.seq.store(pos + i + 1, std::memory_order_release);
+  }
+  return true;
+}
+
+template <typename T>
+template <typename Func>
+size_t MPSCRing<T>::Drain(Func func) {
+  size_t num = 0;
+  while (true) {
+    Cell& c = cells_[head_ & mask_];
+    if (c.seq.load(std::memory_order_acquire) != head_ + 1) {
+      break;  // empty or write in progress
+    }
+    func(c.val);
+    c.seq.store(head_ + mask_ + 1, std::memory_order_release);
+    ++head_;
+    ++num;
+  }
+  return num;
+}
+
+}  // namespace heyp
+
+#endif  // HEYP_THREADS_MPSC_RING_H_
@@ -0,0 +1,97 @@
+#include <cstdint>
+
+#include "absl/container/flat_hash_map.h"
+#include "benchmark/benchmark.h"
+#include "heyp/threads/par-indexed-map.h"
+#include "heyp/threads/recycling-par-map.h"
+
+namespace heyp {
+namespace {
+
+using HostMap = absl::flat_hash_map<uint64_t, ParID>;
+
+// Hosts restart with new ids: each step, the oldest host leaves and a new one joins.
+// Reports the map's memory after the run.
+static void BM_RecyclingParMap_Churn(benchmark::State& state) {
+  const int64_t num_live = state.range(0);
+  RecyclingParMap<uint64_t, int64_t, HostMap> parmap;
+  for (int64_t i = 0; i < num_live; ++i) {
+    parmap.GetID(i);
+  }
+  uint64_t next_host = num_live;
+  for (auto _ : state) {
+    parmap.Retire(next_host - num_live);
+    const ParID id = parmap.GetID(next_host).id;
+    parmap.OnID(id, [](int64_t& v) { ++v; });
+    ++next_host;
+  }
+  state.SetItemsProcessed(state.iterations());
+  state.counters["slots"] = parmap.NumSlots();
+  state.counters["bytes"] = parmap.MemoryUsage();
+}
+
+// Same churn on ParIndexedMap, which cannot retire hosts and so grows without bound.
+// Capped so that it stays under kMaxEntries.
+static void BM_ParIndexedMap_Churn(benchmark::State& state) {
+  const int64_t num_live = state.range(0);
+  ParIndexedMap<uint64_t, int64_t, HostMap> parmap;
+  for (int64_t i = 0; i < num_live; ++i) {
+    parmap.GetID(i);
+  }
+  uint64_t next_host = num_live;
+  for (auto _ : state) {
+    const ParID id = parmap.GetID(next_host).id;
+    parmap.OnID(id, [](int64_t& v) { ++v; });
+    ++next_host;
+  }
+  state.SetItemsProcessed(state.iterations());
+  state.counters["slots"] = parmap.NumIDs();
+}
+
+// Each thread updates its own entries, which are interleaved with other threads'.
+// Without padding, neighbouring entries share cache lines.
+template <typename Map>
+void UpdateInterleaved(benchmark::State& state, Map& parmap) {
+  constexpr int64_t kNumEntries = 1024;
+  const int64_t stride = state.threads();
+  for (auto _ : state) {
+    for (int64_t i = state.thread_index(); i < kNumEntries; i += stride) {
+      parmap.OnID(i, [](int64_t& v) { ++v; });
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * (kNumEntries / stride));
+}
+
+ParIndexedMap<uint64_t, int64_t, HostMap>* NewParIndexedMap() {
+  auto* parmap = new ParIndexedMap<uint64_t, int64_t, HostMap>();
+  for (int64_t i = 0; i < 1024; ++i) {
+    parmap->GetID(i);
+  }
+  return parmap;
+}
+
+RecyclingParMap<uint64_t, int64_t, HostMap>* NewRecyclingParMap() {
+  auto* parmap = new RecyclingParMap<uint64_t, int64_t, HostMap>();
+  for (int64_t i = 0; i < 1024; ++i) {
+    parmap->GetID(i);
+  }
+  return parmap;
+}
+
+static void BM_ParIndexedMap_UpdateInterleaved(benchmark::State& state) {
+  static auto* parmap = NewParIndexedMap();
+  UpdateInterleaved(state, *parmap);
+}
+
+static void BM_RecyclingParMap_UpdateInterleaved(benchmark::State& state) {
+  static auto* parmap = NewRecyclingParMap();
+  UpdateInterleaved(state, *parmap);
+}
+
+BENCHMARK(BM_RecyclingParMap_Churn)->Arg(1'000)->Arg(100'000);
+BENCHMARK(BM_ParIndexedMap_Churn)->Arg(1'000)->Arg(100'000)->Iterations(500'000);
+BENCHMARK(BM_ParIndexedMap_UpdateInterleaved)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK(BM_RecyclingParMap_UpdateInterleaved)->ThreadRange(1, 8)->UseRealTime();
+
+}  // namespace
+}  // namespace heyp
@@ -0,0 +1,116 @@
+#include "heyp/threads/recycling-par-map.h"
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "absl/container/flat_hash_map.h"
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+namespace heyp {
+namespace {
+
+using IntMap = RecyclingParMap<int64_t, int64_t, absl::flat_hash_map<int64_t, ParID>>;
+
+TEST(RecyclingParMapTest, ReusesSlotsWithNewGeneration) {
+  IntMap parmap;
+
+  ASSERT_THAT(parmap.GetID(10), testing::Eq(GetResult{0, true}));
+  ASSERT_THAT(parmap.GetID(11), testing::Eq(GetResult{1, true}));
+  ASSERT_THAT(parmap.GetID(10), testing::Eq(GetResult{0, false}));
+  EXPECT_TRUE(parmap.OnID(0, [](int64_t& v) { v = 100; }));
+
+  EXPECT_TRUE(parmap.Retire(10));
+  EXPECT_FALSE(parmap.Retire(10));
+  EXPECT_EQ(parmap.NumLive(), 1);
+  EXPECT_FALSE(parmap.OnID(0, [](int64_t& v) { v = 1; }));
+
+  GetResult r = parmap.GetID(12);
+  EXPECT_TRUE(r.just_created);
+  EXPECT_NE(r.id, 0);
+  EXPECT_EQ(IntMap::SlotOf(r.id), 0);
+  EXPECT_EQ(parmap.NumSlots(), 2);
+
+  // The reused slot starts with a fresh value.
+  int64_t got = -1;
+  EXPECT_TRUE(parmap.OnID(r.id, [&got](int64_t& v) { got = v; }));
+  EXPECT_EQ(got, 0);
+}
+
+TEST(RecyclingParMapTest, ForEachSkipsRetired) {
+  RecyclingParMap<std::string, int, absl::flat_hash_map<std::string, ParID>> parmap;
+  for (const char* k : {"a", "b", "c", "d"}) {
+    parmap.OnID(parmap.GetID(k).id, [k](int& v) { v = k[0]; });
+  }
+  parmap.Retire("b");
+  EXPECT_EQ(parmap.RetireIf([](ParID, const int& v) { return v == 'd'; }), 1);
+
+  std::vector<int> seen;
+  parmap.ForEach(0, parmap.NumSlots(), [&seen](ParID, int& v) { seen.push_back(v); });
+  EXPECT_THAT(seen, testing::ElementsAre('a', 'c'));
+}
+
+TEST(RecyclingParMapTest, GrowsDirectory) {
+  IntMap parmap;
+  const int64_t n = IntMap::kSpanSize * IntMap::kInitDirectorySize * 3 + 7;
+  for (int64_t i = 0; i < n; ++i) {
+    ASSERT_EQ(parmap.GetID(i).id, i);
+  }
+  for (int64_t i = 0; i < n; ++i) {
+    parmap.OnID(i, [i](int64_t& v) { v = i; });
+  }
+  int64_t num_ok = 0;
+  parmap.ForEach(0, n, [&num_ok](ParID id, int64_t& v) { num_ok += id == v; });
+  EXPECT_EQ(num_ok, n);
+}
+
+TEST(RecyclingParMapTest, MemoryBoundedUnderChurn) {
+  IntMap parmap;
+  constexpr int64_t kLive = 5000;
+  for (int64_t i = 0; i < kLive; ++i) {
+    parmap.GetID(i);
+  }
+  const size_t mem_before = parmap.MemoryUsage();
+  for (int64_t i = kLive; i < 20 * kLive; ++i) {
+    parmap.Retire(i - kLive);
+    parmap.GetID(i);
+  }
+  EXPECT_EQ(parmap.NumSlots(), kLive);
+  EXPECT_EQ(parmap.NumLive(), kLive);
+  EXPECT_LE(parmap.MemoryUsage(), 2 * mem_before);
+}
+
+TEST(RecyclingParMapTest, ConcurrentChurn) {
+  IntMap parmap;
+  constexpr int kNumThreads = 8;
+  constexpr int64_t kKeysPerThread = 2000;
+
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kNumThreads; ++t) {
+    threads.emplace_back([&parmap, t] {
+      for (int64_t k = 0; k < kKeysPerThread; ++k) {
+        const int64_t key = t * kKeysPerThread + k;
+        const ParID id = parmap.GetID(key).id;
+        EXPECT_TRUE(parmap.OnID(id, [key](int64_t& v) { v = key; }));
+        if (k % 2 == 0) {
+          parmap.Retire(key);
+          EXPECT_FALSE(parmap.OnID(id, [](int64_t& v) { v = -1; }));
+        }
+      }
+    });
+  }
+  for (std::thread& t : threads) {
+    t.join();
+  }
+
+  EXPECT_EQ(parmap.NumLive(), kNumThreads * kKeysPerThread / 2);
+  int64_t num_odd = 0;
+  parmap.ForEach(0, parmap.NumSlots(), [&num_odd](ParID, int64_t& v) {
+    num_odd += v % 2 == 1;
+  });
+  EXPECT_EQ(num_odd, kNumThreads * kKeysPerThread / 2);
+}
+
+}  // namespace
+}  // namespace heyp
@@ -0,0 +1,292 @@
+#ifndef HEYP_THREADS_RECYCLING_PAR_MAP_
+#define HEYP_THREADS_RECYCLING_PAR_MAP_
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "absl/base/optimization.h"
+#include "absl/functional/function_ref.h"
+#include "absl/synchronization/mutex.h"
+#include "heyp/log/spdlog.h"
+#include "heyp/threads/par-indexed-map.h"
+
+namespace heyp {
+
+// RecyclingParMap is a ParIndexedMap whose entries can be retired.
+//
+// Entries live in slots. Retiring an entry frees its slot for reuse by a later GetID,
+// so memory is bounded by the peak number of live entries rather than the number of
+// keys ever seen. IDs combine the slot with a generation that is bumped when the
+// slot is freed, so operations on retired IDs are detected instead of touching
+// whichever entry now occupies the slot.
+//
+// Each entry is cache-line aligned so that operating on neighbouring entries in
+// parallel does not false-share. Slots are allocated in spans that are found through
+// a directory that doubles as needed.
+//
+// Lock order: GetID/Retire/RetireIf lock the map before any entry.
+template <typename Key, typename Value, typename KeyToIDMap>
+class RecyclingParMap {
+ public:
+  static constexpr int64_t kSpanSize = 1'024;
+  static constexpr int64_t kInitDirectorySize = 16;
+
+  RecyclingParMap();
+  ~RecyclingParMap();
+
+  RecyclingParMap(const RecyclingParMap&) = delete;
+  RecyclingParMap& operator=(const RecyclingParMap&) = delete;
+
+  // GetID looks up the entry id associated with key. It creates one if none exist,
+  // reusing a retired slot if there is one.
+  // Concurrent calls are serialized through a single lock.
+  GetResult GetID(const Key& key);
+
+  // OnID is used to read and write entries.
+  // Returns false (without calling func) if id has been retired.
+  bool OnID(ParID id, absl::FunctionRef<void(Value&)> func);
+
+  // Retire removes the entry for key and resets its value. Returns false if there
+  // was no entry.
+  bool Retire(const Key& key);
+
+  // RetireIf retires every entry for which pred returns true and returns the number
+  // retired. Blocks GetID and Retire while it runs.
+  int64_t RetireIf(absl::FunctionRef<bool(ParID, const Value&)> pred);
+
+  // ForEach calls func on all live entries with slots in [start_slot, end_slot).
+  void ForEach(int64_t start_slot, int64_t end_slot,
+               absl::FunctionRef<void(ParID, Value&)> func);
+
+  // NumSlots returns one past the highest slot ever used.
+  int64_t NumSlots() const { return num_slots_.load(std::memory_order_acquire); }
+
+  // NumLive returns the number of entries that have not been retired.
+  int64_t NumLive();
+
+  // MemoryUsage approximates the bytes used by the map, excluding heap memory owned
+  // by keys and values.
+  size_t MemoryUsage();
+
+  static int64_t SlotOf(ParID id) { return id & kSlotMask; }
+
+ private:
+  static constexpr int64_t kSlotMask = (int64_t{1} << 32) - 1;
+  static constexpr uint32_t kGenMask = (uint32_t{1} << 31) - 1;  // keep IDs >= 0
+
+  struct alignas(ABSL_CACHELINE_SIZE) Entry {
+    absl::Mutex mu;
+    uint32_t gen = 0;   // guarded by mu
+    bool live = false;  // guarded by mu
+    Value val = Value{};
+  };
+
+  using Span = std::array<Entry, kSpanSize>;
+
+  struct Directory {
+    explicit Directory(int64_t size) : size(size), spans(new std::atomic<Span*>[size]) {
+      for (int64_t i = 0; i < size; ++i) {
+        spans[i].store(nullptr, std::memory_order_relaxed);
+      }
+    }
+
+    const int64_t size;
+    std::unique_ptr<std::atomic<Span*>[]> spans;
+  };
+
+  static ParID MakeID(int64_t slot, uint32_t gen) {
+    return (static_cast<int64_t>(gen) << 32) | slot;
+  }
+
+  Entry* EntryAt(int64_t slot) const;
+  int64_t AddSlot() ABSL_EXCLUSIVE_LOCKS_REQUIRED(add_mu_);
+  void RetireLocked(ParID id) ABSL_EXCLUSIVE_LOCKS_REQUIRED(add_mu_);
+
+  std::atomic<Directory*> dir_;
+  std::atomic<int64_t> num_slots_;  // add_mu_ must be held to mutate
+
+  absl::Mutex add_mu_;
+  KeyToIDMap id_map_ ABSL_GUARDED_BY(add_mu_);
+  std::vector<int64_t> free_slots_ ABSL_GUARDED_BY(add_mu_);
+
+  // Directories replaced by AddSlot are kept alive until the map is destroyed since
+  // readers may still be using them.
+  std::vector<std::unique_ptr<Directory>> dirs_ ABSL_GUARDED_BY(add_mu_);
+};
+
+// Implementation //
+
+template <typename Key, typename Value, typename KeyToIDMap>
+RecyclingParMap<Key, Value, KeyToIDMap>::RecyclingParMap() : num_slots_(0) {
+  absl::MutexLock l(&add_mu_);
+  dirs_.push_back(std::make_unique<Directory>(kInitDirectorySize));
+  dir_.store(dirs_.back().get(), std::memory_order_release);
+}
+
+template <typename Key, typename Value, typename KeyToIDMap>
+RecyclingParMap<Key, Value, KeyToIDMap>::~RecyclingParMap() {
+  Directory* dir = dir_.load();
+  for (int64_t si = 0; si < dir->size; ++si) {
+    delete dir->spans[si].load();
+  }
+}
+
+template <typename Key, typename Value, typename KeyToIDMap>
+typename RecyclingParMap<Key, Value, KeyToIDMap>::Entry*
+RecyclingParMap<Key, Value, KeyToIDMap>::EntryAt(int64_t slot) const {
+  // The acquire load of num_slots_ by callers makes the directory and span that
+  // hold slot visible.
+  Directory* dir = dir_.load(std::memory_order_acquire);
+  Span* s = dir->spans[slot / kSpanSize].load(std::memory_order_acquire);
+  H_ASSERT(s != nullptr);
+  return &(*s)[slot % kSpanSize];
+}
+
+template <typename Key, typename Value, typename KeyToIDMap>
+int64_t RecyclingParMap<Key, Value, KeyToIDMap>::AddSlot() {
+  const int64_t slot = num_slots_.load(std::memory_order_relaxed);
+  H_ASSERT_LE(slot, kSlotMask);
+  if (slot % kSpanSize == 0) {
+    const int64_t si = slot / kSpanSize;
+    Directory* dir = dir_.load(std::memory_order_relaxed);
+    if (si >= dir->size) {
+      dirs_.push_back(std::make_unique<Directory>(2 * dir->size));
+      Directory* bigger = dirs_.back().get();
+      for (int64_t i = 0; i < dir->size; ++i) {
+        bigger->spans[i].store(dir->spans[i].load(std::memory_order_relaxed),
+                               std::memory_order_relaxed);
+      }
+      dir_.store(bigger, std::memory_order_release);
+      dir = bigger;
+    }
+    dir->spans[si].store(new Span(), std::memory_order_release);
+  }
+  num_slots_.store(slot + 1, std::memory_order_release);
+  return slot;
+}
+
+template <typename Key, typename Value, typename KeyToIDMap>
+GetResult RecyclingParMap<Key, Value, KeyToIDMap>::GetID(const Key& key) {
+  absl::MutexLock l(&add_mu_);
+  auto iter = id_map_.find(key);
+  if (iter != id_map_.end()) {
+    return {iter->second, false};
+  }
+
+  int64_t slot;
+  if (free_slots_.empty()) {
+    slot = AddSlot();
+  } else {
+    slot = free_slots_.back();
+    free_slots_.pop_back();
+  }
+  Entry* e = EntryAt(slot);
+  ParID id;
+  {
+    absl::MutexLock l2(&e->mu);
+    e->live = true;
+    id = MakeID(slot, e->gen);
+  }
+  id_map_[key] = id;
+  return {id, true};
+}
+
+template <typename Key, typename Value, typename KeyToIDMap>
+bool RecyclingParMap<Key, Value, KeyToIDMap>::OnID(ParID id,
+                                                   absl::FunctionRef<void(Value&)> func) {
+  const int64_t slot = SlotOf(id);
+  H_ASSERT_LT(slot, NumSlots());
+  Entry* e = EntryAt(slot);
+  absl::MutexLock l(&e->mu);
+  if (!e->live || MakeID(slot, e->gen) != id) {
+    return false;
+  }
+  func(e->val);
+  return true;
+}
+
+template <typename Key, typename Value, typename KeyToIDMap>
+void RecyclingParMap<Key, Value, KeyToIDMap>::RetireLocked(ParID id) {
+  const int64_t slot = SlotOf(id);
+  Entry* e = EntryAt(slot);
+  {
+    absl::MutexLock l(&e->mu);
+    e->live = false;
+    e->gen = (e->gen + 1) & kGenMask;
+    e->val = Value{};
+  }
+  free_slots_.push_back(slot);
+}
+
+template <typename Key, typename Value, typename KeyToIDMap>
+bool RecyclingParMap<Key, Value, KeyToIDMap>::Retire(const Key& key) {
+  absl::MutexLock l(&add_mu_);
+  auto iter = id_map_.find(key);
+  if (iter == id_map_.end()) {
+    return false;
+  }
+  RetireLocked(iter->second);
+  id_map_.erase(iter);
+  return true;
+}
+
+template <typename Key, typename Value, typename KeyToIDMap>
+int64_t RecyclingParMap<Key, Value, KeyToIDMap>::RetireIf(
+    absl::FunctionRef<bool(ParID, const Value&)> pred) {
+  absl::MutexLock l(&add_mu_);
+  std::vector<Key> to_retire;
+  for (const auto& [key, id] : id_map_) {
+    Entry* e = EntryAt(SlotOf(id));
+    absl::MutexLock l2(&e->mu);
+    if (pred(id, e->val)) {
+      to_retire.push_back(key);
+    }
+  }
+  for (const Key& key : to_retire) {
+    auto iter = id_map_.find(key);
+    RetireLocked(iter->second);
+    id_map_.erase(iter);
+  }
+  return to_retire.size();
+}
+
+template <typename Key, typename Value, typename KeyToIDMap>
+void RecyclingParMap<Key, Value, KeyToIDMap>::ForEach(
+    int64_t start_slot, int64_t end_slot, absl::FunctionRef<void(ParID, Value&)> func) {
+  H_ASSERT_GE(start_slot, 0);
+  H_ASSERT_LE(end_slot, NumSlots());
+  for (int64_t slot = start_slot; slot < end_slot; ++slot) {
+    Entry* e = EntryAt(slot);
+    absl::MutexLock l(&e->mu);
+    if (e->live) {
+      func(MakeID(slot, e->gen), e->val);
+    }
+  }
+}
+
+template <typename Key, typename Value, typename KeyToIDMap>
+int64_t RecyclingParMap<Key, Value, KeyToIDMap>::NumLive() {
+  absl::MutexLock l(&add_mu_);
+  return id_map_.size();
+}
+
+template <typename Key, typename Value, typename KeyToIDMap>
+size_t RecyclingParMap<Key, Value, KeyToIDMap>::MemoryUsage() {
+  absl::MutexLock l(&add_mu_);
+  size_t bytes = sizeof(*this);
+  for (const auto& dir : dirs_) {
+    bytes += sizeof(Directory) + dir->size * sizeof(std::atomic<Span*>);
+  }
+  const int64_t num_spans = (NumSlots() + kSpanSize - 1) / kSpanSize;
+  bytes += num_spans * sizeof(Span);
+  bytes += id_map_.bucket_count() * sizeof(typename KeyToIDMap::value_type);
+  bytes += free_slots_.capacity() * sizeof(int64_t);
+  return bytes;
+}
+
+}  // namespace heyp
+
+#endif  // HEYP_THREADS_RECYCLING_PAR_MAP_
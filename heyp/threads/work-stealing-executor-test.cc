@@ -0,0 +1,77 @@
+#include "heyp/threads/work-stealing-executor.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+namespace heyp {
+namespace {
+
+void ExpectEachRunOnce(WorkStealingExecutor& exec, int64_t begin, int64_t end,
+                       int64_t grain) {
+  std::vector<std::atomic<int>> counts(end);
+  exec.ParallelFor(begin, end, grain, [&](int64_t i) { counts[i].fetch_add(1); });
+  for (int64_t i = 0; i < end; ++i) {
+    EXPECT_EQ(counts[i].load(), i >= begin ? 1 : 0)
+        << "i = " << i << " range = [" << begin << ", " << end << ") grain = " << grain;
+  }
+}
+
+TEST(WorkStealingExecutorTest, RunsEachIndexOnce) {
+  WorkStealingExecutor exec(4);
+  EXPECT_EQ(exec.num_workers(), 4);
+  for (int64_t grain : {1, 2, 3, 7, 64, 1000}) {
+    ExpectEachRunOnce(exec, 0, 0, grain);
+    ExpectEachRunOnce(exec, 0, 1, grain);
+    ExpectEachRunOnce(exec, 5, 17, grain);
+    ExpectEachRunOnce(exec, 0, 1001, grain);
+  }
+}
+
+TEST(WorkStealingExecutorTest, NoWorkers) {
+  WorkStealingExecutor exec(0);
+  ExpectEachRunOnce(exec, 0, 100, 1);
+}
+
+TEST(WorkStealingExecutorTest, Nested) {
+  constexpr int kOuter = 16;
+  constexpr int kInner = 50;
+  WorkStealingExecutor exec(3);
+  std::vector<std::atomic<int>> counts(kOuter * kInner);
+  exec.ParallelFor(0, kOuter, 1, [&](int64_t i) {
+    exec.ParallelFor(0, kInner, 1,
+                     [&](int64_t j) { counts[i * kInner + j].fetch_add(1); });
+  });
+  for (int i = 0; i < counts.size(); ++i) {
+    EXPECT_EQ(counts[i].load(), 1) << "i = " << i;
+  }
+}
+
+TEST(WorkStealingExecutorTest, ConcurrentCallers) {
+  constexpr int kNumCallers = 4;
+  constexpr int kNumRounds = 200;
+  WorkStealingExecutor exec(3);
+  std::vector<std::thread> callers;
+  std::vector<int64_t> sums(kNumCallers, 0);
+  for (int c = 0; c < kNumCallers; ++c) {
+    callers.emplace_back([&exec, &sums, c] {
+      for (int r = 0; r < kNumRounds; ++r) {
+        std::atomic<int64_t> sum(0);
+        exec.ParallelFor(0, 100, 4, [&](int64_t i) { sum.fetch_add(i); });
+        sums[c] += sum.load();
+      }
+    });
+  }
+  for (std::thread& t : callers) {
+    t.join();
+  }
+  for (int64_t s : sums) {
+    EXPECT_EQ(s, kNumRounds * 4950);
+  }
+}
+
+}  // namespace
+}  // namespace heyp
@@ -0,0 +1,223 @@
+#include "heyp/threads/work-stealing-executor.h"
+
+#include <algorithm>
+
+#include "absl/synchronization/notification.h"
+#include "heyp/log/spdlog.h"
+#include "heyp/threads/set-name.h"
+
+namespace heyp {
+
+namespace {
+
+// Number of failed attempts to find work before a worker goes to sleep.
+constexpr int kSpinRounds = 64;
+
+thread_local const WorkStealingExecutor* tls_executor = nullptr;
+thread_local void* tls_worker = nullptr;
+
+}  // namespace
+
+struct WorkStealingExecutor::LoopState {
+  LoopState(int64_t num_iters, int64_t grain, absl::FunctionRef<void(int64_t)> fn)
+      : fn(fn),
+        grain(grain),
+        // Halving a range larger than grain leaves pieces of at least (grain+1)/2
+        // iterations, and each task runs exactly one such piece.
+        max_tasks(num_iters / std::max<int64_t>(1, (grain + 1) / 2) + 1),
+        tasks(new Task[max_tasks]),
+        next_task(0),
+        remaining(num_iters) {}
+
+  Task* NewTask(int64_t begin, int64_t end) {
+    const int64_t i = next_task.fetch_add(1, std::memory_order_relaxed);
+    H_ASSERT_LT(i, max_tasks);
+    tasks[i] = Task{this, begin, end};
+    return &tasks[i];
+  }
+
+  const absl::FunctionRef<void(int64_t)> fn;
+  const int64_t grain;
+  const int64_t max_tasks;
+  std::unique_ptr<Task[]> tasks;
+  std::atomic<int64_t> next_task;
+  std::atomic<int64_t> remaining;
+  absl::Notification done;
+};
+
+WorkStealingExecutor::WorkStealingExecutor(int num_workers, const char* name_for_threads)
+    : num_injected_(0), num_sleeping_(0) {
+  worker_states_.reserve(num_workers);
+  for (int i = 0; i < num_workers; ++i) {
+    worker_states_.push_back(std::make_unique<Worker>());
+    worker_states_.back()->rng = static_cast<uint64_t>(i) * 0x9e3779b97f4a7c15 + 1;
+  }
+  workers_.reserve(num_workers);
+  for (int i = 0; i < num_workers; ++i) {
+    workers_.push_back(std::thread([this, i] { WorkerMain(i); }));
+    if (name_for_threads != nullptr) {
+      SetThreadName(workers_.back().native_handle(), name_for_threads);
+    }
+  }
+}
+
+WorkStealingExecutor::~WorkStealingExecutor() {
+  {
+    absl::MutexLock l(&sleep_mu_);
+    is_dead_ = true;
+  }
+  for (std::thread& t : workers_) {
+    t.join();
+  }
+}
+
+void WorkStealingExecutor::ParallelFor(int64_t begin, int64_t end, int64_t grain,
+                                       absl::FunctionRef<void(int64_t)> fn) {
+  grain = std::max<int64_t>(grain, 1);
+  if (end - begin <= grain || workers_.empty()) {
+    for (int64_t i = begin; i < end; ++i) {
+      fn(i);
+    }
+    return;
+  }
+
+  LoopState loop(end - begin, grain, fn);
+  Task* root = loop.NewTask(begin, end);
+
+  if (tls_executor == this) {
+    // Nested loop: run it on this worker and help until it completes.
+    Worker* self = static_cast<Worker*>(tls_worker);
+    RunTask(self, root);
+    while (!loop.done.HasBeenNotified()) {
+      if (Task* t = FindTask(self); t != nullptr) {
+        RunTask(self, t);
+      } else {
+        std::this_thread::yield();
+      }
+    }
+    return;
+  }
+
+  {
+    absl::MutexLock l(&inject_mu_);
+    injected_.push_back(root);
+    num_injected_.fetch_add(1, std::memory_order_relaxed);
+  }
+  WakeSleepers();
+  loop.done.WaitForNotification();
+}
+
+void WorkStealingExecutor::RunTask(Worker* self, Task* task) {
+  LoopState* loop = task->loop;
+  const int64_t begin = task->begin;
+  int64_t end = task->end;
+  while (end - begin > loop->grain) {
+    const int64_t mid = begin + (end - begin) / 2;
+    self->deque.Push(loop->NewTask(mid, end));
+    WakeSleepers();
+    end = mid;
+  }
+  for (int64_t i = begin; i < end; ++i) {
+    loop->fn(i);
+  }
+  const int64_t n = end - begin;
+  if (loop->remaining.fetch_sub(n, std::memory_order_acq_rel) == n) {
+    loop->done.Notify();
+  }
+}
+
+WorkStealingExecutor::Task* WorkStealingExecutor::FindTask(Worker* self) {
+  if (Task* t = self->deque.Pop(); t != nullptr) {
+    return t;
+  }
+
+  if (num_injected_.load(std::memory_order_relaxed) > 0) {
+    absl::MutexLock l(&inject_mu_);
+    if (!injected_.empty()) {
+      Task* t = injected_.back();
+      injected_.pop_back();
+      num_injected_.fetch_sub(1, std::memory_order_relaxed);
+      return t;
+    }
+  }
+
+  // xorshift64
+  self->rng ^= self->rng << 13;
+  self->rng ^= self->rng >> 7;
+  self->rng ^= self->rng << 17;
+  const size_t n = worker_states_.size();
+  const size_t start = self->rng % n;
+  for (size_t k = 0; k < n; ++k) {
+    Worker* victim = worker_states_[(start + k) % n].get();
+    if (victim == self) {
+      continue;
+    }
+    if (Task* t = victim->deque.Steal(); t != nullptr) {
+      return t;
+    }
+  }
+  return nullptr;
+}
+
+void WorkStealingExecutor::WakeSleepers() {
+  // Pairs with the fence in WorkerMain: either we see the sleeper or it sees our task.
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (num_sleeping_.load(std::memory_order_relaxed) > 0) {
+    absl::MutexLock l(&sleep_mu_);
+    ++wake_seq_;
+  }
+}
+
+void WorkStealingExecutor::WorkerMain(int index) {
+  Worker* self = worker_states_[index].get();
+  tls_executor = this;
+  tls_worker = self;
+
+  int idle_rounds = 0;
+  while (true) {
+    if (Task* t = FindTask(self); t != nullptr) {
+      RunTask(self, t);
+      idle_rounds = 0;
+      continue;
+    }
+    if (++idle_rounds < kSpinRounds) {
+      std::this_thread::yield();
+      continue;
+    }
+
+    struct WakeArgs {
+      const uint64_t* wake_seq;
+      const bool* is_dead;
+      uint64_t seen_seq;
+    };
+    WakeArgs args{.wake_seq = &wake_seq_, .is_dead = &is_dead_};
+    {
+      absl::MutexLock l(&sleep_mu_);
+      if (is_dead_) {
+        return;
+      }
+      args.seen_seq = wake_seq_;
+    }
+    num_sleeping_.fetch_add(1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (Task* t = FindTask(self); t != nullptr) {
+      num_sleeping_.fetch_sub(1, std::memory_order_relaxed);
+      RunTask(self, t);
+      idle_rounds = 0;
+      continue;
+    }
+
+    sleep_mu_.LockWhen(absl::Condition(
+        +[](WakeArgs* a) { return *a->wake_seq != a->seen_seq || *a->is_dead; },
+        &args));
+    const bool is_dead = is_dead_;
+    sleep_mu_.Unlock();
+    num_sleeping_.fetch_sub(1, std::memory_order_relaxed);
+    if (is_dead) {
+      return;
+    }
+    idle_rounds = 0;
+  }
+}
+
+}  // namespace heyp
@@ -0,0 +1,76 @@
+#ifndef HEYP_THREADS_WORK_STEALING_EXECUTOR_H_
+#define HEYP_THREADS_WORK_STEALING_EXECUTOR_H_
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/functional/function_ref.h"
+#include "absl/synchronization/mutex.h"
+#include "heyp/threads/chase-lev-deque.h"
+
+namespace heyp {
+
+// WorkStealingExecutor runs data-parallel loops on a fixed set of workers.
+//
+// Unlike Executor, there is no shared task queue: each worker owns a ChaseLevDeque
+// and recursively splits the ranges it runs, pushing the upper halves onto its
+// deque for idle workers to steal. Tasks are fixed-size range descriptors that are
+// preallocated per ParallelFor call, so scheduling does not allocate per task.
+class WorkStealingExecutor {
+ public:
+  explicit WorkStealingExecutor(int num_workers, const char* name_for_threads = nullptr);
+  ~WorkStealingExecutor();
+
+  WorkStealingExecutor(const WorkStealingExecutor&) = delete;
+  WorkStealingExecutor& operator=(const WorkStealingExecutor&) = delete;
+
+  size_t num_workers() const { return workers_.size(); }
+
+  // Calls fn(i) for every i in [begin, end) and returns once all calls are done.
+  // Ranges are not split below grain iterations.
+  //
+  // May be called concurrently and from inside fn (in which case the calling worker
+  // helps run the nested loop).
+  void ParallelFor(int64_t begin, int64_t end, int64_t grain,
+                   absl::FunctionRef<void(int64_t)> fn);
+
+ private:
+  struct LoopState;
+
+  struct Task {
+    LoopState* loop;
+    int64_t begin;
+    int64_t end;
+  };
+
+  struct Worker {
+    ChaseLevDeque<Task> deque;
+    uint64_t rng;
+  };
+
+  void WorkerMain(int index);
+  void RunTask(Worker* self, Task* task);
+  Task* FindTask(Worker* self);
+  void WakeSleepers();
+
+  std::vector<std::unique_ptr<Worker>> worker_states_;
+  std::vector<std::thread> workers_;
+
+  // Loops started by non-worker threads enter through here.
+  absl::Mutex inject_mu_;
+  std::vector<Task*> injected_ ABSL_GUARDED_BY(inject_mu_);
+  std::atomic<int64_t> num_injected_;
+
+  std::atomic<int> num_sleeping_;
+  absl::Mutex sleep_mu_;
+  uint64_t wake_seq_ ABSL_GUARDED_BY(sleep_mu_) = 0;
+  bool is_dead_ ABSL_GUARDED_BY(sleep_mu_) = false;
+};
+
+}  // namespace heyp
+
+#endif  // HEYP_THREADS_WORK_STEALING_EXECUTOR_H_